@@ -38,7 +38,9 @@ void create_header_only() {
 
     char libraries[] = {
         "// Standart libraries used\n\n"
+        "#include <float.h>\n"
         "#include <stdio.h>\n"
+        "#include <stdint.h>\n"
         "#include <stdlib.h>\n"
         "#include <stdarg.h>\n"
         "#include <string.h>\n\n"
@@ -47,21 +49,27 @@ void create_header_only() {
     char separator0[] = "// Functions definitions\n\n";
 
     // header, begining line, end line, filepath
-    ContentNode definesHeader; definesHeader.beginingLine = 4; definesHeader.endLine = 23; definesHeader.filePath = "../library/include/gltfparser_defines.h";
-    ContentNode jsmnHeader; jsmnHeader.beginingLine = 29; jsmnHeader.endLine = 78; jsmnHeader.filePath = "../library/include/jsmn.h";
-    ContentNode utilHeader; utilHeader.beginingLine = 4; utilHeader.endLine = 77; utilHeader.filePath = "../library/include/gltfparser_util.h";
-    ContentNode typesHeader; typesHeader.beginingLine = 3; typesHeader.endLine = 473; typesHeader.filePath = "../library/include/gltfparser_types.h";
-    ContentNode jsonHeader; jsonHeader.beginingLine = 6; jsonHeader.endLine = 44; jsonHeader.filePath = "../library/include/gltfparser_json.h";
-    ContentNode parserHeader; parserHeader.beginingLine = 6; parserHeader.endLine = 27; parserHeader.filePath = "../library/include/gltfparser.h";
+    ContentNode definesHeader; definesHeader.beginingLine = 4; definesHeader.endLine = 72; definesHeader.filePath = "../library/include/gltfparser_defines.h";
+    ContentNode typesHeader; typesHeader.beginingLine = 3; typesHeader.endLine = 685; typesHeader.filePath = "../library/include/gltfparser_types.h";
+    ContentNode jsmnHeader; jsmnHeader.beginingLine = 30; jsmnHeader.endLine = 92; jsmnHeader.filePath = "../library/include/jsmn.h";
+    ContentNode utilHeader; utilHeader.beginingLine = 5; utilHeader.endLine = 177; utilHeader.filePath = "../library/include/gltfparser_util.h";
+    ContentNode base64Header; base64Header.beginingLine = 5; base64Header.endLine = 26; base64Header.filePath = "../library/include/gltfparser_base64.h";
+    ContentNode numberHeader; numberHeader.beginingLine = 5; numberHeader.endLine = 34; numberHeader.filePath = "../library/include/gltfparser_number.h";
+    ContentNode accessorHeader; accessorHeader.beginingLine = 6; accessorHeader.endLine = 60; accessorHeader.filePath = "../library/include/gltfparser_accessor.h";
+    ContentNode jsonHeader; jsonHeader.beginingLine = 6; jsonHeader.endLine = 52; jsonHeader.filePath = "../library/include/gltfparser_json.h";
+    ContentNode parserHeader; parserHeader.beginingLine = 6; parserHeader.endLine = 149; parserHeader.filePath = "../library/include/gltfparser.h";
 
     char separator1[] = "// Functions implementation\n\n";
     char defineMacroStart[] = "#ifdef GLTFPARSER_IMPLEMENTATION\n\n";
 
     // source, begining line, end line, filepath
-    ContentNode jsmnSource; jsmnSource.beginingLine = 2; jsmnSource.endLine = 359; jsmnSource.filePath = "../library/source/jsmn.c";
-    ContentNode utilSource; utilSource.beginingLine = 8; utilSource.endLine = 142; utilSource.filePath = "../library/source/gltfparser_util.c";
-    ContentNode jsonSource; jsonSource.beginingLine = 7; jsonSource.endLine = 118; jsonSource.filePath = "../library/source/gltfparser_json.c";
-    ContentNode parserSource; parserSource.beginingLine = 10; parserSource.endLine = 2387; parserSource.filePath = "../library/source/gltfparser.c";
+    ContentNode jsmnSource; jsmnSource.beginingLine = 4; jsmnSource.endLine = 522; jsmnSource.filePath = "../library/source/jsmn.c";
+    ContentNode utilSource; utilSource.beginingLine = 9; utilSource.endLine = 564; utilSource.filePath = "../library/source/gltfparser_util.c";
+    ContentNode base64Source; base64Source.beginingLine = 4; base64Source.endLine = 194; base64Source.filePath = "../library/source/gltfparser_base64.c";
+    ContentNode numberSource; numberSource.beginingLine = 6; numberSource.endLine = 474; numberSource.filePath = "../library/source/gltfparser_number.c";
+    ContentNode accessorSource; accessorSource.beginingLine = 6; accessorSource.endLine = 587; accessorSource.filePath = "../library/source/gltfparser_accessor.c";
+    ContentNode jsonSource; jsonSource.beginingLine = 7; jsonSource.endLine = 206; jsonSource.filePath = "../library/source/gltfparser_json.c";
+    ContentNode parserSource; parserSource.beginingLine = 13; parserSource.endLine = 4524; parserSource.filePath = "../library/source/gltfparser.c";
 
     char defineMacroEnd[] = "#endif // GLTFPARSER_IMPLEMENTATION\n\n";
 
@@ -76,9 +84,12 @@ void create_header_only() {
     fprintf(outputFile, "%s", separator0);
 
     fprintf_content_node(outputFile, &definesHeader);
+    fprintf_content_node(outputFile, &typesHeader);
     fprintf_content_node(outputFile, &jsmnHeader);
     fprintf_content_node(outputFile, &utilHeader);
-    fprintf_content_node(outputFile, &typesHeader);
+    fprintf_content_node(outputFile, &base64Header);
+    fprintf_content_node(outputFile, &numberHeader);
+    fprintf_content_node(outputFile, &accessorHeader);
     fprintf_content_node(outputFile, &jsonHeader);
     fprintf_content_node(outputFile, &parserHeader);
 
@@ -87,6 +98,9 @@ void create_header_only() {
 
     fprintf_content_node(outputFile, &jsmnSource);
     fprintf_content_node(outputFile, &utilSource);
+    fprintf_content_node(outputFile, &base64Source);
+    fprintf_content_node(outputFile, &numberSource);
+    fprintf_content_node(outputFile, &accessorSource);
     fprintf_content_node(outputFile, &jsonSource);
     fprintf_content_node(outputFile, &parserSource);
 
@@ -3,7 +3,9 @@
 
 // Standart libraries used
 
+#include <float.h>
 #include <stdio.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <stdarg.h>
 #include <string.h>
@@ -24,131 +26,58 @@
 	#define GLTF_API
 #endif
 
-/// @brief sets how many characters the loging system can hold
-#ifndef GLTF_LOG_BUFFER_SIZE
-#define GLTF_LOG_BUFFER_SIZE 2048
+/// @brief enables the x86 simd code paths, they're selected at runtime based on what the cpu supports
+#if !defined(GLTF_DISABLE_SIMD) && (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+	#define GLTF_SIMD_X86
 #endif
 
-#ifdef __cplusplus
-extern "C" {
+/// @brief allows a single function to use instructions the library is not compiled with
+#if defined(__GNUC__) || defined(__clang__)
+	#define GLTF_TARGET(x) __attribute__((target(x)))
+#else
+	#define GLTF_TARGET(x)
 #endif
 
-/// @brief all types of json field types
-typedef enum {
-	JSMN_UNDEFINED = 0,
-	JSMN_OBJECT = 1 << 0,
-	JSMN_ARRAY = 1 << 1,
-	JSMN_STRING = 1 << 2,
-	JSMN_PRIMITIVE = 1 << 3
-} jsmntype_t;
-
-/// @brief all types of errors when parsing 
-enum jsmnerr {
-	
-	JSMN_ERROR_NOMEM = -1, // not enough tokens were provided
-	JSMN_ERROR_INVAL = -2, // invalid char inside json string
-	JSMN_ERROR_PART = -3 // string is no a full json packet, more were expected
-};
-
-/// @brief token structure
-typedef struct jsmntok {
-	jsmntype_t type;
-	int start;
-	int end;
-	int size;
-#ifdef JSMN_PARENT_LINKS
-	int parent;
+/// @brief gives every thread it's own copy of a variable
+#if defined(_MSC_VER)
+	#define GLTF_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+	#define GLTF_THREAD_LOCAL _Thread_local
+#else
+	#define GLTF_THREAD_LOCAL __thread
 #endif
-} jsmntok_t;
-
-/// @brief parser structure
-typedef struct jsmn_parser {
-	unsigned int pos;     // offset in the JSON string
-	unsigned int toknext; // next token to allocate
-	int toksuper;         // superior token node, e.g. parent object or array
-} jsmn_parser;
-
-/// @brief create a JSON parser over an array of tokens
-GLTF_API void jsmn_init(jsmn_parser* parser);
-
-/// @brief parses a JSON data string into and array of tokens, each describing a single JSON object
-GLTF_API int jsmn_parse(jsmn_parser* parser, const char* js, const unsigned long long len, jsmntok_t* tokens, const unsigned int num_tokens);
 
-#ifdef __cplusplus
-}
+/// @brief sets how many characters the loging system can hold
+#ifndef GLTF_LOG_BUFFER_SIZE
+#define GLTF_LOG_BUFFER_SIZE 2048
 #endif
 
-
-#ifdef __cplusplus
-extern "C" {
+/// @brief sets how many structured errors a GLTF_Context keeps, the following ones are only counted and logged
+#ifndef GLTF_MAX_ERRORS
+#define GLTF_MAX_ERRORS 8
 #endif
 
-/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// memory
-
-/// @brief allocates memory using default malloc, this is usefull if allocating functions are to be modified
-/// @param size how many bytes to be allocated
-/// @param empty erases all contents within specified size
-/// @return the memory's address
-GLTF_API void* gltfmemory_allocate(unsigned long long size, int empty);
-
-/// @brief dealocates memory previously allocated
-/// @param ptr address to the memory's block
-GLTF_API void gltfmemory_deallocate(void* ptr);
-
-/// @brief reallocates previouly allocated memory to fit a new size
-/// @param ptr address to the memory
-/// @param size new size of the memory's block
-/// @return the new ptr of the memory
-GLTF_API void* gltfmemory_reallocate(void* ptr, unsigned long long size);
-
-/// @brief erases all content exists in the given address
-/// @param ptr memory's address
-/// @param size how many bytes to be erased
-GLTF_API void gltfmemory_zero(void* ptr, unsigned long long size);
-
-/// @brief copies a block of memory to a new address
-/// @param dest where the memory will be moved to
-/// @param src where memory previously resided
-/// @param size how many bytes the memory occupies
-/// @return dest's address
-GLTF_API void* gltfmemory_copy(void* dest, const void* src, unsigned long long size);
-
-/// @brief compares two blocks of memory
-/// @param s1 the first block of memory
-/// @param s2 the second block of memory
-/// @param n compares until n bytes
-/// @return 0 if both are equal, negative if s1 is less than s2, positve if s1 is greater than s2
-GLTF_API int gltfmemory_cmp(const void* s1, const void* s2, unsigned long long n);
-
-/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// others
-
-/// @brief reads the contents of a file
-/// @param path the path on disk of the file
-/// @param size the file output size
-/// @param data the read data
-/// @return 1 on success, 0 on failure
-GLTF_API int platform_fileread(const char* path, unsigned long long* size, void** data);
+/// @brief sets how many characters the message and the json path of a GLTF_Error can hold
+#ifndef GLTF_ERROR_MESSAGE_SIZE
+#define GLTF_ERROR_MESSAGE_SIZE 192
+#endif
 
-/// @brief copies a string into another string
-/// @param dest destiny string
-/// @param src source string
-/// @param size size of the  
-/// @return the dest address
-GLTF_API void* strncpy_impl(void* dest, const char* src, unsigned long long size);
+#ifndef GLTF_ERROR_PATH_SIZE
+#define GLTF_ERROR_PATH_SIZE 128
+#endif
 
-/// @brief performs a lexicographical comparation between two strings
-/// @param s1 the first string to compare
-/// @param s2 the second string to compare
-/// @param n only compares up to n characters
-GLTF_API int strncmp_impl(const char* s1, const char* s2, unsigned long long n);
+/// @brief sets the size of the first chunk of the parse arena, following chunks double it up to GLTF_ARENA_CHUNK_SIZE_MAX
+#ifndef GLTF_ARENA_CHUNK_SIZE
+#define GLTF_ARENA_CHUNK_SIZE (64 * 1024)
+#endif
 
-/// @brief searches for the first occurrence of a character in a string
-/// @param str the string to be searched in
-/// @param c the character to search
-GLTF_API char* strchr_impl(const char* str, int c);
+#ifndef GLTF_ARENA_CHUNK_SIZE_MAX
+#define GLTF_ARENA_CHUNK_SIZE_MAX (16 * 1024 * 1024)
+#endif
 
-#ifdef __cplusplus
-}
+/// @brief sets how many elements a top-level array needs to be parsed by several threads, see GLTF_ParseOptions::parseThreads
+#ifndef GLTF_PARALLEL_ELEMENTS_MIN
+#define GLTF_PARALLEL_ELEMENTS_MIN 4096
 #endif
 
 #ifdef __cplusplus
@@ -264,6 +193,28 @@ typedef enum {
 /// @brief forward declaration
 typedef struct GLTF_Node GLTF_Node;
 
+/// @brief who is responsible for releasing a block of memory
+typedef enum {
+    StorageType_None,                   // nothing to release, the memory is empty or owned by someone else
+    StorageType_Heap,                   // allocated with gltfmemory_allocate
+    StorageType_Mapped,                 // mapped with platform_filemap
+    StorageType_Borrowed,               // owned by the caller, which must keep it alive while it's referenced
+    StorageType_FileIO                  // mapped through the GLTF_FileIO callbacks, released by closing it's file
+} GLTF_StorageType;
+
+/// @brief closes a file opened by GLTF_FileIO, along with anything mapped from it
+typedef void (*GLTF_FileRelease)(void* userData, void* file);
+
+/// @brief a block of memory owned by the parsed data
+typedef struct {
+    void* data;
+    unsigned long long size;
+    GLTF_StorageType type;
+    void* file;                         // the GLTF_FileIO file the data was mapped from, if applicable
+    GLTF_FileRelease release;           // closes the GLTF_FileIO file, if applicable
+    void* userData;                     // passed to release
+} GLTF_Storage;
+
 /// @brief information about a extension
 typedef struct {
     char* name;
@@ -283,13 +234,16 @@ typedef struct {
 
 // GLTF 2.0 specification https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html#buffers-and-buffer-views
 typedef struct {
-    void* data; // loaded uppon load buffer
+    void* data; // loaded uppon load buffer, either points to storage or to the glb bin chunk
     char* name;
     unsigned long long size;
     char* URI;
     unsigned long long extensionsCount;
     GLTF_Extension* extensions;
     char* extras;
+    GLTF_Storage storage; // the external file loaded for this buffer, if any
+    char* path; // the file lazy buffer views are loaded from, if any
+    unsigned long long fileOffset; // where the buffer starts inside of path
 } GLTF_Buffer;
 
 /// GLTF 2.0 specification https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html#buffers-and-buffer-views
@@ -300,10 +254,11 @@ typedef struct {
     unsigned long long offset;
     unsigned long long size;
     unsigned long long stride;
-    void* data;
+    void* data; // points inside of buffer's data, NULL when the buffer is not loaded
     char* extras;
     unsigned long long extensionsCount;
     GLTF_Extension* extensions;
+    GLTF_Storage storage; // the byte range read when lazily required, if any
 } GLTF_BufferView;
 
 // GLTF 2.0 specification https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html#sparse-accessors
@@ -314,6 +269,8 @@ typedef struct {
     GLTF_ComponentType indicesComponentType;
     GLTF_BufferView* valuesBufferView;
     unsigned long long valueByteOffset;
+    void* resolved;                     // every element of the accessor with the sparse values applied, packed, NULL until GLTF_AccessorResolveSparse is called
+    GLTF_Storage storage;               // owns the resolved elements
 } GLTF_SparseAccessor;
 
 /// GLTF 2.0 specification https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html#accessors
@@ -426,6 +383,9 @@ typedef struct {
     char* extras;
     unsigned long long extensionsCount;
     GLTF_Extension* extensions;
+    void* data; // the encoded image, either decoded from a data uri or pointing to the buffer view's data
+    unsigned long long size;
+    GLTF_Storage storage; // the decoded data uri, if any
 } GLTF_Image;
 
 /// @brief GLTF 2.0 specification https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html#samplers
@@ -567,16 +527,132 @@ struct GLTF_Node {
 // API structs
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// @brief how the parser brings a file into memory
+typedef enum {
+    FileMode_Read,                      // reads the whole file into a heap buffer
+    FileMode_Map                        // maps the file read-only, falls back to FileMode_Read when mapping fails or GLTF_FileIO has no map
+} GLTF_FileMode;
+
+/// @brief callbacks that replaces the platform file access, used for the main file and every external uri
+/// @note the callbacks may be called from several threads at once while external files are loaded
+typedef struct {
+    void* userData;                                                                                             // passed to every callback
+    void* (*open)(void* userData, const char* path);                                                            // opens a file, returns NULL on failure
+    unsigned long long (*size)(void* userData, void* file);                                                     // returns the file size in bytes
+    int (*read)(void* userData, void* file, unsigned long long offset, unsigned long long size, void* dst);      // reads a range of the file into dst, returns 1 on success
+    const void* (*map)(void* userData, void* file, unsigned long long* outSize);                                // optional, exposes the whole file without copying it, returns NULL on failure
+    GLTF_FileRelease release;                                                                                   // closes the file, along with anything mapped from it
+} GLTF_FileIO;
+
+/// @brief callbacks that replaces the heap, used for the parsed data and for the memory the parser needs while working
+/// @note the callbacks may be called from several threads at once while external files are loaded
+typedef struct {
+    void* userData;                                                                                             // passed to every callback
+    void* (*allocate)(void* userData, unsigned long long size);                                                 // returns NULL on failure
+    void* (*reallocate)(void* userData, void* ptr, unsigned long long size);                                    // ptr may be NULL, returns NULL on failure leaving ptr untouched
+    void (*deallocate)(void* userData, void* ptr);                                                              // ptr may be NULL
+} GLTF_Allocator;
+
 typedef struct {
-    const char* path;                   // the path on disk
+    const char* path;                   // the path on disk, or the options basePath when parsed from memory
     void* bin;                          // glb bin data, if applicable
     unsigned long long binSize;                     // glb bin size, if applicable
     int type;                           // 1: GLFW file 0: GLB file
     unsigned int jsonTkCount;           // holds how many tokens the json has
-    const char* json;                   // json data, for latter reference
+    const char* json;                   // json data, for latter reference, only valid when the file data is retained
     unsigned long long jsonSize;                    // json data size, for latter reference
+    GLTF_Storage storage;               // the whole file when it's retained, bin and json then points inside of it
+    unsigned long long binOffset;       // where the glb bin data starts inside of the file, if applicable
+    GLTF_FileMode fileMode;             // the file mode used while parsing, lazy buffers are loaded with it
+    GLTF_FileIO io;                     // the file access used while parsing, lazy buffers are loaded with it
+    GLTF_Allocator allocator;           // the allocator used while parsing, lazy buffers and GLTF_Free uses it
+    int stringViews;                    // 1: names, uris, extras and extensions points into json instead of the arena, json is no longer valid json
 } GLTF_FileInfo;
 
+/// @brief the top-level collections of a document, combined as flags to choose which ones are built
+typedef enum {
+    Section_Accessors       = 1 << 0,
+    Section_Animations      = 1 << 1,
+    Section_BufferViews     = 1 << 2,
+    Section_Buffers         = 1 << 3,   // skipped buffers are neither loaded
+    Section_Cameras         = 1 << 4,
+    Section_Images          = 1 << 5,   // skipped images are neither loaded
+    Section_Materials       = 1 << 6,
+    Section_Meshes          = 1 << 7,
+    Section_Nodes           = 1 << 8,
+    Section_Samplers        = 1 << 9,
+    Section_Scenes          = 1 << 10,  // scenes and the default scene
+    Section_Skins           = 1 << 11,
+    Section_Textures        = 1 << 12,
+    Section_All             = (1 << 13) - 1
+} GLTF_Section;
+
+/// @brief how the parser deals with the buffers data
+typedef enum {
+    BufferMode_Load,                    // every buffer and image is loaded while parsing, external files are loaded concurrently with the same file mode as the main file and base64 data uris are decoded
+    BufferMode_Skip,                    // no buffer or image is loaded, GLTF_Buffer::data, GLTF_BufferView::data and GLTF_Image::data stays NULL
+    BufferMode_Lazy                     // like BufferMode_Skip, but GLTF_RequireBufferView and GLTF_RequireAccessor loads the data on demand
+} GLTF_BufferMode;
+
+/// @brief a unit of work the parser wants done, called once for each index in [0, count)
+typedef void (*GLTF_TaskFunction)(void* taskData, unsigned long long index);
+
+/// @brief runs a task for every index in [0, count), possibly concurrently, must only return once every call has finished
+typedef void (*GLTF_TaskDispatch)(void* userData, GLTF_TaskFunction task, void* taskData, unsigned long long count);
+
+/// @brief what kind of failure an error is
+typedef enum {
+    ErrorCode_None,
+    ErrorCode_InvalidArgument,          // a NULL or empty path or memory, invalid options or an object that can't be required
+    ErrorCode_OutOfMemory,              // an allocation has failed
+    ErrorCode_File,                     // a file couldn't be opened or read
+    ErrorCode_InvalidJson,              // the json text is malformed
+    ErrorCode_InvalidGLB,               // the glb container is malformed
+    ErrorCode_InvalidDocument,          // the json is valid but it's not a valid gltf document
+    ErrorCode_Unsupported               // a valid document that uses something the parser doesn't support
+} GLTF_ErrorCode;
+
+/// @brief a single error that has happened while parsing
+typedef struct {
+    GLTF_ErrorCode code;                // what kind of failure it is
+    long long offset;                   // the byte offset into the json text where it happened, -1 when it's not tied to the json
+    char path[GLTF_ERROR_PATH_SIZE];    // the json path where it happened, like "meshes[2].primitives[0].mode", empty when it's not tied to the json
+    char message[GLTF_ERROR_MESSAGE_SIZE];
+} GLTF_Error;
+
+/// @brief receives the errors of a parse, every parse uses it's own so several threads can parse at once
+typedef struct {
+    unsigned int errorsCount;           // how many errors has happened, only the first GLTF_MAX_ERRORS are kept in errors, the first one is the cause of the failure
+    GLTF_Error errors[GLTF_MAX_ERRORS];
+    char log[GLTF_LOG_BUFFER_SIZE];     // every error message one per line, with it's path when it has one
+} GLTF_Context;
+
+/// @brief memory a parse needs only while it's working, kept between parses so loading many files doesn't allocate it each time
+/// @note zero-initialize it before it's first use, a workspace must not be used by several parses at once
+typedef struct {
+    void* tokens;                       // the json tokens of the largest json parsed so far
+    unsigned int tokensCapacity;        // how many tokens fits in tokens
+    GLTF_Allocator allocator;           // the allocator of the parse that has created it, it keeps using it
+} GLTF_Workspace;
+
+/// @brief options that changes how a file is parsed, a zero-initialized struct means the default behaviour
+typedef struct {
+    GLTF_FileMode fileMode;             // how the main file and external buffers are loaded
+    int retainFileData;                 // 1: keeps the loaded file alive until GLTF_Free, the glb bin chunk is used in place instead of copied, when parsing from memory the caller's memory keeps being referenced instead
+    GLTF_BufferMode bufferMode;         // how buffers are loaded
+    unsigned int loadThreads;           // how many threads loads the external files at once, 0: one per processor, 1: loads them on the calling thread
+    unsigned int parseThreads;          // how many threads parses the accessors, buffer views, materials, meshes and nodes arrays with at least GLTF_PARALLEL_ELEMENTS_MIN elements, 0 or 1: the calling thread only
+    GLTF_TaskDispatch taskDispatch;     // runs the parser work on the caller's own job system instead of the internal threads, may be NULL
+    void* taskUserData;                 // passed to taskDispatch
+    const char* basePath;               // when parsing from memory, the path of the document that external uris are relative to, may be NULL
+    GLTF_FileIO io;                     // custom file access, all but map must be set when open is set, zero-initialized means the platform file access
+    GLTF_Allocator allocator;           // custom memory allocation, the three functions must be set together, zero-initialized means malloc, realloc and free
+    int stringViews;                    // 1: strings points into the retained json instead of being copied, only with retainFileData on a file read into memory, see GLTF_FileInfo::stringViews
+    GLTF_Context* context;              // receives the errors, it's cleared when the parse starts, NULL: the calling thread context returned by GLTF_GetContext
+    GLTF_Workspace* workspace;          // reused by the parse instead of allocating it's temporary memory, NULL: it's allocated and released by the parse
+    unsigned int sections;              // GLTF_Section flags of the collections to build, the others are skipped and any reference into them is NULL, 0: all of them, the asset and the root extensions are always parsed
+} GLTF_ParseOptions;
+
 /// @brief final structure for the parsed data
 typedef struct {
     GLTF_FileInfo fileInfo;
@@ -615,8 +691,73 @@ typedef struct {
     char** extensionsRequired;
     unsigned long long extensionsRequiredCount;
     char* extras;
+    struct GLTF_Arena* arena;           // owns every allocation of the parsed data but the buffers and images storages, released by GLTF_Free
 } GLTF2;
 
+/// @brief the metadata of a document, read by GLTF_Probe without building it
+typedef struct {
+    int valid;                          // 1 when the file was read, tokenized and probed without errors, otherwise the rest of the metadata is partial
+    int isGlb;                          // 1 for a glb file, 0 for a gltf json file
+    unsigned long long jsonSize;        // the json size in bytes
+    unsigned long long binSize;         // the glb bin chunk size in bytes as told by the glb header, 0 when there's none
+    GLTF_Asset asset;                   // the version, generator, copyright... legacy documents are reported too
+    unsigned long long accessorsCount;
+    unsigned long long animationsCount;
+    unsigned long long bufferViewsCount;
+    unsigned long long buffersCount;
+    unsigned long long* bufferSizes;    // the byteLength of every buffer, buffersCount of them
+    unsigned long long camerasCount;
+    unsigned long long imagesCount;
+    unsigned long long materialsCount;
+    unsigned long long meshesCount;
+    unsigned long long nodesCount;
+    unsigned long long imageSamplersCount;
+    unsigned long long scenesCount;
+    unsigned long long skinsCount;
+    unsigned long long texturesCount;
+    char** extensionsUsed;
+    unsigned long long extensionsUsedCount;
+    char** extensionsRequired;
+    unsigned long long extensionsRequiredCount;
+    struct GLTF_Arena* arena;           // owns every allocation of the probe, released by GLTF_FreeProbe
+} GLTF_ProbeInfo;
+
+/// @brief the outcome of one file of a batch
+typedef struct {
+    GLTF2 data;                         // the parsed data, it must be released with GLTF_Free even when parsing has failed
+    int parsed;                         // 1 when the file was parsed, otherwise error tells why
+    unsigned int errorsCount;           // how many errors the file had
+    GLTF_Error error;                   // the first error of the file, the cause of the failure
+    double seconds;                     // how long loading and parsing the file took
+} GLTF_BatchResult;
+
+/// @brief the totals of a batch
+typedef struct {
+    unsigned long long filesCount;      // how many files the batch had
+    unsigned long long parsedCount;     // how many of them were parsed
+    unsigned int threadsCount;          // how many threads parsed them, 0 when they were run by taskDispatch
+    double seconds;                     // how long the whole batch took
+    double filesSeconds;                // the sum of every file time, divided by seconds it's how many files were parsed at once on average
+    double slowestSeconds;              // the time of the slowest file
+    unsigned long long slowestIndex;    // the index of the slowest file
+} GLTF_BatchStats;
+
+/// @brief the width GLTF_AccessorReadIndices writes indices with
+typedef enum {
+    IndexFormat_Auto,                   // 16 bits when every index is below 65535, the 16 bits primitive restart value, 32 bits otherwise
+    IndexFormat_U16,                    // 16 bits, failing when an index doesn't fit
+    IndexFormat_U32                     // 32 bits
+} GLTF_IndexFormat;
+
+/// @brief what GLTF_AccessorReadIndices found and wrote
+typedef struct {
+    GLTF_ComponentType componentType;   // ComponentType_R16_UNSIGNED or ComponentType_R32_UNSIGNED, the width the indices are written with
+    unsigned long long count;           // how many indices there are
+    unsigned int min;                   // the lowest index of the accessor, before rebasing
+    unsigned int max;                   // the highest index of the accessor, before rebasing
+    unsigned int base;                  // what was subtracted from every index, min when they are rebased and 0 otherwise
+} GLTF_IndexInfo;
+
 #ifdef __cplusplus
 }
 #endif
@@ -625,79 +766,692 @@ typedef struct {
 extern "C" {
 #endif
 
-/// @brief compares a string and the json string
-GLTF_API int json_strncmp(const char* data, const jsmntok_t* tok, const char* str);
-
-/// @brief converts a json data in to an integer bool
-GLTF_API int json_to_bool(const char* data, const jsmntok_t* tok);
-
-/// @brief converts json data into an integer
-GLTF_API int json_to_int(const char* data, jsmntok_t const* tok);
+/// @brief all types of json field types
+typedef enum {
+	JSMN_UNDEFINED = 0,
+	JSMN_OBJECT = 1 << 0,
+	JSMN_ARRAY = 1 << 1,
+	JSMN_STRING = 1 << 2,
+	JSMN_PRIMITIVE = 1 << 3
+} jsmntype_t;
 
-/// @brief converts json data into a float
-GLTF_API float json_to_float(const char* data, const jsmntok_t* tok);
+/// @brief all types of errors when parsing 
+enum jsmnerr {
+	
+	JSMN_ERROR_NOMEM = -1, // not enough tokens were provided
+	JSMN_ERROR_INVAL = -2, // invalid char inside json string
+	JSMN_ERROR_PART = -3, // string is no a full json packet, more were expected
+	JSMN_ERROR_SIZE = -4 // an object or array has more than JSMN_SIZE_MAX children
+};
 
-/// @brief converts a json data into a size_t
-GLTF_API unsigned long long json_to_size(const char* data, const jsmntok_t* tok);
+/// @brief the most children a single token can have
+#define JSMN_SIZE_MAX 0x0FFFFFFF
 
-/// @brief parses a json string
-GLTF_API int json_parse_string(const char* data, const jsmntok_t* tokens, int i, char** outString);
+/// @brief token structure, the type is packed along with the size so a token takes 16 bytes
+typedef struct jsmntok {
+	unsigned int type : 4; // a jsmntype_t
+	unsigned int size : 28;
+	int start;
+	int end;
+	int next;             // the token that follows this one's subtree, so skipping an object or array is a single read
+#ifdef JSMN_PARENT_LINKS
+	int parent;
+#endif
+} jsmntok_t;
 
-/// @brief parses the json array
-GLTF_API int json_parse_array(const char* data, const jsmntok_t* tokens, int i, unsigned long long elementSize, void** outArr, unsigned long long* outSize);
+/// @brief parser structure
+typedef struct jsmn_parser {
+	unsigned int pos;     // offset in the JSON string
+	unsigned int toknext; // next token to allocate
+	int toksuper;         // superior token node, e.g. parent object or array
+	int tokopen;          // innermost object or array not closed yet, each one links to the one it's inside of through it's next
+} jsmn_parser;
 
-/// @brief parses a json float array
-GLTF_API int json_parse_array_float(const char* data, const jsmntok_t* tokens, int i, float* outArray, int size);
+/// @brief create a JSON parser over an array of tokens
+GLTF_API void jsmn_init(jsmn_parser* parser);
 
-/// @brief parses a json strign array
-GLTF_API int json_parse_array_string(const char* data, const jsmntok_t* tokens, int i, char*** outArr, unsigned long long* outSize);
+/// @brief parses a JSON data string into and array of tokens, each describing a single JSON object
+GLTF_API int jsmn_parse(jsmn_parser* parser, const char* js, const unsigned long long len, jsmntok_t* tokens, const unsigned int num_tokens);
 
-/// @brief skips the parsing to next iteration
-GLTF_API int json_parse_skip(const jsmntok_t* tokens, int i);
+/// @brief parses a JSON data string in a single pass, growing the array of tokens whenever it runs out of them
+/// @param tokens the array of tokens, may point to NULL, it's reallocated with gltfmemory_reallocate and must be released with gltfmemory_deallocate
+/// @param num_tokens the capacity of the array of tokens, updated whenever it grows, 0 starts with an estimate taken from the data length
+/// @param allocator the allocator the array of tokens comes from, may be NULL
+/// @return the amount of tokens parsed or a negative jsmnerr, JSMN_ERROR_NOMEM only when the allocation fails
+GLTF_API int jsmn_parse_alloc(jsmn_parser* parser, const char* js, const unsigned long long len, jsmntok_t** tokens, unsigned int* num_tokens, const GLTF_Allocator* allocator);
 
 #ifdef __cplusplus
 }
 #endif
 
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-/// @brief attempts to parse a gltf formatted file
-/// @param path the disk path of the gltf file
-/// @return a parsed output data
-GLTF_API GLTF2 GLTF_ParseFromFile(const char* path);
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// memory
 
-/// @brief release the resources used by a GLTF2 object
-/// @param data the gltf2 data
-GLTF_API void GLTF_Free(GLTF2* data);
+/// @brief allocates memory using the given allocator, or default malloc when it's NULL or zero-initialized
+/// @param allocator the allocator, may be NULL
+/// @param size how many bytes to be allocated
+/// @param empty erases all contents within specified size
+/// @return the memory's address
+GLTF_API void* gltfmemory_allocate(const GLTF_Allocator* allocator, unsigned long long size, int empty);
 
-/// @brief get all errors that has happened since last parse has occured
-/// @return the list of errors
-GLTF_API const char* GLTF_GetErrors();
+/// @brief dealocates memory previously allocated
+/// @param allocator the allocator the memory came from, may be NULL
+/// @param ptr address to the memory's block
+GLTF_API void gltfmemory_deallocate(const GLTF_Allocator* allocator, void* ptr);
 
-#ifdef __cplusplus
-}
-#endif
+/// @brief reallocates previouly allocated memory to fit a new size
+/// @param allocator the allocator the memory came from, may be NULL
+/// @param ptr address to the memory
+/// @param size new size of the memory's block
+/// @return the new ptr of the memory
+GLTF_API void* gltfmemory_reallocate(const GLTF_Allocator* allocator, void* ptr, unsigned long long size);
 
-// Functions implementation
+/// @brief erases all content exists in the given address
+/// @param ptr memory's address
+/// @param size how many bytes to be erased
+GLTF_API void gltfmemory_zero(void* ptr, unsigned long long size);
 
-#ifdef GLTFPARSER_IMPLEMENTATION
+/// @brief copies a block of memory to a new address
+/// @param dest where the memory will be moved to
+/// @param src where memory previously resided
+/// @param size how many bytes the memory occupies
+/// @return dest's address
+GLTF_API void* gltfmemory_copy(void* dest, const void* src, unsigned long long size);
 
-/// it is weird that C does not declare NULL as anything
-#ifndef NULL
-    #ifdef __cplusplus
-        #define NULL 0
-    #else
-        #define NULL ((void *)0)
-    #endif
-#endif
+/// @brief compares two blocks of memory
+/// @param s1 the first block of memory
+/// @param s2 the second block of memory
+/// @param n compares until n bytes
+/// @return 0 if both are equal, negative if s1 is less than s2, positve if s1 is greater than s2
+GLTF_API int gltfmemory_cmp(const void* s1, const void* s2, unsigned long long n);
 
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-/// INTERNAL
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// arena
 
-/// @brief Allocates a fresh unused token from the token pool
+/// @brief a chunk of a bump allocator, an arena is a pointer to its newest chunk which links to the older ones
+typedef struct GLTF_Arena {
+    struct GLTF_Arena* next;
+    unsigned long long used;
+    unsigned long long capacity;
+    GLTF_Allocator allocator;
+} GLTF_Arena;
+
+/// @brief creates an arena with a first chunk, every chunk of it comes from the given allocator
+/// @param allocator the allocator, may be NULL
+/// @return the arena, NULL on failure
+GLTF_API GLTF_Arena* gltfarena_create(const GLTF_Allocator* allocator);
+
+/// @brief allocates memory from an arena, a new chunk is added when the newest one can't fit the size
+/// @param arena the arena, it may point to NULL for an empty arena that uses default malloc
+/// @param size how many bytes to be allocated
+/// @param empty erases all contents within specified size
+/// @return the memory's address, it's released with the whole arena
+GLTF_API void* gltfarena_allocate(GLTF_Arena** arena, unsigned long long size, int empty);
+
+/// @brief moves every chunk of an arena into another one, behind it's newest chunk so it keeps allocating from it
+/// @param arena the arena that receives the chunks, it may point to NULL
+/// @param other the arena whose chunks are moved, it must not be used afterwards, may be NULL
+GLTF_API void gltfarena_merge(GLTF_Arena** arena, GLTF_Arena* other);
+
+/// @brief releases every chunk of an arena and leaves it empty
+/// @param arena the arena
+GLTF_API void gltfarena_release(GLTF_Arena** arena);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// others
+
+/// @brief cpu features used by the optional simd code paths
+#define CPU_FEATURE_SSSE3   (1 << 0)
+#define CPU_FEATURE_SSE41   (1 << 1)
+#define CPU_FEATURE_SSE42   (1 << 2)
+#define CPU_FEATURE_AVX2    (1 << 3)
+#define CPU_FEATURE_SSE2    (1 << 4)
+
+/// @brief queries which simd instructions the cpu and the operating system supports
+/// @return a combination of CPU_FEATURE_* bits, 0 when not running on x86 or GLTF_DISABLE_SIMD is defined
+GLTF_API unsigned int platform_cpu_features();
+
+/// @brief reads the contents of a file
+/// @param path the path on disk of the file
+/// @param size the file output size
+/// @param data the read data
+/// @param allocator where the data is allocated from, may be NULL
+/// @return 1 on success, 0 on failure
+GLTF_API int platform_fileread(const char* path, unsigned long long* size, void** data, const GLTF_Allocator* allocator);
+
+/// @brief reads a range of bytes of a file
+/// @param path the path on disk of the file
+/// @param offset where the range starts inside of the file
+/// @param size how many bytes to read
+/// @param dst where the bytes are written into, must hold at least size bytes
+/// @return 1 on success, 0 on failure (including ranges past the end of the file)
+GLTF_API int platform_filereadrange(const char* path, unsigned long long offset, unsigned long long size, void* dst);
+
+/// @brief maps the contents of a file into memory as read-only, without copying it
+/// @param path the path on disk of the file
+/// @param sequential 1 when the file is read once from start to end, so the system reads ahead and drops the pages behind, 0 when it's accessed in any order
+/// @param size the file output size
+/// @param data the mapped address
+/// @return 1 on success, 0 on failure (empty files can't be mapped)
+GLTF_API int platform_filemap(const char* path, int sequential, unsigned long long* size, void** data);
+
+/// @brief releases a file previously mapped with platform_filemap
+/// @param data the mapped address
+/// @param size the mapped size
+GLTF_API void platform_fileunmap(void* data, unsigned long long size);
+
+/// @brief the work executed for each index of platform_parallel_for
+typedef void (*platform_task)(void* taskData, unsigned long long index);
+
+/// @brief queries how many logical processors are available
+/// @return the processor count, at least 1
+GLTF_API unsigned int platform_cpu_count();
+
+/// @brief reads a monotonic clock, only the difference between two reads is meaningful
+/// @return the clock time in seconds
+GLTF_API double platform_time();
+
+/// @brief atomically adds a value to a 64 bits integer
+/// @param value the integer to be modified
+/// @param amount how much to add
+/// @return the integer value before the addition
+GLTF_API long long platform_atomic_add(volatile long long* value, long long amount);
+
+/// @brief atomically lowers a 64 bits integer to a value, it's left as is when it's already lower
+/// @param value the integer to be modified
+/// @param candidate the value it's lowered to
+/// @return the integer value before the operation
+GLTF_API long long platform_atomic_min(volatile long long* value, long long candidate);
+
+/// @brief runs a task for every index in [0, count) across worker threads, the calling thread also takes part
+/// @param threadCount the maximum amount of threads working at once, 0 uses one per processor
+/// @param count how many times the task must run
+/// @param task the work to be done
+/// @param taskData data passed to every task
+/// @param allocator where the threads bookkeeping is allocated from, may be NULL
+/// @note only returns once every task has finished
+GLTF_API void platform_parallel_for(unsigned int threadCount, unsigned long long count, platform_task task, void* taskData, const GLTF_Allocator* allocator);
+
+/// @brief copies a string into another string
+/// @param dest destiny string
+/// @param src source string
+/// @param size size of the  
+/// @return the dest address
+GLTF_API void* strncpy_impl(void* dest, const char* src, unsigned long long size);
+
+/// @brief performs a lexicographical comparation between two strings
+/// @param s1 the first string to compare
+/// @param s2 the second string to compare
+/// @param n only compares up to n characters
+GLTF_API int strncmp_impl(const char* s1, const char* s2, unsigned long long n);
+
+/// @brief searches for the first occurrence of a character in a string
+/// @param str the string to be searched in
+/// @param c the character to search
+GLTF_API char* strchr_impl(const char* str, int c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @brief calculates the maximum amount of bytes a base64 string decodes into
+/// @param length how many characters the base64 string has
+/// @return the maximum decoded size in bytes
+GLTF_API unsigned long long base64_decoded_size(unsigned long long length);
+
+/// @brief decodes a base64 string, using ssse3 or avx2 when the cpu supports it
+/// @param src the base64 characters, json escaped slashes are accepted
+/// @param length how many characters src has
+/// @param dst where the decoded bytes are written into, must hold at least base64_decoded_size(length) bytes
+/// @param outSize how many bytes were decoded
+/// @return 1 on success, 0 if src is not a valid base64 string
+GLTF_API int base64_decode(const char* src, unsigned long long length, void* dst, unsigned long long* outSize);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @brief parses a json number into the nearest float, independently of the current locale
+/// @param str the number characters, it doesn't need to be null terminated
+/// @param length how many characters str has, all of them must belong to the number
+/// @param outValue the parsed value, correctly rounded to nearest even
+/// @return 1 on success, 0 if str is not a json number or it's out of the float range
+GLTF_API int number_parse_float(const char* str, unsigned long long length, float* outValue);
+
+/// @brief parses a json integer, a fractional part made only of zeros is accepted
+/// @param str the number characters, it doesn't need to be null terminated
+/// @param length how many characters str has, all of them must belong to the number
+/// @param outValue the parsed value
+/// @return 1 on success, 0 if str is not an integer or it doesn't fit in 64 bits
+GLTF_API int number_parse_int64(const char* str, unsigned long long length, long long* outValue);
+
+/// @brief parses a non negative json integer, a fractional part made only of zeros is accepted
+/// @param str the number characters, it doesn't need to be null terminated
+/// @param length how many characters str has, all of them must belong to the number
+/// @param outValue the parsed value
+/// @return 1 on success, 0 if str is not a non negative integer or it doesn't fit in 64 bits
+GLTF_API int number_parse_uint64(const char* str, unsigned long long length, unsigned long long* outValue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @brief converts accessor elements into floats, normalized integers are mapped into [0, 1] or [-1, 1], using sse4.1 or avx2 when the cpu supports it
+/// @param src the first component of the first element
+/// @param srcStride how many bytes there are from an element of src to the next one
+/// @param componentType the type of the components of src
+/// @param normalized 1 when the integer components of src are normalized
+/// @param components how many components every element has
+/// @param count how many elements are converted
+/// @param dst where the first element is written into
+/// @param dstStride how many bytes there are from an element of dst to the next one
+GLTF_API void accessor_convert_float(const void* src, unsigned long long srcStride, GLTF_ComponentType componentType, int normalized, unsigned long long components, unsigned long long count, float* dst, unsigned long long dstStride);
+
+/// @brief converts accessor elements into unsigned 32 bits integers, negative values are clamped to 0 and floats are truncated, using sse4.1 or avx2 when the cpu supports it
+/// @param src the first component of the first element
+/// @param srcStride how many bytes there are from an element of src to the next one
+/// @param componentType the type of the components of src
+/// @param components how many components every element has
+/// @param count how many elements are converted
+/// @param dst where the first element is written into
+/// @param dstStride how many bytes there are from an element of dst to the next one
+GLTF_API void accessor_convert_u32(const void* src, unsigned long long srcStride, GLTF_ComponentType componentType, unsigned long long components, unsigned long long count, unsigned int* dst, unsigned long long dstStride);
+
+/// @brief converts accessor elements into unsigned 16 bits integers, values out of it's range are clamped and floats are truncated, using sse4.1 or avx2 when the cpu supports it
+/// @param src the first component of the first element
+/// @param srcStride how many bytes there are from an element of src to the next one
+/// @param componentType the type of the components of src
+/// @param components how many components every element has
+/// @param count how many elements are converted
+/// @param dst where the first element is written into
+/// @param dstStride how many bytes there are from an element of dst to the next one
+GLTF_API void accessor_convert_u16(const void* src, unsigned long long srcStride, GLTF_ComponentType componentType, unsigned long long components, unsigned long long count, unsigned short* dst, unsigned long long dstStride);
+
+/// @brief finds the lowest and highest of packed unsigned indices, using sse4.1 or avx2 when the cpu supports it
+/// @param src the first index
+/// @param componentType the type of the indices, ComponentType_R8_UNSIGNED, ComponentType_R16_UNSIGNED or ComponentType_R32_UNSIGNED
+/// @param count how many indices there are
+/// @param outMin receives the lowest index, it's left untouched when count is 0
+/// @param outMax receives the highest index, it's left untouched when count is 0
+GLTF_API void accessor_index_range(const void* src, GLTF_ComponentType componentType, unsigned long long count, unsigned int* outMin, unsigned int* outMax);
+
+/// @brief subtracts a base from every packed index, using sse4.1 or avx2 when the cpu supports it
+/// @param indices the first index
+/// @param componentType the type of the indices, ComponentType_R16_UNSIGNED or ComponentType_R32_UNSIGNED
+/// @param count how many indices there are
+/// @param base what is subtracted, it must not be above any index
+GLTF_API void accessor_index_rebase(void* indices, GLTF_ComponentType componentType, unsigned long long count, unsigned int base);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @brief compares a string and the json string, both must have the same length to be equal
+GLTF_API int json_strncmp(const char* data, const jsmntok_t* tok, const char* str);
+
+/// @brief converts a json data in to an integer bool
+GLTF_API int json_to_bool(const char* data, const jsmntok_t* tok);
+
+/// @brief reads json data as an integer, returns 1 on success, 0 if it's not a valid integer
+GLTF_API int json_read_int(const char* data, const jsmntok_t* tok, int* outValue);
+
+/// @brief reads json data as the nearest float, returns 1 on success, 0 if it's not a valid number
+GLTF_API int json_read_float(const char* data, const jsmntok_t* tok, float* outValue);
+
+/// @brief reads json data as a size, returns 1 on success, 0 if it's not a valid non negative integer
+GLTF_API int json_read_size(const char* data, const jsmntok_t* tok, unsigned long long* outValue);
+
+/// @brief parses a json string, the copy is allocated from arena and it has it's escapes decoded
+GLTF_API int json_parse_string(const char* data, const jsmntok_t* tokens, int i, char** outString, GLTF_Arena** arena);
+
+/// @brief parses a json string in place, the output points into data, whose closing quote becomes the terminator and escapes are decoded over the original characters
+GLTF_API int json_parse_string_view(char* data, const jsmntok_t* tokens, int i, char** outString);
+
+/// @brief parses the json array, the zeroed elements are allocated from arena
+GLTF_API int json_parse_array(const char* data, const jsmntok_t* tokens, int i, unsigned long long elementSize, void** outArr, unsigned long long* outSize, GLTF_Arena** arena);
+
+/// @brief parses a json float array
+GLTF_API int json_parse_array_float(const char* data, const jsmntok_t* tokens, int i, float* outArray, int size);
+
+/// @brief parses a json float array of any length, only the first capacity floats are kept but every element must be a number
+GLTF_API int json_parse_array_float_partial(const char* data, const jsmntok_t* tokens, int i, float* outArray, int capacity);
+
+/// @brief parses a json strign array, the array and its strings are allocated from arena
+GLTF_API int json_parse_array_string(const char* data, const jsmntok_t* tokens, int i, char*** outArr, unsigned long long* outSize, GLTF_Arena** arena);
+
+/// @brief skips the parsing to next iteration, the token and it's whole subtree are skipped in constant time
+/// @return the token after the subtree, -1 for the trailing UNDEFINED token
+GLTF_API int json_parse_skip(const jsmntok_t* tokens, int i);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @brief attempts to parse a gltf formatted file
+/// @param path the disk path of the gltf file
+/// @return a parsed output data
+GLTF_API GLTF2 GLTF_ParseFromFile(const char* path);
+
+/// @brief attempts to parse a gltf formatted file with custom options
+/// @param path the disk path of the gltf file
+/// @param options how the file should be parsed, NULL means the default options
+/// @return a parsed output data
+GLTF_API GLTF2 GLTF_ParseFromFileWithOptions(const char* path, const GLTF_ParseOptions* options);
+
+/// @brief attempts to parse a gltf or glb document that is already in memory, without copying it
+/// @param data the document data, owned by the caller
+/// @param size the document size in bytes
+/// @param options how the document should be parsed, NULL means the default options
+/// @return a parsed output data
+/// @note with retainFileData the memory must outlive the parsed data, otherwise it's no longer referenced once this returns
+GLTF_API GLTF2 GLTF_ParseFromMemory(const void* data, unsigned long long size, const GLTF_ParseOptions* options);
+
+/// @brief parses many gltf or glb files at once, every idle thread takes the next file that hasn't been started yet
+/// @param paths the disk path of every file
+/// @param count how many files there are
+/// @param options how every file should be parsed, NULL means the default options
+/// @param results receives the outcome of every file, in the same order as paths
+/// @param outStats receives the batch totals, may be NULL
+/// @return how many files were parsed
+/// @note loadThreads and taskDispatch spreads the files instead, one per processor by default, each file loads it's external files on the thread that parses it
+/// @note every thread reuses it's own workspace across the files it parses, options workspace is not used
+/// @note errors that prevents the batch from starting are reported like a single parse, those of each file only in it's result
+GLTF_API unsigned long long GLTF_ParseBatch(const char* const* paths, unsigned long long count, const GLTF_ParseOptions* options, GLTF_BatchResult* results, GLTF_BatchStats* outStats);
+
+/// @brief reads the metadata of a gltf or glb file without building it's data, only the header and the json chunk of a glb file are read
+/// @param path the disk path of the file
+/// @return the file metadata, it must be released with GLTF_FreeProbe even on failure, errors are reported like a parse
+/// @note the metadata is complete only when valid is 1, on failure it holds what was probed before the error
+GLTF_API GLTF_ProbeInfo GLTF_Probe(const char* path);
+
+/// @brief reads the metadata of a gltf or glb file with custom options
+/// @param path the disk path of the file
+/// @param options the fileMode, io, allocator, context and workspace are used, NULL means the default options
+/// @return the file metadata, it must be released with GLTF_FreeProbe even on failure, errors are reported like a parse
+/// @note the metadata is complete only when valid is 1, on failure it holds what was probed before the error
+GLTF_API GLTF_ProbeInfo GLTF_ProbeWithOptions(const char* path, const GLTF_ParseOptions* options);
+
+/// @brief makes sure a buffer view data is in memory, loading only it's byte range when the document was parsed with BufferMode_Lazy
+/// @param data the gltf2 data the buffer view belongs to
+/// @param view the buffer view to be loaded
+/// @return 1 when the view data is available, 0 on failure
+/// @note not thread-safe, the same document must not be required from several threads at once
+GLTF_API int GLTF_RequireBufferView(GLTF2* data, GLTF_BufferView* view);
+
+/// @brief makes sure every buffer view an accessor reads from is in memory, including the sparse ones
+/// @param data the gltf2 data the accessor belongs to
+/// @param accessor the accessor to be loaded
+/// @return 1 when the accessor data is available, 0 on failure
+/// @note not thread-safe, the same document must not be required from several threads at once
+GLTF_API int GLTF_RequireAccessor(GLTF2* data, GLTF_Accessor* accessor);
+
+/// @brief reads accessor elements as floats, integer components are converted and normalized ones are mapped into [0, 1] or [-1, 1]
+/// @param accessor the accessor, it's buffer view data must be in memory, see GLTF_RequireAccessor
+/// @param first the first element to be read
+/// @param count how many elements to be read, those past the end of the accessor are not
+/// @param out where the elements are written into, with as many components as the accessor type, matrices column after column without padding
+/// @param outStride how many bytes there are from an element of out to the next one, 0 means packed elements
+/// @return how many elements were read, 0 on failure
+/// @note the elements of an accessor without buffer view are zeros, sparse values are applied over them
+GLTF_API unsigned long long GLTF_AccessorReadFloat(const GLTF_Accessor* accessor, unsigned long long first, unsigned long long count, float* out, unsigned long long outStride);
+
+/// @brief reads accessor elements as unsigned 32 bits integers, negative values are clamped to 0 and floats are truncated
+/// @param accessor the accessor, it's buffer view data must be in memory, see GLTF_RequireAccessor
+/// @param first the first element to be read
+/// @param count how many elements to be read, those past the end of the accessor are not
+/// @param out where the elements are written into, with as many components as the accessor type, matrices column after column without padding
+/// @param outStride how many bytes there are from an element of out to the next one, 0 means packed elements
+/// @return how many elements were read, 0 on failure
+/// @note the elements of an accessor without buffer view are zeros, sparse values are applied over them
+GLTF_API unsigned long long GLTF_AccessorReadU32(const GLTF_Accessor* accessor, unsigned long long first, unsigned long long count, unsigned int* out, unsigned long long outStride);
+
+/// @brief reads accessor elements as unsigned 16 bits integers, values out of it's range are clamped and floats are truncated
+/// @param accessor the accessor, it's buffer view data must be in memory, see GLTF_RequireAccessor
+/// @param first the first element to be read
+/// @param count how many elements to be read, those past the end of the accessor are not
+/// @param out where the elements are written into, with as many components as the accessor type, matrices column after column without padding
+/// @param outStride how many bytes there are from an element of out to the next one, 0 means packed elements
+/// @return how many elements were read, 0 on failure
+/// @note the elements of an accessor without buffer view are zeros, sparse values are applied over them
+GLTF_API unsigned long long GLTF_AccessorReadU16(const GLTF_Accessor* accessor, unsigned long long first, unsigned long long count, unsigned short* out, unsigned long long outStride);
+
+/// @brief writes every element of an accessor packed in it's own component type, with the sparse values applied
+/// @param accessor the accessor, it's buffer views data must be in memory, see GLTF_RequireAccessor
+/// @param out where the elements are written into, NULL to only get the size they need
+/// @param outSize how many bytes out can hold
+/// @return how many bytes the elements take, 0 on failure
+GLTF_API unsigned long long GLTF_AccessorMaterialize(const GLTF_Accessor* accessor, void* out, unsigned long long outSize);
+
+/// @brief materializes a sparse accessor once and keeps it in GLTF_SparseAccessor::resolved, so the next reads of it are plain reads
+/// @param data the gltf2 data the accessor belongs to, it's allocator is used and GLTF_Free releases the elements
+/// @param accessor the accessor, nothing is done when it's not sparse or it's already resolved
+/// @return 1 on success, 0 on failure
+/// @note not thread-safe, the same document must not be resolved from several threads at once
+GLTF_API int GLTF_AccessorResolveSparse(GLTF2* data, GLTF_Accessor* accessor);
+
+/// @brief reads the indices of a primitive into a uniform width, finding the lowest and highest of them
+/// @param accessor the indices accessor, a scalar of unsigned 8, 16 or 32 bits integers whose buffer view data is in memory, see GLTF_RequireAccessor
+/// @param format the width the indices are written with, IndexFormat_Auto picks 16 bits when they fit
+/// @param rebase 1 to subtract the lowest index from every index, so a primitive using a window of a big vertex buffer fits in 16 bits
+/// @param out where the packed indices are written into, NULL to only get the size they need and outInfo
+/// @param outSize how many bytes out can hold
+/// @param outInfo receives the width, count, range and base of the indices, it may be NULL
+/// @return how many bytes the indices take, 0 on failure, an accessor without any index is invalid and fails too
+/// @note packed indices are scanned and widened or narrowed with sse4.1 or avx2 when the cpu supports it, sparse values are applied
+GLTF_API unsigned long long GLTF_AccessorReadIndices(const GLTF_Accessor* accessor, GLTF_IndexFormat format, int rebase, void* out, unsigned long long outSize, GLTF_IndexInfo* outInfo);
+
+/// @brief releases the memory a workspace has kept between parses
+/// @param workspace the workspace, it's left zero-initialized and ready to be used again
+GLTF_API void GLTF_ReleaseWorkspace(GLTF_Workspace* workspace);
+
+/// @brief release the resources used by a GLTF2 object
+/// @param data the gltf2 data
+GLTF_API void GLTF_Free(GLTF2* data);
+
+/// @brief release the resources used by a GLTF_ProbeInfo object
+/// @param info the probed metadata
+GLTF_API void GLTF_FreeProbe(GLTF_ProbeInfo* info);
+
+/// @brief get all errors that has happened since last parse has occured on the calling thread
+/// @return the list of errors
+/// @note errors of parses given their own GLTF_ParseOptions::context are only found in that context
+GLTF_API const char* GLTF_GetErrors();
+
+/// @brief get the structured errors that has happened since last parse has occured on the calling thread
+/// @return the calling thread context, it's cleared by it's next parse
+/// @note errors of parses given their own GLTF_ParseOptions::context are only found in that context
+GLTF_API const GLTF_Context* GLTF_GetContext();
+
+#ifdef __cplusplus
+}
+#endif
+
+// Functions implementation
+
+#ifdef GLTFPARSER_IMPLEMENTATION
+
+#if defined(GLTF_SIMD_X86)
+#include <immintrin.h>
+#endif
+
+/// it is weird that C does not declare NULL as anything
+#ifndef NULL
+    #ifdef __cplusplus
+        #define NULL 0
+    #else
+        #define NULL ((void *)0)
+    #endif
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// INTERNAL
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(GLTF_SIMD_X86)
+
+/// @brief index of the lowest set bit, mask must not be 0
+static unsigned int jsmn_ctz(unsigned int mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (unsigned int)index;
+#else
+    return (unsigned int)__builtin_ctz(mask);
+#endif
+}
+
+/// @brief sse2 variant of jsmn_scan_string
+GLTF_TARGET("sse2") static unsigned long long jsmn_scan_string_sse2(const char* js, unsigned long long pos, const unsigned long long len) {
+    const __m128i quote = _mm_set1_epi8('\"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; pos + 16 <= len; pos += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(js + pos));
+        __m128i hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)), _mm_cmpeq_epi8(chunk, zero));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(hit);
+        if (mask) return pos + jsmn_ctz(mask);
+    }
+    return pos;
+}
+
+/// @brief avx2 variant of jsmn_scan_string
+GLTF_TARGET("avx2") static unsigned long long jsmn_scan_string_avx2(const char* js, unsigned long long pos, const unsigned long long len) {
+    const __m256i quote = _mm256_set1_epi8('\"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i zero = _mm256_setzero_si256();
+
+    for (; pos + 32 <= len; pos += 32) {
+        __m256i chunk = _mm256_loadu_si256((const __m256i*)(js + pos));
+        __m256i hit = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote), _mm256_cmpeq_epi8(chunk, backslash)), _mm256_cmpeq_epi8(chunk, zero));
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(hit);
+        if (mask) return pos + jsmn_ctz(mask);
+    }
+    return pos;
+}
+
+/// @brief sse2 variant of jsmn_scan_whitespace
+GLTF_TARGET("sse2") static unsigned long long jsmn_scan_whitespace_sse2(const char* js, unsigned long long pos, const unsigned long long len) {
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i lf = _mm_set1_epi8('\n');
+
+    for (; pos + 16 <= len; pos += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(js + pos));
+        __m128i ws = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, tab)), _mm_or_si128(_mm_cmpeq_epi8(chunk, cr), _mm_cmpeq_epi8(chunk, lf)));
+        unsigned int mask = ~(unsigned int)_mm_movemask_epi8(ws) & 0xFFFFu;
+        if (mask) return pos + jsmn_ctz(mask);
+    }
+    return pos;
+}
+
+/// @brief avx2 variant of jsmn_scan_whitespace
+GLTF_TARGET("avx2") static unsigned long long jsmn_scan_whitespace_avx2(const char* js, unsigned long long pos, const unsigned long long len) {
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i cr = _mm256_set1_epi8('\r');
+    const __m256i lf = _mm256_set1_epi8('\n');
+
+    for (; pos + 32 <= len; pos += 32) {
+        __m256i chunk = _mm256_loadu_si256((const __m256i*)(js + pos));
+        __m256i ws = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, space), _mm256_cmpeq_epi8(chunk, tab)), _mm256_or_si256(_mm256_cmpeq_epi8(chunk, cr), _mm256_cmpeq_epi8(chunk, lf)));
+        unsigned int mask = ~(unsigned int)_mm256_movemask_epi8(ws);
+        if (mask) return pos + jsmn_ctz(mask);
+    }
+    return pos;
+}
+
+/// @brief sse2 variant of jsmn_scan_primitive
+GLTF_TARGET("sse2") static unsigned long long jsmn_scan_primitive_sse2(const char* js, unsigned long long pos, const unsigned long long len) {
+    const __m128i comma = _mm_set1_epi8(',');
+    const __m128i bracket = _mm_set1_epi8(']');
+    const __m128i brace = _mm_set1_epi8('}');
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i del = _mm_set1_epi8(127);
+    const __m128i printable = _mm_set1_epi8(32);
+#ifndef JSMN_STRICT
+    const __m128i colon = _mm_set1_epi8(':');
+#endif
+
+    for (; pos + 16 <= len; pos += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(js + pos));
+
+        // tabs, line breaks, null and any non ascii character are all below 32 as signed bytes
+        __m128i hit = _mm_or_si128(_mm_cmplt_epi8(chunk, printable), _mm_cmpeq_epi8(chunk, del));
+        hit = _mm_or_si128(hit, _mm_or_si128(_mm_cmpeq_epi8(chunk, comma), _mm_cmpeq_epi8(chunk, space)));
+        hit = _mm_or_si128(hit, _mm_or_si128(_mm_cmpeq_epi8(chunk, bracket), _mm_cmpeq_epi8(chunk, brace)));
+#ifndef JSMN_STRICT
+        hit = _mm_or_si128(hit, _mm_cmpeq_epi8(chunk, colon));
+#endif
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(hit);
+        if (mask) return pos + jsmn_ctz(mask);
+    }
+    return pos;
+}
+
+#endif
+
+/// @brief skips the characters of a string that need no attention, many bytes at a time when the cpu allows it
+/// @return the first quote, backslash or null character, or where the vectorized scan has stopped
+static unsigned long long jsmn_scan_string(const char* js, unsigned long long pos, const unsigned long long len, const unsigned int features) {
+#if defined(GLTF_SIMD_X86)
+    if (features & CPU_FEATURE_AVX2) pos = jsmn_scan_string_avx2(js, pos, len);
+    else if (features & CPU_FEATURE_SSE2) pos = jsmn_scan_string_sse2(js, pos, len);
+#else
+    (void)js; (void)len; (void)features;
+#endif
+    return pos;
+}
+
+/// @brief skips a run of whitespaces, many bytes at a time when the cpu allows it
+/// @return the first non whitespace character, or where the vectorized scan has stopped
+static unsigned long long jsmn_scan_whitespace(const char* js, unsigned long long pos, const unsigned long long len, const unsigned int features) {
+#if defined(GLTF_SIMD_X86)
+    if (features & CPU_FEATURE_AVX2) pos = jsmn_scan_whitespace_avx2(js, pos, len);
+    else if (features & CPU_FEATURE_SSE2) pos = jsmn_scan_whitespace_sse2(js, pos, len);
+#else
+    (void)js; (void)len; (void)features;
+#endif
+    return pos;
+}
+
+/// @brief skips the characters of a primitive, many bytes at a time when the cpu allows it
+/// @return the first delimiter or invalid character, or where the vectorized scan has stopped
+static unsigned long long jsmn_scan_primitive(const char* js, unsigned long long pos, const unsigned long long len, const unsigned int features) {
+#if defined(GLTF_SIMD_X86)
+    // primitives are short, the 16 bytes variant fits them better
+    if (features & CPU_FEATURE_SSE2) pos = jsmn_scan_primitive_sse2(js, pos, len);
+#else
+    (void)js; (void)len; (void)features;
+#endif
+    return pos;
+}
+
+/// @brief Allocates a fresh unused token from the token pool
 static jsmntok_t* jsmn_alloc_token(jsmn_parser* parser, jsmntok_t* tokens, const unsigned long long num_tokens) {
 	jsmntok_t* tok;
 	if (parser->toknext >= num_tokens) {
@@ -706,6 +1460,7 @@ static jsmntok_t* jsmn_alloc_token(jsmn_parser* parser, jsmntok_t* tokens, const
 	tok = &tokens[parser->toknext++];
 	tok->start = tok->end = -1;
 	tok->size = 0;
+	tok->next = parser->toknext;
 #ifdef JSMN_PARENT_LINKS
 	tok->parent = -1;
 #endif
@@ -722,12 +1477,16 @@ static void jsmn_fill_token(jsmntok_t* token, const jsmntype_t type,
 }
 
 /// @brief fills next available token with JSON primitive.
-static int jsmn_parse_primitive(jsmn_parser* parser, const char* js, const unsigned long long len, jsmntok_t* tokens, const unsigned long long num_tokens) {
+static int jsmn_parse_primitive(jsmn_parser* parser, const char* js, const unsigned long long len, jsmntok_t* tokens, const unsigned long long num_tokens, const unsigned int features) {
     jsmntok_t* token;
     int start;
     start = parser->pos;
 
     for (; parser->pos < len && js[parser->pos] != '\0'; parser->pos++) {
+        parser->pos = (unsigned int)jsmn_scan_primitive(js, parser->pos, len, features);
+        if (parser->pos >= len || js[parser->pos] == '\0') {
+            break;
+        }
         switch (js[parser->pos]) {
 #ifndef JSMN_STRICT
             /* in strict mode primitive must be followed by "," or "}" or "]" */
@@ -775,7 +1534,7 @@ found:
 }
 
 /// @brief fills next token with JSON string
-static int jsmn_parse_string(jsmn_parser* parser, const char* js, const unsigned long long len, jsmntok_t* tokens, const unsigned long long num_tokens) {
+static int jsmn_parse_string(jsmn_parser* parser, const char* js, const unsigned long long len, jsmntok_t* tokens, const unsigned long long num_tokens, const unsigned int features) {
     jsmntok_t* token;
     int start = parser->pos;
 
@@ -783,6 +1542,10 @@ static int jsmn_parse_string(jsmn_parser* parser, const char* js, const unsigned
     parser->pos++;
 
     for (; parser->pos < len && js[parser->pos] != '\0'; parser->pos++) {
+        parser->pos = (unsigned int)jsmn_scan_string(js, parser->pos, len, features);
+        if (parser->pos >= len || js[parser->pos] == '\0') {
+            break;
+        }
         char c = js[parser->pos];
 
         /* quote: end of string */
@@ -853,13 +1616,14 @@ void jsmn_init(jsmn_parser* parser) {
 	parser->pos = 0;
 	parser->toknext = 0;
 	parser->toksuper = -1;
+	parser->tokopen = -1;
 }
 
 int jsmn_parse(jsmn_parser* parser, const char* js, const unsigned long long len, jsmntok_t* tokens, const unsigned int num_tokens) {
     int r;
-    int i;
     jsmntok_t* token;
     int count = parser->toknext;
+    const unsigned int features = platform_cpu_features();
 
     for (; parser->pos < len && js[parser->pos] != '\0'; parser->pos++) {
         char c;
@@ -885,6 +1649,9 @@ int jsmn_parse(jsmn_parser* parser, const char* js, const unsigned long long len
                     return JSMN_ERROR_INVAL;
                 }
 #endif
+                if (t->size == JSMN_SIZE_MAX) {
+                    return JSMN_ERROR_SIZE;
+                }
                 t->size++;
 #ifdef JSMN_PARENT_LINKS
                 token->parent = parser->toksuper;
@@ -893,6 +1660,10 @@ int jsmn_parse(jsmn_parser* parser, const char* js, const unsigned long long len
             token->type = (c == '{' ? JSMN_OBJECT : JSMN_ARRAY);
             token->start = parser->pos;
             parser->toksuper = parser->toknext - 1;
+
+            /* until it's closed, the next of an object or array links to the one it's inside of */
+            token->next = parser->tokopen;
+            parser->tokopen = parser->toknext - 1;
             break;
         case '}':
         case ']':
@@ -900,60 +1671,32 @@ int jsmn_parse(jsmn_parser* parser, const char* js, const unsigned long long len
                 break;
             }
             type = (c == '}' ? JSMN_OBJECT : JSMN_ARRAY);
-#ifdef JSMN_PARENT_LINKS
-            if (parser->toknext < 1) {
+
+            /* the innermost open object or array is the one being closed, error if unmatched closing bracket */
+            if (parser->tokopen == -1) {
                 return JSMN_ERROR_INVAL;
             }
-            token = &tokens[parser->toknext - 1];
-            for (;;) {
-                if (token->start != -1 && token->end == -1) {
-                    if (token->type != type) {
-                        return JSMN_ERROR_INVAL;
-                    }
-                    token->end = parser->pos + 1;
-                    parser->toksuper = token->parent;
-                    break;
-                }
-                if (token->parent == -1) {
-                    if (token->type != type || parser->toksuper == -1) {
-                        return JSMN_ERROR_INVAL;
-                    }
-                    break;
-                }
-                token = &tokens[token->parent];
-            }
-#else
-            for (i = parser->toknext - 1; i >= 0; i--) {
-                token = &tokens[i];
-                if (token->start != -1 && token->end == -1) {
-                    if (token->type != type) {
-                        return JSMN_ERROR_INVAL;
-                    }
-                    parser->toksuper = -1;
-                    token->end = parser->pos + 1;
-                    break;
-                }
-            }
-            /* error if unmatched closing bracket */
-            if (i == -1) {
+            token = &tokens[parser->tokopen];
+            if (token->type != type) {
                 return JSMN_ERROR_INVAL;
             }
-            for (; i >= 0; i--) {
-                token = &tokens[i];
-                if (token->start != -1 && token->end == -1) {
-                    parser->toksuper = i;
-                    break;
-                }
-            }
-#endif
+            token->end = parser->pos + 1;
+
+            /* the one it was inside of becomes the innermost open one, and the next becomes the token after the subtree */
+            parser->tokopen = token->next;
+            parser->toksuper = token->next;
+            token->next = parser->toknext;
             break;
         case '\"':
-            r = jsmn_parse_string(parser, js, len, tokens, num_tokens);
+            r = jsmn_parse_string(parser, js, len, tokens, num_tokens, features);
             if (r < 0) {
                 return r;
             }
             count++;
             if (parser->toksuper != -1 && tokens != NULL) {
+                if (tokens[parser->toksuper].size == JSMN_SIZE_MAX) {
+                    return JSMN_ERROR_SIZE;
+                }
                 tokens[parser->toksuper].size++;
             }
             break;
@@ -961,6 +1704,8 @@ int jsmn_parse(jsmn_parser* parser, const char* js, const unsigned long long len
         case '\r':
         case '\n':
         case ' ':
+            /* indentation comes in runs, the loop increment lands on the first character after it */
+            parser->pos = (unsigned int)jsmn_scan_whitespace(js, parser->pos + 1, len, features) - 1;
             break;
         case ':':
             parser->toksuper = parser->toknext - 1;
@@ -968,19 +1713,9 @@ int jsmn_parse(jsmn_parser* parser, const char* js, const unsigned long long len
         case ',':
             if (tokens != NULL && parser->toksuper != -1 &&
                 tokens[parser->toksuper].type != JSMN_ARRAY &&
-                tokens[parser->toksuper].type != JSMN_OBJECT) {
-#ifdef JSMN_PARENT_LINKS
-                parser->toksuper = tokens[parser->toksuper].parent;
-#else
-                for (i = parser->toknext - 1; i >= 0; i--) {
-                    if (tokens[i].type == JSMN_ARRAY || tokens[i].type == JSMN_OBJECT) {
-                        if (tokens[i].start != -1 && tokens[i].end == -1) {
-                            parser->toksuper = i;
-                            break;
-                        }
-                    }
-                }
-#endif
+                tokens[parser->toksuper].type != JSMN_OBJECT &&
+                parser->tokopen != -1) {
+                parser->toksuper = parser->tokopen;
             }
             break;
 #ifdef JSMN_STRICT
@@ -1011,12 +1746,15 @@ int jsmn_parse(jsmn_parser* parser, const char* js, const unsigned long long len
             /* in non-strict mode every unquoted value is a primitive */
         default:
 #endif
-            r = jsmn_parse_primitive(parser, js, len, tokens, num_tokens);
+            r = jsmn_parse_primitive(parser, js, len, tokens, num_tokens, features);
             if (r < 0) {
                 return r;
             }
             count++;
             if (parser->toksuper != -1 && tokens != NULL) {
+                if (tokens[parser->toksuper].size == JSMN_SIZE_MAX) {
+                    return JSMN_ERROR_SIZE;
+                }
                 tokens[parser->toksuper].size++;
             }
             break;
@@ -1029,28 +1767,85 @@ int jsmn_parse(jsmn_parser* parser, const char* js, const unsigned long long len
         }
     }
 
-    if (tokens != NULL) {
-        for (i = parser->toknext - 1; i >= 0; i--) {
-            /* unmatched opened object or array */
-            if (tokens[i].start != -1 && tokens[i].end == -1) {
-                return JSMN_ERROR_PART;
-            }
-        }
+    /* unmatched opened object or array */
+    if (tokens != NULL && parser->tokopen != -1) {
+        return JSMN_ERROR_PART;
     }
 
     return count;
 }
-void* gltfmemory_allocate(unsigned long long size, int empty) {
-    void* ptr = malloc(size);
+
+int jsmn_parse_alloc(jsmn_parser* parser, const char* js, const unsigned long long len, jsmntok_t** tokens, unsigned int* num_tokens, const GLTF_Allocator* allocator) {
+    /* gltf json averages a token every 8 to 16 bytes, starting a bit above that avoids most of the growths */
+    if (*tokens == NULL || *num_tokens == 0) {
+        unsigned long long estimate = len / 8 + 64;
+        if (estimate > 0x7FFFFFFF) estimate = 0x7FFFFFFF;
+
+        jsmntok_t* grown = (jsmntok_t*)gltfmemory_reallocate(allocator, *tokens, sizeof(jsmntok_t) * estimate);
+        if (grown == NULL) {
+            return JSMN_ERROR_NOMEM;
+        }
+        *tokens = grown;
+        *num_tokens = (unsigned int)estimate;
+    }
+
+    for (;;) {
+        int r = jsmn_parse(parser, js, len, *tokens, *num_tokens);
+        if (r != JSMN_ERROR_NOMEM) {
+            return r;
+        }
+
+        /* the parser stopped right before the token it could not allocate, it resumes from there */
+        unsigned long long capacity = (unsigned long long)*num_tokens * 2;
+        if (capacity > 0x7FFFFFFF) capacity = 0x7FFFFFFF;
+        if (capacity <= *num_tokens) {
+            return JSMN_ERROR_NOMEM;
+        }
+
+        jsmntok_t* grown = (jsmntok_t*)gltfmemory_reallocate(allocator, *tokens, sizeof(jsmntok_t) * capacity);
+        if (grown == NULL) {
+            return JSMN_ERROR_NOMEM;
+        }
+        *tokens = grown;
+        *num_tokens = (unsigned int)capacity;
+    }
+}
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <pthread.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <sys/time.h>
+    #include <time.h>
+    #include <unistd.h>
+#endif
+
+#if defined(GLTF_SIMD_X86)
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#endif
+
+void* gltfmemory_allocate(const GLTF_Allocator* allocator, unsigned long long size, int empty) {
+    void* ptr = allocator && allocator->allocate ? allocator->allocate(allocator->userData, size) : malloc(size);
     if(empty == 1 && ptr != NULL) memset(ptr, 0, size);
     return ptr;
 }
 
-void gltfmemory_deallocate(void* ptr) {
-    free(ptr);
+void gltfmemory_deallocate(const GLTF_Allocator* allocator, void* ptr) {
+    if (allocator && allocator->deallocate) allocator->deallocate(allocator->userData, ptr);
+    else free(ptr);
 }
 
-void* gltfmemory_reallocate(void* ptr, unsigned long long size) {
+void* gltfmemory_reallocate(const GLTF_Allocator* allocator, void* ptr, unsigned long long size) {
+    if (allocator && allocator->reallocate) return allocator->reallocate(allocator->userData, ptr, size);
     return realloc(ptr, size);
 }
 
@@ -1081,18 +1876,98 @@ int gltfmemory_cmp(const void* s1, const void* s2, unsigned long long n) {
     return 0; // all n bytes were equal
 }
 
-int platform_fileread(const char* path, unsigned long long* size, void** data) {
-    if (!path || !size || !data) {
-        return 0;
+// every allocation is aligned to this, the chunk header included
+#define GLTF_ARENA_ALIGNMENT 16
+#define GLTF_ARENA_HEADER_SIZE ((sizeof(GLTF_Arena) + GLTF_ARENA_ALIGNMENT - 1) & ~(unsigned long long)(GLTF_ARENA_ALIGNMENT - 1))
+
+GLTF_Arena* gltfarena_create(const GLTF_Allocator* allocator) {
+    GLTF_Arena* arena = (GLTF_Arena*)gltfmemory_allocate(allocator, GLTF_ARENA_HEADER_SIZE + GLTF_ARENA_CHUNK_SIZE, 0);
+    if (!arena) return NULL;
+
+    arena->next = NULL;
+    arena->used = 0;
+    arena->capacity = GLTF_ARENA_CHUNK_SIZE;
+    if (allocator) arena->allocator = *allocator;
+    else memset(&arena->allocator, 0, sizeof(GLTF_Allocator));
+    return arena;
+}
+
+void* gltfarena_allocate(GLTF_Arena** arena, unsigned long long size, int empty) {
+    size = (size + GLTF_ARENA_ALIGNMENT - 1) & ~(unsigned long long)(GLTF_ARENA_ALIGNMENT - 1);
+
+    GLTF_Arena* chunk = *arena;
+    if (!chunk || chunk->capacity - chunk->used < size) {
+        // chunks double in size so the count stays logarithmic, a bigger allocation gets a chunk on its own
+        unsigned long long capacity = chunk ? chunk->capacity * 2 : GLTF_ARENA_CHUNK_SIZE;
+        if (capacity > GLTF_ARENA_CHUNK_SIZE_MAX) capacity = GLTF_ARENA_CHUNK_SIZE_MAX;
+        if (capacity < size) capacity = size;
+
+        // new chunks come from the same allocator as the newest one
+        GLTF_Arena* grown = (GLTF_Arena*)gltfmemory_allocate(chunk ? &chunk->allocator : NULL, GLTF_ARENA_HEADER_SIZE + capacity, 0);
+        if (!grown) return NULL;
+
+        grown->used = 0;
+        grown->capacity = capacity;
+        if (chunk) grown->allocator = chunk->allocator;
+        else memset(&grown->allocator, 0, sizeof(GLTF_Allocator));
+
+        // an oversized allocation goes behind the newest chunk, which keeps the room it has left
+        if (chunk && capacity == size && chunk->capacity - chunk->used > 0) {
+            grown->used = size;
+            grown->next = chunk->next;
+            chunk->next = grown;
+            void* ptr = (unsigned char*)grown + GLTF_ARENA_HEADER_SIZE;
+            if (empty == 1) memset(ptr, 0, size);
+            return ptr;
+        }
+
+        grown->next = chunk;
+        *arena = chunk = grown;
     }
 
-    FILE* file = fopen(path, "rb");
-    if (!file) {
-        return 0;
+    void* ptr = (unsigned char*)chunk + GLTF_ARENA_HEADER_SIZE + chunk->used;
+    chunk->used += size;
+    if (empty == 1) memset(ptr, 0, size);
+    return ptr;
+}
+
+void gltfarena_merge(GLTF_Arena** arena, GLTF_Arena* other) {
+    if (!other) return;
+    if (!*arena) {
+        *arena = other;
+        return;
     }
 
-    // Detect file size if not provided
-    unsigned long long fileSize = *size;
+    GLTF_Arena* last = other;
+    while (last->next) last = last->next;
+
+    last->next = (*arena)->next;
+    (*arena)->next = other;
+}
+
+void gltfarena_release(GLTF_Arena** arena) {
+    GLTF_Arena* chunk = *arena;
+    while (chunk) {
+        GLTF_Arena* next = chunk->next;
+        GLTF_Allocator allocator = chunk->allocator;
+        gltfmemory_deallocate(&allocator, chunk);
+        chunk = next;
+    }
+    *arena = NULL;
+}
+
+int platform_fileread(const char* path, unsigned long long* size, void** data, const GLTF_Allocator* allocator) {
+    if (!path || !size || !data) {
+        return 0;
+    }
+
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return 0;
+    }
+
+    // Detect file size if not provided
+    unsigned long long fileSize = *size;
     if (fileSize == 0) {
         fseek(file, 0, SEEK_END);
         long long length = ftell(file);  // 64-bit offset
@@ -1109,7 +1984,8 @@ int platform_fileread(const char* path, unsigned long long* size, void** data) {
         return 0;
     }
 
-    char* fileData = (char*)gltfmemory_allocate(fileSize, 1);
+    // no need to zero the memory, fread overwrites every byte of it
+    char* fileData = (char*)gltfmemory_allocate(allocator, fileSize, 0);
     if (!fileData) {
         fclose(file);
         return 0;
@@ -1119,7 +1995,7 @@ int platform_fileread(const char* path, unsigned long long* size, void** data) {
     fclose(file);
 
     if (readSize != fileSize) {
-        gltfmemory_deallocate(fileData);
+        gltfmemory_deallocate(allocator, fileData);
         return 0;
     }
 
@@ -1128,6 +2004,321 @@ int platform_fileread(const char* path, unsigned long long* size, void** data) {
     return 1;
 }
 
+int platform_filereadrange(const char* path, unsigned long long offset, unsigned long long size, void* dst) {
+    if (!path || !dst) {
+        return 0;
+    }
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return 0;
+    }
+
+    LARGE_INTEGER position;
+    position.QuadPart = (LONGLONG)offset;
+    if (!SetFilePointerEx(file, position, NULL, FILE_BEGIN)) {
+        CloseHandle(file);
+        return 0;
+    }
+
+    // ReadFile is limited to 32 bits sizes
+    unsigned char* out = (unsigned char*)dst;
+    while (size > 0) {
+        DWORD chunk = size > 0x40000000ull ? 0x40000000u : (DWORD)size;
+        DWORD readSize = 0;
+        if (!ReadFile(file, out, chunk, &readSize, NULL) || readSize == 0) {
+            CloseHandle(file);
+            return 0;
+        }
+        out += readSize;
+        size -= readSize;
+    }
+
+    CloseHandle(file);
+    return 1;
+#else
+    int file = open(path, O_RDONLY);
+    if (file < 0) {
+        return 0;
+    }
+
+    if (lseek(file, (off_t)offset, SEEK_SET) == (off_t)-1) {
+        close(file);
+        return 0;
+    }
+
+    // read may return less than asked, keep going until the range is complete
+    unsigned char* out = (unsigned char*)dst;
+    while (size > 0) {
+        size_t chunk = size > 0x40000000ull ? 0x40000000u : (size_t)size;
+        ssize_t readSize = read(file, out, chunk);
+        if (readSize <= 0) {
+            close(file);
+            return 0;
+        }
+        out += readSize;
+        size -= (unsigned long long)readSize;
+    }
+
+    close(file);
+    return 1;
+#endif
+}
+
+int platform_filemap(const char* path, int sequential, unsigned long long* size, void** data) {
+    if (!path || !size || !data) {
+        return 0;
+    }
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, sequential ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return 0;
+    }
+
+    LARGE_INTEGER length;
+    if (!GetFileSizeEx(file, &length) || length.QuadPart <= 0) {
+        CloseHandle(file);
+        return 0;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mapping) {
+        return 0;
+    }
+
+    // the view keeps the mapping alive, so the handle can be closed right away
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!view) {
+        return 0;
+    }
+
+    *size = (unsigned long long)length.QuadPart;
+    *data = view;
+    return 1;
+#else
+    int file = open(path, O_RDONLY);
+    if (file < 0) {
+        return 0;
+    }
+
+    struct stat info;
+    if (fstat(file, &info) != 0 || info.st_size <= 0 || (unsigned long long)info.st_size > SIZE_MAX) {
+        close(file);
+        return 0;
+    }
+
+    // the mapping keeps a reference to the file, so the descriptor can be closed right away
+    void* view = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    if (view == MAP_FAILED) {
+        return 0;
+    }
+
+    // files accessed in any order, like lazy buffers, keep the default read ahead of the pages around each fault
+#if defined(MADV_SEQUENTIAL)
+    if (sequential) madvise(view, (size_t)info.st_size, MADV_SEQUENTIAL);
+#endif
+
+    *size = (unsigned long long)info.st_size;
+    *data = view;
+    return 1;
+#endif
+}
+
+void platform_fileunmap(void* data, unsigned long long size) {
+    if (!data) return;
+
+#if defined(_WIN32)
+    (void)size;
+    UnmapViewOfFile(data);
+#else
+    munmap(data, (size_t)size);
+#endif
+}
+
+#if defined(GLTF_SIMD_X86)
+/// @brief executes the cpuid instruction
+static void internal_cpuid(unsigned int leaf, unsigned int subleaf, unsigned int regs[4]) {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuidex(info, (int)leaf, (int)subleaf);
+    regs[0] = (unsigned int)info[0]; regs[1] = (unsigned int)info[1]; regs[2] = (unsigned int)info[2]; regs[3] = (unsigned int)info[3];
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+/// @brief reads the extended control register, tells which register states the operating system saves
+static unsigned long long internal_xgetbv() {
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    unsigned int eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((unsigned long long)edx << 32) | eax;
+#endif
+}
+#endif
+
+unsigned int platform_cpu_features() {
+    static int s_detected = 0;
+    static unsigned int s_features = 0;
+    if (s_detected) return s_features;
+
+    unsigned int features = 0;
+
+#if defined(GLTF_SIMD_X86)
+    unsigned int regs[4];
+    internal_cpuid(0, 0, regs);
+    unsigned int maxLeaf = regs[0];
+
+    if (maxLeaf >= 1) {
+        internal_cpuid(1, 0, regs);
+        if (regs[3] & (1u << 26)) features |= CPU_FEATURE_SSE2;
+        if (regs[2] & (1u << 9)) features |= CPU_FEATURE_SSSE3;
+        if (regs[2] & (1u << 19)) features |= CPU_FEATURE_SSE41;
+        if (regs[2] & (1u << 20)) features |= CPU_FEATURE_SSE42;
+
+        // avx2 also requires the operating system to save the ymm registers
+        int osxsave = (regs[2] & (1u << 27)) != 0;
+        int avx = (regs[2] & (1u << 28)) != 0;
+        if (maxLeaf >= 7 && osxsave && avx && (internal_xgetbv() & 0x6) == 0x6) {
+            internal_cpuid(7, 0, regs);
+            if (regs[1] & (1u << 5)) features |= CPU_FEATURE_AVX2;
+        }
+    }
+#endif
+
+    s_features = features;
+    s_detected = 1;
+    return features;
+}
+
+unsigned int platform_cpu_count() {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (unsigned int)info.dwNumberOfProcessors : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (unsigned int)count : 1;
+#endif
+}
+
+double platform_time() {
+#if defined(_WIN32)
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+#else
+    // strict iso builds hides clock_gettime, the wall clock is the fallback
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    return (double)now.tv_sec + (double)now.tv_usec * 1e-6;
+#endif
+}
+
+long long platform_atomic_add(volatile long long* value, long long amount) {
+#if defined(_WIN32)
+    return InterlockedExchangeAdd64((volatile LONG64*)value, amount);
+#else
+    return __sync_fetch_and_add(value, amount);
+#endif
+}
+
+long long platform_atomic_min(volatile long long* value, long long candidate) {
+    long long current = platform_atomic_add(value, 0);
+    while (candidate < current) {
+#if defined(_WIN32)
+        long long previous = InterlockedCompareExchange64((volatile LONG64*)value, candidate, current);
+#else
+        long long previous = __sync_val_compare_and_swap(value, current, candidate);
+#endif
+        if (previous == current) break;
+        current = previous;
+    }
+    return current;
+}
+
+/// @brief the state shared by every thread of a parallel for
+typedef struct {
+    platform_task task;
+    void* taskData;
+    unsigned long long count;
+    volatile long long next;
+} internal_parallel_work;
+
+/// @brief keeps taking indices until none are left
+static void internal_parallel_run(internal_parallel_work* work) {
+    for (;;) {
+        unsigned long long index = (unsigned long long)platform_atomic_add(&work->next, 1);
+        if (index >= work->count) return;
+        work->task(work->taskData, index);
+    }
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI internal_parallel_thread(LPVOID param) {
+    internal_parallel_run((internal_parallel_work*)param);
+    return 0;
+}
+#else
+static void* internal_parallel_thread(void* param) {
+    internal_parallel_run((internal_parallel_work*)param);
+    return NULL;
+}
+#endif
+
+void platform_parallel_for(unsigned int threadCount, unsigned long long count, platform_task task, void* taskData, const GLTF_Allocator* allocator) {
+    if (count == 0) return;
+
+    if (threadCount == 0) threadCount = platform_cpu_count();
+    if (threadCount > count) threadCount = (unsigned int)count;
+
+    internal_parallel_work work;
+    work.task = task;
+    work.taskData = taskData;
+    work.count = count;
+    work.next = 0;
+
+    // the calling thread is one of the workers
+    unsigned int workers = 0;
+#if defined(_WIN32)
+    HANDLE* threads = threadCount > 1 ? (HANDLE*)gltfmemory_allocate(allocator, sizeof(HANDLE) * (threadCount - 1), 0) : NULL;
+    for (unsigned int i = 0; threads && i < threadCount - 1; ++i) {
+        threads[workers] = CreateThread(NULL, 0, internal_parallel_thread, &work, 0, NULL);
+        if (threads[workers]) workers++;
+    }
+#else
+    pthread_t* threads = threadCount > 1 ? (pthread_t*)gltfmemory_allocate(allocator, sizeof(pthread_t) * (threadCount - 1), 0) : NULL;
+    for (unsigned int i = 0; threads && i < threadCount - 1; ++i) {
+        if (pthread_create(&threads[workers], NULL, internal_parallel_thread, &work) == 0) workers++;
+    }
+#endif
+
+    // when threads can't be created the calling thread simply does all the work
+    internal_parallel_run(&work);
+
+    for (unsigned int i = 0; i < workers; ++i) {
+#if defined(_WIN32)
+        WaitForSingleObject(threads[i], INFINITE);
+        CloseHandle(threads[i]);
+#else
+        pthread_join(threads[i], NULL);
+#endif
+    }
+    gltfmemory_deallocate(allocator, threads);
+}
+
 void* strncpy_impl(void* dest, const char* src, unsigned long long size) {
     char* d = (char*)dest;
     unsigned long long i;
@@ -1173,1767 +2364,5275 @@ char* strchr_impl(const char* str, int c) {
 
     return NULL;
 }
-int json_strncmp(const char* data, const jsmntok_t* tok, const char* str) {
-	if (tok->type != JSMN_STRING) return -1; 
+#if defined(GLTF_SIMD_X86)
+#include <immintrin.h>
+#endif
 
-	unsigned long long strLen = strlen(str);
-	unsigned long long nameLength = (unsigned long long)(tok->end - tok->start);
-	return strncmp_impl((const char*)data + tok->start, str, strLen);
-}
+/// @brief marks the padding character
+#define BASE64_PAD 0xFE
+
+/// @brief marks the backslash of a json escaped slash, which is skipped
+#define BASE64_SKIP 0xFD
+
+/// @brief maps every character to it's 6 bits value, 0xFF are invalid characters
+static const unsigned char s_gBase64Table[256] = {
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+	0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
+	0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+	0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+	0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
 
-int json_to_bool(const char* data, const jsmntok_t* tok) {
-	int size = (int)(tok->end - tok->start);
-	return size == 4 && gltfmemory_cmp(data + tok->start, "true", 4) == 0;
-}
+/// @brief decodes base64 characters one at a time, also handles padding and escaped slashes
+/// @param src the base64 characters
+/// @param length how many characters src has
+/// @param dst where the decoded bytes are written into
+/// @param outSize how many bytes were decoded
+/// @return 1 on success, 0 on invalid input
+static int internal_base64_decode_scalar(const unsigned char* src, unsigned long long length, unsigned char* dst, unsigned long long* outSize) {
+	unsigned int accumulator = 0;
+	int sextets = 0;
+	unsigned long long o = 0;
+
+	for (unsigned long long i = 0; i < length; ++i) {
+		unsigned char value = s_gBase64Table[src[i]];
+
+		if (value < 64) {
+			accumulator = (accumulator << 6) | value;
+			if (++sextets == 4) {
+				dst[o++] = (unsigned char)(accumulator >> 16);
+				dst[o++] = (unsigned char)(accumulator >> 8);
+				dst[o++] = (unsigned char)accumulator;
+				accumulator = 0;
+				sextets = 0;
+			}
+		}
+		else if (value == BASE64_SKIP) continue;
+		else if (value == BASE64_PAD) break;
+		else return 0;
+	}
 
-int json_to_int(const char* data, const jsmntok_t* tok) {
-	if (tok->type != JSMN_PRIMITIVE) return -1;
+	// a single leftover character can't represent a byte
+	if (sextets == 1) return 0;
+	if (sextets == 2) {
+		dst[o++] = (unsigned char)(accumulator >> 4);
+	}
+	else if (sextets == 3) {
+		dst[o++] = (unsigned char)(accumulator >> 10);
+		dst[o++] = (unsigned char)(accumulator >> 2);
+	}
 
-	char tmp[128];
-	int size = (unsigned long long)(tok->end - tok->start) < sizeof(tmp) ? (int)(tok->end - tok->start) : (int)(sizeof(tmp) - 1);
-	strncpy_impl(tmp, (const char*)data + tok->start, size);
-	tmp[size] = 0;
-	return atoi(tmp);
+	*outSize = o;
+	return 1;
 }
 
-float json_to_float(const char* data, const jsmntok_t* tok) {
-	if (tok->type != JSMN_PRIMITIVE) return -1;
+#if defined(GLTF_SIMD_X86)
+
+/// @brief decodes blocks of 16 characters into 12 bytes, stops at the first block with anything other than the base64 alphabet
+/// @param src the base64 characters, advanced past the decoded blocks
+/// @param length how many characters remains in src, updated accordingly
+/// @param dst where the decoded bytes are written into, advanced past the written bytes
+GLTF_TARGET("ssse3") static void internal_base64_decode_ssse3(const unsigned char** src, unsigned long long* length, unsigned char** dst) {
+	const __m128i lutLow = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+	const __m128i lutHigh = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+	const __m128i lutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+	const __m128i mask2F = _mm_set1_epi8(0x2F);
+	const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+	// each store writes 16 bytes but only 12 are decoded, the remaining characters guarantee the extra bytes are inside dst
+	while (*length >= 24) {
+		__m128i str = _mm_loadu_si128((const __m128i*)*src);
+
+		// classify the characters by their nibbles, any invalid character has a bit in common in both lookups
+		const __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(str, 4), mask2F);
+		const __m128i lowNibbles = _mm_and_si128(str, mask2F);
+		const __m128i high = _mm_shuffle_epi8(lutHigh, highNibbles);
+		const __m128i low = _mm_shuffle_epi8(lutLow, lowNibbles);
+		if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(low, high), _mm_setzero_si128())) != 0) {
+			return;
+		}
+
+		// translate the characters into their 6 bits values, '/' shares the high nibble with '+' and needs it's own offset
+		const __m128i eq2F = _mm_cmpeq_epi8(str, mask2F);
+		const __m128i roll = _mm_shuffle_epi8(lutRoll, _mm_add_epi8(eq2F, highNibbles));
+		str = _mm_add_epi8(str, roll);
+
+		// merge the 6 bits values into 24 bits groups and pack them together
+		const __m128i merged = _mm_maddubs_epi16(str, _mm_set1_epi32(0x01400140));
+		const __m128i out = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+		_mm_storeu_si128((__m128i*)*dst, _mm_shuffle_epi8(out, pack));
+
+		*src += 16;
+		*length -= 16;
+		*dst += 12;
+	}
+}
 
-	char tmp[128];
-	int size = (unsigned long long)(tok->end - tok->start) < sizeof(tmp) ? (int)(tok->end - tok->start) : (int)(sizeof(tmp) - 1);
-	strncpy_impl(tmp, (const char*)data + tok->start, size);
-	tmp[size] = 0;
-	return (float)atof(tmp);
+/// @brief decodes blocks of 32 characters into 24 bytes, stops at the first block with anything other than the base64 alphabet
+/// @param src the base64 characters, advanced past the decoded blocks
+/// @param length how many characters remains in src, updated accordingly
+/// @param dst where the decoded bytes are written into, advanced past the written bytes
+GLTF_TARGET("avx2") static void internal_base64_decode_avx2(const unsigned char** src, unsigned long long* length, unsigned char** dst) {
+	const __m256i lutLow = _mm256_setr_epi8(
+		0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+		0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+	const __m256i lutHigh = _mm256_setr_epi8(
+		0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+	const __m256i lutRoll = _mm256_setr_epi8(
+		0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+	const __m256i mask2F = _mm256_set1_epi8(0x2F);
+	const __m256i pack = _mm256_setr_epi8(
+		2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+		2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+	const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1);
+
+	// each store writes 32 bytes but only 24 are decoded, the remaining characters guarantee the extra bytes are inside dst
+	while (*length >= 45) {
+		__m256i str = _mm256_loadu_si256((const __m256i*)*src);
+
+		const __m256i highNibbles = _mm256_and_si256(_mm256_srli_epi32(str, 4), mask2F);
+		const __m256i lowNibbles = _mm256_and_si256(str, mask2F);
+		const __m256i high = _mm256_shuffle_epi8(lutHigh, highNibbles);
+		const __m256i low = _mm256_shuffle_epi8(lutLow, lowNibbles);
+		if (_mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_and_si256(low, high), _mm256_setzero_si256())) != 0) {
+			return;
+		}
+
+		const __m256i eq2F = _mm256_cmpeq_epi8(str, mask2F);
+		const __m256i roll = _mm256_shuffle_epi8(lutRoll, _mm256_add_epi8(eq2F, highNibbles));
+		str = _mm256_add_epi8(str, roll);
+
+		// same as the ssse3 version, but each 128 bits lane is packed on it's own and then the lanes are joined
+		const __m256i merged = _mm256_maddubs_epi16(str, _mm256_set1_epi32(0x01400140));
+		__m256i out = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+		out = _mm256_shuffle_epi8(out, pack);
+		out = _mm256_permutevar8x32_epi32(out, lanes);
+		_mm256_storeu_si256((__m256i*)*dst, out);
+
+		*src += 32;
+		*length -= 32;
+		*dst += 24;
+	}
 }
 
-unsigned long long json_to_size(const char* data, const jsmntok_t* tok) {
-	if (tok->type != JSMN_PRIMITIVE) return -1;
+#endif
 
-	char tmp[128];
-	int size = (unsigned long long)(tok->end - tok->start) < sizeof(tmp) ? (int)(tok->end - tok->start) : (int)(sizeof(tmp) - 1);
-	strncpy_impl(tmp, (const char*)data + tok->start, size);
-	tmp[size] = 0;
-	long long res = atoll(tmp);
-	return res < 0 ? 0 : (unsigned long long)res;
+unsigned long long base64_decoded_size(unsigned long long length) {
+	return (length / 4) * 3 + 3;
 }
 
-int json_parse_string(const char* data, const jsmntok_t* tokens, int i, char** outString) {
-	if (tokens[i].type != JSMN_STRING) return -1;
+int base64_decode(const char* src, unsigned long long length, void* dst, unsigned long long* outSize) {
+	const unsigned char* s = (const unsigned char*)src;
+	unsigned char* o = (unsigned char*)dst;
 
-	int size = (int)(tokens[i].end - tokens[i].start);
-	char* result = (char*)gltfmemory_allocate(size + 1, 0);
-	if (!result) return -1;
+#if defined(GLTF_SIMD_X86)
+	// the vectorized loops only consumes whole blocks, whatever is left (padding, escapes, tail) goes through the scalar loop
+	unsigned int features = platform_cpu_features();
+	if (features & CPU_FEATURE_AVX2) internal_base64_decode_avx2(&s, &length, &o);
+	if (features & CPU_FEATURE_SSSE3) internal_base64_decode_ssse3(&s, &length, &o);
+#endif
 
-	strncpy_impl(result, (const char*)data + tokens[i].start, size);
-	result[size] = 0;
-	*outString = result;
-	return i + 1;
+	unsigned long long tailSize = 0;
+	if (!internal_base64_decode_scalar(s, length, o, &tailSize)) {
+		return 0;
+	}
+
+	*outSize = (unsigned long long)(o - (unsigned char*)dst) + tailSize;
+	return 1;
 }
+/// @brief how many digits the exact conversion keeps, any further digit only matters as being zero or not
+#define NUMBER_MAX_DIGITS 800
 
-int json_parse_array(const char* data, const jsmntok_t* tokens, int i, unsigned long long elementSize, void** outArr, unsigned long long* outSize) { 
-	if (tokens[i].type != JSMN_ARRAY) return -1;
+/// @brief the fast paths need every float and double operation to be rounded right away, not kept in higher precision
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+	#define NUMBER_FAST_PATH
+#endif
 
-	int size = tokens[i].size;
-	void* result = gltfmemory_allocate(elementSize * size, 1);
-	if (!result) return -1;
+/// @brief the pieces of a json number
+typedef struct {
+	int negative;
+	const char* integer;                // integer digits
+	unsigned long long integerLength;
+	const char* fraction;               // fraction digits, may be empty
+	unsigned long long fractionLength;
+	long long exponent;                 // the explicit exponent, clamped to a magnitude that can't wrap around
+} internal_number;
+
+/// @brief an arbitrary precision decimal, used when the fast paths can't guarantee the exact rounding
+typedef struct {
+	unsigned char d[NUMBER_MAX_DIGITS]; // digits values, most significant first
+	int nd;                             // how many digits are used
+	int dp;                             // where the decimal point is, relative to the first digit
+	int trunc;                          // 1 if non zero digits were discarded after d[nd - 1]
+} internal_decimal;
+
+#if defined(NUMBER_FAST_PATH)
+/// @brief powers of ten exactly representable as a float
+static const float s_gPow10f[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+/// @brief powers of ten exactly representable as a double
+static const double s_gPow10[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+#endif
 
-	*outArr = result;
-	*outSize = size;
-	return i + 1;
-}
+/// @brief splits a json number into it's pieces, following the json grammar strictly
+/// @param str the number characters
+/// @param length how many characters str has
+/// @param outNumber the number pieces
+/// @return 1 if every character belongs to a valid json number, 0 otherwise
+static int internal_number_scan(const char* str, unsigned long long length, internal_number* outNumber) {
+	unsigned long long i = 0;
+
+	outNumber->negative = 0;
+	if (i < length && str[i] == '-') {
+		outNumber->negative = 1;
+		++i;
+	}
 
-int json_parse_array_float(const char* data, const jsmntok_t* tokens, int i, float* outArray, int size) {
-	if (tokens[i].type != JSMN_ARRAY) return -1;
-	if (tokens[i].size != size) return -1;
+	// json allows neither a missing integer part nor leading zeros
+	if (i >= length || str[i] < '0' || str[i] > '9') return 0;
+	outNumber->integer = str + i;
+	if (str[i] == '0') ++i;
+	else while (i < length && str[i] >= '0' && str[i] <= '9') ++i;
+	outNumber->integerLength = (unsigned long long)(str + i - outNumber->integer);
 
-	++i;
-	for (int j = 0; j < size; ++j) {
-		if (tokens[i].type != JSMN_PRIMITIVE) return -1;
-		outArray[j] = json_to_float(data, tokens + i);
+	outNumber->fraction = str + i;
+	outNumber->fractionLength = 0;
+	if (i < length && str[i] == '.') {
 		++i;
+		outNumber->fraction = str + i;
+		while (i < length && str[i] >= '0' && str[i] <= '9') ++i;
+		outNumber->fractionLength = (unsigned long long)(str + i - outNumber->fraction);
+		if (outNumber->fractionLength == 0) return 0;
 	}
-	return i;
-}
 
-int json_parse_array_string(const char* data, const jsmntok_t* tokens, int i, char*** outArr, unsigned long long* outSize) {
-	if (tokens[i].type != JSMN_ARRAY) return -1;
-	i = json_parse_array(data, tokens, i, sizeof(char*), (void**)outArr, outSize);
-	if (i < 0) return i;
+	outNumber->exponent = 0;
+	if (i < length && (str[i] == 'e' || str[i] == 'E')) {
+		++i;
+		int negativeExponent = 0;
+		if (i < length && (str[i] == '+' || str[i] == '-')) {
+			negativeExponent = str[i] == '-';
+			++i;
+		}
 
-	for (unsigned long long j = 0; j < *outSize; ++j) {
-		i = json_parse_string(data, tokens, i, j + (*outArr));
-		if (i < 0) return i;
+		if (i >= length || str[i] < '0' || str[i] > '9') return 0;
+		while (i < length && str[i] >= '0' && str[i] <= '9') {
+			// anything this big already overflows or underflows a float
+			if (outNumber->exponent < 100000) outNumber->exponent = outNumber->exponent * 10 + (str[i] - '0');
+			++i;
+		}
+		if (negativeExponent) outNumber->exponent = -outNumber->exponent;
 	}
-	return i;
+
+	return i == length;
 }
 
-int json_parse_skip(const jsmntok_t* tokens, int i) {
-	int end = i + 1;
+/// @brief removes the trailing zeros of a decimal
+static void internal_decimal_trim(internal_decimal* a) {
+	while (a->nd > 0 && a->d[a->nd - 1] == 0) a->nd--;
+	if (a->nd == 0) a->dp = 0;
+}
 
-	while (i < end) {
-		switch (tokens[i].type)
-		{
-			case JSMN_OBJECT: { end += tokens[i].size * 2; break; }
-			case JSMN_ARRAY: { end += tokens[i].size; break; }
-			case JSMN_PRIMITIVE:
-			case JSMN_STRING: break;
-			default: return -1;
+/// @brief divides a decimal by 2^k, k must be at most 28
+static void internal_decimal_right_shift(internal_decimal* a, unsigned int k) {
+	int r = 0;
+	int w = 0;
+	unsigned long long n = 0;
+
+	// picks up enough leading digits to produce the first output digit
+	for (; (n >> k) == 0; r++) {
+		if (r >= a->nd) {
+			if (n == 0) {
+				a->nd = 0;
+				return;
+			}
+			while ((n >> k) == 0) {
+				n *= 10;
+				r++;
+			}
+			break;
 		}
-		i++;
+		n = n * 10 + a->d[r];
 	}
-	return i;
-}
-/// @macro for checking token type
-#define CHECK_TKTYPE(tk, tktype) if ((tk).type != (tktype)) { return GLTF_JsonInvalid; }
-
-/// @macro for checking token key
-#define CHECK_TKKEY(tk) if ((tk).type != JSMN_STRING || (tk).size == 0) { return GLTF_JsonInvalid; }
+	a->dp -= r - 1;
 
-/// @macro expected GLB header size
-#define GLB_HEADER_SIZE 12
+	unsigned long long mask = (1ull << k) - 1;
+	for (; r < a->nd; r++) {
+		unsigned char c = a->d[r];
+		a->d[w++] = (unsigned char)(n >> k);
+		n = (n & mask) * 10 + c;
+	}
 
-/// @macro expected GLB header chunk size
-#define GLB_CHUNK_HEADER_SIZE 8
+	// the remainder produces the remaining digits
+	while (n > 0) {
+		unsigned char digit = (unsigned char)(n >> k);
+		n &= mask;
+		if (w < NUMBER_MAX_DIGITS) a->d[w++] = digit;
+		else if (digit > 0) a->trunc = 1;
+		n *= 10;
+	}
 
-/// @macro little-endian "glTF" 
-#define GLB_MAGIC 0x46546C67 
+	a->nd = w;
+	internal_decimal_trim(a);
+}
 
-/// @macro "JSON" em little-endian
-#define JSON_CHUNK_TYPE 0x4E4F534A
+/// @brief multiplies a decimal by 2^k, k must be at most 28
+static void internal_decimal_left_shift(internal_decimal* a, unsigned int k) {
+	// each shifted bit adds at most log10(2) digits
+	int delta = (int)(k * 3 / 10 + 1);
+	int w = a->nd + delta;
+	unsigned long long n = 0;
+
+	// digits are produced from the least significant one, always ahead of the digits still being read
+	for (int r = a->nd - 1; r >= 0; r--) {
+		n += (unsigned long long)a->d[r] << k;
+		unsigned long long quotient = n / 10;
+		unsigned char remainder = (unsigned char)(n - 10 * quotient);
+		w--;
+		if (w < NUMBER_MAX_DIGITS) a->d[w] = remainder;
+		else if (remainder != 0) a->trunc = 1;
+		n = quotient;
+	}
 
-/// @macro little-endian "BIN"
-#define BIN_CHUNK_TYPE 0x004E4942
+	while (n > 0) {
+		unsigned long long quotient = n / 10;
+		unsigned char remainder = (unsigned char)(n - 10 * quotient);
+		w--;
+		if (w < NUMBER_MAX_DIGITS) a->d[w] = remainder;
+		else if (remainder != 0) a->trunc = 1;
+		n = quotient;
+	}
 
-/// @brief hold all errors that has happened when parsing
-static char s_gErrors[GLTF_LOG_BUFFER_SIZE] = { 0 };
+	a->nd += delta;
+	if (a->nd > NUMBER_MAX_DIGITS) a->nd = NUMBER_MAX_DIGITS;
+	a->dp += delta;
 
-// log an error message (appends to the buffer with newline)
-void internal_log_error(const char* format, ...) {
-	va_list args;
-	va_start(args, format);
+	// delta may have overestimated the new digits, w is where the first one landed
+	if (w > 0) {
+		for (int i = w; i < a->nd; i++) a->d[i - w] = a->d[i];
+		a->nd -= w;
+		a->dp -= w;
+	}
+	internal_decimal_trim(a);
+}
 
-	size_t currentLen = strlen(s_gErrors);
-	size_t remainingSpace = GLTF_LOG_BUFFER_SIZE - currentLen - 1; // -1 for null terminator
+/// @brief multiplies (k > 0) or divides (k < 0) a decimal by 2^k
+static void internal_decimal_shift(internal_decimal* a, int k) {
+	if (a->nd == 0) return;
 
-	if (remainingSpace > 1) {  // need space for at least 1 char + null terminator
-		if (currentLen > 0) {
-			s_gErrors[currentLen] = '\n';
-			currentLen++;
-			remainingSpace--;
+	if (k > 0) {
+		while (k > 28) {
+			internal_decimal_left_shift(a, 28);
+			k -= 28;
 		}
-
-		vsnprintf(s_gErrors + currentLen, remainingSpace, format, args);
-		s_gErrors[GLTF_LOG_BUFFER_SIZE - 1] = '\0'; // ensure null-termination
+		internal_decimal_left_shift(a, (unsigned int)k);
+	}
+	else if (k < 0) {
+		while (k < -28) {
+			internal_decimal_right_shift(a, 28);
+			k += 28;
+		}
+		internal_decimal_right_shift(a, (unsigned int)-k);
 	}
-	va_end(args);
 }
 
-// @brief assertions
-#ifdef GLTF_ENABLE_ASSERTS
-#include <assert.h>
-#define GLTF_ASSERT(exp, msg) \
-    do { \
-        if (!(exp)) { \
-			internal_log_error(msg); \
-            fprintf(stderr, "[GLTF:Assertion] %s\n", msg); \
-            abort(); \
-        } \
-    } while (0)
-#else
-#define GLTF_ASSERT(exp, msg) \
-	if(!(exp)) { \
-		internal_log_error(msg); \
-		return -1; \
+/// @brief tells if rounding a decimal to nd digits rounds up, ties goes to even
+static int internal_decimal_round_up(const internal_decimal* a, int nd) {
+	if (nd < 0 || nd >= a->nd) return 0;
+
+	// exactly halfway, unless there are discarded digits
+	if (a->d[nd] == 5 && nd + 1 == a->nd) {
+		if (a->trunc) return 1;
+		return nd > 0 && (a->d[nd - 1] % 2) == 1;
 	}
-#endif
+	return a->d[nd] >= 5;
+}
 
-/// @macro for converting index into a pointer 
-#define PTR_TO_INDEX(type, idx) (type*)((unsigned long long)idx + 1)
+/// @brief extracts the integer part of a decimal, rounded
+static unsigned long long internal_decimal_rounded_integer(const internal_decimal* a) {
+	if (a->dp > 20) return 0xFFFFFFFFFFFFFFFFull;
 
-/// @macro null check, bounds check and pointer adjustment.
-#define PTR_FIX(var, data, size) do { \
-    if (var) { \
-        unsigned long long index = (size_t)((uintptr_t)var - 1); \
-        if (index >= size) { \
-            internal_log_error("Invalid pointer index %zu (max %zu)", index, size); \
-            return 0; \
-        } \
-        var = &(data)[index]; \
-    } \
-} while (0)
+	int i = 0;
+	unsigned long long n = 0;
+	for (; i < a->dp && i < a->nd; i++) n = n * 10 + a->d[i];
+	for (; i < a->dp; i++) n *= 10;
 
-/// @macro same as PTR_FIX but enforces not nullptr, for required fields
-#define PTR_FIX_REQUIRED(var, data, size) do { \
-    size_t index = (size_t)((uintptr_t)var - 1); \
-    if (!var || index >= size) { \
-        internal_log_error("Required pointer invalid (index %zu, max %zu)", index, size); \
-        return 0; \
-    } \
-    var = &(data)[index]; \
-} while (0)
+	if (internal_decimal_round_up(a, a->dp)) n++;
+	return n;
+}
 
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// parsing GLTF objects
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief converts a decimal to the nearest float, by shifting it until the mantissa bits are in it's integer part
+/// @param a the decimal, it's modified
+/// @param negative the float sign
+/// @param outValue the converted value
+/// @return 1 on success, 0 on overflow
+static int internal_decimal_to_float(internal_decimal* a, int negative, float* outValue) {
+	static const int powtab[] = { 1, 3, 6, 9, 13, 16, 19, 23, 26 };
+	const int mantbits = 23;
+	const int bias = -127;
+
+	int exp = 0;
+	unsigned long long mant = 0;
+	int overflow = 0;
+
+	if (a->nd == 0) {
+		exp = bias;
+	}
+	else if (a->dp > 39) {
+		overflow = 1;
+	}
+	else if (a->dp < -46) {
+		exp = bias;
+	}
+	else {
+		// scales the value into [0.5, 1)
+		while (a->dp > 0) {
+			int n = a->dp >= 9 ? 27 : powtab[a->dp];
+			internal_decimal_shift(a, -n);
+			exp += n;
+		}
+		while (a->dp < 0 || (a->dp == 0 && a->d[0] < 5)) {
+			int n = a->dp == 0 ? 1 : (-a->dp >= 9 ? 27 : powtab[-a->dp]);
+			internal_decimal_shift(a, n);
+			exp -= n;
+		}
 
-/// @brief converts the read integer to a component type
-/// @param data the json entire data
-/// @param tok the json token to read
-/// @return the component
-static GLTF_ComponentType internal_json_to_component_type(const char* data, const jsmntok_t* tok) {
-	int type = json_to_int(data, tok);
+		// floats are in [1, 2)
+		exp--;
 
-	switch (type)
-	{
-	case 5120: return ComponentType_R8;
-	case 5121: return ComponentType_R8_UNSIGNED;
-	case 5122: return ComponentType_R16;
-	case 5123: return ComponentType_R16_UNSIGNED;
-	case 5125: return ComponentType_R32_UNSIGNED;
-	case 5126: return ComponentType_R32_FLOAT;
+		// subnormals have less mantissa bits
+		if (exp < bias + 1) {
+			int n = bias + 1 - exp;
+			internal_decimal_shift(a, -n);
+			exp += n;
+		}
+
+		if (exp - bias >= 0xFF) {
+			overflow = 1;
+		}
+		else {
+			internal_decimal_shift(a, 1 + mantbits);
+			mant = internal_decimal_rounded_integer(a);
+
+			// rounding up may carry into a new bit
+			if (mant == (2ull << mantbits)) {
+				mant >>= 1;
+				exp++;
+				if (exp - bias >= 0xFF) overflow = 1;
+			}
+
+			if ((mant & (1ull << mantbits)) == 0) exp = bias;
+		}
 	}
 
-	internal_log_error("An invalid component type has been parsed");
-	return (GLTF_ComponentType)0;
+	unsigned int bits;
+	if (overflow) bits = 0xFFu << mantbits;
+	else bits = (unsigned int)(mant & ((1ull << mantbits) - 1)) | ((unsigned int)((exp - bias) & 0xFF) << mantbits);
+	if (negative) bits |= 0x80000000u;
+
+	gltfmemory_copy(outValue, &bits, sizeof(float));
+	return !overflow;
 }
 
-/// @brief any extra information a gltf object may have will be dealed as a char*
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outExtra the output
-/// @return the next token index to be analyzed
-static int internal_parse_extras(const char* data, const jsmntok_t* tokens, int tkindex, char** outExtra) {
-	unsigned long long start = tokens[tkindex].start;
-	unsigned long long size = tokens[tkindex].end - start;
-	*outExtra = (char*)gltfmemory_allocate(size + 1, 0);
-	GLTF_ASSERT(outExtra, "Failed to allocate memory for extra data parsing");
+/// @brief converts the pieces of a number exactly, whatever amount of digits it has
+static int internal_number_to_float_exact(const internal_number* number, float* outValue) {
+	internal_decimal a;
+	a.nd = 0;
+	a.dp = 0;
+	a.trunc = 0;
 
-	strncpy_impl(*outExtra, (const char*)data + start, size);
-	(*outExtra)[size] = '\0';  // Fixed parentheses
+	int significant = 0;
+	long long dp = (long long)number->integerLength;
 
-	tkindex = json_parse_skip(tokens, tkindex);
-	return tkindex;
-}
+	for (int part = 0; part < 2; ++part) {
+		const char* digits = part == 0 ? number->integer : number->fraction;
+		unsigned long long count = part == 0 ? number->integerLength : number->fractionLength;
 
-/// @brief parses the extensions that are not processed yet
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outExtension the output extension info
-/// @return the next token index to be analyzed
-static int internal_parse_unprocessed_extension(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Extension* outExtension) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING, "Unpprocessed extension token is not a string");
-	GLTF_ASSERT(tokens[tkindex + 1].type == JSMN_OBJECT, "Unprocessed extension token value is not an object");
+		for (unsigned long long i = 0; i < count; ++i) {
+			unsigned char digit = (unsigned char)(digits[i] - '0');
 
-	unsigned long long nameLength = tokens[tkindex].end - tokens[tkindex].start;
-	outExtension->name = (char*)gltfmemory_allocate(nameLength + 1, 0);
-	GLTF_ASSERT(outExtension->name, "Failed to allocate memory for unprocessed extension name");
+			// leading zeros only move the decimal point
+			if (!significant && digit == 0) {
+				dp--;
+				continue;
+			}
+			significant = 1;
 
-	strncpy_impl(outExtension->name, (const char*)data + tokens[tkindex].start, nameLength);
-	outExtension->name[nameLength] = 0;
-	tkindex++;
+			if (a.nd < NUMBER_MAX_DIGITS) a.d[a.nd++] = digit;
+			else if (digit != 0) a.trunc = 1;
+		}
+	}
 
-	unsigned long long start = tokens[tkindex].start;
-	unsigned long long size = tokens[tkindex].end - start;
-	outExtension->data = (char*)gltfmemory_allocate(size + 1, 0);
-	GLTF_ASSERT(outExtension->data, "Failed to allocate memory for unprocessed extension data");
+	dp += number->exponent;
+	if (dp > 100000) dp = 100000;
+	if (dp < -100000) dp = -100000;
+	a.dp = (int)dp;
+	internal_decimal_trim(&a);
 
-	strncpy_impl(outExtension->data, (const char*)data + start, size);
-	outExtension->data[size] = '\0';
-	tkindex = json_parse_skip(tokens, tkindex);
-	return tkindex;
+	return internal_decimal_to_float(&a, number->negative, outValue);
 }
 
-/// @brief handles unprocessed extensions
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outextensionsCount how many extensions the gltf file has
-/// @param outExtensions the output
-/// @return the next token index to be analyzed
-static int internal_parse_unprocessed_extensions(const char* data, const jsmntok_t* tokens, int tkindex, unsigned long long* outextensionsCount, GLTF_Extension** outExtensions) {
-	++tkindex;
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+#if defined(NUMBER_FAST_PATH)
+/// @brief tells if converting a double to a float can't be trusted to give the nearest float of the original decimal
+/// @note a rounded double can only mislead the float rounding when it lands exactly between two floats
+static int internal_double_unsafe_for_float(double value) {
+	unsigned long long bits;
+	gltfmemory_copy(&bits, &value, sizeof(double));
 
-	int extensionsSize = tokens[tkindex].size;
-	*outextensionsCount = 0;
-	*outExtensions = (GLTF_Extension*)gltfmemory_allocate(sizeof(GLTF_Extension) * extensionsSize, 0);
-	GLTF_ASSERT((*outExtensions), "Failed to allocate memory for extensions");
+	// subnormal and overflowing floats have their own rounding, those are left to the exact conversion
+	int exponent = (int)((bits >> 52) & 0x7FF) - 1023;
+	if (exponent < -126 || exponent > 127) return 1;
 
-	++tkindex;
-	for (int j = 0; j < extensionsSize; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+	return (bits & ((1ull << 29) - 1)) == (1ull << 28);
+}
+#endif
 
-		unsigned long long extensionIndex = (*outextensionsCount)++;
-		GLTF_Extension* extension = &((*outExtensions)[extensionIndex]);
-		tkindex = internal_parse_unprocessed_extension(data, tokens, tkindex, extension);
+int number_parse_float(const char* str, unsigned long long length, float* outValue) {
+	internal_number number;
+	if (!internal_number_scan(str, length, &number)) return 0;
 
-		if (tkindex < 0) return tkindex;
+	// up to 19 significant digits always fits in 64 bits
+	unsigned long long mantissa = 0;
+	int digits = 0;
+	int manyDigits = 0;
+	long long exponent = number.exponent;
+
+	for (unsigned long long i = 0; i < number.integerLength && !manyDigits; ++i) {
+		unsigned int digit = (unsigned int)(number.integer[i] - '0');
+		if (digits == 0 && digit == 0) continue;
+		if (digits == 19) manyDigits = 1;
+		else {
+			mantissa = mantissa * 10 + digit;
+			digits++;
+		}
+	}
+	for (unsigned long long i = 0; i < number.fractionLength && !manyDigits; ++i) {
+		unsigned int digit = (unsigned int)(number.fraction[i] - '0');
+		if (digits == 0 && digit == 0) {
+			exponent--;
+			continue;
+		}
+		if (digits == 19) manyDigits = 1;
+		else {
+			mantissa = mantissa * 10 + digit;
+			digits++;
+			exponent--;
+		}
 	}
-	return tkindex;
-}
 
-/// @brief parses a sparse-accessor field from the json data
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outAccessor the output acessor
-/// @return the next token index to be analyzed
-static int internal_json_parse_accessor_sparse(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_SparseAccessor* outAccessor) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-	int size = tokens[tkindex].size;
-	++tkindex;
+	if (mantissa == 0 && !manyDigits) {
+		*outValue = number.negative ? -0.0f : 0.0f;
+		return 1;
+	}
 
-	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+#if defined(NUMBER_FAST_PATH)
+	if (!manyDigits) {
+		// both the mantissa and the power of ten are exact floats, so a single rounding happens
+		if (mantissa <= (1ull << 24) && exponent >= -10 && exponent <= 10) {
+			float value = (float)mantissa;
+			value = exponent < 0 ? value / s_gPow10f[-exponent] : value * s_gPow10f[exponent];
+			*outValue = number.negative ? -value : value;
+			return 1;
+		}
+
+		// same with doubles, then rounded again to a float when that second rounding can be trusted
+		if (mantissa <= (1ull << 53) && exponent >= -22 && exponent <= 22) {
+			double value = (double)mantissa;
+			int exact = 0;
+			if (exponent < 0) value /= s_gPow10[-exponent];
+			else {
+				value *= s_gPow10[exponent];
+				exact = value <= 9007199254740992.0;
+			}
 
-		if (json_strncmp(data, tokens + tkindex, "count") == 0) { 
-			++tkindex; outAccessor->count = json_to_size(data, tokens + tkindex); ++tkindex; 
+			if (exact || !internal_double_unsafe_for_float(value)) {
+				*outValue = number.negative ? -(float)value : (float)value;
+				return 1;
+			}
 		}
-		else if (json_strncmp(data, tokens + tkindex, "indices") == 0) {
-			++tkindex;
-			GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	}
+#endif
 
-			int indicesSize = tokens[tkindex].size;
-			++tkindex;
+	return internal_number_to_float_exact(&number, outValue);
+}
 
-			for (int k = 0; k < indicesSize; ++k) {
-				GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+/// @brief parses the magnitude of a json integer
+/// @param number the number pieces
+/// @param outValue the magnitude
+/// @return 1 on success, 0 if it's not an integer or doesn't fit in 64 bits
+static int internal_number_magnitude(const internal_number* number, unsigned long long* outValue) {
+	if (number->exponent != 0) return 0;
 
-				if (json_strncmp(data, tokens + tkindex, "bufferView") == 0) {
-					++tkindex;
-					outAccessor->indicesBufferView = PTR_TO_INDEX(GLTF_BufferView, json_to_int(data, tokens + tkindex)); 
-					++tkindex;
-				}
-				else if (json_strncmp(data, tokens + tkindex, "byteOffset") == 0) { 
-					++tkindex;
-					outAccessor->indicesByteOffset = json_to_size(data, tokens + tkindex);
-					++tkindex;
-				}
-				else if (json_strncmp(data, tokens + tkindex, "componentType") == 0) {
-					++tkindex;
-					outAccessor->indicesComponentType = internal_json_to_component_type(data, tokens + tkindex);
-					++tkindex;
-				}
-				else { 
-					tkindex = json_parse_skip(tokens, tkindex + 1);
-				}
+	for (unsigned long long i = 0; i < number->fractionLength; ++i) {
+		if (number->fraction[i] != '0') return 0;
+	}
 
-				if (tkindex < 0) return tkindex;
-			}
-		}
-		else if (json_strncmp(data, tokens + tkindex, "values") == 0) {
-			++tkindex;
-			GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	unsigned long long value = 0;
+	for (unsigned long long i = 0; i < number->integerLength; ++i) {
+		unsigned int digit = (unsigned int)(number->integer[i] - '0');
+		if (value > (0xFFFFFFFFFFFFFFFFull - digit) / 10) return 0;
+		value = value * 10 + digit;
+	}
 
-			int valuesSize = tokens[tkindex].size;
-			++tkindex;
+	*outValue = value;
+	return 1;
+}
 
-			for (int k = 0; k < valuesSize; ++k) {
-				GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+int number_parse_int64(const char* str, unsigned long long length, long long* outValue) {
+	internal_number number;
+	unsigned long long magnitude = 0;
+	if (!internal_number_scan(str, length, &number) || !internal_number_magnitude(&number, &magnitude)) return 0;
 
-				if (json_strncmp(data, tokens + tkindex, "bufferView") == 0) { 
-					++tkindex; 
-					outAccessor->valuesBufferView = PTR_TO_INDEX(GLTF_BufferView, json_to_int(data, tokens + tkindex)); 
-					++tkindex;
-				}
-				else if (json_strncmp(data, tokens + tkindex, "byteOffset") == 0) { 
-					++tkindex;
-					outAccessor->valueByteOffset = json_to_size(data, tokens + tkindex);
-					++tkindex;
-				}
-				else { 
-					tkindex = json_parse_skip(tokens, tkindex + 1); 
-				}
+	if (number.negative) {
+		if (magnitude > 0x8000000000000000ull) return 0;
+		*outValue = magnitude == 0x8000000000000000ull ? (-0x7FFFFFFFFFFFFFFFll - 1) : -(long long)magnitude;
+	}
+	else {
+		if (magnitude > 0x7FFFFFFFFFFFFFFFull) return 0;
+		*outValue = (long long)magnitude;
+	}
+	return 1;
+}
 
-				if (tkindex < 0) return tkindex;
-			}
-		}
-		else { 
-			tkindex = json_parse_skip(tokens, tkindex + 1); 
-		}
+int number_parse_uint64(const char* str, unsigned long long length, unsigned long long* outValue) {
+	internal_number number;
+	unsigned long long magnitude = 0;
+	if (!internal_number_scan(str, length, &number) || !internal_number_magnitude(&number, &magnitude)) return 0;
 
-		if (tkindex < 0) return tkindex;
+	// "-0" is still zero
+	if (number.negative && magnitude != 0) return 0;
+
+	*outValue = magnitude;
+	return 1;
+}
+#if defined(GLTF_SIMD_X86)
+#include <immintrin.h>
+#endif
+
+/// @brief converts every component of every element with the given expression of the read component v
+/// @param type the c type of the source components
+/// @param outType the c type of the destination components
+/// @param expr the converted value of v
+#define ACCESSOR_CONVERT(type, outType, expr) do { \
+	for (unsigned long long e = 0; e < count; ++e) { \
+		const unsigned char* s = src + e * srcStride; \
+		outType* d = (outType*)(dst + e * dstStride); \
+		for (unsigned long long c = 0; c < components; ++c) { \
+			type v; \
+			memcpy(&v, s + c * sizeof(type), sizeof(type)); \
+			d[c] = (outType)(expr); \
+		} \
+	} \
+} while (0)
+
+/// @brief returns the size in bytes of a single component
+/// @param componentType the component type
+/// @return the component size, 0 for an invalid component type
+static unsigned long long internal_accessor_component_size(GLTF_ComponentType componentType) {
+	switch (componentType) {
+	case ComponentType_R8:
+	case ComponentType_R8_UNSIGNED: return 1;
+	case ComponentType_R16:
+	case ComponentType_R16_UNSIGNED: return 2;
+	case ComponentType_R32_UNSIGNED:
+	case ComponentType_R32_FLOAT: return 4;
 	}
-	return tkindex;
+	return 0;
 }
 
-/// @brief parses an accessor field from the json data
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outAccessor the output acessor
-/// @return the next token index to be analyzed
-static int internal_parse_json_accessor(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Accessor* outAccessor) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-	int size = tokens[tkindex].size;
-	++tkindex;
+/// @brief converts elements into floats one component at a time
+static void internal_accessor_float_scalar(const unsigned char* src, unsigned long long srcStride, GLTF_ComponentType componentType, int normalized, unsigned long long components, unsigned long long count, unsigned char* dst, unsigned long long dstStride) {
+	switch (componentType) {
+	case ComponentType_R8:
+		if (normalized) ACCESSOR_CONVERT(signed char, float, v == -128 ? -1.0f : v / 127.0f);
+		else ACCESSOR_CONVERT(signed char, float, v);
+		break;
+	case ComponentType_R8_UNSIGNED:
+		if (normalized) ACCESSOR_CONVERT(unsigned char, float, v / 255.0f);
+		else ACCESSOR_CONVERT(unsigned char, float, v);
+		break;
+	case ComponentType_R16:
+		if (normalized) ACCESSOR_CONVERT(short, float, v == -32768 ? -1.0f : v / 32767.0f);
+		else ACCESSOR_CONVERT(short, float, v);
+		break;
+	case ComponentType_R16_UNSIGNED:
+		if (normalized) ACCESSOR_CONVERT(unsigned short, float, v / 65535.0f);
+		else ACCESSOR_CONVERT(unsigned short, float, v);
+		break;
+	case ComponentType_R32_UNSIGNED:
+		if (normalized) ACCESSOR_CONVERT(unsigned int, float, v / 4294967295.0);
+		else ACCESSOR_CONVERT(unsigned int, float, v);
+		break;
+	case ComponentType_R32_FLOAT:
+		ACCESSOR_CONVERT(float, float, v);
+		break;
+	}
+}
 
-	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+/// @brief converts elements into unsigned 32 bits integers one component at a time
+static void internal_accessor_u32_scalar(const unsigned char* src, unsigned long long srcStride, GLTF_ComponentType componentType, unsigned long long components, unsigned long long count, unsigned char* dst, unsigned long long dstStride) {
+	switch (componentType) {
+	case ComponentType_R8: ACCESSOR_CONVERT(signed char, unsigned int, v < 0 ? 0 : v); break;
+	case ComponentType_R8_UNSIGNED: ACCESSOR_CONVERT(unsigned char, unsigned int, v); break;
+	case ComponentType_R16: ACCESSOR_CONVERT(short, unsigned int, v < 0 ? 0 : v); break;
+	case ComponentType_R16_UNSIGNED: ACCESSOR_CONVERT(unsigned short, unsigned int, v); break;
+	case ComponentType_R32_UNSIGNED: ACCESSOR_CONVERT(unsigned int, unsigned int, v); break;
+	case ComponentType_R32_FLOAT: ACCESSOR_CONVERT(float, unsigned int, !(v > 0.0f) ? 0u : v >= 4294967295.0f ? 4294967295u : (unsigned int)v); break;
+	}
+}
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outAccessor->name);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "bufferView") == 0) { 
-			++tkindex;
-			outAccessor->bufferView = PTR_TO_INDEX(GLTF_BufferView, json_to_int(data, tokens + tkindex));
-			++tkindex;
+/// @brief converts elements into unsigned 16 bits integers one component at a time
+static void internal_accessor_u16_scalar(const unsigned char* src, unsigned long long srcStride, GLTF_ComponentType componentType, unsigned long long components, unsigned long long count, unsigned char* dst, unsigned long long dstStride) {
+	switch (componentType) {
+	case ComponentType_R8: ACCESSOR_CONVERT(signed char, unsigned short, v < 0 ? 0 : v); break;
+	case ComponentType_R8_UNSIGNED: ACCESSOR_CONVERT(unsigned char, unsigned short, v); break;
+	case ComponentType_R16: ACCESSOR_CONVERT(short, unsigned short, v < 0 ? 0 : v); break;
+	case ComponentType_R16_UNSIGNED: ACCESSOR_CONVERT(unsigned short, unsigned short, v); break;
+	case ComponentType_R32_UNSIGNED: ACCESSOR_CONVERT(unsigned int, unsigned short, v > 65535u ? 65535u : v); break;
+	case ComponentType_R32_FLOAT: ACCESSOR_CONVERT(float, unsigned short, !(v > 0.0f) ? 0u : v >= 65535.0f ? 65535u : (unsigned int)v); break;
+	}
+}
+
+#if defined(GLTF_SIMD_X86)
+
+/// @brief converts blocks of 8 components of 8 or 16 bits into floats, other component types are left to the scalar loop
+/// @param src the components, advanced past the converted blocks
+/// @param length how many components remains in src, updated accordingly
+/// @param dst where the floats are written into, advanced past the written floats
+/// @param componentType the type of the components of src
+/// @param normalized 1 when the components of src are normalized
+GLTF_TARGET("sse4.1") static void internal_accessor_float_sse41(const unsigned char** src, unsigned long long* length, unsigned char** dst, GLTF_ComponentType componentType, int normalized) {
+	const int isSigned = componentType == ComponentType_R8 || componentType == ComponentType_R16;
+	const int isShort = componentType == ComponentType_R16 || componentType == ComponentType_R16_UNSIGNED;
+	if (!isShort && componentType != ComponentType_R8 && componentType != ComponentType_R8_UNSIGNED) return;
+
+	// dividing rather than multiplying by the inverse gives the same result as the scalar loop, the maximum maps exactly to 1
+	const float scale = !normalized ? 1.0f : isShort ? (isSigned ? 32767.0f : 65535.0f) : (isSigned ? 127.0f : 255.0f);
+	const __m128 divisor = _mm_set1_ps(scale);
+	const __m128 minusOne = _mm_set1_ps(-1.0f);
+	const int clamp = normalized && isSigned;
+
+	while (*length >= 8) {
+		__m128i low, high;
+		if (isShort) {
+			const __m128i v = _mm_loadu_si128((const __m128i*)*src);
+			low = isSigned ? _mm_cvtepi16_epi32(v) : _mm_cvtepu16_epi32(v);
+			high = isSigned ? _mm_cvtepi16_epi32(_mm_srli_si128(v, 8)) : _mm_cvtepu16_epi32(_mm_srli_si128(v, 8));
+			*src += 16;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "byteOffset") == 0) {
-			++tkindex;
-			outAccessor->offset = json_to_size(data, tokens + tkindex); 
-			++tkindex; 
+		else {
+			const __m128i v = _mm_loadl_epi64((const __m128i*)*src);
+			low = isSigned ? _mm_cvtepi8_epi32(v) : _mm_cvtepu8_epi32(v);
+			high = isSigned ? _mm_cvtepi8_epi32(_mm_srli_si128(v, 4)) : _mm_cvtepu8_epi32(_mm_srli_si128(v, 4));
+			*src += 8;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "componentType") == 0) {
-			++tkindex; 
-			outAccessor->componentType = internal_json_to_component_type(data, tokens + tkindex); 
-			++tkindex;
+
+		// the lowest signed value is below -1 once divided, it's clamped like the scalar loop does
+		__m128 first = _mm_div_ps(_mm_cvtepi32_ps(low), divisor);
+		__m128 second = _mm_div_ps(_mm_cvtepi32_ps(high), divisor);
+		if (clamp) {
+			first = _mm_max_ps(first, minusOne);
+			second = _mm_max_ps(second, minusOne);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "normalized") == 0) { 
-			++tkindex;
-			outAccessor->normalized = json_to_bool(data, tokens + tkindex); 
-			++tkindex; 
+
+		_mm_storeu_ps((float*)*dst, first);
+		_mm_storeu_ps((float*)*dst + 4, second);
+		*dst += 32;
+		*length -= 8;
+	}
+}
+
+/// @brief converts blocks of 16 components of 8 or 16 bits into floats, other component types are left to the scalar loop
+/// @param src the components, advanced past the converted blocks
+/// @param length how many components remains in src, updated accordingly
+/// @param dst where the floats are written into, advanced past the written floats
+/// @param componentType the type of the components of src
+/// @param normalized 1 when the components of src are normalized
+GLTF_TARGET("avx2") static void internal_accessor_float_avx2(const unsigned char** src, unsigned long long* length, unsigned char** dst, GLTF_ComponentType componentType, int normalized) {
+	const int isSigned = componentType == ComponentType_R8 || componentType == ComponentType_R16;
+	const int isShort = componentType == ComponentType_R16 || componentType == ComponentType_R16_UNSIGNED;
+	if (!isShort && componentType != ComponentType_R8 && componentType != ComponentType_R8_UNSIGNED) return;
+
+	const float scale = !normalized ? 1.0f : isShort ? (isSigned ? 32767.0f : 65535.0f) : (isSigned ? 127.0f : 255.0f);
+	const __m256 divisor = _mm256_set1_ps(scale);
+	const __m256 minusOne = _mm256_set1_ps(-1.0f);
+	const int clamp = normalized && isSigned;
+
+	while (*length >= 16) {
+		__m256i low, high;
+		if (isShort) {
+			const __m128i v0 = _mm_loadu_si128((const __m128i*)*src);
+			const __m128i v1 = _mm_loadu_si128((const __m128i*)(*src + 16));
+			low = isSigned ? _mm256_cvtepi16_epi32(v0) : _mm256_cvtepu16_epi32(v0);
+			high = isSigned ? _mm256_cvtepi16_epi32(v1) : _mm256_cvtepu16_epi32(v1);
+			*src += 32;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "count") == 0) { 
-			++tkindex;
-			outAccessor->count = json_to_size(data, tokens + tkindex); 
-			++tkindex; 
+		else {
+			const __m128i v = _mm_loadu_si128((const __m128i*)*src);
+			low = isSigned ? _mm256_cvtepi8_epi32(v) : _mm256_cvtepu8_epi32(v);
+			high = isSigned ? _mm256_cvtepi8_epi32(_mm_srli_si128(v, 8)) : _mm256_cvtepu8_epi32(_mm_srli_si128(v, 8));
+			*src += 16;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "type") == 0) {
-			++tkindex;
-			if (json_strncmp(data, tokens + tkindex, "SCALAR") == 0) {
-				outAccessor->type = Type_Scalar; 
-			}
-			else if (json_strncmp(data, tokens + tkindex, "VEC2") == 0) { 
-				outAccessor->type = Type_Vec2;
-			}
-			else if (json_strncmp(data, tokens + tkindex, "VEC3") == 0) { 
-				outAccessor->type = Type_Vec3;
-			}
-			else if (json_strncmp(data, tokens + tkindex, "VEC4") == 0) { 
-				outAccessor->type = Type_Vec4;
-			}
-			else if (json_strncmp(data, tokens + tkindex, "MAT2") == 0) {
-				outAccessor->type = Type_Mat2; 
-			}
-			else if (json_strncmp(data, tokens + tkindex, "MAT3") == 0) { 
-				outAccessor->type = Type_Mat3; 
-			}
-			else if (json_strncmp(data, tokens + tkindex, "MAT4") == 0) {
-				outAccessor->type = Type_Mat4;
-			}
-			++tkindex;
+
+		__m256 first = _mm256_div_ps(_mm256_cvtepi32_ps(low), divisor);
+		__m256 second = _mm256_div_ps(_mm256_cvtepi32_ps(high), divisor);
+		if (clamp) {
+			first = _mm256_max_ps(first, minusOne);
+			second = _mm256_max_ps(second, minusOne);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "sparse") == 0) { 
-			outAccessor->isSparse = 1;
-			tkindex = internal_json_parse_accessor_sparse(data, tokens, tkindex + 1, &outAccessor->sparse);
+
+		_mm256_storeu_ps((float*)*dst, first);
+		_mm256_storeu_ps((float*)*dst + 8, second);
+		*dst += 64;
+		*length -= 16;
+	}
+}
+
+/// @brief widens blocks of 8 unsigned components of 8 or 16 bits into 32 bits, other component types are left to the scalar loop
+/// @param src the components, advanced past the converted blocks
+/// @param length how many components remains in src, updated accordingly
+/// @param dst where the integers are written into, advanced past the written integers
+/// @param componentType the type of the components of src
+GLTF_TARGET("sse4.1") static void internal_accessor_u32_sse41(const unsigned char** src, unsigned long long* length, unsigned char** dst, GLTF_ComponentType componentType) {
+	if (componentType == ComponentType_R16_UNSIGNED) {
+		while (*length >= 8) {
+			const __m128i v = _mm_loadu_si128((const __m128i*)*src);
+			_mm_storeu_si128((__m128i*)*dst, _mm_cvtepu16_epi32(v));
+			_mm_storeu_si128((__m128i*)*dst + 1, _mm_cvtepu16_epi32(_mm_srli_si128(v, 8)));
+			*src += 16;
+			*dst += 32;
+			*length -= 8;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "min") == 0) { 
-			++tkindex; 
-			outAccessor->hasMin = 1;
-			tkindex = json_parse_array_float(data, tokens, tkindex, outAccessor->min, tokens[tkindex].size > 16 ? 16 : tokens[tkindex].size);
+	}
+	else if (componentType == ComponentType_R8_UNSIGNED) {
+		while (*length >= 8) {
+			const __m128i v = _mm_loadl_epi64((const __m128i*)*src);
+			_mm_storeu_si128((__m128i*)*dst, _mm_cvtepu8_epi32(v));
+			_mm_storeu_si128((__m128i*)*dst + 1, _mm_cvtepu8_epi32(_mm_srli_si128(v, 4)));
+			*src += 8;
+			*dst += 32;
+			*length -= 8;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "max") == 0) { 
-			++tkindex;
-			outAccessor->hasMax = 1;
-			tkindex = json_parse_array_float(data, tokens, tkindex, outAccessor->max, tokens[tkindex].size > 16 ? 16 : tokens[tkindex].size);
+	}
+}
+
+/// @brief widens blocks of 16 unsigned components of 8 or 16 bits into 32 bits, other component types are left to the scalar loop
+/// @param src the components, advanced past the converted blocks
+/// @param length how many components remains in src, updated accordingly
+/// @param dst where the integers are written into, advanced past the written integers
+/// @param componentType the type of the components of src
+GLTF_TARGET("avx2") static void internal_accessor_u32_avx2(const unsigned char** src, unsigned long long* length, unsigned char** dst, GLTF_ComponentType componentType) {
+	if (componentType == ComponentType_R16_UNSIGNED) {
+		while (*length >= 16) {
+			_mm256_storeu_si256((__m256i*)*dst, _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)*src)));
+			_mm256_storeu_si256((__m256i*)*dst + 1, _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(*src + 16))));
+			*src += 32;
+			*dst += 64;
+			*length -= 16;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) { 
-			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outAccessor->extras);
+	}
+	else if (componentType == ComponentType_R8_UNSIGNED) {
+		while (*length >= 16) {
+			const __m128i v = _mm_loadu_si128((const __m128i*)*src);
+			_mm256_storeu_si256((__m256i*)*dst, _mm256_cvtepu8_epi32(v));
+			_mm256_storeu_si256((__m256i*)*dst + 1, _mm256_cvtepu8_epi32(_mm_srli_si128(v, 8)));
+			*src += 16;
+			*dst += 64;
+			*length -= 16;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
-			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outAccessor->extensionsCount, &outAccessor->extensions);
+	}
+}
+
+/// @brief widens blocks of 8 unsigned bytes, or narrows blocks of 8 unsigned 32 bits components with saturation, into 16 bits, other component types are left to the scalar loop
+/// @param src the components, advanced past the converted blocks
+/// @param length how many components remains in src, updated accordingly
+/// @param dst where the integers are written into, advanced past the written integers
+/// @param componentType the type of the components of src
+GLTF_TARGET("sse4.1") static void internal_accessor_u16_sse41(const unsigned char** src, unsigned long long* length, unsigned char** dst, GLTF_ComponentType componentType) {
+	if (componentType == ComponentType_R32_UNSIGNED) {
+		// once clamped every value is a positive signed integer, which is what packus expects
+		const __m128i max = _mm_set1_epi32(65535);
+		while (*length >= 8) {
+			const __m128i v0 = _mm_min_epu32(_mm_loadu_si128((const __m128i*)*src), max);
+			const __m128i v1 = _mm_min_epu32(_mm_loadu_si128((const __m128i*)*src + 1), max);
+			_mm_storeu_si128((__m128i*)*dst, _mm_packus_epi32(v0, v1));
+			*src += 32;
+			*dst += 16;
+			*length -= 8;
 		}
-		else { 
-			tkindex = json_parse_skip(tokens, tkindex + 1); 
+	}
+	else if (componentType == ComponentType_R8_UNSIGNED) {
+		while (*length >= 8) {
+			_mm_storeu_si128((__m128i*)*dst, _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*)*src)));
+			*src += 8;
+			*dst += 16;
+			*length -= 8;
 		}
-
-		if (tkindex < 0) return tkindex;
 	}
-
-	return tkindex;
 }
 
-/// @brief parses the accessors field
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outData the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_accessors(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Accessor), (void**)&outData->accessors, &outData->accessorsCount);
-	if (tkindex < 0) return tkindex;
-
-	for (unsigned long long j = 0; j < outData->accessorsCount; ++j) {
-		tkindex = internal_parse_json_accessor(data, tokens, tkindex, &outData->accessors[j]);
-		if (tkindex < 0) return tkindex;
+/// @brief widens blocks of 16 unsigned bytes, or narrows blocks of 16 unsigned 32 bits components with saturation, into 16 bits, other component types are left to the scalar loop
+/// @param src the components, advanced past the converted blocks
+/// @param length how many components remains in src, updated accordingly
+/// @param dst where the integers are written into, advanced past the written integers
+/// @param componentType the type of the components of src
+GLTF_TARGET("avx2") static void internal_accessor_u16_avx2(const unsigned char** src, unsigned long long* length, unsigned char** dst, GLTF_ComponentType componentType) {
+	if (componentType == ComponentType_R32_UNSIGNED) {
+		const __m256i max = _mm256_set1_epi32(65535);
+		while (*length >= 16) {
+			const __m256i v0 = _mm256_min_epu32(_mm256_loadu_si256((const __m256i*)*src), max);
+			const __m256i v1 = _mm256_min_epu32(_mm256_loadu_si256((const __m256i*)*src + 1), max);
+
+			// packus works within each 128 bits lane, the 64 bits quarters are put back in order afterwards
+			_mm256_storeu_si256((__m256i*)*dst, _mm256_permute4x64_epi64(_mm256_packus_epi32(v0, v1), 0xD8));
+			*src += 64;
+			*dst += 32;
+			*length -= 16;
+		}
+	}
+	else if (componentType == ComponentType_R8_UNSIGNED) {
+		while (*length >= 16) {
+			_mm256_storeu_si256((__m256i*)*dst, _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)*src)));
+			*src += 16;
+			*dst += 32;
+			*length -= 16;
+		}
 	}
-	return tkindex;
 }
 
-/// @brief parses the asset structure
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outAsset the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_asset(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Asset* outAsset) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-	int size = tokens[tkindex].size;
-	++tkindex;
-
-	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
-
-		if (json_strncmp(data, tokens + tkindex, "copyright") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outAsset->copyright); 
-		}
-		else if (json_strncmp(data, tokens + tkindex, "generator") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outAsset->generator);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "version") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outAsset->version);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "minVersion") == 0) {
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outAsset->minVersion);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
-			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outAsset->extras);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
-			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outAsset->extensionsCount, &outAsset->extensions);
+/// @brief folds the lanes of the lowest and highest vectors into min and max
+/// @param lows the lanes of the lowest indices vector
+/// @param highs the lanes of the highest indices vector
+/// @param size how many bytes the vectors have
+/// @param componentSize how many bytes every lane has
+/// @param min the lowest index, updated
+/// @param max the highest index, updated
+static void internal_accessor_range_fold(const unsigned char* lows, const unsigned char* highs, unsigned long long size, unsigned long long componentSize, unsigned int* min, unsigned int* max) {
+	for (unsigned long long i = 0; i < size; i += componentSize) {
+		unsigned int low = 0, high = 0;
+		if (componentSize == 1) {
+			low = lows[i];
+			high = highs[i];
+		}
+		else if (componentSize == 2) {
+			unsigned short l, h;
+			memcpy(&l, lows + i, 2);
+			memcpy(&h, highs + i, 2);
+			low = l;
+			high = h;
 		}
 		else {
-			tkindex = json_parse_skip(tokens, tkindex + 1); 
+			memcpy(&low, lows + i, 4);
+			memcpy(&high, highs + i, 4);
 		}
-
-		if (tkindex < 0) return tkindex;
+		if (low < *min) *min = low;
+		if (high > *max) *max = high;
 	}
-	GLTF_ASSERT(!(outAsset->version && atof(outAsset->version) < 2), "Legacy GLTF is not supported");
-	return tkindex;
 }
 
-/// @brief parses the buffer view
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outBufferView the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_buffer_view(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_BufferView* outBufferView) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-	int size = tokens[tkindex].size;
-	++tkindex;
+/// @brief finds the lowest and highest of blocks of 16 bytes of unsigned indices, the remaining ones are left to the scalar loop
+/// @param src the indices, advanced past the read blocks
+/// @param length how many indices remains in src, updated accordingly
+/// @param componentType the type of the indices
+/// @param min the lowest index, updated
+/// @param max the highest index, updated
+GLTF_TARGET("sse4.1") static void internal_accessor_range_sse41(const unsigned char** src, unsigned long long* length, GLTF_ComponentType componentType, unsigned int* min, unsigned int* max) {
+	const unsigned long long componentSize = internal_accessor_component_size(componentType);
+	const unsigned long long block = 16 / componentSize;
+	if (*length < block) return;
+
+	__m128i low = _mm_loadu_si128((const __m128i*)*src);
+	__m128i high = low;
+	while (*length >= block) {
+		const __m128i v = _mm_loadu_si128((const __m128i*)*src);
+		if (componentType == ComponentType_R8_UNSIGNED) {
+			low = _mm_min_epu8(low, v);
+			high = _mm_max_epu8(high, v);
+		}
+		else if (componentType == ComponentType_R16_UNSIGNED) {
+			low = _mm_min_epu16(low, v);
+			high = _mm_max_epu16(high, v);
+		}
+		else {
+			low = _mm_min_epu32(low, v);
+			high = _mm_max_epu32(high, v);
+		}
+		*src += 16;
+		*length -= block;
+	}
 
-	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+	unsigned char lows[16], highs[16];
+	_mm_storeu_si128((__m128i*)lows, low);
+	_mm_storeu_si128((__m128i*)highs, high);
+	internal_accessor_range_fold(lows, highs, 16, componentSize, min, max);
+}
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outBufferView->name);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "buffer") == 0) {
-			++tkindex; 
-			outBufferView->buffer = PTR_TO_INDEX(GLTF_Buffer, json_to_int(data, tokens + tkindex)); 
-			++tkindex;
+/// @brief finds the lowest and highest of blocks of 32 bytes of unsigned indices, the remaining ones are left to the scalar loop
+/// @param src the indices, advanced past the read blocks
+/// @param length how many indices remains in src, updated accordingly
+/// @param componentType the type of the indices
+/// @param min the lowest index, updated
+/// @param max the highest index, updated
+GLTF_TARGET("avx2") static void internal_accessor_range_avx2(const unsigned char** src, unsigned long long* length, GLTF_ComponentType componentType, unsigned int* min, unsigned int* max) {
+	const unsigned long long componentSize = internal_accessor_component_size(componentType);
+	const unsigned long long block = 32 / componentSize;
+	if (*length < block) return;
+
+	__m256i low = _mm256_loadu_si256((const __m256i*)*src);
+	__m256i high = low;
+	while (*length >= block) {
+		const __m256i v = _mm256_loadu_si256((const __m256i*)*src);
+		if (componentType == ComponentType_R8_UNSIGNED) {
+			low = _mm256_min_epu8(low, v);
+			high = _mm256_max_epu8(high, v);
+		}
+		else if (componentType == ComponentType_R16_UNSIGNED) {
+			low = _mm256_min_epu16(low, v);
+			high = _mm256_max_epu16(high, v);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "byteOffset") == 0) { 
-			++tkindex; 
-			outBufferView->offset = json_to_size(data, tokens + tkindex); 
-			++tkindex;
+		else {
+			low = _mm256_min_epu32(low, v);
+			high = _mm256_max_epu32(high, v);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "byteLength") == 0) { 
-			++tkindex; outBufferView->size = json_to_size(data, tokens + tkindex); ++tkindex;
+		*src += 32;
+		*length -= block;
+	}
+
+	unsigned char lows[32], highs[32];
+	_mm256_storeu_si256((__m256i*)lows, low);
+	_mm256_storeu_si256((__m256i*)highs, high);
+	internal_accessor_range_fold(lows, highs, 32, componentSize, min, max);
+}
+
+/// @brief subtracts a base from blocks of 8 indices of 16 or 32 bits, the remaining ones are left to the scalar loop
+/// @param indices the indices, advanced past the rebased blocks
+/// @param length how many indices remains, updated accordingly
+/// @param componentType the type of the indices
+/// @param base what is subtracted
+GLTF_TARGET("sse4.1") static void internal_accessor_rebase_sse41(unsigned char** indices, unsigned long long* length, GLTF_ComponentType componentType, unsigned int base) {
+	if (componentType == ComponentType_R16_UNSIGNED) {
+		const __m128i b = _mm_set1_epi16((short)base);
+		while (*length >= 8) {
+			_mm_storeu_si128((__m128i*)*indices, _mm_sub_epi16(_mm_loadu_si128((const __m128i*)*indices), b));
+			*indices += 16;
+			*length -= 8;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "byteStride") == 0) { 
-			++tkindex;
-			outBufferView->stride = json_to_size(data, tokens + tkindex);
-			++tkindex; 
+	}
+	else {
+		const __m128i b = _mm_set1_epi32((int)base);
+		while (*length >= 8) {
+			_mm_storeu_si128((__m128i*)*indices, _mm_sub_epi32(_mm_loadu_si128((const __m128i*)*indices), b));
+			_mm_storeu_si128((__m128i*)*indices + 1, _mm_sub_epi32(_mm_loadu_si128((const __m128i*)*indices + 1), b));
+			*indices += 32;
+			*length -= 8;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "target") == 0) { 
-			++tkindex; 
-			outBufferView->type = (GLTF_BufferViewType)json_to_int(data, tokens + tkindex); 
-			tkindex++;
+	}
+}
+
+/// @brief subtracts a base from blocks of 16 indices of 16 or 32 bits, the remaining ones are left to the scalar loop
+/// @param indices the indices, advanced past the rebased blocks
+/// @param length how many indices remains, updated accordingly
+/// @param componentType the type of the indices
+/// @param base what is subtracted
+GLTF_TARGET("avx2") static void internal_accessor_rebase_avx2(unsigned char** indices, unsigned long long* length, GLTF_ComponentType componentType, unsigned int base) {
+	if (componentType == ComponentType_R16_UNSIGNED) {
+		const __m256i b = _mm256_set1_epi16((short)base);
+		while (*length >= 16) {
+			_mm256_storeu_si256((__m256i*)*indices, _mm256_sub_epi16(_mm256_loadu_si256((const __m256i*)*indices), b));
+			*indices += 32;
+			*length -= 16;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
-			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outBufferView->extras);
+	}
+	else {
+		const __m256i b = _mm256_set1_epi32((int)base);
+		while (*length >= 16) {
+			_mm256_storeu_si256((__m256i*)*indices, _mm256_sub_epi32(_mm256_loadu_si256((const __m256i*)*indices), b));
+			_mm256_storeu_si256((__m256i*)*indices + 1, _mm256_sub_epi32(_mm256_loadu_si256((const __m256i*)*indices + 1), b));
+			*indices += 64;
+			*length -= 16;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
-			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outBufferView->extensionsCount, &outBufferView->extensions);
+	}
+}
+
+#endif
+
+void accessor_convert_float(const void* src, unsigned long long srcStride, GLTF_ComponentType componentType, int normalized, unsigned long long components, unsigned long long count, float* dst, unsigned long long dstStride) {
+	const unsigned char* s = (const unsigned char*)src;
+	unsigned char* d = (unsigned char*)dst;
+	const unsigned long long componentSize = internal_accessor_component_size(componentType);
+
+	// packed elements on both sides are a single run of components, converted in blocks
+	if (srcStride == components * componentSize && dstStride == components * sizeof(float)) {
+		unsigned long long length = count * components;
+		if (componentType == ComponentType_R32_FLOAT) {
+			memcpy(d, s, length * sizeof(float));
+			return;
 		}
-		else { 
-			tkindex = json_parse_skip(tokens, tkindex + 1);
+
+#if defined(GLTF_SIMD_X86)
+		unsigned int features = platform_cpu_features();
+		if (features & CPU_FEATURE_AVX2) internal_accessor_float_avx2(&s, &length, &d, componentType, normalized);
+		if (features & CPU_FEATURE_SSE41) internal_accessor_float_sse41(&s, &length, &d, componentType, normalized);
+#endif
+
+		internal_accessor_float_scalar(s, componentSize, componentType, normalized, 1, length, d, sizeof(float));
+		return;
+	}
+
+	internal_accessor_float_scalar(s, srcStride, componentType, normalized, components, count, d, dstStride);
+}
+
+void accessor_convert_u32(const void* src, unsigned long long srcStride, GLTF_ComponentType componentType, unsigned long long components, unsigned long long count, unsigned int* dst, unsigned long long dstStride) {
+	const unsigned char* s = (const unsigned char*)src;
+	unsigned char* d = (unsigned char*)dst;
+	const unsigned long long componentSize = internal_accessor_component_size(componentType);
+
+	if (srcStride == components * componentSize && dstStride == components * sizeof(unsigned int)) {
+		unsigned long long length = count * components;
+		if (componentType == ComponentType_R32_UNSIGNED) {
+			memcpy(d, s, length * sizeof(unsigned int));
+			return;
 		}
 
-		if (tkindex < 0) return tkindex;
+#if defined(GLTF_SIMD_X86)
+		unsigned int features = platform_cpu_features();
+		if (features & CPU_FEATURE_AVX2) internal_accessor_u32_avx2(&s, &length, &d, componentType);
+		if (features & CPU_FEATURE_SSE41) internal_accessor_u32_sse41(&s, &length, &d, componentType);
+#endif
+
+		internal_accessor_u32_scalar(s, componentSize, componentType, 1, length, d, sizeof(unsigned int));
+		return;
 	}
-	return tkindex;
+
+	internal_accessor_u32_scalar(s, srcStride, componentType, components, count, d, dstStride);
 }
 
-/// @brief parses the buffer views
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outBufferView the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_bufferviews(const char* data, const jsmntok_t* tokens, int i, GLTF2* outData) {
-	i = json_parse_array(data, tokens, i, sizeof(GLTF_BufferView), (void**)&outData->bufferViews, &outData->bufferViewsCount);
-	if (i < 0) return i;
+void accessor_convert_u16(const void* src, unsigned long long srcStride, GLTF_ComponentType componentType, unsigned long long components, unsigned long long count, unsigned short* dst, unsigned long long dstStride) {
+	const unsigned char* s = (const unsigned char*)src;
+	unsigned char* d = (unsigned char*)dst;
+	const unsigned long long componentSize = internal_accessor_component_size(componentType);
 
-	for (unsigned long long j = 0; j < outData->bufferViewsCount; ++j) {
-		i = internal_parse_buffer_view(data, tokens, i, &outData->bufferViews[j]);
-		if (i < 0) return i;
+	if (srcStride == components * componentSize && dstStride == components * sizeof(unsigned short)) {
+		unsigned long long length = count * components;
+		if (componentType == ComponentType_R16_UNSIGNED) {
+			memcpy(d, s, length * sizeof(unsigned short));
+			return;
+		}
+
+#if defined(GLTF_SIMD_X86)
+		unsigned int features = platform_cpu_features();
+		if (features & CPU_FEATURE_AVX2) internal_accessor_u16_avx2(&s, &length, &d, componentType);
+		if (features & CPU_FEATURE_SSE41) internal_accessor_u16_sse41(&s, &length, &d, componentType);
+#endif
+
+		internal_accessor_u16_scalar(s, componentSize, componentType, 1, length, d, sizeof(unsigned short));
+		return;
 	}
-	return i;
+
+	internal_accessor_u16_scalar(s, srcStride, componentType, components, count, d, dstStride);
 }
 
-/// @brief parses a buffer
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outBuffer the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_buffer(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Buffer* outBuffer) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-	int size = tokens[tkindex].size;
-	++tkindex;
+void accessor_index_range(const void* src, GLTF_ComponentType componentType, unsigned long long count, unsigned int* outMin, unsigned int* outMax) {
+	const unsigned char* s = (const unsigned char*)src;
+	const unsigned long long componentSize = internal_accessor_component_size(componentType);
+	if (count == 0 || (componentType != ComponentType_R8_UNSIGNED && componentType != ComponentType_R16_UNSIGNED && componentType != ComponentType_R32_UNSIGNED)) return;
 
-	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+	unsigned int min = ~0u;
+	unsigned int max = 0;
+	unsigned long long length = count;
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) {
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outBuffer->name);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "byteLength") == 0) {
-			++tkindex;
-			outBuffer->size = json_to_size(data, tokens + tkindex);
-			++tkindex;
-		}
-		else if (json_strncmp(data, tokens + tkindex, "uri") == 0) {
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outBuffer->URI);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) { 
-			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outBuffer->extras);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
-			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outBuffer->extensionsCount, &outBuffer->extensions);
-		}
-		else { 
-			tkindex = json_parse_skip(tokens, tkindex + 1);
+#if defined(GLTF_SIMD_X86)
+	unsigned int features = platform_cpu_features();
+	if (features & CPU_FEATURE_AVX2) internal_accessor_range_avx2(&s, &length, componentType, &min, &max);
+	if (features & CPU_FEATURE_SSE41) internal_accessor_range_sse41(&s, &length, componentType, &min, &max);
+#endif
+
+	for (unsigned long long i = 0; i < length; ++i) {
+		unsigned int v;
+		if (componentSize == 1) v = s[i];
+		else if (componentSize == 2) {
+			unsigned short index;
+			memcpy(&index, s + i * 2, 2);
+			v = index;
 		}
+		else memcpy(&v, s + i * 4, 4);
 
-		if (tkindex < 0) return tkindex;
+		if (v < min) min = v;
+		if (v > max) max = v;
 	}
-	return tkindex;
+
+	*outMin = min;
+	*outMax = max;
 }
 
-/// @brief parses the buffers
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outData the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_buffers(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Buffer), (void**)&outData->buffers, &outData->buffersCount);
-	if (tkindex < 0) return tkindex;
+void accessor_index_rebase(void* indices, GLTF_ComponentType componentType, unsigned long long count, unsigned int base) {
+	unsigned char* d = (unsigned char*)indices;
+	unsigned long long length = count;
+	if (base == 0) return;
 
-	for (unsigned long long j = 0; j < outData->buffersCount; ++j) {
-		tkindex = internal_parse_buffer(data, tokens, tkindex, &outData->buffers[j]);
-		if (tkindex < 0) return tkindex;
+#if defined(GLTF_SIMD_X86)
+	unsigned int features = platform_cpu_features();
+	if (features & CPU_FEATURE_AVX2) internal_accessor_rebase_avx2(&d, &length, componentType, base);
+	if (features & CPU_FEATURE_SSE41) internal_accessor_rebase_sse41(&d, &length, componentType, base);
+#endif
+
+	if (componentType == ComponentType_R16_UNSIGNED) {
+		unsigned short* i16 = (unsigned short*)d;
+		for (unsigned long long i = 0; i < length; ++i) i16[i] = (unsigned short)(i16[i] - base);
+	}
+	else {
+		unsigned int* i32 = (unsigned int*)d;
+		for (unsigned long long i = 0; i < length; ++i) i32[i] -= base;
 	}
-	return tkindex;
 }
+int json_strncmp(const char* data, const jsmntok_t* tok, const char* str) {
+	if (tok->type != JSMN_STRING) return -1; 
 
-/// @brief parses an animation sampler
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outSampler the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_animation_sampler(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_AnimationSampler* outSampler) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-	int size = tokens[tkindex].size;
-	++tkindex;
+	unsigned long long strLen = strlen(str);
+	unsigned long long nameLength = (unsigned long long)(tok->end - tok->start);
+	if (nameLength != strLen) return nameLength < strLen ? -1 : 1;
+	return gltfmemory_cmp((const char*)data + tok->start, str, strLen);
+}
 
-	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+int json_to_bool(const char* data, const jsmntok_t* tok) {
+	int size = (int)(tok->end - tok->start);
+	return size == 4 && gltfmemory_cmp(data + tok->start, "true", 4) == 0;
+}
 
-		if (json_strncmp(data, tokens + tkindex, "input") == 0) { 
-			++tkindex; 
-			outSampler->input = PTR_TO_INDEX(GLTF_Accessor, json_to_int(data, tokens + tkindex)); 
-			++tkindex; 
-		}
-		else if (json_strncmp(data, tokens + tkindex, "output") == 0) { 
-			++tkindex;
-			outSampler->output = PTR_TO_INDEX(GLTF_Accessor, json_to_int(data, tokens + tkindex));
-			++tkindex; 
-		}
-		else if (json_strncmp(data, tokens + tkindex, "interpolation") == 0) {
-			++tkindex;
-			if (json_strncmp(data, tokens + tkindex, "LINEAR") == 0) {
-				outSampler->interpolation = InterpolationType_Linear;
-			}
-			else if (json_strncmp(data, tokens + tkindex, "STEP") == 0) {
-				outSampler->interpolation = InterpolationType_Step;
-			}
-			else if (json_strncmp(data, tokens + tkindex, "CUBICSPLINE") == 0) {
-				outSampler->interpolation = InterpolationType_CubicSpline; 
-			}
-			++tkindex;
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) { 
-			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outSampler->extras);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) { 
-			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outSampler->extensionsCount, &outSampler->extensions);
-		}
-		else {
-			tkindex = json_parse_skip(tokens, tkindex + 1); 
-		}
+int json_read_int(const char* data, const jsmntok_t* tok, int* outValue) {
+	if (tok->type != JSMN_PRIMITIVE) return 0;
 
-		if (tkindex < 0) return tkindex;
-	}
-	return tkindex;
+	long long value = 0;
+	if (!number_parse_int64(data + tok->start, (unsigned long long)(tok->end - tok->start), &value)) return 0;
+	if (value < -2147483647 - 1 || value > 2147483647) return 0;
+
+	*outValue = (int)value;
+	return 1;
 }
 
-/// @brief parses an animation channel
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outChannel the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_animation_channel(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_AnimationChannel* outChannel) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-	int size = tokens[tkindex].size;
-	++tkindex;
+int json_read_float(const char* data, const jsmntok_t* tok, float* outValue) {
+	if (tok->type != JSMN_PRIMITIVE) return 0;
+	return number_parse_float(data + tok->start, (unsigned long long)(tok->end - tok->start), outValue);
+}
 
-	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+int json_read_size(const char* data, const jsmntok_t* tok, unsigned long long* outValue) {
+	if (tok->type != JSMN_PRIMITIVE) return 0;
+	return number_parse_uint64(data + tok->start, (unsigned long long)(tok->end - tok->start), outValue);
+}
 
-		if (json_strncmp(data, tokens + tkindex, "sampler") == 0) { 
-			++tkindex; outChannel->sampler = PTR_TO_INDEX(GLTF_AnimationSampler, json_to_int(data, tokens + tkindex));
-			++tkindex; 
-		}
-		else if (json_strncmp(data, tokens + tkindex, "target") == 0) {
-			++tkindex;
-			GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-			int target_size = tokens[tkindex].size;
-			++tkindex;
+/// @brief checks if a json string has any escape sequence
+static int json_has_escapes(const char* str, unsigned long long length) {
+	for (unsigned long long i = 0; i < length; ++i) {
+		if (str[i] == '\\') return 1;
+	}
+	return 0;
+}
 
-			for (int k = 0; k < target_size; ++k) {
-				GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+/// @brief converts 4 hexadecimal characters into their value, jsmn already made sure they're valid
+static unsigned int json_hex4(const char* str) {
+	unsigned int value = 0;
+	for (int i = 0; i < 4; ++i) {
+		char c = str[i];
+		value <<= 4;
+		if (c >= '0' && c <= '9') value |= (unsigned int)(c - '0');
+		else if (c >= 'a' && c <= 'f') value |= (unsigned int)(c - 'a' + 10);
+		else if (c >= 'A' && c <= 'F') value |= (unsigned int)(c - 'A' + 10);
+	}
+	return value;
+}
 
-				if (json_strncmp(data, tokens + tkindex, "node") == 0) { 
-					++tkindex; outChannel->targetNode = PTR_TO_INDEX(GLTF_Node, json_to_int(data, tokens + tkindex)); ++tkindex; }
-				else if (json_strncmp(data, tokens + tkindex, "path") == 0) {
-					++tkindex;
-					if (json_strncmp(data, tokens + tkindex, "translation") == 0) { 
-						outChannel->targetPath = AnimationPathType_Translation; 
-					}
-					else if (json_strncmp(data, tokens + tkindex, "rotation") == 0) { 
-						outChannel->targetPath = AnimationPathType_Rotation; 
-					}
-					else if (json_strncmp(data, tokens + tkindex, "scale") == 0) { 
-						outChannel->targetPath = AnimationPathType_Scale;
-					}
-					else if (json_strncmp(data, tokens + tkindex, "weights") == 0) {
-						outChannel->targetPath = AnimationPathType_Weights; 
+/// @brief decodes the escape sequences of a json string, unicode escapes are written as utf-8
+/// @param dst where the decoded string is written, it may be str itself since the decoded string is never longer
+/// @param str the json string characters, without the quotes
+/// @param length how many characters str has
+/// @return the decoded length
+static unsigned long long json_decode_escapes(char* dst, const char* str, unsigned long long length) {
+	unsigned long long out = 0;
+	for (unsigned long long i = 0; i < length; ++i) {
+		if (str[i] != '\\' || i + 1 >= length) {
+			dst[out++] = str[i];
+			continue;
+		}
+
+		char c = str[++i];
+		switch (c)
+		{
+			case 'b': dst[out++] = '\b'; break;
+			case 'f': dst[out++] = '\f'; break;
+			case 'n': dst[out++] = '\n'; break;
+			case 'r': dst[out++] = '\r'; break;
+			case 't': dst[out++] = '\t'; break;
+			case 'u': {
+				if (i + 4 >= length) return out;
+				unsigned int code = json_hex4(str + i + 1);
+				i += 4;
+
+				// a surrogate pair makes a single code point, a lone surrogate becomes the replacement character
+				if (code >= 0xD800 && code <= 0xDBFF && i + 6 < length && str[i + 1] == '\\' && str[i + 2] == 'u') {
+					unsigned int low = json_hex4(str + i + 3);
+					if (low >= 0xDC00 && low <= 0xDFFF) {
+						code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+						i += 6;
 					}
-					++tkindex;
 				}
-				else if (json_strncmp(data, tokens + tkindex, "extras") == 0) { 
-					tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outChannel->extras);
+				if (code >= 0xD800 && code <= 0xDFFF) code = 0xFFFD;
+
+				if (code < 0x80) {
+					dst[out++] = (char)code;
 				}
-				else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) { 
-					tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outChannel->extensionsCount, &outChannel->extensions);
+				else if (code < 0x800) {
+					dst[out++] = (char)(0xC0 | (code >> 6));
+					dst[out++] = (char)(0x80 | (code & 0x3F));
 				}
-				else { 
-					tkindex = json_parse_skip(tokens, tkindex + 1);
+				else if (code < 0x10000) {
+					dst[out++] = (char)(0xE0 | (code >> 12));
+					dst[out++] = (char)(0x80 | ((code >> 6) & 0x3F));
+					dst[out++] = (char)(0x80 | (code & 0x3F));
 				}
-
-				if (tkindex < 0) return tkindex;
+				else {
+					dst[out++] = (char)(0xF0 | (code >> 18));
+					dst[out++] = (char)(0x80 | ((code >> 12) & 0x3F));
+					dst[out++] = (char)(0x80 | ((code >> 6) & 0x3F));
+					dst[out++] = (char)(0x80 | (code & 0x3F));
+				}
+				break;
 			}
+			default: dst[out++] = c; break; // quotes, slashes and backslashes stands for themselves
 		}
-		else { 
-			tkindex = json_parse_skip(tokens, tkindex + 1);
-		}
-
-		if (tkindex < 0) return tkindex;
 	}
-	return tkindex;
+	return out;
 }
 
-/// @brief parses an animation
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outAnimation the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_animation(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Animation* outAnimation) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-	int size = tokens[tkindex].size;
-	++tkindex;
+int json_parse_string(const char* data, const jsmntok_t* tokens, int i, char** outString, GLTF_Arena** arena) {
+	if (tokens[i].type != JSMN_STRING) return -1;
+
+	const char* str = data + tokens[i].start;
+	unsigned long long size = (unsigned long long)(tokens[i].end - tokens[i].start);
+	char* result = (char*)gltfarena_allocate(arena, size + 1, 0);
+	if (!result) return -1;
+
+	// most strings have no escapes and are simply copied
+	if (json_has_escapes(str, size)) size = json_decode_escapes(result, str, size);
+	else gltfmemory_copy(result, str, size);
+
+	result[size] = 0;
+	*outString = result;
+	return i + 1;
+}
+
+int json_parse_string_view(char* data, const jsmntok_t* tokens, int i, char** outString) {
+	if (tokens[i].type != JSMN_STRING) return -1;
+
+	// the closing quote makes room for the terminator, escapes are decoded only when there's any
+	char* str = data + tokens[i].start;
+	unsigned long long size = (unsigned long long)(tokens[i].end - tokens[i].start);
+	if (json_has_escapes(str, size)) size = json_decode_escapes(str, str, size);
+
+	str[size] = 0;
+	*outString = str;
+	return i + 1;
+}
+
+int json_parse_array(const char* data, const jsmntok_t* tokens, int i, unsigned long long elementSize, void** outArr, unsigned long long* outSize, GLTF_Arena** arena) {
+	if (tokens[i].type != JSMN_ARRAY) return -1;
+
+	int size = tokens[i].size;
+	void* result = gltfarena_allocate(arena, elementSize * size, 1);
+	if (!result) return -1;
+
+	*outArr = result;
+	*outSize = size;
+	return i + 1;
+}
+
+int json_parse_array_float(const char* data, const jsmntok_t* tokens, int i, float* outArray, int size) {
+	if (tokens[i].type != JSMN_ARRAY) return -1;
+	if (tokens[i].size != size) return -1;
+	return json_parse_array_float_partial(data, tokens, i, outArray, size);
+}
+
+int json_parse_array_float_partial(const char* data, const jsmntok_t* tokens, int i, float* outArray, int capacity) {
+	if (tokens[i].type != JSMN_ARRAY) return -1;
+	const int size = (int)tokens[i].size;
+
+	// the elements are consecutive tokens, each one is parsed straight from it's span
+	const jsmntok_t* element = tokens + i + 1;
+	for (int j = 0; j < size; ++j, ++element) {
+		float value = 0.0f;
+		if (element->type != JSMN_PRIMITIVE) return -1;
+		if (!number_parse_float(data + element->start, (unsigned long long)(element->end - element->start), &value)) return -1;
+		if (j < capacity) outArray[j] = value;
+	}
+	return i + 1 + size;
+}
+
+int json_parse_array_string(const char* data, const jsmntok_t* tokens, int i, char*** outArr, unsigned long long* outSize, GLTF_Arena** arena) {
+	if (tokens[i].type != JSMN_ARRAY) return -1;
+	i = json_parse_array(data, tokens, i, sizeof(char*), (void**)outArr, outSize, arena);
+	if (i < 0) return i;
+
+	for (unsigned long long j = 0; j < *outSize; ++j) {
+		i = json_parse_string(data, tokens, i, j + (*outArr), arena);
+		if (i < 0) return i;
+	}
+	return i;
+}
+
+int json_parse_skip(const jsmntok_t* tokens, int i) {
+	// the tokenizer links every token to the one after it's subtree, the trailing UNDEFINED token has no link
+	if (tokens[i].type == JSMN_UNDEFINED) return -1;
+	return tokens[i].next;
+}
+/// @macro for checking token type
+#define CHECK_TKTYPE(tk, tktype) if ((tk).type != (tktype)) { return GLTF_JsonInvalid; }
+
+/// @macro for checking token key
+#define CHECK_TKKEY(tk) if ((tk).type != JSMN_STRING || (tk).size == 0) { return GLTF_JsonInvalid; }
+
+/// @macro expected GLB header size
+#define GLB_HEADER_SIZE 12
+
+/// @macro expected GLB header chunk size
+#define GLB_CHUNK_HEADER_SIZE 8
+
+/// @macro little-endian "glTF" 
+#define GLB_MAGIC 0x46546C67 
+
+/// @macro "JSON" em little-endian
+#define JSON_CHUNK_TYPE 0x4E4F534A
+
+/// @macro little-endian "BIN"
+#define BIN_CHUNK_TYPE 0x004E4942
+
+/// @brief the state of a parse in progress, it lives on the stack of the parse entry point
+typedef struct internal_parse_state {
+	GLTF_ParseOptions options;          // the options of the parse
+	GLTF_Context* context;              // where the errors are recorded
+	GLTF_Arena** arena;                 // every allocation the output data owns comes from it, NULL until the parsed data exists
+	int stringViews;                    // 1 when strings points into the json instead of being copied
+	const char* json;                   // the json text while it's tokens are alive, used to report error paths
+	const jsmntok_t* tokens;
+	int tokensCount;
+	struct internal_parse_state* previous; // the parse this one has interrupted on the same thread, if any
+} internal_parse_state;
+
+/// @brief the errors of the calling thread when a parse doesn't provide it's own context
+static GLTF_THREAD_LOCAL GLTF_Context s_gContext;
+
+/// @brief the parse in progress on the calling thread, NULL outside of a parse
+static GLTF_THREAD_LOCAL internal_parse_state* s_gState = NULL;
+
+/// @brief starts a parse on the calling thread, clearing it's context
+/// @param state the state of the new parse
+/// @param options the parse options, never NULL
+static void internal_parse_begin(internal_parse_state* state, const GLTF_ParseOptions* options) {
+	memset(state, 0, sizeof(internal_parse_state));
+	state->options = *options;
+	state->context = options->context ? options->context : &s_gContext;
+	state->previous = s_gState;
+	if (state->options.sections == 0) state->options.sections = Section_All;
+
+	state->context->errorsCount = 0;
+	state->context->log[0] = '\0';
+	s_gState = state;
+}
+
+/// @brief finishes the parse started by internal_parse_begin
+/// @param state the state of the parse
+static void internal_parse_end(internal_parse_state* state) {
+	s_gState = state->previous;
+}
+
+/// @brief appends text to a bounded string, truncating it when it doesn't fit
+/// @param str the string
+/// @param length the current string length, updated with the appended text
+/// @param size the string capacity
+/// @param format the printf format of the text
+static void internal_append(char* str, unsigned long long* length, unsigned long long size, const char* format, ...) {
+	if (*length + 1 >= size) return;
+
+	va_list args;
+	va_start(args, format);
+	int written = vsnprintf(str + *length, size - *length, format, args);
+	va_end(args);
+
+	if (written > 0) *length += (unsigned long long)written < size - *length ? (unsigned long long)written : size - *length - 1;
+}
+
+/// @brief writes the json path of a token, like "meshes[2].primitives[0].mode"
+/// @param json the json text
+/// @param tokens the json tokens, the first one is the root
+/// @param count how many tokens there are
+/// @param target the token whose path is written
+/// @param outPath the output path
+/// @param size the output path capacity
+static void internal_token_path(const char* json, const jsmntok_t* tokens, int count, int target, char* outPath, unsigned long long size) {
+	unsigned long long length = 0;
+	outPath[0] = '\0';
+
+	int parent = 0;
+	while (parent != target && parent < count) {
+		if (tokens[parent].type != JSMN_OBJECT && tokens[parent].type != JSMN_ARRAY) break;
+
+		// finds the member of the parent whose subtree holds the target
+		int child = parent + 1;
+		int found = -1;
+		for (int k = 0; k < tokens[parent].size && child < count; ++k) {
+			int key = child;
+			if (tokens[parent].type == JSMN_OBJECT) child++;
+
+			int next = json_parse_skip(tokens, child);
+			if (target >= key && target < next) {
+				if (tokens[parent].type == JSMN_OBJECT) {
+					internal_append(outPath, &length, size, "%s%.*s", length ? "." : "", tokens[key].end - tokens[key].start, json + tokens[key].start);
+				}
+				else {
+					internal_append(outPath, &length, size, "[%d]", k);
+				}
+				found = target == key ? target : child;
+				break;
+			}
+			child = next;
+		}
+
+		if (found < 0) break;
+		parent = found;
+	}
+}
+
+/// @brief records an error in the context of the calling thread parse
+/// @param code what kind of failure it is
+/// @param tkindex the json token it has happened at, -1 when it's not tied to a token
+/// @param offset the byte offset into the json it has happened at, -1 when it's not tied to the json, ignored when tkindex is valid
+/// @param format the printf format of the message
+/// @param args the message arguments
+static void internal_log_record(GLTF_ErrorCode code, int tkindex, long long offset, const char* format, va_list args) {
+	internal_parse_state* state = s_gState;
+	GLTF_Context* context = state ? state->context : &s_gContext;
+
+	GLTF_Error error;
+	error.code = code;
+	error.offset = offset;
+	error.path[0] = '\0';
+	vsnprintf(error.message, GLTF_ERROR_MESSAGE_SIZE, format, args);
+
+	if (state && state->tokens && tkindex >= 0 && tkindex < state->tokensCount) {
+		error.offset = state->tokens[tkindex].start;
+		internal_token_path(state->json, state->tokens, state->tokensCount, tkindex, error.path, GLTF_ERROR_PATH_SIZE);
+	}
+
+	if (context->errorsCount < GLTF_MAX_ERRORS) {
+		context->errors[context->errorsCount] = error;
+	}
+	context->errorsCount++;
+
+	// the log keeps the messages along with where they've happened
+	unsigned long long length = strlen(context->log);
+	if (length > 0) internal_append(context->log, &length, GLTF_LOG_BUFFER_SIZE, "\n");
+	internal_append(context->log, &length, GLTF_LOG_BUFFER_SIZE, "%s", error.message);
+	if (error.path[0]) internal_append(context->log, &length, GLTF_LOG_BUFFER_SIZE, " (at %s, byte %lld)", error.path, error.offset);
+	else if (error.offset >= 0) internal_append(context->log, &length, GLTF_LOG_BUFFER_SIZE, " (at byte %lld)", error.offset);
+}
+
+/// @brief records an error that isn't tied to the json
+/// @param code what kind of failure it is
+/// @param format the printf format of the message
+static void internal_log_error(GLTF_ErrorCode code, const char* format, ...) {
+	va_list args;
+	va_start(args, format);
+	internal_log_record(code, -1, -1, format, args);
+	va_end(args);
+}
+
+/// @brief records an error at a json token, the context gets it's byte offset and json path
+/// @param code what kind of failure it is
+/// @param tkindex the json token index
+/// @param format the printf format of the message
+static void internal_log_error_at(GLTF_ErrorCode code, int tkindex, const char* format, ...) {
+	va_list args;
+	va_start(args, format);
+	internal_log_record(code, tkindex, -1, format, args);
+	va_end(args);
+}
+
+/// @brief records an error at a byte offset of the json
+/// @param code what kind of failure it is
+/// @param offset the byte offset into the json
+/// @param format the printf format of the message
+static void internal_log_error_offset(GLTF_ErrorCode code, long long offset, const char* format, ...) {
+	va_list args;
+	va_start(args, format);
+	internal_log_record(code, -1, offset, format, args);
+	va_end(args);
+}
+
+// @brief assertions, they're reported at the json token tkindex of the function they're used in
+#ifdef GLTF_ENABLE_ASSERTS
+#include <assert.h>
+#define GLTF_ASSERT(exp, code, msg) \
+    do { \
+        if (!(exp)) { \
+			internal_log_error_at(code, tkindex, "%s", msg); \
+            fprintf(stderr, "[GLTF:Assertion] %s\n", msg); \
+            abort(); \
+        } \
+    } while (0)
+#else
+#define GLTF_ASSERT(exp, code, msg) \
+	if(!(exp)) { \
+		internal_log_error_at(code, tkindex, "%s", msg); \
+		return -1; \
+	}
+#endif
+
+/// @macro for converting index into a pointer 
+#define PTR_TO_INDEX(type, idx) (type*)((unsigned long long)idx + 1)
+
+/// @macro reads the json index at tkindex into a pointer that PTR_FIX resolves later, a non integer or negative index fails the parse
+#define JSON_READ_INDEX(var, type) do { \
+	int index = 0; \
+	GLTF_ASSERT(json_read_int(data, tokens + tkindex, &index) && index >= 0, ErrorCode_InvalidDocument, "Invalid json index"); \
+	var = PTR_TO_INDEX(type, index); \
+} while (0)
+
+/// @macro reads the json integer at tkindex into an enum, a non integer fails the parse
+#define JSON_READ_ENUM(var, type) do { \
+	int value = 0; \
+	GLTF_ASSERT(json_read_int(data, tokens + tkindex, &value), ErrorCode_InvalidDocument, "Invalid json integer"); \
+	var = (type)value; \
+} while (0)
+
+/// @macro null check, bounds check and pointer adjustment.
+#define PTR_FIX(var, data, size) do { \
+    if (var) { \
+        unsigned long long index = (unsigned long long)((uintptr_t)var - 1); \
+        if (index >= size) { \
+            internal_log_error(ErrorCode_InvalidDocument, "Invalid pointer index %llu (max %llu)", index, (unsigned long long)(size)); \
+            return -1; \
+        } \
+        var = &(data)[index]; \
+    } \
+} while (0)
+
+/// @macro same as PTR_FIX but enforces not nullptr, for required fields
+#define PTR_FIX_REQUIRED(var, data, size) do { \
+    unsigned long long index = (unsigned long long)((uintptr_t)var - 1); \
+    if (!var || index >= size) { \
+        internal_log_error(ErrorCode_InvalidDocument, "Required pointer invalid (index %llu, max %llu)", index, (unsigned long long)(size)); \
+        return -1; \
+    } \
+    var = &(data)[index]; \
+} while (0)
+
+/// @macro PTR_FIX into a section that may have been skipped, the pointer is cleared when it was, an invalid index into a built section still fails the parse.
+#define PTR_FIX_SECTION(var, data, size, built) do { \
+    if (!(built)) var = NULL; \
+    else PTR_FIX(var, data, size); \
+} while (0)
+
+/// @macro PTR_FIX_REQUIRED into a section that may have been skipped, the pointer is cleared when it was, a missing or invalid index into a built section still fails the parse.
+#define PTR_FIX_REQUIRED_SECTION(var, data, size, built) do { \
+    if (!(built)) var = NULL; \
+    else PTR_FIX_REQUIRED(var, data, size); \
+} while (0)
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// json keys
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief every json key and enum string the parser understands, resolved once per token by internal_json_key_lookup
+typedef enum {
+	JsonKey_Unknown = 0,
+	JsonKey_Accessors,
+	JsonKey_AlphaCutoff,
+	JsonKey_AlphaMode,
+	JsonKey_Animations,
+	JsonKey_AspectRatio,
+	JsonKey_Asset,
+	JsonKey_Attributes,
+	JsonKey_BaseColorFactor,
+	JsonKey_BaseColorTexture,
+	JsonKey_Blend,
+	JsonKey_Buffer,
+	JsonKey_Buffers,
+	JsonKey_BufferView,
+	JsonKey_BufferViews,
+	JsonKey_ByteLength,
+	JsonKey_ByteOffset,
+	JsonKey_ByteStride,
+	JsonKey_Camera,
+	JsonKey_Cameras,
+	JsonKey_Channels,
+	JsonKey_Children,
+	JsonKey_ComponentType,
+	JsonKey_Copyright,
+	JsonKey_Count,
+	JsonKey_CubicSpline,
+	JsonKey_DoubleSided,
+	JsonKey_EmissiveFactor,
+	JsonKey_EmissiveTexture,
+	JsonKey_Extensions,
+	JsonKey_ExtensionsRequired,
+	JsonKey_ExtensionsUsed,
+	JsonKey_Extras,
+	JsonKey_Generator,
+	JsonKey_Images,
+	JsonKey_Index,
+	JsonKey_Indices,
+	JsonKey_Input,
+	JsonKey_Interpolation,
+	JsonKey_InverseBindMatrices,
+	JsonKey_Joints,
+	JsonKey_Linear,
+	JsonKey_MagFilter,
+	JsonKey_Mask,
+	JsonKey_Mat2,
+	JsonKey_Mat3,
+	JsonKey_Mat4,
+	JsonKey_Material,
+	JsonKey_Materials,
+	JsonKey_Matrix,
+	JsonKey_Max,
+	JsonKey_Mesh,
+	JsonKey_Meshes,
+	JsonKey_MetallicFactor,
+	JsonKey_MetallicRoughnessTexture,
+	JsonKey_MimeType,
+	JsonKey_Min,
+	JsonKey_MinFilter,
+	JsonKey_MinVersion,
+	JsonKey_Mode,
+	JsonKey_Name,
+	JsonKey_Node,
+	JsonKey_Nodes,
+	JsonKey_Normalized,
+	JsonKey_NormalTexture,
+	JsonKey_OcclusionTexture,
+	JsonKey_Opaque,
+	JsonKey_Orthographic,
+	JsonKey_Output,
+	JsonKey_Path,
+	JsonKey_PbrMetallicRoughness,
+	JsonKey_Perspective,
+	JsonKey_Primitives,
+	JsonKey_Rotation,
+	JsonKey_RoughnessFactor,
+	JsonKey_Sampler,
+	JsonKey_Samplers,
+	JsonKey_Scalar,
+	JsonKey_Scale,
+	JsonKey_Scene,
+	JsonKey_Scenes,
+	JsonKey_Skeleton,
+	JsonKey_Skin,
+	JsonKey_Skins,
+	JsonKey_Source,
+	JsonKey_Sparse,
+	JsonKey_Step,
+	JsonKey_Strength,
+	JsonKey_Target,
+	JsonKey_Targets,
+	JsonKey_TexCoord,
+	JsonKey_Textures,
+	JsonKey_Translation,
+	JsonKey_Type,
+	JsonKey_Uri,
+	JsonKey_Values,
+	JsonKey_Vec2,
+	JsonKey_Vec3,
+	JsonKey_Vec4,
+	JsonKey_Version,
+	JsonKey_Weights,
+	JsonKey_WrapS,
+	JsonKey_WrapT,
+	JsonKey_Xmag,
+	JsonKey_Yfov,
+	JsonKey_Ymag,
+	JsonKey_Zfar,
+	JsonKey_Znear,
+} internal_json_key;
+
+/// @brief resolves a json string token to its key with a switch on the length and the first character,
+/// so each token costs a single exact-length compare no matter how many keys the object schema has
+/// @param data the json entire data
+/// @param tok the json token to read
+/// @return the matching key, JsonKey_Unknown if the token is not a string or not a known key
+static internal_json_key internal_json_key_lookup(const char* data, const jsmntok_t* tok) {
+	if (tok->type != JSMN_STRING) return JsonKey_Unknown;
+
+	const char* str = data + tok->start;
+	switch (tok->end - tok->start)
+	{
+	case 3:
+		switch (str[0])
+		{
+		case 'm':
+			if (gltfmemory_cmp(str, "max", 3) == 0) return JsonKey_Max;
+			if (gltfmemory_cmp(str, "min", 3) == 0) return JsonKey_Min;
+			break;
+		case 'u': if (gltfmemory_cmp(str, "uri", 3) == 0) return JsonKey_Uri; break;
+		}
+		break;
+	case 4:
+		switch (str[0])
+		{
+		case 'M':
+			if (gltfmemory_cmp(str, "MASK", 4) == 0) return JsonKey_Mask;
+			if (gltfmemory_cmp(str, "MAT2", 4) == 0) return JsonKey_Mat2;
+			if (gltfmemory_cmp(str, "MAT3", 4) == 0) return JsonKey_Mat3;
+			if (gltfmemory_cmp(str, "MAT4", 4) == 0) return JsonKey_Mat4;
+			break;
+		case 'S': if (gltfmemory_cmp(str, "STEP", 4) == 0) return JsonKey_Step; break;
+		case 'V':
+			if (gltfmemory_cmp(str, "VEC2", 4) == 0) return JsonKey_Vec2;
+			if (gltfmemory_cmp(str, "VEC3", 4) == 0) return JsonKey_Vec3;
+			if (gltfmemory_cmp(str, "VEC4", 4) == 0) return JsonKey_Vec4;
+			break;
+		case 'm':
+			if (gltfmemory_cmp(str, "mesh", 4) == 0) return JsonKey_Mesh;
+			if (gltfmemory_cmp(str, "mode", 4) == 0) return JsonKey_Mode;
+			break;
+		case 'n':
+			if (gltfmemory_cmp(str, "name", 4) == 0) return JsonKey_Name;
+			if (gltfmemory_cmp(str, "node", 4) == 0) return JsonKey_Node;
+			break;
+		case 'p': if (gltfmemory_cmp(str, "path", 4) == 0) return JsonKey_Path; break;
+		case 's': if (gltfmemory_cmp(str, "skin", 4) == 0) return JsonKey_Skin; break;
+		case 't': if (gltfmemory_cmp(str, "type", 4) == 0) return JsonKey_Type; break;
+		case 'x': if (gltfmemory_cmp(str, "xmag", 4) == 0) return JsonKey_Xmag; break;
+		case 'y':
+			if (gltfmemory_cmp(str, "yfov", 4) == 0) return JsonKey_Yfov;
+			if (gltfmemory_cmp(str, "ymag", 4) == 0) return JsonKey_Ymag;
+			break;
+		case 'z': if (gltfmemory_cmp(str, "zfar", 4) == 0) return JsonKey_Zfar; break;
+		}
+		break;
+	case 5:
+		switch (str[0])
+		{
+		case 'B': if (gltfmemory_cmp(str, "BLEND", 5) == 0) return JsonKey_Blend; break;
+		case 'a': if (gltfmemory_cmp(str, "asset", 5) == 0) return JsonKey_Asset; break;
+		case 'c': if (gltfmemory_cmp(str, "count", 5) == 0) return JsonKey_Count; break;
+		case 'i':
+			if (gltfmemory_cmp(str, "index", 5) == 0) return JsonKey_Index;
+			if (gltfmemory_cmp(str, "input", 5) == 0) return JsonKey_Input;
+			break;
+		case 'n': if (gltfmemory_cmp(str, "nodes", 5) == 0) return JsonKey_Nodes; break;
+		case 's':
+			if (gltfmemory_cmp(str, "scale", 5) == 0) return JsonKey_Scale;
+			if (gltfmemory_cmp(str, "scene", 5) == 0) return JsonKey_Scene;
+			if (gltfmemory_cmp(str, "skins", 5) == 0) return JsonKey_Skins;
+			break;
+		case 'w':
+			if (gltfmemory_cmp(str, "wrapS", 5) == 0) return JsonKey_WrapS;
+			if (gltfmemory_cmp(str, "wrapT", 5) == 0) return JsonKey_WrapT;
+			break;
+		case 'z': if (gltfmemory_cmp(str, "znear", 5) == 0) return JsonKey_Znear; break;
+		}
+		break;
+	case 6:
+		switch (str[0])
+		{
+		case 'L': if (gltfmemory_cmp(str, "LINEAR", 6) == 0) return JsonKey_Linear; break;
+		case 'O': if (gltfmemory_cmp(str, "OPAQUE", 6) == 0) return JsonKey_Opaque; break;
+		case 'S': if (gltfmemory_cmp(str, "SCALAR", 6) == 0) return JsonKey_Scalar; break;
+		case 'b': if (gltfmemory_cmp(str, "buffer", 6) == 0) return JsonKey_Buffer; break;
+		case 'c': if (gltfmemory_cmp(str, "camera", 6) == 0) return JsonKey_Camera; break;
+		case 'e': if (gltfmemory_cmp(str, "extras", 6) == 0) return JsonKey_Extras; break;
+		case 'i': if (gltfmemory_cmp(str, "images", 6) == 0) return JsonKey_Images; break;
+		case 'j': if (gltfmemory_cmp(str, "joints", 6) == 0) return JsonKey_Joints; break;
+		case 'm':
+			if (gltfmemory_cmp(str, "matrix", 6) == 0) return JsonKey_Matrix;
+			if (gltfmemory_cmp(str, "meshes", 6) == 0) return JsonKey_Meshes;
+			break;
+		case 'o': if (gltfmemory_cmp(str, "output", 6) == 0) return JsonKey_Output; break;
+		case 's':
+			if (gltfmemory_cmp(str, "scenes", 6) == 0) return JsonKey_Scenes;
+			if (gltfmemory_cmp(str, "source", 6) == 0) return JsonKey_Source;
+			if (gltfmemory_cmp(str, "sparse", 6) == 0) return JsonKey_Sparse;
+			break;
+		case 't': if (gltfmemory_cmp(str, "target", 6) == 0) return JsonKey_Target; break;
+		case 'v': if (gltfmemory_cmp(str, "values", 6) == 0) return JsonKey_Values; break;
+		}
+		break;
+	case 7:
+		switch (str[0])
+		{
+		case 'b': if (gltfmemory_cmp(str, "buffers", 7) == 0) return JsonKey_Buffers; break;
+		case 'c': if (gltfmemory_cmp(str, "cameras", 7) == 0) return JsonKey_Cameras; break;
+		case 'i': if (gltfmemory_cmp(str, "indices", 7) == 0) return JsonKey_Indices; break;
+		case 's': if (gltfmemory_cmp(str, "sampler", 7) == 0) return JsonKey_Sampler; break;
+		case 't': if (gltfmemory_cmp(str, "targets", 7) == 0) return JsonKey_Targets; break;
+		case 'v': if (gltfmemory_cmp(str, "version", 7) == 0) return JsonKey_Version; break;
+		case 'w': if (gltfmemory_cmp(str, "weights", 7) == 0) return JsonKey_Weights; break;
+		}
+		break;
+	case 8:
+		switch (str[0])
+		{
+		case 'c':
+			if (gltfmemory_cmp(str, "channels", 8) == 0) return JsonKey_Channels;
+			if (gltfmemory_cmp(str, "children", 8) == 0) return JsonKey_Children;
+			break;
+		case 'm':
+			if (gltfmemory_cmp(str, "material", 8) == 0) return JsonKey_Material;
+			if (gltfmemory_cmp(str, "mimeType", 8) == 0) return JsonKey_MimeType;
+			break;
+		case 'r': if (gltfmemory_cmp(str, "rotation", 8) == 0) return JsonKey_Rotation; break;
+		case 's':
+			if (gltfmemory_cmp(str, "samplers", 8) == 0) return JsonKey_Samplers;
+			if (gltfmemory_cmp(str, "skeleton", 8) == 0) return JsonKey_Skeleton;
+			if (gltfmemory_cmp(str, "strength", 8) == 0) return JsonKey_Strength;
+			break;
+		case 't':
+			if (gltfmemory_cmp(str, "texCoord", 8) == 0) return JsonKey_TexCoord;
+			if (gltfmemory_cmp(str, "textures", 8) == 0) return JsonKey_Textures;
+			break;
+		}
+		break;
+	case 9:
+		switch (str[0])
+		{
+		case 'a':
+			if (gltfmemory_cmp(str, "accessors", 9) == 0) return JsonKey_Accessors;
+			if (gltfmemory_cmp(str, "alphaMode", 9) == 0) return JsonKey_AlphaMode;
+			break;
+		case 'c': if (gltfmemory_cmp(str, "copyright", 9) == 0) return JsonKey_Copyright; break;
+		case 'g': if (gltfmemory_cmp(str, "generator", 9) == 0) return JsonKey_Generator; break;
+		case 'm':
+			if (gltfmemory_cmp(str, "magFilter", 9) == 0) return JsonKey_MagFilter;
+			if (gltfmemory_cmp(str, "materials", 9) == 0) return JsonKey_Materials;
+			if (gltfmemory_cmp(str, "minFilter", 9) == 0) return JsonKey_MinFilter;
+			break;
+		}
+		break;
+	case 10:
+		switch (str[0])
+		{
+		case 'a':
+			if (gltfmemory_cmp(str, "animations", 10) == 0) return JsonKey_Animations;
+			if (gltfmemory_cmp(str, "attributes", 10) == 0) return JsonKey_Attributes;
+			break;
+		case 'b':
+			if (gltfmemory_cmp(str, "bufferView", 10) == 0) return JsonKey_BufferView;
+			if (gltfmemory_cmp(str, "byteLength", 10) == 0) return JsonKey_ByteLength;
+			if (gltfmemory_cmp(str, "byteOffset", 10) == 0) return JsonKey_ByteOffset;
+			if (gltfmemory_cmp(str, "byteStride", 10) == 0) return JsonKey_ByteStride;
+			break;
+		case 'e': if (gltfmemory_cmp(str, "extensions", 10) == 0) return JsonKey_Extensions; break;
+		case 'm': if (gltfmemory_cmp(str, "minVersion", 10) == 0) return JsonKey_MinVersion; break;
+		case 'n': if (gltfmemory_cmp(str, "normalized", 10) == 0) return JsonKey_Normalized; break;
+		case 'p': if (gltfmemory_cmp(str, "primitives", 10) == 0) return JsonKey_Primitives; break;
+		}
+		break;
+	case 11:
+		switch (str[0])
+		{
+		case 'C': if (gltfmemory_cmp(str, "CUBICSPLINE", 11) == 0) return JsonKey_CubicSpline; break;
+		case 'a':
+			if (gltfmemory_cmp(str, "alphaCutoff", 11) == 0) return JsonKey_AlphaCutoff;
+			if (gltfmemory_cmp(str, "aspectRatio", 11) == 0) return JsonKey_AspectRatio;
+			break;
+		case 'b': if (gltfmemory_cmp(str, "bufferViews", 11) == 0) return JsonKey_BufferViews; break;
+		case 'd': if (gltfmemory_cmp(str, "doubleSided", 11) == 0) return JsonKey_DoubleSided; break;
+		case 'p': if (gltfmemory_cmp(str, "perspective", 11) == 0) return JsonKey_Perspective; break;
+		case 't': if (gltfmemory_cmp(str, "translation", 11) == 0) return JsonKey_Translation; break;
+		}
+		break;
+	case 12:
+		switch (str[0])
+		{
+		case 'o': if (gltfmemory_cmp(str, "orthographic", 12) == 0) return JsonKey_Orthographic; break;
+		}
+		break;
+	case 13:
+		switch (str[0])
+		{
+		case 'c': if (gltfmemory_cmp(str, "componentType", 13) == 0) return JsonKey_ComponentType; break;
+		case 'i': if (gltfmemory_cmp(str, "interpolation", 13) == 0) return JsonKey_Interpolation; break;
+		case 'n': if (gltfmemory_cmp(str, "normalTexture", 13) == 0) return JsonKey_NormalTexture; break;
+		}
+		break;
+	case 14:
+		switch (str[0])
+		{
+		case 'e':
+			if (gltfmemory_cmp(str, "emissiveFactor", 14) == 0) return JsonKey_EmissiveFactor;
+			if (gltfmemory_cmp(str, "extensionsUsed", 14) == 0) return JsonKey_ExtensionsUsed;
+			break;
+		case 'm': if (gltfmemory_cmp(str, "metallicFactor", 14) == 0) return JsonKey_MetallicFactor; break;
+		}
+		break;
+	case 15:
+		switch (str[0])
+		{
+		case 'b': if (gltfmemory_cmp(str, "baseColorFactor", 15) == 0) return JsonKey_BaseColorFactor; break;
+		case 'e': if (gltfmemory_cmp(str, "emissiveTexture", 15) == 0) return JsonKey_EmissiveTexture; break;
+		case 'r': if (gltfmemory_cmp(str, "roughnessFactor", 15) == 0) return JsonKey_RoughnessFactor; break;
+		}
+		break;
+	case 16:
+		switch (str[0])
+		{
+		case 'b': if (gltfmemory_cmp(str, "baseColorTexture", 16) == 0) return JsonKey_BaseColorTexture; break;
+		case 'o': if (gltfmemory_cmp(str, "occlusionTexture", 16) == 0) return JsonKey_OcclusionTexture; break;
+		}
+		break;
+	case 18:
+		switch (str[0])
+		{
+		case 'e': if (gltfmemory_cmp(str, "extensionsRequired", 18) == 0) return JsonKey_ExtensionsRequired; break;
+		}
+		break;
+	case 19:
+		switch (str[0])
+		{
+		case 'i': if (gltfmemory_cmp(str, "inverseBindMatrices", 19) == 0) return JsonKey_InverseBindMatrices; break;
+		}
+		break;
+	case 20:
+		switch (str[0])
+		{
+		case 'p': if (gltfmemory_cmp(str, "pbrMetallicRoughness", 20) == 0) return JsonKey_PbrMetallicRoughness; break;
+		}
+		break;
+	case 24:
+		switch (str[0])
+		{
+		case 'm': if (gltfmemory_cmp(str, "metallicRoughnessTexture", 24) == 0) return JsonKey_MetallicRoughnessTexture; break;
+		}
+		break;
+	}
+	return JsonKey_Unknown;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// parsing GLTF objects
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief converts the read integer to a component type
+/// @param data the json entire data
+/// @param tok the json token to read
+/// @return the component
+static GLTF_ComponentType internal_json_to_component_type(const char* data, const jsmntok_t* tok) {
+	// anything that isn't an integer is reported as an invalid component type below
+	int type = 0;
+	json_read_int(data, tok, &type);
+
+	switch (type)
+	{
+	case 5120: return ComponentType_R8;
+	case 5121: return ComponentType_R8_UNSIGNED;
+	case 5122: return ComponentType_R16;
+	case 5123: return ComponentType_R16_UNSIGNED;
+	case 5125: return ComponentType_R32_UNSIGNED;
+	case 5126: return ComponentType_R32_FLOAT;
+	}
+
+	internal_log_error(ErrorCode_InvalidDocument, "An invalid component type has been parsed");
+	return (GLTF_ComponentType)0;
+}
+
+/// @brief parses a json array of floats, logging the element that is wrong
+/// @param data the json entire data
+/// @param tokens the json tokens
+/// @param tkindex the json array token index
+/// @param outArray the output floats
+/// @param size how many floats the array must have
+/// @param exact 1 when the array must have exactly size floats, 0 when it may have any count of them and only the first size are kept
+/// @return the next token index to be analyzed
+static int internal_parse_float_array(const char* data, const jsmntok_t* tokens, int tkindex, float* outArray, int size, int exact) {
+	int next = exact ? json_parse_array_float(data, tokens, tkindex, outArray, size) : json_parse_array_float_partial(data, tokens, tkindex, outArray, size);
+	if (next < 0) {
+		if (exact) internal_log_error_at(ErrorCode_InvalidDocument, tkindex, "Expected an array of %d numbers", size);
+		else internal_log_error_at(ErrorCode_InvalidDocument, tkindex, "Expected an array of numbers");
+	}
+	return next;
+}
+
+/// @brief parses one element of an array, see internal_parse_elements
+typedef int (*internal_element_parser)(const char* data, const jsmntok_t* tokens, int tkindex, void* outElement);
+
+/// @brief a range of array elements parsed by a single task of internal_parse_elements
+typedef struct {
+	unsigned long long first;
+	unsigned long long last;
+	GLTF_Arena* arena;                  // what the elements allocates, merged into the parse arena afterwards
+	GLTF_Context context;               // the errors of the elements, merged into the parse context afterwards
+	int failed;
+} internal_elements_chunk;
+
+/// @brief the array shared by every task of internal_parse_elements
+typedef struct {
+	const char* data;
+	const jsmntok_t* tokens;
+	const int* starts;                  // the token every element starts at
+	unsigned char* elements;
+	unsigned long long elementSize;
+	internal_element_parser parse;
+	const internal_parse_state* state;
+	internal_elements_chunk* chunks;
+	volatile long long failedChunk;     // the first chunk that has failed so far, the chunks after it are not parsed
+} internal_elements_work;
+
+/// @brief appends the errors of a context to another one
+/// @param context where the errors are appended
+/// @param other the errors to append
+static void internal_context_merge(GLTF_Context* context, const GLTF_Context* other) {
+	unsigned int kept = other->errorsCount < GLTF_MAX_ERRORS ? other->errorsCount : GLTF_MAX_ERRORS;
+	for (unsigned int i = 0; i < kept && context->errorsCount + i < GLTF_MAX_ERRORS; ++i) {
+		context->errors[context->errorsCount + i] = other->errors[i];
+	}
+	context->errorsCount += other->errorsCount;
+
+	if (other->log[0]) {
+		unsigned long long length = strlen(context->log);
+		if (length > 0) internal_append(context->log, &length, GLTF_LOG_BUFFER_SIZE, "\n");
+		internal_append(context->log, &length, GLTF_LOG_BUFFER_SIZE, "%s", other->log);
+	}
+}
+
+/// @brief parses a chunk of array elements, may run on any thread
+/// @param taskData the internal_elements_work
+/// @param index which chunk to parse
+static void internal_elements_task(void* taskData, unsigned long long index) {
+	internal_elements_work* work = (internal_elements_work*)taskData;
+	internal_elements_chunk* chunk = work->chunks + index;
+
+	// the chunk is parsed like the rest of the document, but it allocates and logs on it's own so no locking is needed
+	internal_parse_state state = *work->state;
+	state.arena = &chunk->arena;
+	state.context = &chunk->context;
+	state.previous = s_gState;
+	s_gState = &state;
+
+	chunk->arena = gltfarena_create(&state.options.allocator);
+	if (!chunk->arena) {
+		internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for the parsed data");
+		chunk->failed = 1;
+	}
+
+	// once an earlier chunk has failed nothing after it is reported, so there's no point in parsing it
+	for (unsigned long long j = chunk->first; j < chunk->last && !chunk->failed; ++j) {
+		if (platform_atomic_add(&work->failedChunk, 0) < (long long)index) break;
+		if (work->parse(work->data, work->tokens, work->starts[j], work->elements + j * work->elementSize) < 0) chunk->failed = 1;
+	}
+
+	if (chunk->failed) platform_atomic_min(&work->failedChunk, (long long)index);
+	internal_parse_end(&state);
+}
+
+/// @brief parses the elements of an array already allocated by json_parse_array, big arrays are split across threads when the options allows it
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the token of the first element
+/// @param count how many elements the array has
+/// @param elementSize the size of each element
+/// @param elements the array elements
+/// @param parse parses a single element
+/// @return the next token index to be analyzed
+static int internal_parse_elements(const char* data, const jsmntok_t* tokens, int tkindex, unsigned long long count, unsigned long long elementSize, void* elements, internal_element_parser parse) {
+	const GLTF_ParseOptions* options = &s_gState->options;
+	if (options->parseThreads <= 1 || count < GLTF_PARALLEL_ELEMENTS_MIN) {
+		for (unsigned long long j = 0; j < count; ++j) {
+			tkindex = parse(data, tokens, tkindex, (unsigned char*)elements + j * elementSize);
+			if (tkindex < 0) return tkindex;
+		}
+		return tkindex;
+	}
+
+	// the elements are independent once it's known where each one starts
+	int* starts = (int*)gltfmemory_allocate(&options->allocator, sizeof(int) * count, 0);
+	if (!starts) {
+		internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for the array elements");
+		return -1;
+	}
+
+	for (unsigned long long j = 0; j < count; ++j) {
+		starts[j] = tkindex;
+		tkindex = json_parse_skip(tokens, tkindex);
+	}
+
+	// a few chunks per thread keeps them busy when some elements are heavier than others
+	unsigned long long chunkSize = count / ((unsigned long long)options->parseThreads * 4);
+	if (chunkSize < GLTF_PARALLEL_ELEMENTS_MIN / 4) chunkSize = GLTF_PARALLEL_ELEMENTS_MIN / 4;
+	unsigned long long chunksCount = (count + chunkSize - 1) / chunkSize;
+
+	internal_elements_chunk* chunks = (internal_elements_chunk*)gltfmemory_allocate(&options->allocator, sizeof(internal_elements_chunk) * chunksCount, 0);
+	if (!chunks) {
+		gltfmemory_deallocate(&options->allocator, starts);
+		internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for the array elements");
+		return -1;
+	}
+
+	for (unsigned long long c = 0; c < chunksCount; ++c) {
+		chunks[c].first = c * chunkSize;
+		chunks[c].last = c * chunkSize + chunkSize < count ? c * chunkSize + chunkSize : count;
+		chunks[c].arena = NULL;
+		chunks[c].context.errorsCount = 0;
+		chunks[c].context.log[0] = '\0';
+		chunks[c].failed = 0;
+	}
+
+	internal_elements_work work;
+	work.data = data;
+	work.tokens = tokens;
+	work.starts = starts;
+	work.elements = (unsigned char*)elements;
+	work.elementSize = elementSize;
+	work.parse = parse;
+	work.state = s_gState;
+	work.chunks = chunks;
+	work.failedChunk = (long long)chunksCount;
+
+	if (options->taskDispatch) options->taskDispatch(options->taskUserData, internal_elements_task, &work, chunksCount);
+	else platform_parallel_for(options->parseThreads, chunksCount, internal_elements_task, &work, &options->allocator);
+
+	// the chunks are merged in order, so the errors are reported as if they were parsed one after the other:
+	// a sequential parse stops at the first failing element, the errors of the chunks after it are dropped but their arenas are still kept to be released
+	int failed = 0;
+	for (unsigned long long c = 0; c < chunksCount; ++c) {
+		gltfarena_merge(s_gState->arena, chunks[c].arena);
+		if (!failed) internal_context_merge(s_gState->context, &chunks[c].context);
+		failed |= chunks[c].failed;
+	}
+
+	gltfmemory_deallocate(&options->allocator, chunks);
+	gltfmemory_deallocate(&options->allocator, starts);
+	return failed ? -1 : tkindex;
+}
+
+/// @brief parses a json string, it points into the json when the parse uses string views, otherwise it's copied into the arena
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outString the output
+/// @return the next token index to be analyzed
+static int internal_parse_string(const char* data, const jsmntok_t* tokens, int tkindex, char** outString) {
+	// string views are only used when the json is a heap copy owned by the parsed data, so it can be written
+	if (s_gState->stringViews) return json_parse_string_view((char*)data, tokens, tkindex, outString);
+	return json_parse_string(data, tokens, tkindex, outString, s_gState->arena);
+}
+
+/// @brief parses a json array of strings, each one like internal_parse_string does
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outArr the output
+/// @param outSize how many strings the array has
+/// @return the next token index to be analyzed
+static int internal_parse_string_array(const char* data, const jsmntok_t* tokens, int tkindex, char*** outArr, unsigned long long* outSize) {
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(char*), (void**)outArr, outSize, s_gState->arena);
+	for (unsigned long long j = 0; j < *outSize && tkindex >= 0; ++j) {
+		tkindex = internal_parse_string(data, tokens, tkindex, j + (*outArr));
+	}
+	return tkindex;
+}
+
+/// @brief keeps the raw json text of a token, like extras and extension objects, as a string view or an arena copy
+/// @param data the json entire data
+/// @param tok the json token to keep
+/// @return the raw json text, NULL on failure
+static char* internal_parse_raw(const char* data, const jsmntok_t* tok) {
+	unsigned long long size = tok->end - tok->start;
+
+	// the character after an object or array is a separator the tokens never look at again
+	if (s_gState->stringViews) {
+		char* raw = (char*)data + tok->start;
+		raw[size] = '\0';
+		return raw;
+	}
+
+	char* raw = (char*)gltfarena_allocate(s_gState->arena, size + 1, 0);
+	if (!raw) return NULL;
+
+	gltfmemory_copy(raw, data + tok->start, size);
+	raw[size] = '\0';
+	return raw;
+}
+
+/// @brief any extra information a gltf object may have will be dealed as a char*
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outExtra the output
+/// @return the next token index to be analyzed
+static int internal_parse_extras(const char* data, const jsmntok_t* tokens, int tkindex, char** outExtra) {
+	*outExtra = internal_parse_raw(data, tokens + tkindex);
+	GLTF_ASSERT(*outExtra, ErrorCode_OutOfMemory, "Failed to allocate memory for extra data parsing");
+
+	tkindex = json_parse_skip(tokens, tkindex);
+	return tkindex;
+}
+
+/// @brief checks if a json string is a base64 encoded data uri
+/// @param data the json entire data
+/// @param tok the json token to check
+/// @param outPayload the index in data where the base64 characters starts
+/// @return 1 if it's a base64 data uri, 0 otherwise
+static int internal_is_base64_uri(const char* data, const jsmntok_t* tok, int* outPayload) {
+	if (tok->type != JSMN_STRING || tok->end - tok->start < 5 || gltfmemory_cmp(data + tok->start, "data:", 5) != 0) return 0;
+
+	for (int i = tok->start + 5; i < tok->end; ++i) {
+		if (data[i] != ',') continue;
+
+		// the shortest header is "data:;base64"
+		if (i - tok->start >= 12 && gltfmemory_cmp(data + i - 7, ";base64", 7) == 0) {
+			*outPayload = i + 1;
+			return 1;
+		}
+		return 0;
+	}
+	return 0;
+}
+
+/// @brief decodes a base64 data uri straight from the json data into it's own storage, without copying the uri
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param payload the index in data where the base64 characters starts
+/// @param outStorage the decoded data
+/// @param outMimeType the mime type the uri declares, NULL if not wanted
+/// @return the next token index to be analyzed
+static int internal_parse_base64_uri(const char* data, const jsmntok_t* tokens, int tkindex, int payload, GLTF_Storage* outStorage, char** outMimeType) {
+	unsigned long long length = tokens[tkindex].end - payload;
+	void* decoded = gltfmemory_allocate(&s_gState->options.allocator, base64_decoded_size(length), 0);
+	GLTF_ASSERT(decoded, ErrorCode_OutOfMemory, "Failed to allocate memory for a base64 data uri");
+
+	unsigned long long size = 0;
+	if (!base64_decode(data + payload, length, decoded, &size)) {
+		gltfmemory_deallocate(&s_gState->options.allocator, decoded);
+		internal_log_error(ErrorCode_InvalidDocument, "Invalid base64 data uri");
+		return -1;
+	}
+
+	outStorage->data = decoded;
+	outStorage->size = size;
+	outStorage->type = StorageType_Heap;
+
+	// the mime type sits between "data:" and ";base64"
+	unsigned long long mimeLength = payload - 8 - (tokens[tkindex].start + 5);
+	if (outMimeType && mimeLength > 0) {
+		*outMimeType = (char*)gltfarena_allocate(s_gState->arena, mimeLength + 1, 0);
+		GLTF_ASSERT(*outMimeType, ErrorCode_OutOfMemory, "Failed to allocate memory for a data uri mime type");
+
+		strncpy_impl(*outMimeType, data + tokens[tkindex].start + 5, mimeLength);
+		(*outMimeType)[mimeLength] = '\0';
+	}
+
+	return tkindex + 1;
+}
+
+/// @brief parses the extensions that are not processed yet
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outExtension the output extension info
+/// @return the next token index to be analyzed
+static int internal_parse_unprocessed_extension(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Extension* outExtension) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING, ErrorCode_InvalidDocument, "Unpprocessed extension token is not a string");
+	GLTF_ASSERT(tokens[tkindex + 1].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "Unprocessed extension token value is not an object");
+
+	tkindex = internal_parse_string(data, tokens, tkindex, &outExtension->name);
+	GLTF_ASSERT(tkindex >= 0, ErrorCode_OutOfMemory, "Failed to allocate memory for unprocessed extension name");
+
+	outExtension->data = internal_parse_raw(data, tokens + tkindex);
+	GLTF_ASSERT(outExtension->data, ErrorCode_OutOfMemory, "Failed to allocate memory for unprocessed extension data");
+
+	tkindex = json_parse_skip(tokens, tkindex);
+	return tkindex;
+}
+
+/// @brief handles unprocessed extensions
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outextensionsCount how many extensions the gltf file has
+/// @param outExtensions the output
+/// @return the next token index to be analyzed
+static int internal_parse_unprocessed_extensions(const char* data, const jsmntok_t* tokens, int tkindex, unsigned long long* outextensionsCount, GLTF_Extension** outExtensions) {
+	++tkindex;
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+
+	int extensionsSize = tokens[tkindex].size;
+	*outextensionsCount = 0;
+	*outExtensions = (GLTF_Extension*)gltfarena_allocate(s_gState->arena, sizeof(GLTF_Extension) * extensionsSize, 0);
+	GLTF_ASSERT((*outExtensions), ErrorCode_OutOfMemory, "Failed to allocate memory for extensions");
+
+	++tkindex;
+	for (int j = 0; j < extensionsSize; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		unsigned long long extensionIndex = (*outextensionsCount)++;
+		GLTF_Extension* extension = &((*outExtensions)[extensionIndex]);
+		tkindex = internal_parse_unprocessed_extension(data, tokens, tkindex, extension);
+
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief parses a sparse-accessor field from the json data
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outAccessor the output acessor
+/// @return the next token index to be analyzed
+static int internal_json_parse_accessor_sparse(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_SparseAccessor* outAccessor) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
+
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Count) { 
+			++tkindex; GLTF_ASSERT(json_read_size(data, tokens + tkindex, &outAccessor->count), ErrorCode_InvalidDocument, "Invalid json number"); ++tkindex; 
+		}
+		else if (key == JsonKey_Indices) {
+			++tkindex;
+			GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+
+			int indicesSize = tokens[tkindex].size;
+			++tkindex;
+
+			for (int k = 0; k < indicesSize; ++k) {
+				GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+				const internal_json_key subkey = internal_json_key_lookup(data, tokens + tkindex);
+				if (subkey == JsonKey_BufferView) {
+					++tkindex;
+					JSON_READ_INDEX(outAccessor->indicesBufferView, GLTF_BufferView); 
+					++tkindex;
+				}
+				else if (subkey == JsonKey_ByteOffset) { 
+					++tkindex;
+					GLTF_ASSERT(json_read_size(data, tokens + tkindex, &outAccessor->indicesByteOffset), ErrorCode_InvalidDocument, "Invalid json number");
+					++tkindex;
+				}
+				else if (subkey == JsonKey_ComponentType) {
+					++tkindex;
+					outAccessor->indicesComponentType = internal_json_to_component_type(data, tokens + tkindex);
+					++tkindex;
+				}
+				else { 
+					tkindex = json_parse_skip(tokens, tkindex + 1);
+				}
+
+				if (tkindex < 0) return tkindex;
+			}
+		}
+		else if (key == JsonKey_Values) {
+			++tkindex;
+			GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+
+			int valuesSize = tokens[tkindex].size;
+			++tkindex;
+
+			for (int k = 0; k < valuesSize; ++k) {
+				GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+				const internal_json_key subkey = internal_json_key_lookup(data, tokens + tkindex);
+				if (subkey == JsonKey_BufferView) { 
+					++tkindex; 
+					JSON_READ_INDEX(outAccessor->valuesBufferView, GLTF_BufferView); 
+					++tkindex;
+				}
+				else if (subkey == JsonKey_ByteOffset) { 
+					++tkindex;
+					GLTF_ASSERT(json_read_size(data, tokens + tkindex, &outAccessor->valueByteOffset), ErrorCode_InvalidDocument, "Invalid json number");
+					++tkindex;
+				}
+				else { 
+					tkindex = json_parse_skip(tokens, tkindex + 1); 
+				}
+
+				if (tkindex < 0) return tkindex;
+			}
+		}
+		else { 
+			tkindex = json_parse_skip(tokens, tkindex + 1); 
+		}
+
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief parses an accessor field from the json data
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outAccessor the output acessor
+/// @return the next token index to be analyzed
+static int internal_parse_json_accessor(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Accessor* outAccessor) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
+
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) { 
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outAccessor->name);
+		}
+		else if (key == JsonKey_BufferView) { 
+			++tkindex;
+			JSON_READ_INDEX(outAccessor->bufferView, GLTF_BufferView);
+			++tkindex;
+		}
+		else if (key == JsonKey_ByteOffset) {
+			++tkindex;
+			GLTF_ASSERT(json_read_size(data, tokens + tkindex, &outAccessor->offset), ErrorCode_InvalidDocument, "Invalid json number"); 
+			++tkindex; 
+		}
+		else if (key == JsonKey_ComponentType) {
+			++tkindex; 
+			outAccessor->componentType = internal_json_to_component_type(data, tokens + tkindex); 
+			++tkindex;
+		}
+		else if (key == JsonKey_Normalized) { 
+			++tkindex;
+			outAccessor->normalized = json_to_bool(data, tokens + tkindex); 
+			++tkindex; 
+		}
+		else if (key == JsonKey_Count) { 
+			++tkindex;
+			GLTF_ASSERT(json_read_size(data, tokens + tkindex, &outAccessor->count), ErrorCode_InvalidDocument, "Invalid json number"); 
+			++tkindex; 
+		}
+		else if (key == JsonKey_Type) {
+			++tkindex;
+			const internal_json_key value = internal_json_key_lookup(data, tokens + tkindex);
+			if (value == JsonKey_Scalar) {
+				outAccessor->type = Type_Scalar; 
+			}
+			else if (value == JsonKey_Vec2) { 
+				outAccessor->type = Type_Vec2;
+			}
+			else if (value == JsonKey_Vec3) { 
+				outAccessor->type = Type_Vec3;
+			}
+			else if (value == JsonKey_Vec4) { 
+				outAccessor->type = Type_Vec4;
+			}
+			else if (value == JsonKey_Mat2) {
+				outAccessor->type = Type_Mat2; 
+			}
+			else if (value == JsonKey_Mat3) { 
+				outAccessor->type = Type_Mat3; 
+			}
+			else if (value == JsonKey_Mat4) {
+				outAccessor->type = Type_Mat4;
+			}
+			++tkindex;
+		}
+		else if (key == JsonKey_Sparse) { 
+			outAccessor->isSparse = 1;
+			tkindex = internal_json_parse_accessor_sparse(data, tokens, tkindex + 1, &outAccessor->sparse);
+		}
+		else if (key == JsonKey_Min) { 
+			++tkindex; 
+			outAccessor->hasMin = 1;
+			tkindex = internal_parse_float_array(data, tokens, tkindex, outAccessor->min, 16, 0);
+		}
+		else if (key == JsonKey_Max) { 
+			++tkindex;
+			outAccessor->hasMax = 1;
+			tkindex = internal_parse_float_array(data, tokens, tkindex, outAccessor->max, 16, 0);
+		}
+		else if (key == JsonKey_Extras) { 
+			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outAccessor->extras);
+		}
+		else if (key == JsonKey_Extensions) {
+			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outAccessor->extensionsCount, &outAccessor->extensions);
+		}
+		else { 
+			tkindex = json_parse_skip(tokens, tkindex + 1); 
+		}
+
+		if (tkindex < 0) return tkindex;
+	}
+
+	return tkindex;
+}
+
+/// @brief internal_parse_json_accessor for internal_parse_elements
+static int internal_parse_json_accessor_element(const char* data, const jsmntok_t* tokens, int tkindex, void* outElement) {
+	return internal_parse_json_accessor(data, tokens, tkindex, (GLTF_Accessor*)outElement);
+}
+
+/// @brief parses the accessors field
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outData the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_accessors(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Accessor), (void**)&outData->accessors, &outData->accessorsCount, s_gState->arena);
+	if (tkindex < 0) return tkindex;
+
+	return internal_parse_elements(data, tokens, tkindex, outData->accessorsCount, sizeof(GLTF_Accessor), outData->accessors, internal_parse_json_accessor_element);
+}
+
+/// @brief parses the asset structure
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outAsset the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_asset(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Asset* outAsset) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
+
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Copyright) { 
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outAsset->copyright); 
+		}
+		else if (key == JsonKey_Generator) { 
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outAsset->generator);
+		}
+		else if (key == JsonKey_Version) { 
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outAsset->version);
+		}
+		else if (key == JsonKey_MinVersion) {
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outAsset->minVersion);
+		}
+		else if (key == JsonKey_Extras) {
+			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outAsset->extras);
+		}
+		else if (key == JsonKey_Extensions) {
+			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outAsset->extensionsCount, &outAsset->extensions);
+		}
+		else {
+			tkindex = json_parse_skip(tokens, tkindex + 1); 
+		}
+
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief reads the major number of an asset version, independently of the current locale
+/// @param version the version string, like "2.0"
+/// @return the major version, like 2, -1 when the version doesn't start with a digit
+static int internal_version_major(const char* version) {
+	if (version[0] < '0' || version[0] > '9') return -1;
+
+	int major = 0;
+	for (const char* c = version; *c >= '0' && *c <= '9' && major < 1000; ++c) {
+		major = major * 10 + (*c - '0');
+	}
+	return major;
+}
+
+/// @brief parses the buffer view
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outBufferView the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_buffer_view(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_BufferView* outBufferView) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
+
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) { 
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outBufferView->name);
+		}
+		else if (key == JsonKey_Buffer) {
+			++tkindex; 
+			JSON_READ_INDEX(outBufferView->buffer, GLTF_Buffer); 
+			++tkindex;
+		}
+		else if (key == JsonKey_ByteOffset) { 
+			++tkindex; 
+			GLTF_ASSERT(json_read_size(data, tokens + tkindex, &outBufferView->offset), ErrorCode_InvalidDocument, "Invalid json number"); 
+			++tkindex;
+		}
+		else if (key == JsonKey_ByteLength) { 
+			++tkindex; GLTF_ASSERT(json_read_size(data, tokens + tkindex, &outBufferView->size), ErrorCode_InvalidDocument, "Invalid json number"); ++tkindex;
+		}
+		else if (key == JsonKey_ByteStride) { 
+			++tkindex;
+			GLTF_ASSERT(json_read_size(data, tokens + tkindex, &outBufferView->stride), ErrorCode_InvalidDocument, "Invalid json number");
+			++tkindex; 
+		}
+		else if (key == JsonKey_Target) { 
+			++tkindex; 
+			JSON_READ_ENUM(outBufferView->type, GLTF_BufferViewType); 
+			tkindex++;
+		}
+		else if (key == JsonKey_Extras) {
+			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outBufferView->extras);
+		}
+		else if (key == JsonKey_Extensions) {
+			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outBufferView->extensionsCount, &outBufferView->extensions);
+		}
+		else { 
+			tkindex = json_parse_skip(tokens, tkindex + 1);
+		}
+
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief internal_parse_buffer_view for internal_parse_elements
+static int internal_parse_buffer_view_element(const char* data, const jsmntok_t* tokens, int tkindex, void* outElement) {
+	return internal_parse_buffer_view(data, tokens, tkindex, (GLTF_BufferView*)outElement);
+}
+
+/// @brief parses the buffer views
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outBufferView the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_bufferviews(const char* data, const jsmntok_t* tokens, int i, GLTF2* outData) {
+	i = json_parse_array(data, tokens, i, sizeof(GLTF_BufferView), (void**)&outData->bufferViews, &outData->bufferViewsCount, s_gState->arena);
+	if (i < 0) return i;
+
+	return internal_parse_elements(data, tokens, i, outData->bufferViewsCount, sizeof(GLTF_BufferView), outData->bufferViews, internal_parse_buffer_view_element);
+}
+
+/// @brief parses a buffer
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outBuffer the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_buffer(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Buffer* outBuffer) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
+
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) {
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outBuffer->name);
+		}
+		else if (key == JsonKey_ByteLength) {
+			++tkindex;
+			GLTF_ASSERT(json_read_size(data, tokens + tkindex, &outBuffer->size), ErrorCode_InvalidDocument, "Invalid json number");
+			++tkindex;
+		}
+		else if (key == JsonKey_Uri) {
+			int payload = 0;
+			if (s_gState->options.bufferMode == BufferMode_Load && internal_is_base64_uri(data, tokens + tkindex + 1, &payload)) {
+				tkindex = internal_parse_base64_uri(data, tokens, tkindex + 1, payload, &outBuffer->storage, NULL);
+				outBuffer->data = outBuffer->storage.data;
+			}
+			else {
+				tkindex = internal_parse_string(data, tokens, tkindex + 1, &outBuffer->URI);
+			}
+		}
+		else if (key == JsonKey_Extras) { 
+			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outBuffer->extras);
+		}
+		else if (key == JsonKey_Extensions) {
+			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outBuffer->extensionsCount, &outBuffer->extensions);
+		}
+		else { 
+			tkindex = json_parse_skip(tokens, tkindex + 1);
+		}
+
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief parses the buffers
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outData the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_buffers(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Buffer), (void**)&outData->buffers, &outData->buffersCount, s_gState->arena);
+	if (tkindex < 0) return tkindex;
+
+	for (unsigned long long j = 0; j < outData->buffersCount; ++j) {
+		tkindex = internal_parse_buffer(data, tokens, tkindex, &outData->buffers[j]);
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief parses an animation sampler
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outSampler the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_animation_sampler(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_AnimationSampler* outSampler) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
+
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Input) { 
+			++tkindex; 
+			JSON_READ_INDEX(outSampler->input, GLTF_Accessor); 
+			++tkindex; 
+		}
+		else if (key == JsonKey_Output) { 
+			++tkindex;
+			JSON_READ_INDEX(outSampler->output, GLTF_Accessor);
+			++tkindex; 
+		}
+		else if (key == JsonKey_Interpolation) {
+			++tkindex;
+			const internal_json_key value = internal_json_key_lookup(data, tokens + tkindex);
+			if (value == JsonKey_Linear) {
+				outSampler->interpolation = InterpolationType_Linear;
+			}
+			else if (value == JsonKey_Step) {
+				outSampler->interpolation = InterpolationType_Step;
+			}
+			else if (value == JsonKey_CubicSpline) {
+				outSampler->interpolation = InterpolationType_CubicSpline; 
+			}
+			++tkindex;
+		}
+		else if (key == JsonKey_Extras) { 
+			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outSampler->extras);
+		}
+		else if (key == JsonKey_Extensions) { 
+			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outSampler->extensionsCount, &outSampler->extensions);
+		}
+		else {
+			tkindex = json_parse_skip(tokens, tkindex + 1); 
+		}
+
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief parses an animation channel
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outChannel the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_animation_channel(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_AnimationChannel* outChannel) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
+
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Sampler) { 
+			++tkindex; JSON_READ_INDEX(outChannel->sampler, GLTF_AnimationSampler);
+			++tkindex; 
+		}
+		else if (key == JsonKey_Target) {
+			++tkindex;
+			GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+			int target_size = tokens[tkindex].size;
+			++tkindex;
+
+			for (int k = 0; k < target_size; ++k) {
+				GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+				const internal_json_key subkey = internal_json_key_lookup(data, tokens + tkindex);
+				if (subkey == JsonKey_Node) { 
+					++tkindex; JSON_READ_INDEX(outChannel->targetNode, GLTF_Node); ++tkindex; }
+				else if (subkey == JsonKey_Path) {
+					++tkindex;
+					const internal_json_key value = internal_json_key_lookup(data, tokens + tkindex);
+					if (value == JsonKey_Translation) { 
+						outChannel->targetPath = AnimationPathType_Translation; 
+					}
+					else if (value == JsonKey_Rotation) { 
+						outChannel->targetPath = AnimationPathType_Rotation; 
+					}
+					else if (value == JsonKey_Scale) { 
+						outChannel->targetPath = AnimationPathType_Scale;
+					}
+					else if (value == JsonKey_Weights) {
+						outChannel->targetPath = AnimationPathType_Weights; 
+					}
+					++tkindex;
+				}
+				else if (subkey == JsonKey_Extras) { 
+					tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outChannel->extras);
+				}
+				else if (subkey == JsonKey_Extensions) { 
+					tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outChannel->extensionsCount, &outChannel->extensions);
+				}
+				else { 
+					tkindex = json_parse_skip(tokens, tkindex + 1);
+				}
+
+				if (tkindex < 0) return tkindex;
+			}
+		}
+		else { 
+			tkindex = json_parse_skip(tokens, tkindex + 1);
+		}
+
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief parses an animation
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outAnimation the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_animation(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Animation* outAnimation) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
+
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) { 
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outAnimation->name);
+		}
+		else if (key == JsonKey_Samplers) {
+			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_AnimationSampler), (void**)&outAnimation->samplers, &outAnimation->samplersCount, s_gState->arena);
+			if (tkindex < 0) return tkindex;
+
+			for (unsigned long long k = 0; k < outAnimation->samplersCount; ++k) {
+				tkindex = internal_parse_animation_sampler(data, tokens, tkindex, &outAnimation->samplers[k]);
+				if (tkindex < 0) return tkindex;
+			}
+		}
+		else if (key == JsonKey_Channels) {
+			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_AnimationChannel), (void**)&outAnimation->channels, &outAnimation->channelsCount, s_gState->arena);
+			if (tkindex < 0) return tkindex;
+
+			for (unsigned long long k = 0; k < outAnimation->channelsCount; ++k) {
+				tkindex = internal_parse_animation_channel(data, tokens, tkindex, &outAnimation->channels[k]);
+				if (tkindex < 0) return tkindex;
+			}
+		}
+		else if (key == JsonKey_Extras) { 
+			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outAnimation->extras);
+		}
+		else if (key == JsonKey_Extensions) { 
+			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outAnimation->extensionsCount, &outAnimation->extensions);
+		}
+		else { 
+			tkindex = json_parse_skip(tokens, tkindex + 1);
+		}
+
+		if (tkindex < 0) { return tkindex; }
+	}
+	return tkindex;
+}
+
+/// @brief parses the animations field from json data
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outData the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_animations(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Animation), (void**)&outData->animations, &outData->animationsCount, s_gState->arena);
+	if (tkindex < 0) return tkindex;
+
+	for (unsigned long long j = 0; j < outData->animationsCount; ++j) {
+		tkindex = internal_parse_animation(data, tokens, tkindex, &outData->animations[j]);
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief parses a camera field from json data
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outCamera the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_camera(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Camera* outCamera) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
+
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) { 
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outCamera->name);
+		}
+		else if (key == JsonKey_Perspective) {
+			++tkindex;
+			GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+			int data_size = tokens[tkindex].size;
+			++tkindex;
+
+			outCamera->type = CameraType_Perspective;
+
+			for (int k = 0; k < data_size; ++k) {
+				GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+				const internal_json_key subkey = internal_json_key_lookup(data, tokens + tkindex);
+				if (subkey == JsonKey_AspectRatio) {
+					++tkindex;
+					outCamera->data.perspective.hasAspectRatio = 1;
+					GLTF_ASSERT(json_read_float(data, tokens + tkindex, &outCamera->data.perspective.aspectRatio), ErrorCode_InvalidDocument, "Invalid json number");
+					++tkindex;
+				}
+				else if (subkey == JsonKey_Yfov) { 
+					++tkindex;
+					GLTF_ASSERT(json_read_float(data, tokens + tkindex, &outCamera->data.perspective.yFOV), ErrorCode_InvalidDocument, "Invalid json number");
+					++tkindex;
+				}
+				else if (subkey == JsonKey_Zfar) {
+					++tkindex;
+					outCamera->data.perspective.hasZFar = 1;
+					GLTF_ASSERT(json_read_float(data, tokens + tkindex, &outCamera->data.perspective.zFar), ErrorCode_InvalidDocument, "Invalid json number");
+					++tkindex;
+				}
+				else if (subkey == JsonKey_Znear) { 
+					++tkindex;
+					GLTF_ASSERT(json_read_float(data, tokens + tkindex, &outCamera->data.perspective.zNear), ErrorCode_InvalidDocument, "Invalid json number"); 
+					++tkindex; 
+				}
+				else if (subkey == JsonKey_Extras) { 
+					tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outCamera->data.perspective.extras);
+				}
+				else {
+					tkindex = json_parse_skip(tokens, tkindex + 1); 
+				}
+
+				if (tkindex < 0)  return tkindex;
+			}
+		}
+		else if (key == JsonKey_Orthographic) {
+			++tkindex;
+			GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+			int data_size = tokens[tkindex].size;
+			++tkindex;
+			outCamera->type = CameraType_Orthographic;
+
+			for (int k = 0; k < data_size; ++k) {
+				GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+				const internal_json_key subkey = internal_json_key_lookup(data, tokens + tkindex);
+				if (subkey == JsonKey_Xmag) { 
+					++tkindex; 
+					GLTF_ASSERT(json_read_float(data, tokens + tkindex, &outCamera->data.orthographic.xMag), ErrorCode_InvalidDocument, "Invalid json number");
+					++tkindex;
+				}
+				else if (subkey == JsonKey_Ymag) {
+					++tkindex; 
+					GLTF_ASSERT(json_read_float(data, tokens + tkindex, &outCamera->data.orthographic.yMag), ErrorCode_InvalidDocument, "Invalid json number"); 
+					++tkindex;
+				}
+				else if (subkey == JsonKey_Zfar) { 
+					++tkindex; 
+					GLTF_ASSERT(json_read_float(data, tokens + tkindex, &outCamera->data.orthographic.zFar), ErrorCode_InvalidDocument, "Invalid json number"); 
+					++tkindex; 
+				}
+				else if (subkey == JsonKey_Znear) {
+					++tkindex; 
+					GLTF_ASSERT(json_read_float(data, tokens + tkindex, &outCamera->data.orthographic.zNear), ErrorCode_InvalidDocument, "Invalid json number");
+					++tkindex;
+				}
+				else if (subkey == JsonKey_Extras) {
+					tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outCamera->data.orthographic.extras);
+				}
+				else { 
+					tkindex = json_parse_skip(tokens, tkindex + 1);
+				}
+
+				if (tkindex < 0) return tkindex;
+			}
+		}
+		else if (key == JsonKey_Extras) {
+			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outCamera->extras);
+		}
+		else if (key == JsonKey_Extensions) { 
+			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outCamera->extensionsCount, &outCamera->extensions);
+		}
+		else { 
+			tkindex = json_parse_skip(tokens, tkindex + 1);
+		}
+
+		if (tkindex < 0)  return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief parses the cameras field of a json data
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outData the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_cameras(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Camera), (void**)&outData->cameras, &outData->camerasCount, s_gState->arena);
+	if (tkindex < 0) return tkindex;
+
+	for (unsigned long long j = 0; j < outData->camerasCount; ++j) {
+		tkindex = internal_parse_camera(data, tokens, tkindex, &outData->cameras[j]);
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief parses an image
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outImage the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_image(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Image* outImage) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
+
+	char* uriMimeType = NULL;
+
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Uri) { 
+			int payload = 0;
+			if (s_gState->options.bufferMode == BufferMode_Load && internal_is_base64_uri(data, tokens + tkindex + 1, &payload)) {
+				tkindex = internal_parse_base64_uri(data, tokens, tkindex + 1, payload, &outImage->storage, &uriMimeType);
+				outImage->data = outImage->storage.data;
+				outImage->size = outImage->storage.size;
+			}
+			else {
+				tkindex = internal_parse_string(data, tokens, tkindex + 1, &outImage->URI);
+			}
+		}
+		else if (key == JsonKey_BufferView) { 
+			++tkindex; 
+			JSON_READ_INDEX(outImage->bufferView, GLTF_BufferView); 
+			++tkindex; 
+		}
+		else if (key == JsonKey_MimeType) { 
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outImage->mime_type); 
+		}
+		else if (key == JsonKey_Name) { 
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outImage->name); 
+		}
+		else if (key == JsonKey_Extras) { 
+			tkindex = internal_parse_extras(data , tokens, tkindex + 1, &outImage->extras);
+		}
+		else if (key == JsonKey_Extensions) { 
+			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outImage->extensionsCount, &outImage->extensions);
+		}
+		else { 
+			tkindex = json_parse_skip(tokens, tkindex + 1);
+		}
+
+		if (tkindex < 0) return tkindex;
+	}
+
+	// an explicit mime type has priority over the one the data uri declares
+	if (!outImage->mime_type) outImage->mime_type = uriMimeType;
+
+	return tkindex;
+}
+
+/// @brief parses the json images
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outData the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_images(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Image), (void**)&outData->images, &outData->imagesCount, s_gState->arena);
+	if (tkindex < 0) return tkindex;
+
+	for (unsigned long long j = 0; j < outData->imagesCount; ++j) {
+		tkindex = internal_parse_image(data, tokens, tkindex, &outData->images[j]);
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief parses the texture view field of json data
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param textureView the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_texture_view(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_TextureView* textureView) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
+
+	textureView->scale = 1.0f;
+
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Index) { 
+			++tkindex; JSON_READ_INDEX(textureView->texture, GLTF_Texture); 
+			++tkindex; 
+		}
+		else if (key == JsonKey_TexCoord) { 
+			++tkindex; 
+			GLTF_ASSERT(json_read_int(data, tokens + tkindex, &textureView->texCoord), ErrorCode_InvalidDocument, "Invalid json number");
+			++tkindex;
+		}
+		else if (key == JsonKey_Scale) { 
+			++tkindex; 
+			GLTF_ASSERT(json_read_float(data, tokens + tkindex, &textureView->scale), ErrorCode_InvalidDocument, "Invalid json number"); ++tkindex;
+		}
+		else if (key == JsonKey_Strength) { 
+			++tkindex; 
+			GLTF_ASSERT(json_read_float(data, tokens + tkindex, &textureView->scale), ErrorCode_InvalidDocument, "Invalid json number"); ++tkindex;
+		}
+		else if (key == JsonKey_Extensions) { 
+			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &textureView->extensionsCount, &textureView->extensions);
+		}
+		else { 
+			tkindex = json_parse_skip(tokens, tkindex + 1); 
+		}
+
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief parses the physically based rendering, metallic-roughness pipeline
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param textureView the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_pbr_metallic_roughness(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_PBRMetallicRoughness* pbr) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
+
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_MetallicFactor) {
+			++tkindex;
+			GLTF_ASSERT(json_read_float(data, tokens + tkindex, &pbr->metallicFactor), ErrorCode_InvalidDocument, "Invalid json number");
+			++tkindex;
+		}
+		else if (key == JsonKey_RoughnessFactor) {
+			++tkindex;
+			GLTF_ASSERT(json_read_float(data, tokens + tkindex, &pbr->roughnessFactor), ErrorCode_InvalidDocument, "Invalid json number");
+			++tkindex;
+		}
+		else if (key == JsonKey_BaseColorFactor) {
+			tkindex = internal_parse_float_array(data, tokens, tkindex + 1, pbr->baseColor, 4, 1);
+		}
+		else if (key == JsonKey_BaseColorTexture) {
+			tkindex = internal_parse_texture_view(data, tokens, tkindex + 1, &pbr->baseColorTexture);
+		}
+		else if (key == JsonKey_MetallicRoughnessTexture) {
+			tkindex = internal_parse_texture_view(data, tokens, tkindex + 1, &pbr->metallicRoughnessTexture);
+		}
+		else {
+			tkindex = json_parse_skip(tokens, tkindex + 1);
+		}
+
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief parses a single material
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param textureView the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_material(const char* data, jsmntok_t const* tokens, int tkindex, GLTF_Material* material) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
+
+	for (int j = 0; j < 4; ++j) {
+		material->PBRmetallicRoughness.baseColor[j] = 1.0f;
+	}
+
+	material->PBRmetallicRoughness.metallicFactor = 1.0f;
+	material->PBRmetallicRoughness.roughnessFactor = 1.0f;
+	material->alphaCutoff = 0.5f;
+
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) { 
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &material->name);
+		}
+		else if (key == JsonKey_PbrMetallicRoughness) { 
+			tkindex = internal_parse_pbr_metallic_roughness(data, tokens, tkindex + 1, &material->PBRmetallicRoughness);
+		}
+		else if (key == JsonKey_EmissiveFactor) { 
+			tkindex = internal_parse_float_array(data, tokens, tkindex + 1, material->emissiveFactor, 3, 1);
+		}
+		else if (key == JsonKey_NormalTexture) { 
+			tkindex = internal_parse_texture_view(data, tokens, tkindex + 1, &material->normalTexture);
+		}
+		else if (key == JsonKey_OcclusionTexture) { 
+			tkindex = internal_parse_texture_view(data, tokens, tkindex + 1, &material->occlusionTexture);
+		}
+		else if (key == JsonKey_EmissiveTexture) { 
+			tkindex = internal_parse_texture_view(data, tokens, tkindex + 1, &material->emissiveTexture);
+		}
+		else if (key == JsonKey_AlphaCutoff) {
+			++tkindex; 
+			GLTF_ASSERT(json_read_float(data, tokens + tkindex, &material->alphaCutoff), ErrorCode_InvalidDocument, "Invalid json number"); 
+			++tkindex; 
+		}
+		else if (key == JsonKey_DoubleSided) { 
+			++tkindex;
+			material->doubleSided = json_to_bool(data, tokens + tkindex);
+			++tkindex; 
+		}
+		else if (key == JsonKey_AlphaMode) {
+			++tkindex;
+			const internal_json_key value = internal_json_key_lookup(data, tokens + tkindex);
+			if (value == JsonKey_Opaque) { 
+				material->alphaMode = AlphaMode_Opaque; 
+			}
+			else if (value == JsonKey_Mask) { 
+				material->alphaMode = AlphaMode_Mask; 
+			}
+			else if (value == JsonKey_Blend) {
+				material->alphaMode = AlphaMode_Blend;
+			}
+			++tkindex;
+		}
+		else if (key == JsonKey_Extras) { 
+			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &material->extras);
+		}
+		else if (key == JsonKey_Extensions) {
+			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &material->extensionsCount, &material->extensions);
+		}
+		else {
+			tkindex = json_parse_skip(tokens, tkindex + 1); 
+		}
+
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief internal_parse_material for internal_parse_elements
+static int internal_parse_material_element(const char* data, const jsmntok_t* tokens, int tkindex, void* outElement) {
+	return internal_parse_material(data, tokens, tkindex, (GLTF_Material*)outElement);
+}
+
+/// @brief parses the json materials
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outData the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_materials(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Material), (void**)&outData->materials, &outData->materialsCount, s_gState->arena);
+	if (tkindex < 0) return tkindex;
+
+	return internal_parse_elements(data, tokens, tkindex, outData->materialsCount, sizeof(GLTF_Material), outData->materials, internal_parse_material_element);
+}
+
+/// @brief converts attribute type given it's string name
+/// @param name the string attribute name
+/// @param type the parsed attribute type
+/// @param index the output index value
+static void internal_parse_attribute_type(const char* name, GLTF_AttributeType* type, int* index) {
+	if (*name == '_') {
+		*type = AttributeType_Custom;
+		return;
+	}
+
+	const char* us = strchr_impl(name, '_');
+	unsigned long long len = us ? (unsigned long long)(us - name) : strlen(name);
+
+	if (len == 8 && strncmp_impl(name, "POSITION", 8) == 0) {
+		*type = AttributeType_Position;
+	}
+	else if (len == 6 && strncmp_impl(name, "NORMAL", 6) == 0) {
+		*type = AttributeType_Normal;
+	}
+	else if (len == 7 && strncmp_impl(name, "TANGENT", 7) == 0) {
+		*type = AttributeType_Tangent;
+	}
+	else if (len == 8 && strncmp_impl(name, "TEXCOORD", 8) == 0) {
+		*type = AttributeType_TexCoord;
+	}
+	else if (len == 5 && strncmp_impl(name, "COLOR", 5) == 0){
+		*type = AttributeType_Color;
+	}
+	else if (len == 6 && strncmp_impl(name, "JOINTS", 6) == 0) {
+		*type = AttributeType_Joints;
+	}
+	else if (len == 7 && strncmp_impl(name, "WEIGHTS", 7) == 0) {
+		*type = AttributeType_Weights;
+	}
+	else {
+		*type = AttributeType_Invalid;
+	}
+
+	if (us && *type != AttributeType_Invalid) {
+		*index = atoi(us + 1);
+		if (*index < 0) {
+			*type = *type = AttributeType_Invalid;
+			*index = 0;
+		}
+	}
+}
+
+/// @brief parses the attribute lists
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param attributes the output data with the parsed information
+/// @param attributesCount the parsed attributes count
+/// @return the next token index to be analyzed
+static int internal_parse_attribute_list(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Attribute** attributes, unsigned long long* attributesCount) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+
+	*attributesCount = tokens[tkindex].size;
+	*attributes = (GLTF_Attribute*)gltfarena_allocate(s_gState->arena, sizeof(GLTF_Attribute) * (*attributesCount), 1);
+	++tkindex;
+
+	for (unsigned long long j = 0; j < *attributesCount; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		tkindex = internal_parse_string(data, tokens, tkindex, &(*attributes)[j].name);
+		GLTF_ASSERT(attributes > 0, ErrorCode_InvalidDocument, "There was an error when parsing attributes");
+
+		internal_parse_attribute_type((*attributes)[j].name, &(*attributes)[j].type, &(*attributes)[j].index);
+		JSON_READ_INDEX((*attributes)[j].data, GLTF_Accessor);
+		++tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief parses the json primitive
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param primitive the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_primitive(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Primitive* primitive) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
+
+	primitive->type = PrimitiveType_Triangles;
+
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Mode) {
+			++tkindex;
+			JSON_READ_ENUM(primitive->type, GLTF_PrimitiveType);
+			++tkindex;
+		}
+		else if (key == JsonKey_Indices) {
+			++tkindex;
+			JSON_READ_INDEX(primitive->indices, GLTF_Accessor);
+			++tkindex;
+		}
+		else if (key == JsonKey_Material) {
+			++tkindex;
+			JSON_READ_INDEX(primitive->material, GLTF_Material);
+			++tkindex;
+		}
+		else if (key == JsonKey_Attributes) {
+			tkindex = internal_parse_attribute_list(data, tokens, tkindex + 1, &primitive->attributes, &primitive->attributesCount);
+		}
+		else if (key == JsonKey_Targets) {
+			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_MorphTarget), (void**)&primitive->targets, &primitive->targetsCount, s_gState->arena);
+			if (tkindex  < 0) return tkindex;
+
+			for (unsigned long long k = 0; k < primitive->targetsCount; ++k) {
+				tkindex = internal_parse_attribute_list(data, tokens, tkindex, &primitive->targets[k].attributes, &primitive->targets[k].attributesCount);
+				if (tkindex < 0) return tkindex;
+			}
+		}
+		else if (key == JsonKey_Extras) {
+			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &primitive->extras);
+		}
+		else if (key == JsonKey_Extensions) {
+			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &primitive->extensionsCount, &primitive->extensions);
+		}
+		else {
+			tkindex = json_parse_skip(tokens, tkindex + 1);
+		}
+
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief parses a single mesh
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param mesh the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_mesh(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Mesh* mesh) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
 
 	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outAnimation->name);
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) {
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &mesh->name);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "samplers") == 0) {
-			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_AnimationSampler), (void**)&outAnimation->samplers, &outAnimation->samplersCount);
+		else if (key == JsonKey_Primitives) {
+			tkindex = json_parse_array(data , tokens, tkindex + 1, sizeof(GLTF_Primitive), (void**)&mesh->primitives, &mesh->primitivesCount, s_gState->arena);
 			if (tkindex < 0) return tkindex;
 
-			for (unsigned long long k = 0; k < outAnimation->samplersCount; ++k) {
-				tkindex = internal_parse_animation_sampler(data, tokens, tkindex, &outAnimation->samplers[k]);
+			for (unsigned long long prim_index = 0; prim_index < mesh->primitivesCount; ++prim_index) {
+				tkindex = internal_parse_primitive(data, tokens, tkindex, &mesh->primitives[prim_index]);
 				if (tkindex < 0) return tkindex;
 			}
 		}
-		else if (json_strncmp(data, tokens + tkindex, "channels") == 0) {
-			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_AnimationChannel), (void**)&outAnimation->channels, &outAnimation->channelsCount);
+		else if (key == JsonKey_Weights) {
+			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(float), (void**)&mesh->weights, &mesh->weightsCount, s_gState->arena);
+			if (tkindex < 0) return tkindex;
+			tkindex = internal_parse_float_array(data, tokens, tkindex - 1, mesh->weights, (int)mesh->weightsCount, 1);
+		}
+		else if (key == JsonKey_Extras) { 
+			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &mesh->extras);
+		}
+		else if (key == JsonKey_Extensions) {
+			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &mesh->extensionsCount, &mesh->extensions); 
+		}
+		else {
+			tkindex = json_parse_skip(tokens, tkindex + 1); 
+		}
+
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief internal_parse_mesh for internal_parse_elements
+static int internal_parse_mesh_element(const char* data, const jsmntok_t* tokens, int tkindex, void* outElement) {
+	return internal_parse_mesh(data, tokens, tkindex, (GLTF_Mesh*)outElement);
+}
+
+/// @brief parses the meshes
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outData the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_meshes(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Mesh), (void**)&outData->meshes, &outData->meshesCount, s_gState->arena);
+	if (tkindex < 0) return tkindex;
+
+	return internal_parse_elements(data, tokens, tkindex, outData->meshesCount, sizeof(GLTF_Mesh), outData->meshes, internal_parse_mesh_element);
+}
+
+/// @brief parses a single node
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param node the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_node(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Node* node) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
+
+	node->rotation[3] = 1.0f;
+	node->scale[0] = 1.0f;
+	node->scale[1] = 1.0f;
+	node->scale[2] = 1.0f;
+	node->matrix[0] = 1.0f;
+	node->matrix[5] = 1.0f;
+	node->matrix[10] = 1.0f;
+	node->matrix[15] = 1.0f;
+
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) {
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &node->name);
+		}
+		else if (key == JsonKey_Children) {
+			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_Node*), (void**)&node->children, &node->childrenCount, s_gState->arena);
+			if (tkindex < 0) return tkindex;
+
+			for (unsigned long long k = 0; k < node->childrenCount; ++k) {
+				JSON_READ_INDEX(node->children[k], GLTF_Node);
+				++tkindex;
+			}
+		}
+		else if (key == JsonKey_Mesh) {
+			++tkindex;
+			GLTF_ASSERT(tokens[tkindex].type == JSMN_PRIMITIVE, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid primitive");
+			JSON_READ_INDEX(node->mesh, GLTF_Mesh);
+			++tkindex;
+		}
+		else if (key == JsonKey_Skin) {
+			++tkindex;
+			GLTF_ASSERT(tokens[tkindex].type == JSMN_PRIMITIVE, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid primitive");
+			JSON_READ_INDEX(node->skin, GLTF_Skin);
+			++tkindex;
+		}
+		else if (key == JsonKey_Camera) {
+			++tkindex;
+			GLTF_ASSERT(tokens[tkindex].type == JSMN_PRIMITIVE, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid primitive");
+			JSON_READ_INDEX(node->camera, GLTF_Camera);
+			++tkindex;
+		}
+		else if (key == JsonKey_Translation) { 
+			tkindex = internal_parse_float_array(data, tokens, tkindex + 1, node->translation, 3, 1);
+		}
+		else if (key == JsonKey_Rotation) { 
+			tkindex = internal_parse_float_array(data, tokens, tkindex + 1, node->rotation, 4, 1);
+		}
+		else if (key == JsonKey_Scale) { 
+			tkindex = internal_parse_float_array(data, tokens, tkindex + 1, node->scale, 3, 1);
+		}
+		else if (key == JsonKey_Matrix) { 
+			tkindex = internal_parse_float_array(data, tokens, tkindex + 1, node->matrix, 16, 1);
+		}
+		else if (key == JsonKey_Weights) {
+			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(float), (void**)&node->weights, &node->weightsCount, s_gState->arena);
+			if (tkindex < 0) return tkindex;
+			tkindex = internal_parse_float_array(data, tokens, tkindex - 1, node->weights, (int)node->weightsCount, 1);
+		}
+		else if (key == JsonKey_Extras) {
+			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &node->extras);
+		}
+		else if (key == JsonKey_Extensions) {
+			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &node->extensionsCount, &node->extensions);
+		}
+		else { 
+			tkindex = json_parse_skip(tokens, tkindex + 1); 
+		}
+
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief internal_parse_node for internal_parse_elements
+static int internal_parse_node_element(const char* data, const jsmntok_t* tokens, int tkindex, void* outElement) {
+	return internal_parse_node(data, tokens, tkindex, (GLTF_Node*)outElement);
+}
+
+/// @brief parses the nodes
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outData the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_nodes(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Node), (void**)&outData->nodes, &outData->nodesCount, s_gState->arena);
+	if (tkindex < 0) return tkindex;
+
+	return internal_parse_elements(data, tokens, tkindex, outData->nodesCount, sizeof(GLTF_Node), outData->nodes, internal_parse_node_element);
+}
+
+/// @brief parses a single sampler
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param sampler the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_image_sampler(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_ImageSampler* sampler) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
+
+	sampler->wrapS = WrapMode_Repeat;
+	sampler->wrapT = WrapMode_Repeat;
+
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) {
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &sampler->name);
+		}
+		else if (key == JsonKey_MagFilter) {
+			++tkindex; 
+			JSON_READ_ENUM(sampler->magFilter, GLTF_FilterType); 
+			++tkindex; 
+		}
+		else if (key == JsonKey_MinFilter) {
+			++tkindex; JSON_READ_ENUM(sampler->minFilter, GLTF_FilterType); 
+			++tkindex; 
+		}
+		else if (key == JsonKey_WrapS) { 
+			++tkindex; 
+			JSON_READ_ENUM(sampler->wrapS, GLTF_WrapMode); 
+			++tkindex; 
+		}
+		else if (key == JsonKey_WrapT) { 
+			++tkindex; 
+			JSON_READ_ENUM(sampler->wrapT, GLTF_WrapMode); 
+			++tkindex; 
+		}
+		else if (key == JsonKey_Extras) {
+			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &sampler->extras);
+		}
+		else if (key == JsonKey_Extensions) { 
+			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &sampler->extensionsCount, &sampler->extensions);
+		}
+		else { 
+			tkindex = json_parse_skip(tokens, tkindex + 1); 
+		}
+
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief parses the samplers
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outData the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_image_samplers(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_ImageSampler), (void**)&outData->imageSamplers, &outData->imageSamplersCount, s_gState->arena);
+	if (tkindex < 0) return tkindex;
+
+	for (unsigned long long j = 0; j < outData->imageSamplersCount; ++j) {
+		tkindex = internal_parse_image_sampler(data, tokens, tkindex, &outData->imageSamplers[j]);
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief parses a skin
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param skin the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_skin(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Skin* skin) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
+
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) {
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &skin->name);
+		}
+		else if (key == JsonKey_Joints) {
+			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_Node*), (void**)&skin->joints, &skin->jointsCount, s_gState->arena);
+			if (tkindex < 0) return tkindex;
+
+			for (unsigned long long k = 0; k < skin->jointsCount; ++k) {
+				JSON_READ_INDEX(skin->joints[k], GLTF_Node);
+				++tkindex;
+			}
+		}
+		else if (key == JsonKey_Skeleton) {
+			++tkindex;
+			GLTF_ASSERT(tokens[tkindex].type == JSMN_PRIMITIVE, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid primitive");
+			JSON_READ_INDEX(skin->skeleton, GLTF_Node);
+			++tkindex;
+		}
+		else if (key == JsonKey_InverseBindMatrices) {
+			++tkindex;
+			GLTF_ASSERT(tokens[tkindex].type == JSMN_PRIMITIVE, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid primitive");
+			JSON_READ_INDEX(skin->inverseBindMatrices, GLTF_Accessor);
+			++tkindex;
+		}
+		else if (key == JsonKey_Extras) {
+			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &skin->extras);
+		}
+		else if (key == JsonKey_Extensions) {
+			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &skin->extensionsCount, &skin->extensions);
+		}
+		else {
+			tkindex = json_parse_skip(tokens, tkindex + 1);
+		}
+
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief parses the skins
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outData the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_skins(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Skin), (void**)&outData->skins, &outData->skinsCount, s_gState->arena);
+	if (tkindex < 0) return tkindex;
+
+	for (unsigned long long j = 0; j < outData->skinsCount; ++j) {
+		tkindex = internal_parse_skin(data, tokens, tkindex, &outData->skins[j]);
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
+
+/// @brief parses a scene
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param scene the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_scene(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Scene* scene) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
+
+	for (int j = 0; j < size; ++j){
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) {
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &scene->name);
+		}
+		else if (key == JsonKey_Nodes) {
+			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_Node*), (void**)&scene->nodes, &scene->nodesCount, s_gState->arena);
 			if (tkindex < 0) return tkindex;
 
-			for (unsigned long long k = 0; k < outAnimation->channelsCount; ++k) {
-				tkindex = internal_parse_animation_channel(data, tokens, tkindex, &outAnimation->channels[k]);
-				if (tkindex < 0) return tkindex;
+			for (unsigned long long k = 0; k < scene->nodesCount; ++k) {
+				JSON_READ_INDEX(scene->nodes[k], GLTF_Node);
+				++tkindex;
 			}
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) { 
-			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outAnimation->extras);
+		else if (key == JsonKey_Extras) {
+			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &scene->extras);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) { 
-			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outAnimation->extensionsCount, &outAnimation->extensions);
+		else if (key == JsonKey_Extensions) {
+			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &scene->extensionsCount, &scene->extensions);
 		}
-		else { 
+		else {
 			tkindex = json_parse_skip(tokens, tkindex + 1);
 		}
 
-		if (tkindex < 0) { return tkindex; }
+		if (tkindex < 0) return tkindex;
 	}
 	return tkindex;
 }
 
-/// @brief parses the animations field from json data
+/// @brief parses the scenes
 /// @param data the json entire data
 /// @param tokens the json token to read
 /// @param tkindex the json token index
 /// @param outData the output data with the parsed information
 /// @return the next token index to be analyzed
-static int internal_parse_animations(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Animation), (void**)&outData->animations, &outData->animationsCount);
+static int internal_parse_scenes(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Scene), (void**)&outData->scenes, &outData->scenesCount, s_gState->arena);
 	if (tkindex < 0) return tkindex;
 
-	for (unsigned long long j = 0; j < outData->animationsCount; ++j) {
-		tkindex = internal_parse_animation(data, tokens, tkindex, &outData->animations[j]);
+	for (unsigned long long j = 0; j < outData->scenesCount; ++j) {
+		tkindex = internal_parse_scene(data, tokens, tkindex, &outData->scenes[j]);
 		if (tkindex < 0) return tkindex;
 	}
 	return tkindex;
 }
 
-/// @brief parses a camera field from json data
+/// @brief parses a texture
 /// @param data the json entire data
 /// @param tokens the json token to read
 /// @param tkindex the json token index
-/// @param outCamera the output data with the parsed information
+/// @param texture the output data with the parsed information
 /// @return the next token index to be analyzed
-static int internal_parse_camera(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Camera* outCamera) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+static int internal_parse_texture(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Texture* texture) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
-	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+	for (int j = 0; j < size; ++j){
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outCamera->name);
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) {
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &texture->name);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "perspective") == 0) {
+		else if (key == JsonKey_Sampler) {
 			++tkindex;
-			GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-			int data_size = tokens[tkindex].size;
+			JSON_READ_INDEX(texture->sampler, GLTF_ImageSampler);
+			++tkindex;
+		}
+		else if (key == JsonKey_Source) {
 			++tkindex;
+			JSON_READ_INDEX(texture->image, GLTF_Image);
+			++tkindex;
+		}
+		else if (key == JsonKey_Extras) {
+			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &texture->extras);
+		}
+		else if (key == JsonKey_Extensions) {
+			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &texture->extensionsCount, &texture->extensions);
+		}
+		else {
+			tkindex = json_parse_skip(tokens, tkindex + 1);
+		}
 
-			outCamera->type = CameraType_Perspective;
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
 
-			for (int k = 0; k < data_size; ++k) {
-				GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+/// @brief parses the textures
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outData the output data with the parsed information
+/// @return the next token index to be analyzed
+static int internal_parse_textures(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Texture), (void**)&outData->textures, &outData->texturesCount, s_gState->arena);
+	if (tkindex < 0) return tkindex;
 
-				if (json_strncmp(data, tokens + tkindex, "aspectRatio") == 0) {
-					++tkindex;
-					outCamera->data.perspective.hasAspectRatio = 1;
-					outCamera->data.perspective.aspectRatio = json_to_float(data, tokens + tkindex);
-					++tkindex;
-				}
-				else if (json_strncmp(data, tokens + tkindex, "yfov") == 0) { 
-					++tkindex;
-					outCamera->data.perspective.yFOV = json_to_float(data, tokens + tkindex);
-					++tkindex;
-				}
-				else if (json_strncmp(data, tokens + tkindex, "zfar") == 0) {
-					++tkindex;
-					outCamera->data.perspective.hasZFar = 1;
-					outCamera->data.perspective.zFar = json_to_float(data, tokens + tkindex);
-					++tkindex;
-				}
-				else if (json_strncmp(data, tokens + tkindex, "znear") == 0) { 
-					++tkindex;
-					outCamera->data.perspective.zNear = json_to_float(data, tokens + tkindex); 
-					++tkindex; 
-				}
-				else if (json_strncmp(data, tokens + tkindex, "extras") == 0) { 
-					tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outCamera->data.perspective.extras);
-				}
-				else {
-					tkindex = json_parse_skip(tokens, tkindex + 1); 
-				}
+	for (unsigned long long j = 0; j < outData->texturesCount; ++j) {
+		tkindex = internal_parse_texture(data, tokens, tkindex, &outData->textures[j]);
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
 
-				if (tkindex < 0)  return tkindex;
+/// @brief tells which section a root key builds
+/// @param key the root key
+/// @return the GLTF_Section flag of the key, 0 when it isn't a collection that can be skipped
+static unsigned int internal_json_key_section(internal_json_key key) {
+	switch (key) {
+	case JsonKey_Accessors: return Section_Accessors;
+	case JsonKey_Animations: return Section_Animations;
+	case JsonKey_BufferViews: return Section_BufferViews;
+	case JsonKey_Buffers: return Section_Buffers;
+	case JsonKey_Cameras: return Section_Cameras;
+	case JsonKey_Images: return Section_Images;
+	case JsonKey_Materials: return Section_Materials;
+	case JsonKey_Meshes: return Section_Meshes;
+	case JsonKey_Nodes: return Section_Nodes;
+	case JsonKey_Samplers: return Section_Samplers;
+	case JsonKey_Scenes:
+	case JsonKey_Scene: return Section_Scenes;
+	case JsonKey_Skins: return Section_Skins;
+	case JsonKey_Textures: return Section_Textures;
+	default: return 0;
+	}
+}
+
+/// @brief parses the json by it's root
+/// @param data the json entire data
+/// @param tokens the json tokens
+/// @param tkindex the initial token index to start parsing from
+/// @param outData the output data with the parsed information
+/// @return 1 on success, 0 on failure
+static int internal_parse_jsonroot(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
+
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		const unsigned int section = internal_json_key_section(key);
+		if (section && !(s_gState->options.sections & section)) {
+			// the sections that aren't wanted are skipped without being built
+			tkindex = json_parse_skip(tokens, tkindex + 1);
+		}
+		else if (key == JsonKey_Accessors) {
+			tkindex = internal_parse_accessors(data, tokens, tkindex + 1, outData);
+		}
+		else if (key == JsonKey_Animations) {
+			tkindex = internal_parse_animations(data, tokens, tkindex + 1, outData);
+		}
+		else if (key == JsonKey_Asset) {
+			const int assetIndex = tkindex + 1;
+			tkindex = internal_parse_asset(data, tokens, assetIndex, &outData->asset);
+
+			if (tkindex >= 0 && outData->asset.version && internal_version_major(outData->asset.version) < 2) {
+				internal_log_error_at(ErrorCode_Unsupported, assetIndex, "Legacy GLTF is not supported");
+				return -1;
 			}
 		}
-		else if (json_strncmp(data, tokens + tkindex, "orthographic") == 0) {
+		else if (key == JsonKey_BufferViews) {
+			tkindex = internal_parse_bufferviews(data, tokens, tkindex + 1, outData);
+		}
+		else if (key == JsonKey_Buffers) {
+			tkindex = internal_parse_buffers(data, tokens, tkindex + 1, outData);
+		}
+		else if (key == JsonKey_Cameras) {
+			tkindex = internal_parse_cameras(data, tokens, tkindex + 1, outData);
+		}
+		else if (key == JsonKey_Images) {
+			tkindex = internal_parse_images(data, tokens, tkindex + 1, outData);
+		}
+		else if (key == JsonKey_Materials) {
+			tkindex = internal_parse_materials(data, tokens, tkindex + 1, outData);
+		}
+		else if (key == JsonKey_Meshes) {
+			tkindex = internal_parse_meshes(data, tokens, tkindex + 1, outData);
+		}
+		else if (key == JsonKey_Nodes) {
+			tkindex = internal_parse_nodes(data, tokens, tkindex + 1, outData);
+		}
+		else if (key == JsonKey_Samplers) {
+			tkindex = internal_parse_image_samplers(data, tokens, tkindex + 1, outData);
+		}
+		else if (key == JsonKey_Scenes){
+			tkindex = internal_parse_scenes(data, tokens, tkindex + 1, outData);
+		}
+		else if (key == JsonKey_Scene) {
 			++tkindex;
-			GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-			int data_size = tokens[tkindex].size;
+			JSON_READ_INDEX(outData->scene, GLTF_Scene);
 			++tkindex;
-			outCamera->type = CameraType_Orthographic;
+		}
+		else if (key == JsonKey_Skins) {
+			tkindex = internal_parse_skins(data, tokens, tkindex + 1, outData);
+		}
+		else if (key == JsonKey_Textures) {
+			tkindex = internal_parse_textures(data, tokens, tkindex + 1, outData);
+		}
+		else if (key == JsonKey_Extensions) {
+			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outData->extensionsCount, &outData->extensions);
+		}
+		else if (key == JsonKey_ExtensionsUsed){
+			tkindex = internal_parse_string_array(data, tokens, tkindex + 1, &outData->extensionsUsed, &outData->extensionsUsedCount);
+		}
+		else if (key == JsonKey_ExtensionsRequired) {
+			tkindex = internal_parse_string_array(data, tokens, tkindex + 1, &outData->extensionsRequired, &outData->extensionsRequiredCount);
+		}
+		else if (key == JsonKey_Extras) {
+			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outData->extras);
+		}
+		else {
+			tkindex = json_parse_skip(tokens, tkindex + 1);
+		}
 
-			for (int k = 0; k < data_size; ++k) {
-				GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
 
-				if (json_strncmp(data, tokens + tkindex, "xmag") == 0) { 
-					++tkindex; 
-					outCamera->data.orthographic.xMag = json_to_float(data, tokens + tkindex);
-					++tkindex;
-				}
-				else if (json_strncmp(data, tokens + tkindex, "ymag") == 0) {
-					++tkindex; 
-					outCamera->data.orthographic.yMag = json_to_float(data, tokens + tkindex); 
-					++tkindex;
-				}
-				else if (json_strncmp(data, tokens + tkindex, "zfar") == 0) { 
-					++tkindex; 
-					outCamera->data.orthographic.zFar = json_to_float(data, tokens + tkindex); 
-					++tkindex; 
-				}
-				else if (json_strncmp(data, tokens + tkindex, "znear") == 0) {
-					++tkindex; 
-					outCamera->data.orthographic.zNear = json_to_float(data, tokens + tkindex);
-					++tkindex;
-				}
-				else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
-					tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outCamera->data.orthographic.extras);
-				}
-				else { 
-					tkindex = json_parse_skip(tokens, tkindex + 1);
+
+// @brief returns the number of components for a given gltf data type
+unsigned long long internal_get_components_number(GLTF_Type type) {
+	switch (type)
+	{
+	case Type_Vec2: return 2;
+	case Type_Vec3: return 3;
+	case Type_Vec4: return 4;
+	case Type_Mat2: return 4;
+	case Type_Mat3: return 9;
+	case Type_Mat4: return 16;
+	case Type_Scalar: return 1;
+	}
+	return 1;
+}
+
+// returns the size in bytes of a single component based on its data type
+unsigned long long internal_component_size(GLTF_ComponentType componentType) {
+	switch (componentType)
+	{
+	case ComponentType_R8:
+	case ComponentType_R8_UNSIGNED:
+		return 1;
+	case ComponentType_R16:
+	case ComponentType_R16_UNSIGNED:
+		return 2;
+	case ComponentType_R32_UNSIGNED:
+	case ComponentType_R32_FLOAT:
+		return 4;
+	}
+	return 0; // invalid components
+}
+
+/// @brief calculates the total byte size for a gltf attribute by combining component count and component size
+unsigned long long internal_calculate_attribute_size(GLTF_Type type, GLTF_ComponentType componentType) {
+	unsigned long long componentSize = internal_component_size(componentType);
+
+	if (type == Type_Mat2 && componentSize == 1) return 8 * componentSize;
+	else if (type == Type_Mat3 && (componentSize == 1 || componentSize == 2)) return 12 * componentSize;
+
+	return componentSize * internal_get_components_number(type);
+}
+
+/// @brief conrrects the pointer of loaded members of a gltf file
+/// @param data the gltf parsed data
+/// @return 1 on success, -1 otherwise
+static int internal_fix_pointers(GLTF2* data) {
+	const unsigned int sections = s_gState->options.sections;
+
+	// meshes pointers
+	for (unsigned long long i = 0; i < data->meshesCount; ++i) {
+		for (unsigned long long j = 0; j < data->meshes[i].primitivesCount; ++j) {
+			PTR_FIX_SECTION(data->meshes[i].primitives[j].indices, data->accessors, data->accessorsCount, sections & Section_Accessors);
+			PTR_FIX_SECTION(data->meshes[i].primitives[j].material, data->materials, data->materialsCount, sections & Section_Materials);
+
+			for (unsigned long long k = 0; k < data->meshes[i].primitives[j].attributesCount; ++k) {
+				PTR_FIX_SECTION(data->meshes[i].primitives[j].attributes[k].data, data->accessors, data->accessorsCount, sections & Section_Accessors);
+			}
+
+			for (unsigned long long k = 0; k < data->meshes[i].primitives[j].targetsCount; ++k) {
+				for (unsigned long long m = 0; m < data->meshes[i].primitives[j].targets[k].attributesCount; ++m) {
+					PTR_FIX_REQUIRED_SECTION(data->meshes[i].primitives[j].targets[k].attributes[m].data, data->accessors, data->accessorsCount, sections & Section_Accessors);
 				}
+			}
+		}
+	}
+
+	// accessors
+	for (unsigned long long i = 0; i < data->accessorsCount; ++i) {
+		PTR_FIX_SECTION(data->accessors[i].bufferView, data->bufferViews, data->bufferViewsCount, sections & Section_BufferViews);
+
+		if (data->accessors[i].isSparse) {
+			PTR_FIX_REQUIRED_SECTION(data->accessors[i].sparse.indicesBufferView, data->bufferViews, data->bufferViewsCount, sections & Section_BufferViews);
+			PTR_FIX_REQUIRED_SECTION(data->accessors[i].sparse.valuesBufferView, data->bufferViews, data->bufferViewsCount, sections & Section_BufferViews);
+		}
+
+		if (data->accessors[i].bufferView) {
+			data->accessors[i].stride = data->accessors[i].bufferView->stride;
+		}
+
+		if (data->accessors[i].stride == 0) {
+			data->accessors[i].stride = internal_calculate_attribute_size(data->accessors[i].type, data->accessors[i].componentType);
+		}
+	}
+
+	// textures
+	for (unsigned long long i = 0; i < data->texturesCount; ++i) {
+		PTR_FIX_SECTION(data->textures[i].image, data->images, data->imagesCount, sections & Section_Images);
+		PTR_FIX_SECTION(data->textures[i].sampler, data->imageSamplers, data->imageSamplersCount, sections & Section_Samplers);
+	}
+
+	// images
+	for (unsigned long long i = 0; i < data->imagesCount; ++i) {
+		PTR_FIX_SECTION(data->images[i].bufferView, data->bufferViews, data->bufferViewsCount, sections & Section_BufferViews);
+	}
+
+	// materials
+	for (unsigned long long i = 0; i < data->materialsCount; ++i) {
+		PTR_FIX_SECTION(data->materials[i].normalTexture.texture, data->textures, data->texturesCount, sections & Section_Textures);
+		PTR_FIX_SECTION(data->materials[i].emissiveTexture.texture, data->textures, data->texturesCount, sections & Section_Textures);
+		PTR_FIX_SECTION(data->materials[i].occlusionTexture.texture, data->textures, data->texturesCount, sections & Section_Textures);
+
+		PTR_FIX_SECTION(data->materials[i].PBRmetallicRoughness.baseColorTexture.texture, data->textures, data->texturesCount, sections & Section_Textures);
+		PTR_FIX_SECTION(data->materials[i].PBRmetallicRoughness.metallicRoughnessTexture.texture, data->textures, data->texturesCount, sections & Section_Textures);
+	}
+
+	// buffer views
+	for (unsigned long long i = 0; i < data->bufferViewsCount; ++i) {
+		PTR_FIX_REQUIRED_SECTION(data->bufferViews[i].buffer, data->buffers, data->buffersCount, sections & Section_Buffers);
+	}
+
+	// skins
+	for (unsigned long long i = 0; i < data->skinsCount; ++i) {
+		for (unsigned long long j = 0; j < data->skins[i].jointsCount; ++j) {
+			PTR_FIX_REQUIRED_SECTION(data->skins[i].joints[j], data->nodes, data->nodesCount, sections & Section_Nodes);
+		}
+
+		PTR_FIX_SECTION(data->skins[i].skeleton, data->nodes, data->nodesCount, sections & Section_Nodes);
+		PTR_FIX_SECTION(data->skins[i].inverseBindMatrices, data->accessors, data->accessorsCount, sections & Section_Accessors);
+	}
 
-				if (tkindex < 0) return tkindex;
+	// nodes
+	for (unsigned long long i = 0; i < data->nodesCount; ++i) {
+		for (unsigned long long j = 0; j < data->nodes[i].childrenCount; ++j) {
+			PTR_FIX_REQUIRED_SECTION(data->nodes[i].children[j], data->nodes, data->nodesCount, sections & Section_Nodes);
+
+			if (data->nodes[i].children[j]->parent) {
+				return -1;
 			}
+
+			data->nodes[i].children[j]->parent = &data->nodes[i];
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
-			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outCamera->extras);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) { 
-			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outCamera->extensionsCount, &outCamera->extensions);
+
+		PTR_FIX_SECTION(data->nodes[i].mesh, data->meshes, data->meshesCount, sections & Section_Meshes);
+		PTR_FIX_SECTION(data->nodes[i].skin, data->skins, data->skinsCount, sections & Section_Skins);
+		PTR_FIX_SECTION(data->nodes[i].camera, data->cameras, data->camerasCount, sections & Section_Cameras);
+	}
+
+	// scenes
+	for (unsigned long long i = 0; i < data->scenesCount; ++i) {
+		for (unsigned long long j = 0; j < data->scenes[i].nodesCount; ++j) {
+			PTR_FIX_REQUIRED_SECTION(data->scenes[i].nodes[j], data->nodes, data->nodesCount, sections & Section_Nodes);
+
+			if (data->scenes[i].nodes[j] && data->scenes[i].nodes[j]->parent) {
+				return -1;
+			}
 		}
-		else { 
-			tkindex = json_parse_skip(tokens, tkindex + 1);
+	}
+	PTR_FIX_SECTION(data->scene, data->scenes, data->scenesCount, sections & Section_Scenes);
+
+	// animations
+	for (unsigned long long i = 0; i < data->animationsCount; ++i) {
+		for (unsigned long long j = 0; j < data->animations[i].samplersCount; ++j) {
+			PTR_FIX_REQUIRED_SECTION(data->animations[i].samplers[j].input, data->accessors, data->accessorsCount, sections & Section_Accessors);
+			PTR_FIX_REQUIRED_SECTION(data->animations[i].samplers[j].output, data->accessors, data->accessorsCount, sections & Section_Accessors);
 		}
 
-		if (tkindex < 0)  return tkindex;
+		for (unsigned long long j = 0; j < data->animations[i].channelsCount; ++j) {
+			PTR_FIX_REQUIRED(data->animations[i].channels[j].sampler, data->animations[i].samplers, data->animations[i].samplersCount);
+			PTR_FIX_SECTION(data->animations[i].channels[j].targetNode, data->nodes, data->nodesCount, sections & Section_Nodes);
+		}
 	}
-	return tkindex;
-}
 
-/// @brief parses the cameras field of a json data
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outData the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_cameras(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Camera), (void**)&outData->cameras, &outData->camerasCount);
-	if (tkindex < 0) return tkindex;
+	return 1;
+}
 
-	for (unsigned long long j = 0; j < outData->camerasCount; ++j) {
-		tkindex = internal_parse_camera(data, tokens, tkindex, &outData->cameras[j]);
-		if (tkindex < 0) return tkindex;
+/// @brief gives the json tokens back to the workspace of the parse, or releases them when there's none
+/// @param tokens the json tokens, may be NULL
+/// @param capacity how many tokens fits in them
+static void internal_tokens_release(jsmntok_t* tokens, unsigned int capacity) {
+	GLTF_Workspace* workspace = s_gState->options.workspace;
+	if (workspace) {
+		workspace->tokens = tokens;
+		workspace->tokensCapacity = tokens ? capacity : 0;
+	}
+	else {
+		gltfmemory_deallocate(&s_gState->options.allocator, tokens);
 	}
-	return tkindex;
 }
 
-/// @brief parses an image
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outImage the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_image(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Image* outImage) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-	int size = tokens[tkindex].size;
-	++tkindex;
+/// @brief splits a json into tokens, the tokens of the parse workspace are reused when there's one
+/// @param data the json text
+/// @param size the json size in bytes
+/// @param known how many tokens the json is known to have, 0 when it's unknown
+/// @param outTokens the json tokens followed by an UNDEFINED token, release them with internal_tokens_release
+/// @param outCapacity how many tokens fits in outTokens
+/// @return how many tokens the json has, -1 on failure
+static int internal_json_tokenize(const char* data, unsigned long long size, unsigned int known, jsmntok_t** outTokens, unsigned int* outCapacity) {
+	jsmn_parser parser;
+	jsmn_init(&parser);
 
-	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+	// the tokens of a workspace are reused, with the allocator it was created with
+	GLTF_Workspace* workspace = s_gState->options.workspace;
+	const GLTF_Allocator* allocator = &s_gState->options.allocator;
+	jsmntok_t* tokens = NULL;
+	unsigned int capacity = 0;
+	if (workspace) {
+		if (!workspace->tokens) workspace->allocator = *allocator;
+		allocator = &workspace->allocator;
+		tokens = (jsmntok_t*)workspace->tokens;
+		capacity = workspace->tokensCapacity;
+	}
 
-		if (json_strncmp(data, tokens + tkindex, "uri") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outImage->URI);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "bufferView") == 0) { 
-			++tkindex; 
-			outImage->bufferView = PTR_TO_INDEX(GLTF_BufferView, json_to_int(data, tokens + tkindex)); 
-			++tkindex; 
-		}
-		else if (json_strncmp(data, tokens + tkindex, "mimeType") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outImage->mime_type); 
-		}
-		else if (json_strncmp(data, tokens + tkindex, "name") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outImage->name); 
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) { 
-			tkindex = internal_parse_extras(data , tokens, tkindex + 1, &outImage->extras);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) { 
-			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outImage->extensionsCount, &outImage->extensions);
-		}
-		else { 
-			tkindex = json_parse_skip(tokens, tkindex + 1);
+	// a single pass that grows the tokens as needed, a known token count avoids any growth
+	if (known > 0 && capacity <= known) {
+		jsmntok_t* grown = (jsmntok_t*)gltfmemory_reallocate(allocator, tokens, sizeof(jsmntok_t) * (known + 1));
+		if (!grown) {
+			internal_tokens_release(tokens, capacity);
+			internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for the json tokens");
+			return -1;
 		}
+		tokens = grown;
+		capacity = known + 1;
+	}
 
-		if (tkindex < 0) return tkindex;
+	int tokenCount = jsmn_parse_alloc(&parser, data, size, &tokens, &capacity, allocator);
+	if (tokenCount <= 0) {
+		internal_tokens_release(tokens, capacity);
+		if (tokenCount == JSMN_ERROR_NOMEM) internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for the json tokens");
+		else internal_log_error_offset(ErrorCode_InvalidJson, parser.pos, "Invalid json (error %d)", tokenCount);
+		return -1;
 	}
-	return tkindex;
+
+	// there must be room for the trailing UNDEFINED token
+	if ((unsigned int)tokenCount >= capacity) {
+		jsmntok_t* grown = (jsmntok_t*)gltfmemory_reallocate(allocator, tokens, sizeof(jsmntok_t) * (tokenCount + 1));
+		if (!grown) {
+			internal_tokens_release(tokens, capacity);
+			internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for the json tokens");
+			return -1;
+		}
+		tokens = grown;
+		capacity = tokenCount + 1;
+	}
+
+	// this makes sure that we always have an UNDEFINED token at the end of the stream, for invalid JSON inputs this makes sure we don't perform out of bound reads of token data
+	tokens[tokenCount].type = JSMN_UNDEFINED;
+
+	*outTokens = tokens;
+	*outCapacity = capacity;
+	return tokenCount;
 }
 
-/// @brief parses the json images
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outData the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_images(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Image), (void**)&outData->images, &outData->imagesCount);
-	if (tkindex < 0) return tkindex;
+/// @brief begins the parsing of the GLFW
+static int internal_parse_json(const char* data, unsigned long long size, GLTF2* outData) {
+	jsmntok_t* tokens = NULL;
+	unsigned int capacity = 0;
+	int tokenCount = internal_json_tokenize(data, size, outData->fileInfo.jsonTkCount, &tokens, &capacity);
+	if (tokenCount < 0) {
+		return -1;
+	}
+	outData->fileInfo.jsonTkCount = tokenCount;
 
-	for (unsigned long long j = 0; j < outData->imagesCount; ++j) {
-		tkindex = internal_parse_image(data, tokens, tkindex, &outData->images[j]);
-		if (tkindex < 0) return tkindex;
+	// begins the parsing at the root-level, errors are reported with their json path meanwhile
+	s_gState->json = data;
+	s_gState->tokens = tokens;
+	s_gState->tokensCount = tokenCount;
+
+	int i = internal_parse_jsonroot(data, tokens, 0, outData);
+
+	s_gState->json = NULL;
+	s_gState->tokens = NULL;
+	s_gState->tokensCount = 0;
+	internal_tokens_release(tokens, capacity);
+
+	if (i < 0) {
+		return -1;
 	}
-	return tkindex;
+
+	if (internal_fix_pointers(outData) < 0) {
+		return -1;
+	}
+
+	outData->fileInfo.json = data;
+	outData->fileInfo.jsonSize = size;
+
+	return 1;
 }
 
-/// @brief parses the texture view field of json data
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param textureView the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_texture_view(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_TextureView* textureView) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-	int size = tokens[tkindex].size;
-	++tkindex;
+/// @brief parses the contents of a gltf or glb file already in memory, the caller must release outData on failure
+/// @param ptr the file contents
+/// @param size the file size
+/// @param copyBin 1 to copy the glb bin chunk, 0 to point into ptr, which must then outlive outData
+/// @param outData the output data with the parsed information
+/// @return 1 on success, 0 on failure
+static int internal_parse_document(const unsigned char* ptr, unsigned long long size, int copyBin, GLTF2* outData) {
 
-	textureView->scale = 1.0f;
+	// validate minimum file size
+	if (size < 4) {
+		internal_log_error(ErrorCode_InvalidDocument, "File too small to be valid GLTF/GLB");
+		return 0;
+	}
 
-	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+	int isGlb = strncmp_impl((const char*)ptr, "glTF", 4) == 0 ? 1 : 0;
 
-		if (json_strncmp(data, tokens + tkindex, "index") == 0) { 
-			++tkindex; textureView->texture = PTR_TO_INDEX(GLTF_Texture, json_to_int(data, tokens + tkindex)); 
-			++tkindex; 
-		}
-		else if (json_strncmp(data, tokens + tkindex, "texCoord") == 0) { 
-			++tkindex; 
-			textureView->texCoord = json_to_int(data, tokens + tkindex);
-			++tkindex;
-		}
-		else if (json_strncmp(data, tokens + tkindex, "scale") == 0) { 
-			++tkindex; 
-			textureView->scale = json_to_float(data, tokens + tkindex); ++tkindex;
-		}
-		else if (json_strncmp(data, tokens + tkindex, "strength") == 0) { 
-			++tkindex; 
-			textureView->scale = json_to_float(data, tokens + tkindex); ++tkindex;
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) { 
-			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &textureView->extensionsCount, &textureView->extensions);
-		}
-		else { 
-			tkindex = json_parse_skip(tokens, tkindex + 1); 
+	if (!isGlb) {
+		// regular GLTF (JSON)
+		outData->fileInfo.type = 1;
+
+		int parseResult = internal_parse_json((const char*)ptr, size, outData);
+		if (parseResult < 0) {
+			internal_log_error(ErrorCode_InvalidJson, "GLTF JSON parsing failed with error: %d", parseResult);
+			return 0;
 		}
+		return 1;
+	}
 
-		if (tkindex < 0) return tkindex;
+	outData->fileInfo.type = 0; // GLB
+
+	// validate GLB header
+	if (size < GLB_HEADER_SIZE) {
+		internal_log_error(ErrorCode_InvalidGLB, "GLB file too small (header incomplete)");
+		return 0;
 	}
-	return tkindex;
-}
 
-/// @brief parses the physically based rendering, metallic-roughness pipeline
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param textureView the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_pbr_metallic_roughness(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_PBRMetallicRoughness* pbr) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-	int size = tokens[tkindex].size;
-	++tkindex;
+	// check version
+	unsigned int version;
+	memcpy(&version, ptr + 4, 4);
+	if (version != 2) {
+		internal_log_error(ErrorCode_Unsupported, "Unsupported GLB version: %u (expected 2)", version);
+		return 0;
+	}
 
-	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+	// verify total length
+	unsigned int totalLength;
+	memcpy(&totalLength, ptr + 8, 4);
+	if (totalLength != size) {
+		internal_log_error(ErrorCode_InvalidGLB, "GLB size mismatch (header: %u, actual: %llu)", totalLength, size);
+		return 0;
+	}
 
-		if (json_strncmp(data, tokens + tkindex, "metallicFactor") == 0) {
-			++tkindex;
-			pbr->metallicFactor = json_to_float(data, tokens + tkindex);
-			++tkindex;
-		}
-		else if (json_strncmp(data, tokens + tkindex, "roughnessFactor") == 0) {
-			++tkindex;
-			pbr->roughnessFactor = json_to_float(data, tokens + tkindex);
-			++tkindex;
-		}
-		else if (json_strncmp(data, tokens + tkindex, "baseColorFactor") == 0) {
-			tkindex = json_parse_array_float(data, tokens, tkindex + 1, pbr->baseColor, 4);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "baseColorTexture") == 0) {
-			tkindex = internal_parse_texture_view(data, tokens, tkindex + 1, &pbr->baseColorTexture);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "metallicRoughnessTexture") == 0) {
-			tkindex = internal_parse_texture_view(data, tokens, tkindex + 1, &pbr->metallicRoughnessTexture);
-		}
-		else {
-			tkindex = json_parse_skip(tokens, tkindex + 1);
-		}
+	// Process chunks
+	unsigned long long offset = GLB_HEADER_SIZE;
 
-		if (tkindex < 0) return tkindex;
+	// JSON chunk (required)
+	if (offset + GLB_CHUNK_HEADER_SIZE > size) {
+		internal_log_error(ErrorCode_InvalidGLB, "Invalid GLB chunk header (out of bounds)");
+		return 0;
 	}
-	return tkindex;
-}
 
-/// @brief parses a single material
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param textureView the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_material(const char* data, jsmntok_t const* tokens, int tkindex, GLTF_Material* material) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-	int size = tokens[tkindex].size;
-	++tkindex;
+	unsigned int jsonLength;
+	memcpy(&jsonLength, ptr + offset, 4);
+	offset += 4;
 
-	for (int j = 0; j < 4; ++j) {
-		material->PBRmetallicRoughness.baseColor[j] = 1.0f;
+	unsigned int jsonType;
+	memcpy(&jsonType, ptr + offset, 4);
+	offset += 4;
+
+	if (jsonType != JSON_CHUNK_TYPE) {
+		internal_log_error(ErrorCode_InvalidGLB, "Missing JSON chunk (found type: 0x%X)", jsonType);
+		return 0;
 	}
 
-	material->PBRmetallicRoughness.metallicFactor = 1.0f;
-	material->PBRmetallicRoughness.roughnessFactor = 1.0f;
-	material->alphaCutoff = 0.5f;
+	if (offset + jsonLength > size) {
+		internal_log_error(ErrorCode_InvalidGLB, "JSON chunk size overflow (%u > %llu)", jsonLength, size - offset);
+		return 0;
+	}
 
-	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+	// parse JSON
+	int parseResult = internal_parse_json((const char*)ptr + offset, jsonLength, outData);
+	if (parseResult < 0) {
+		internal_log_error(ErrorCode_InvalidJson, "JSON parsing failed with error: %d", parseResult);
+		return 0;
+	}
+	offset += jsonLength;
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &material->name);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "pbrMetallicRoughness") == 0) { 
-			tkindex = internal_parse_pbr_metallic_roughness(data, tokens, tkindex + 1, &material->PBRmetallicRoughness);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "emissiveFactor") == 0) { 
-			tkindex = json_parse_array_float(data, tokens, tkindex + 1, material->emissiveFactor, 3);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "normalTexture") == 0) { 
-			tkindex = internal_parse_texture_view(data, tokens, tkindex + 1, &material->normalTexture);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "occlusionTexture") == 0) { 
-			tkindex = internal_parse_texture_view(data, tokens, tkindex + 1, &material->occlusionTexture);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "emissiveTexture") == 0) { 
-			tkindex = internal_parse_texture_view(data, tokens, tkindex + 1, &material->emissiveTexture);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "alphaCutoff") == 0) {
-			++tkindex; 
-			material->alphaCutoff = json_to_float(data, tokens + tkindex); 
-			++tkindex; 
-		}
-		else if (json_strncmp(data, tokens + tkindex, "doubleSided") == 0) { 
-			++tkindex;
-			material->doubleSided = json_to_bool(data, tokens + tkindex);
-			++tkindex; 
-		}
-		else if (json_strncmp(data, tokens + tkindex, "alphaMode") == 0) {
-			++tkindex;
-			if (json_strncmp(data, tokens + tkindex, "OPAQUE") == 0) { 
-				material->alphaMode = AlphaMode_Opaque; 
-			}
-			else if (json_strncmp(data, tokens + tkindex, "MASK") == 0) { 
-				material->alphaMode = AlphaMode_Mask; 
-			}
-			else if (json_strncmp(data, tokens + tkindex, "BLEND") == 0) {
-				material->alphaMode = AlphaMode_Blend;
-			}
-			++tkindex;
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) { 
-			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &material->extras);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
-			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &material->extensionsCount, &material->extensions);
-		}
-		else {
-			tkindex = json_parse_skip(tokens, tkindex + 1); 
+	// BIN chunk (optional)
+	if (offset < size) {
+		if (offset + GLB_CHUNK_HEADER_SIZE > size) {
+			internal_log_error(ErrorCode_InvalidGLB, "Invalid BIN chunk header (out of bounds)");
+			return 0;
 		}
 
-		if (tkindex < 0) return tkindex;
-	}
-	return tkindex;
-}
+		unsigned int binLength;
+		memcpy(&binLength, ptr + offset, 4);
+		offset += 4;
 
-/// @brief parses the json materials
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outData the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_materials(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Material), (void**)&outData->materials, &outData->materialsCount);
-	if (tkindex < 0) return tkindex;
+		unsigned int binType;
+		memcpy(&binType, ptr + offset, 4);
+		offset += 4;
 
-	for (unsigned long long j = 0; j < outData->materialsCount; ++j) {
-		tkindex = internal_parse_material(data, tokens, tkindex, &outData->materials[j]);
-		if (tkindex < 0) return tkindex;
+		if (binType == BIN_CHUNK_TYPE) {
+			if (offset + binLength > size) {
+				internal_log_error(ErrorCode_InvalidGLB, "BIN chunk size overflow (%u > %llu)", binLength, size - offset);
+				return 0;
+			}
+
+			if (copyBin) {
+				outData->fileInfo.bin = gltfarena_allocate(s_gState->arena, binLength, 0);
+				if (!outData->fileInfo.bin) {
+					internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for BIN chunk");
+					return 0;
+				}
+				memcpy(outData->fileInfo.bin, ptr + offset, binLength);
+			}
+			else {
+				outData->fileInfo.bin = (void*)(ptr + offset);
+			}
+			outData->fileInfo.binSize = binLength;
+			outData->fileInfo.binOffset = offset;
+		}
 	}
-	return tkindex;
+	return 1;
 }
 
-/// @brief converts attribute type given it's string name
-/// @param name the string attribute name
-/// @param type the parsed attribute type
-/// @param index the output index value
-static void internal_parse_attribute_type(const char* name, GLTF_AttributeType* type, int* index) {
-	if (*name == '_') {
-		*type = AttributeType_Custom;
-		return;
+/// @brief maps a whole file into memory, without copying it
+/// @param path the disk path of the file
+/// @param io the custom file access, unused when it has no open callback
+/// @param sequential 1 when the file is read once from start to end, 0 when it's accessed in any order
+/// @param outStorage the mapped file
+/// @return 1 on success, 0 when the file can't be mapped
+static int internal_file_map(const char* path, const GLTF_FileIO* io, int sequential, GLTF_Storage* outStorage) {
+	outStorage->size = 0;
+
+	if (!io->open) {
+		if (!platform_filemap(path, sequential, &outStorage->size, &outStorage->data)) return 0;
+		outStorage->type = StorageType_Mapped;
+		return 1;
 	}
 
-	const char* us = strchr_impl(name, '_');
-	unsigned long long len = us ? (unsigned long long)(us - name) : strlen(name);
+	if (!io->map) return 0;
 
-	if (len == 8 && strncmp_impl(name, "POSITION", 8) == 0) {
-		*type = AttributeType_Position;
-	}
-	else if (len == 6 && strncmp_impl(name, "NORMAL", 6) == 0) {
-		*type = AttributeType_Normal;
-	}
-	else if (len == 7 && strncmp_impl(name, "TANGENT", 7) == 0) {
-		*type = AttributeType_Tangent;
-	}
-	else if (len == 8 && strncmp_impl(name, "TEXCOORD", 8) == 0) {
-		*type = AttributeType_TexCoord;
+	void* file = io->open(io->userData, path);
+	if (!file) return 0;
+
+	// a mapped file stays open until the storage is released
+	const void* mapped = io->map(io->userData, file, &outStorage->size);
+	if (!mapped) {
+		io->release(io->userData, file);
+		return 0;
 	}
-	else if (len == 5 && strncmp_impl(name, "COLOR", 5) == 0){
-		*type = AttributeType_Color;
+
+	outStorage->data = (void*)mapped;
+	outStorage->type = StorageType_FileIO;
+	outStorage->file = file;
+	outStorage->release = io->release;
+	outStorage->userData = io->userData;
+	return 1;
+}
+
+/// @brief reads a range of bytes of a file
+/// @param path the disk path of the file
+/// @param io the custom file access, unused when it has no open callback
+/// @param offset where the range starts inside of the file
+/// @param size how many bytes to read
+/// @param dst where the bytes are written into
+/// @return 1 on success, 0 on failure
+static int internal_file_read_range(const char* path, const GLTF_FileIO* io, unsigned long long offset, unsigned long long size, void* dst) {
+	if (!io->open) return platform_filereadrange(path, offset, size, dst);
+
+	void* file = io->open(io->userData, path);
+	if (!file) return 0;
+
+	int result = io->read(io->userData, file, offset, size, dst);
+	io->release(io->userData, file);
+	return result;
+}
+
+/// @brief brings a file into memory according to the requested file mode
+/// @param path the disk path of the file
+/// @param mode how the file should be loaded
+/// @param io the custom file access, unused when it has no open callback
+/// @param allocator where a read file is allocated from
+/// @param sequential 1 when the file is read once from start to end, 0 when it's accessed in any order
+/// @param outStorage the loaded file
+/// @return 1 on success, 0 on failure
+static int internal_file_load(const char* path, GLTF_FileMode mode, const GLTF_FileIO* io, const GLTF_Allocator* allocator, int sequential, GLTF_Storage* outStorage) {
+	if (mode == FileMode_Map && internal_file_map(path, io, sequential, outStorage)) {
+		return 1;
 	}
-	else if (len == 6 && strncmp_impl(name, "JOINTS", 6) == 0) {
-		*type = AttributeType_Joints;
+
+	// either mapping was not requested or it has failed, fallback to reading the file
+	outStorage->size = 0;
+
+	if (!io->open) {
+		if (!platform_fileread(path, &outStorage->size, &outStorage->data, allocator)) return 0;
+		outStorage->type = StorageType_Heap;
+		return 1;
 	}
-	else if (len == 7 && strncmp_impl(name, "WEIGHTS", 7) == 0) {
-		*type = AttributeType_Weights;
+
+	void* file = io->open(io->userData, path);
+	if (!file) return 0;
+
+	unsigned long long size = io->size(io->userData, file);
+	void* data = size > 0 ? gltfmemory_allocate(allocator, size, 0) : NULL;
+	if (!data || !io->read(io->userData, file, 0, size, data)) {
+		gltfmemory_deallocate(allocator, data);
+		io->release(io->userData, file);
+		return 0;
 	}
-	else {
-		*type = AttributeType_Invalid;
+	io->release(io->userData, file);
+
+	outStorage->data = data;
+	outStorage->size = size;
+	outStorage->type = StorageType_Heap;
+	return 1;
+}
+
+/// @brief releases a storage according to it's type
+/// @param storage the storage to be released
+/// @param allocator the allocator a heap storage comes from
+static void internal_storage_release(GLTF_Storage* storage, const GLTF_Allocator* allocator) {
+	if (storage->type == StorageType_Heap) gltfmemory_deallocate(allocator, storage->data);
+	else if (storage->type == StorageType_Mapped) platform_fileunmap(storage->data, storage->size);
+	else if (storage->type == StorageType_FileIO) storage->release(storage->userData, storage->file);
+
+	gltfmemory_zero(storage, sizeof(GLTF_Storage));
+}
+
+/// @brief checks if a character is an hexadecimal digit and converts it
+/// @param c the character
+/// @return the digit value, -1 if it's not an hexadecimal digit
+static int internal_hex_value(char c) {
+	if (c >= '0' && c <= '9') return c - '0';
+	if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+	return -1;
+}
+
+/// @brief checks if a character is an ascii letter, independently of the current locale
+/// @param c the character
+/// @return 1 if it's a letter, 0 otherwise
+static int internal_is_letter(char c) {
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+/// @brief checks if an uri starts with a scheme, like "http:" or "file:"
+/// @param uri the uri
+/// @return 1 if it has a scheme, 0 otherwise, a single letter followed by ':' is a windows drive and not a scheme
+static int internal_uri_has_scheme(const char* uri) {
+	if (!internal_is_letter(uri[0])) return 0;
+
+	unsigned long long i = 1;
+	while (internal_is_letter(uri[i]) || (uri[i] >= '0' && uri[i] <= '9') || uri[i] == '+' || uri[i] == '-' || uri[i] == '.') ++i;
+	return uri[i] == ':' && i > 1;
+}
+
+/// @brief checks if a path is absolute, from the root or a windows drive
+/// @param path the path
+/// @return 1 if it's absolute, 0 if it's relative
+static int internal_path_is_absolute(const char* path) {
+	if (path[0] == '/' || path[0] == '\\') return 1;
+	return internal_is_letter(path[0]) && path[1] == ':';
+}
+
+/// @brief decodes the percent-encoded characters of an uri and joins it to the directory of a base path
+/// @param basePath the path the uri is relative to, may be NULL
+/// @param uri the uri to be resolved, it must not have a scheme
+/// @return the resolved path, allocated from the parse arena, NULL on failure
+static char* internal_resolve_uri(const char* basePath, const char* uri) {
+	unsigned long long dirLength = 0;
+
+	// absolute paths are not relative to anything
+	if (basePath && !internal_path_is_absolute(uri)) {
+		for (unsigned long long i = 0; basePath[i] != '\0'; ++i) {
+			if (basePath[i] == '/' || basePath[i] == '\\') dirLength = i + 1;
+		}
 	}
 
-	if (us && *type != AttributeType_Invalid) {
-		*index = atoi(us + 1);
-		if (*index < 0) {
-			*type = *type = AttributeType_Invalid;
-			*index = 0;
+	unsigned long long uriLength = strlen(uri);
+	char* path = (char*)gltfarena_allocate(s_gState->arena, dirLength + uriLength + 1, 0);
+	if (!path) return NULL;
+
+	memcpy(path, basePath, dirLength);
+	char* out = path + dirLength;
+
+	for (unsigned long long i = 0; i < uriLength; ++i) {
+		if (uri[i] == '%' && i + 2 < uriLength) {
+			int high = internal_hex_value(uri[i + 1]);
+			int low = internal_hex_value(uri[i + 2]);
+			if (high >= 0 && low >= 0) {
+				*out++ = (char)(high * 16 + low);
+				i += 2;
+				continue;
+			}
 		}
+		*out++ = uri[i];
 	}
+	*out = '\0';
+	return path;
 }
 
-/// @brief parses the attribute lists
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param attributes the output data with the parsed information
-/// @param attributesCount the parsed attributes count
-/// @return the next token index to be analyzed
-static int internal_parse_attribute_list(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Attribute** attributes, unsigned long long* attributesCount) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+/// @brief an external file to be loaded by internal_file_task
+typedef struct {
+	const char* kind;
+	unsigned long long index;
+	char* path;
+	GLTF_FileMode mode;
+	const GLTF_FileIO* io;
+	const GLTF_Allocator* allocator;
+	GLTF_Storage* storage;
+	int loaded;
+} internal_file_job;
+
+/// @brief loads one of the external files, may run on any thread so it must not log errors
+/// @note the application reads external buffers in any order, so they are not mapped for sequential access
+/// @param taskData the internal_file_job array
+/// @param index which job to run
+static void internal_file_task(void* taskData, unsigned long long index) {
+	internal_file_job* job = (internal_file_job*)taskData + index;
+	job->loaded = internal_file_load(job->path, job->mode, job->io, job->allocator, 0, job->storage);
+}
 
-	*attributesCount = tokens[tkindex].size;
-	*attributes = (GLTF_Attribute*)gltfmemory_allocate(sizeof(GLTF_Attribute) * (*attributesCount), 1);
-	++tkindex;
+/// @brief checks if an uri refers to an external file and prepares the job that loads it
+/// @param data the gltf parsed data
+/// @param kind what is being loaded, used in error messages
+/// @param index the index of what is being loaded, used in error messages
+/// @param uri the uri to be loaded, may be NULL
+/// @param storage where the file will be loaded into
+/// @param outJob the prepared job
+/// @return 1 if a job was prepared, 0 if there's nothing to load, -1 on failure
+static int internal_file_job_prepare(GLTF2* data, const char* kind, unsigned long long index, const char* uri, GLTF_Storage* storage, internal_file_job* outJob) {
+	if (!uri) {
+		return 0;
+	}
 
-	for (unsigned long long j = 0; j < *attributesCount; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+	// only base64 data uris are supported, they are decoded while parsing the json so any other is left here
+	if (strncmp_impl(uri, "data:", 5) == 0) {
+		internal_log_error(ErrorCode_Unsupported, "%s %llu data uri is not base64, only base64 data uris are supported", kind, index);
+		return -1;
+	}
 
-		tkindex = json_parse_string(data, tokens, tkindex, &(*attributes)[j].name);
-		GLTF_ASSERT(attributes > 0, "There was an error when parsing attributes");
+	if (internal_uri_has_scheme(uri)) {
+		internal_log_error(ErrorCode_Unsupported, "%s %llu uri is not a file path: %s", kind, index, uri);
+		return -1;
+	}
 
-		internal_parse_attribute_type((*attributes)[j].name, &(*attributes)[j].type, &(*attributes)[j].index);
-		(*attributes)[j].data = PTR_TO_INDEX(GLTF_Accessor, json_to_int(data, tokens + tkindex));
-		++tkindex;
+	outJob->path = internal_resolve_uri(data->fileInfo.path, uri);
+	if (!outJob->path) {
+		internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for %s %llu path", kind, index);
+		return -1;
 	}
-	return tkindex;
+
+	outJob->kind = kind;
+	outJob->index = index;
+	outJob->mode = data->fileInfo.fileMode;
+	outJob->io = &data->fileInfo.io;
+	outJob->allocator = &data->fileInfo.allocator;
+	outJob->storage = storage;
+	outJob->loaded = 0;
+	return 1;
 }
 
-/// @brief parses the json primitive
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param primitive the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_primitive(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Primitive* primitive) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-	int size = tokens[tkindex].size;
-	++tkindex;
+/// @brief loads every external buffer and image at once, then points buffer views and images into their data
+/// @param data the gltf parsed data
+/// @return 1 on success, 0 on failure
+static int internal_load_external(GLTF2* data) {
+	internal_file_job* jobs = NULL;
+	unsigned long long jobsCount = 0;
+	int result = 1;
 
-	primitive->type = PrimitiveType_Triangles;
+	if (data->buffersCount + data->imagesCount > 0) {
+		jobs = (internal_file_job*)gltfmemory_allocate(&s_gState->options.allocator, sizeof(internal_file_job) * (data->buffersCount + data->imagesCount), 0);
+		if (!jobs) {
+			internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for the external files");
+			return 0;
+		}
+	}
 
-	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+	for (unsigned long long i = 0; i < data->buffersCount && result; ++i) {
+		GLTF_Buffer* buffer = &data->buffers[i];
 
-		if (json_strncmp(data, tokens + tkindex, "mode") == 0) {
-			++tkindex;
-			primitive->type = (GLTF_PrimitiveType)json_to_int(data, tokens + tkindex);
-			++tkindex;
-		}
-		else if (json_strncmp(data, tokens + tkindex, "indices") == 0) {
-			++tkindex;
-			primitive->indices = PTR_TO_INDEX(GLTF_Accessor, json_to_int(data, tokens + tkindex));
-			++tkindex;
-		}
-		else if (json_strncmp(data, tokens + tkindex, "material") == 0) {
-			++tkindex;
-			primitive->material = PTR_TO_INDEX(GLTF_Material, json_to_int(data, tokens + tkindex));
-			++tkindex;
-		}
-		else if (json_strncmp(data, tokens + tkindex, "attributes") == 0) {
-			tkindex = internal_parse_attribute_list(data, tokens, tkindex + 1, &primitive->attributes, &primitive->attributesCount);
+		// base64 data uris were already decoded while parsing the json
+		if (buffer->storage.type != StorageType_None) {
+			if (buffer->storage.size < buffer->size) {
+				internal_log_error(ErrorCode_InvalidDocument, "Buffer %llu data uri is smaller than its byteLength (%llu < %llu)", i, buffer->storage.size, buffer->size);
+				result = 0;
+			}
+			continue;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "targets") == 0) {
-			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_MorphTarget), (void**)&primitive->targets, &primitive->targetsCount);
-			if (tkindex  < 0) return tkindex;
 
-			for (unsigned long long k = 0; k < primitive->targetsCount; ++k) {
-				tkindex = internal_parse_attribute_list(data, tokens, tkindex, &primitive->targets[k].attributes, &primitive->targets[k].attributesCount);
-				if (tkindex < 0) return tkindex;
+		// the glb bin chunk is referenced by the first buffer, which has no uri
+		if (!buffer->URI) {
+			if (i == 0 && data->fileInfo.type == 0 && data->fileInfo.bin) {
+				if (data->fileInfo.binSize < buffer->size) {
+					internal_log_error(ErrorCode_InvalidGLB, "GLB bin chunk is smaller than the buffer byteLength (%llu < %llu)", data->fileInfo.binSize, buffer->size);
+					result = 0;
+				}
+				buffer->data = data->fileInfo.bin;
 			}
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
-			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &primitive->extras);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
-			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &primitive->extensionsCount, &primitive->extensions);
-		}
-		else {
-			tkindex = json_parse_skip(tokens, tkindex + 1);
+			continue;
 		}
 
-		if (tkindex < 0) return tkindex;
+		int prepared = internal_file_job_prepare(data, "Buffer", i, buffer->URI, &buffer->storage, &jobs[jobsCount]);
+		if (prepared < 0) result = 0;
+		jobsCount += prepared > 0;
 	}
-	return tkindex;
-}
 
-/// @brief parses a single mesh
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param mesh the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_mesh(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Mesh* mesh) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-	int size = tokens[tkindex].size;
-	++tkindex;
+	for (unsigned long long i = 0; i < data->imagesCount && result; ++i) {
+		GLTF_Image* image = &data->images[i];
+		if (image->storage.type != StorageType_None) continue;
 
-	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		int prepared = internal_file_job_prepare(data, "Image", i, image->URI, &image->storage, &jobs[jobsCount]);
+		if (prepared < 0) result = 0;
+		jobsCount += prepared > 0;
+	}
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) {
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &mesh->name);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "primitives") == 0) {
-			tkindex = json_parse_array(data , tokens, tkindex + 1, sizeof(GLTF_Primitive), (void**)&mesh->primitives, &mesh->primitivesCount);
-			if (tkindex < 0) return tkindex;
+	// every file is read at once, the parsing only goes on when all of them are resident
+	if (result && jobsCount > 0) {
+		if (s_gState->options.taskDispatch) s_gState->options.taskDispatch(s_gState->options.taskUserData, internal_file_task, jobs, jobsCount);
+		else platform_parallel_for(s_gState->options.loadThreads, jobsCount, internal_file_task, jobs, &s_gState->options.allocator);
+	}
 
-			for (unsigned long long prim_index = 0; prim_index < mesh->primitivesCount; ++prim_index) {
-				tkindex = internal_parse_primitive(data, tokens, tkindex, &mesh->primitives[prim_index]);
-				if (tkindex < 0) return tkindex;
-			}
+	for (unsigned long long i = 0; i < jobsCount; ++i) {
+		if (result && !jobs[i].loaded) {
+			internal_log_error(ErrorCode_File, "Failed to read %s %llu: %s", jobs[i].kind, jobs[i].index, jobs[i].path);
+			result = 0;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "weights") == 0) {
-			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(float), (void**)&mesh->weights, &mesh->weightsCount);
-			if (tkindex < 0) return tkindex;
-			tkindex = json_parse_array_float(data, tokens, tkindex - 1, mesh->weights, (int)mesh->weightsCount);
+	}
+	gltfmemory_deallocate(&s_gState->options.allocator, jobs);
+	if (!result) return 0;
+
+	for (unsigned long long i = 0; i < data->buffersCount; ++i) {
+		GLTF_Buffer* buffer = &data->buffers[i];
+		if (!buffer->URI || buffer->storage.type == StorageType_None) continue;
+
+		if (buffer->storage.size < buffer->size) {
+			internal_log_error(ErrorCode_InvalidDocument, "Buffer %llu file is smaller than its byteLength (%llu < %llu)", i, buffer->storage.size, buffer->size);
+			return 0;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) { 
-			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &mesh->extras);
+		buffer->data = buffer->storage.data;
+	}
+
+	for (unsigned long long i = 0; i < data->bufferViewsCount; ++i) {
+		GLTF_BufferView* view = &data->bufferViews[i];
+		if (!view->buffer || !view->buffer->data) continue;
+
+		if (view->offset > view->buffer->size || view->size > view->buffer->size - view->offset) {
+			internal_log_error(ErrorCode_InvalidDocument, "Buffer view %llu is out of it's buffer bounds", i);
+			return 0;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
-			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &mesh->extensionsCount, &mesh->extensions); 
+		view->data = (unsigned char*)view->buffer->data + view->offset;
+	}
+
+	// images are either loaded from their own file or stored inside buffer views
+	for (unsigned long long i = 0; i < data->imagesCount; ++i) {
+		GLTF_Image* image = &data->images[i];
+
+		if (image->storage.type != StorageType_None) {
+			image->data = image->storage.data;
+			image->size = image->storage.size;
 		}
-		else {
-			tkindex = json_parse_skip(tokens, tkindex + 1); 
+		else if (image->bufferView && image->bufferView->data) {
+			image->data = image->bufferView->data;
+			image->size = image->bufferView->size;
 		}
-
-		if (tkindex < 0) return tkindex;
 	}
-	return tkindex;
-}
 
-/// @brief parses the meshes
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outData the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_meshes(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Mesh), (void**)&outData->meshes, &outData->meshesCount);
-	if (tkindex < 0) return tkindex;
+	return 1;
+}
 
-	for (unsigned long long j = 0; j < outData->meshesCount; ++j) {
-		tkindex = internal_parse_mesh(data, tokens, tkindex, &outData->meshes[j]);
-		if (tkindex < 0) return tkindex;
-	}
-	return tkindex;
+GLTF2 GLTF_ParseFromFile(const char* path) {
+	return GLTF_ParseFromFileWithOptions(path, NULL);
 }
 
-/// @brief parses a single node
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param node the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_node(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Node* node) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-	int size = tokens[tkindex].size;
-	++tkindex;
+/// @brief remembers where every buffer is loaded from, so their buffer views can be required later on
+/// @param data the gltf parsed data
+/// @return 1 on success, 0 on failure
+static int internal_prepare_lazy(GLTF2* data) {
 
-	node->rotation[3] = 1.0f;
-	node->scale[0] = 1.0f;
-	node->scale[1] = 1.0f;
-	node->scale[2] = 1.0f;
-	node->matrix[0] = 1.0f;
-	node->matrix[5] = 1.0f;
-	node->matrix[10] = 1.0f;
-	node->matrix[15] = 1.0f;
+	for (unsigned long long i = 0; i < data->buffersCount; ++i) {
+		GLTF_Buffer* buffer = &data->buffers[i];
 
-	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		// the glb bin chunk is referenced by the first buffer, which has no uri
+		if (!buffer->URI) {
+			if (i != 0 || data->fileInfo.type != 0 || data->fileInfo.binSize == 0) continue;
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) {
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &node->name);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "children") == 0) {
-			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_Node*), (void**)&node->children, &node->childrenCount);
-			if (tkindex < 0) return tkindex;
+			if (data->fileInfo.binSize < buffer->size) {
+				internal_log_error(ErrorCode_InvalidGLB, "GLB bin chunk is smaller than the buffer byteLength (%llu < %llu)", data->fileInfo.binSize, buffer->size);
+				return 0;
+			}
 
-			for (unsigned long long k = 0; k < node->childrenCount; ++k) {
-				node->children[k] = PTR_TO_INDEX(GLTF_Node, json_to_int(data, tokens + tkindex));
-				++tkindex;
+			// the bin chunk is still in memory when it has been copied or the file is retained
+			if (data->fileInfo.bin) {
+				buffer->data = data->fileInfo.bin;
+				continue;
 			}
+
+			if (!data->fileInfo.path) continue;
+
+			unsigned long long length = strlen(data->fileInfo.path);
+			buffer->path = (char*)gltfarena_allocate(s_gState->arena, length + 1, 0);
+			if (!buffer->path) {
+				internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for buffer %llu path", i);
+				return 0;
+			}
+			memcpy(buffer->path, data->fileInfo.path, length + 1);
+			buffer->fileOffset = data->fileInfo.binOffset;
+			continue;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "mesh") == 0) {
-			++tkindex;
-			GLTF_ASSERT(tokens[tkindex].type == JSMN_PRIMITIVE, "The expected unprocessed extension is not a json valid primitive");
-			node->mesh = PTR_TO_INDEX(GLTF_Mesh, json_to_int(data, tokens + tkindex));
-			++tkindex;
-		}
-		else if (json_strncmp(data, tokens + tkindex, "skin") == 0) {
-			++tkindex;
-			GLTF_ASSERT(tokens[tkindex].type == JSMN_PRIMITIVE, "The expected unprocessed extension is not a json valid primitive");
-			node->skin = PTR_TO_INDEX(GLTF_Skin, json_to_int(data, tokens + tkindex));
-			++tkindex;
-		}
-		else if (json_strncmp(data, tokens + tkindex, "camera") == 0) {
-			++tkindex;
-			GLTF_ASSERT(tokens[tkindex].type == JSMN_PRIMITIVE, "The expected unprocessed extension is not a json valid primitive");
-			node->camera = PTR_TO_INDEX(GLTF_Camera, json_to_int(data, tokens + tkindex));
-			++tkindex;
-		}
-		else if (json_strncmp(data, tokens + tkindex, "translation") == 0) { 
-			tkindex = json_parse_array_float(data, tokens, tkindex + 1, node->translation, 3);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "rotation") == 0) { 
-			tkindex = json_parse_array_float(data, tokens, tkindex + 1, node->rotation, 4);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "scale") == 0) { 
-			tkindex = json_parse_array_float(data, tokens, tkindex + 1, node->scale, 3);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "matrix") == 0) { 
-			tkindex = json_parse_array_float(data, tokens, tkindex + 1, node->matrix, 16);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "weights") == 0) {
-			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(float), (void**)&node->weights, &node->weightsCount);
-			if (tkindex < 0) return tkindex;
-			tkindex = json_parse_array_float(data, tokens, tkindex - 1, node->weights, (int)node->weightsCount);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
-			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &node->extras);
+
+		// data uris are decoded as a whole when required
+		if (strncmp_impl(buffer->URI, "data:", 5) == 0) {
+			continue;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
-			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &node->extensionsCount, &node->extensions);
+
+		if (internal_uri_has_scheme(buffer->URI)) {
+			internal_log_error(ErrorCode_Unsupported, "Buffer %llu uri is not a file path: %s", i, buffer->URI);
+			return 0;
 		}
-		else { 
-			tkindex = json_parse_skip(tokens, tkindex + 1); 
+
+		buffer->path = internal_resolve_uri(data->fileInfo.path, buffer->URI);
+		if (!buffer->path) {
+			internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for buffer %llu path", i);
+			return 0;
 		}
+	}
 
-		if (tkindex < 0) return tkindex;
+	return 1;
+}
+
+/// @brief decodes a buffer base64 data uri into the buffer's own storage
+/// @param buffer the buffer whose uri is decoded
+/// @param allocator where the decoded data is allocated from
+/// @return 1 on success, 0 on failure
+static int internal_decode_buffer_uri(GLTF_Buffer* buffer, const GLTF_Allocator* allocator) {
+	const char* payload = strchr_impl(buffer->URI, ',');
+	if (!payload || payload - buffer->URI < 12 || gltfmemory_cmp(payload - 7, ";base64", 7) != 0) {
+		internal_log_error(ErrorCode_Unsupported, "Only base64 data uris are supported");
+		return 0;
 	}
-	return tkindex;
+	payload++;
+
+	unsigned long long length = strlen(payload);
+	void* decoded = gltfmemory_allocate(allocator, base64_decoded_size(length), 0);
+	if (!decoded) {
+		internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for a base64 data uri");
+		return 0;
+	}
+
+	unsigned long long size = 0;
+	if (!base64_decode(payload, length, decoded, &size) || size < buffer->size) {
+		gltfmemory_deallocate(allocator, decoded);
+		internal_log_error(ErrorCode_InvalidDocument, "Invalid base64 data uri");
+		return 0;
+	}
+
+	buffer->storage.data = decoded;
+	buffer->storage.size = size;
+	buffer->storage.type = StorageType_Heap;
+	buffer->data = decoded;
+	return 1;
 }
 
-/// @brief parses the nodes
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outData the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_nodes(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Node), (void**)&outData->nodes, &outData->nodesCount);
-	if (tkindex < 0) return tkindex;
+/// @brief checks if the parse options can be used
+/// @param options the options to be checked
+/// @return 1 if they're valid, 0 otherwise
+static int internal_options_valid(const GLTF_ParseOptions* options) {
+	const GLTF_FileIO* io = &options->io;
+	if (io->open && (!io->size || !io->read || !io->release)) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid file io, size, read and release must be set along with open");
+		return 0;
+	}
 
-	for (unsigned long long j = 0; j < outData->nodesCount; ++j) {
-		tkindex = internal_parse_node(data, tokens, tkindex, &outData->nodes[j]);
-		if (tkindex < 0) return tkindex;
+	const GLTF_Allocator* allocator = &options->allocator;
+	if ((allocator->allocate || allocator->reallocate || allocator->deallocate) && (!allocator->allocate || !allocator->reallocate || !allocator->deallocate)) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid allocator, allocate, reallocate and deallocate must be set together");
+		return 0;
 	}
-	return tkindex;
+	return 1;
 }
 
-/// @brief parses a single sampler
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param sampler the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_image_sampler(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_ImageSampler* sampler) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-	int size = tokens[tkindex].size;
-	++tkindex;
+/// @brief parses a document that is already in memory and loads it's external data
+/// @param file the document data, released at the end unless the options retains it
+/// @param path the path external uris are relative to, may be NULL
+/// @param options how the document should be parsed, never NULL
+/// @return a parsed output data
+static GLTF2 internal_parse_storage(GLTF_Storage file, const char* path, const GLTF_ParseOptions* options) {
+	GLTF2 parsedData = { 0 };
+	parsedData.fileInfo.path = path;
+	parsedData.fileInfo.fileMode = options->fileMode;
+	parsedData.fileInfo.io = options->io;
+	parsedData.fileInfo.allocator = options->allocator;
+	s_gState->arena = &parsedData.arena;
+
+	parsedData.arena = gltfarena_create(&options->allocator);
+	if (!parsedData.arena) {
+		internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for the parsed data");
+		internal_storage_release(&file, &options->allocator);
+		s_gState->arena = NULL;
+		return parsedData;
+	}
 
-	sampler->wrapS = WrapMode_Repeat;
-	sampler->wrapT = WrapMode_Repeat;
+	// when retaining the file, GLTF_Free becomes responsible for releasing it
+	if (options->retainFileData) {
+		parsedData.fileInfo.storage = file;
+	}
 
-	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+	// strings can only point into the json when it's a private copy that lives as long as the parsed data
+	parsedData.fileInfo.stringViews = options->stringViews && options->retainFileData && file.type == StorageType_Heap;
+	s_gState->stringViews = parsedData.fileInfo.stringViews;
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) {
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &sampler->name);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "magFilter") == 0) {
-			++tkindex; 
-			sampler->magFilter = (GLTF_FilterType)json_to_int(data, tokens + tkindex); 
-			++tkindex; 
-		}
-		else if (json_strncmp(data, tokens + tkindex, "minFilter") == 0) {
-			++tkindex; sampler->minFilter = (GLTF_FilterType)json_to_int(data, tokens + tkindex); 
-			++tkindex; 
-		}
-		else if (json_strncmp(data, tokens + tkindex, "wrapS") == 0) { 
-			++tkindex; 
-			sampler->wrapS = (GLTF_WrapMode)json_to_int(data, tokens + tkindex); 
-			++tkindex; 
-		}
-		else if (json_strncmp(data, tokens + tkindex, "wrapT") == 0) { 
-			++tkindex; 
-			sampler->wrapT = (GLTF_WrapMode)json_to_int(data, tokens + tkindex); 
-			++tkindex; 
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
-			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &sampler->extras);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) { 
-			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &sampler->extensionsCount, &sampler->extensions);
-		}
-		else { 
-			tkindex = json_parse_skip(tokens, tkindex + 1); 
-		}
+	// lazy files reads the glb bin chunk back from the file when it's required, instead of copying it
+	int lazyFile = options->bufferMode == BufferMode_Lazy && file.type != StorageType_Borrowed;
+	int copyBin = !options->retainFileData && !lazyFile;
 
-		if (tkindex < 0) return tkindex;
+	int parsed = internal_parse_document((const unsigned char*)file.data, file.size, copyBin, &parsedData);
+
+	if (!options->retainFileData) {
+		internal_storage_release(&file, &options->allocator);
+		parsedData.fileInfo.json = NULL;
+		if (!copyBin) parsedData.fileInfo.bin = NULL;
 	}
-	return tkindex;
-}
 
-/// @brief parses the samplers
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outData the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_image_samplers(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_ImageSampler), (void**)&outData->imageSamplers, &outData->imageSamplersCount);
-	if (tkindex < 0) return tkindex;
+	if (parsed && options->bufferMode == BufferMode_Load) {
+		parsed = internal_load_external(&parsedData);
+	}
+	else if (parsed && options->bufferMode == BufferMode_Lazy) {
+		parsed = internal_prepare_lazy(&parsedData);
+	}
 
-	for (unsigned long long j = 0; j < outData->imageSamplersCount; ++j) {
-		tkindex = internal_parse_image_sampler(data, tokens, tkindex, &outData->imageSamplers[j]);
-		if (tkindex < 0) return tkindex;
+	if (!parsed) {
+		GLTF_Free(&parsedData); // Clean up any partial parsing, including the retained file
 	}
-	return tkindex;
+
+	s_gState->arena = NULL;
+	s_gState->stringViews = 0;
+	return parsedData;
 }
 
-/// @brief parses a skin
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param skin the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_skin(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Skin* skin) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-	int size = tokens[tkindex].size;
-	++tkindex;
+GLTF2 GLTF_ParseFromFileWithOptions(const char* path, const GLTF_ParseOptions* options) {
+	GLTF2 parsedData = { 0 };
 
-	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+	GLTF_ParseOptions defaultOptions = { 0 };
+	if (!options) options = &defaultOptions;
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) {
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &skin->name);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "joints") == 0) {
-			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_Node*), (void**)&skin->joints, &skin->jointsCount);
-			if (tkindex < 0) return tkindex;
+	internal_parse_state state;
+	internal_parse_begin(&state, options);
 
-			for (unsigned long long k = 0; k < skin->jointsCount; ++k) {
-				skin->joints[k] = PTR_TO_INDEX(GLTF_Node, json_to_int(data, tokens + tkindex));
-				++tkindex;
-			}
-		}
-		else if (json_strncmp(data, tokens + tkindex, "skeleton") == 0) {
-			++tkindex;
-			GLTF_ASSERT(tokens[tkindex].type == JSMN_PRIMITIVE, "The expected unprocessed extension is not a json valid primitive");
-			skin->skeleton = PTR_TO_INDEX(GLTF_Node, json_to_int(data, tokens + tkindex));
-			++tkindex;
-		}
-		else if (json_strncmp(data, tokens + tkindex, "inverseBindMatrices") == 0) {
-			++tkindex;
-			GLTF_ASSERT(tokens[tkindex].type == JSMN_PRIMITIVE, "The expected unprocessed extension is not a json valid primitive");
-			skin->inverseBindMatrices = PTR_TO_INDEX(GLTF_Accessor, json_to_int(data, tokens + tkindex));
-			++tkindex;
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
-			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &skin->extras);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
-			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &skin->extensionsCount, &skin->extensions);
+	if (!path || !path[0]) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid GLTF path (NULL or empty)");
+	}
+	else if (internal_options_valid(options)) {
+		// read file
+		GLTF_Storage file = { 0 };
+		if (internal_file_load(path, options->fileMode, &options->io, &options->allocator, 1, &file)) {
+			parsedData = internal_parse_storage(file, path, options);
 		}
 		else {
-			tkindex = json_parse_skip(tokens, tkindex + 1);
+			internal_log_error(ErrorCode_File, "Failed to read file: %s", path);
 		}
+	}
 
-		if (tkindex < 0) return tkindex;
+	internal_parse_end(&state);
+	return parsedData;
+}
+
+GLTF2 GLTF_ParseFromMemory(const void* data, unsigned long long size, const GLTF_ParseOptions* options) {
+	GLTF2 parsedData = { 0 };
+
+	GLTF_ParseOptions defaultOptions = { 0 };
+	if (!options) options = &defaultOptions;
+
+	internal_parse_state state;
+	internal_parse_begin(&state, options);
+
+	if (!data || size == 0) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid GLTF memory (NULL or empty)");
 	}
-	return tkindex;
+	else if (internal_options_valid(options)) {
+		// the caller owns the memory, it's never copied nor released
+		GLTF_Storage file = { 0 };
+		file.data = (void*)data;
+		file.size = size;
+		file.type = StorageType_Borrowed;
+
+		parsedData = internal_parse_storage(file, options->basePath, options);
+	}
+
+	internal_parse_end(&state);
+	return parsedData;
 }
 
-/// @brief parses the skins
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outData the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_skins(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Skin), (void**)&outData->skins, &outData->skinsCount);
-	if (tkindex < 0) return tkindex;
+/// @brief a workspace of a batch, taken by one file at a time
+typedef struct {
+	GLTF_Workspace workspace;
+	volatile long long busy;
+} internal_batch_slot;
 
-	for (unsigned long long j = 0; j < outData->skinsCount; ++j) {
-		tkindex = internal_parse_skin(data, tokens, tkindex, &outData->skins[j]);
-		if (tkindex < 0) return tkindex;
+/// @brief the files of a batch, shared by every thread parsing them
+typedef struct {
+	const char* const* paths;
+	GLTF_ParseOptions options;
+	GLTF_BatchResult* results;
+	internal_batch_slot* slots;         // one per thread, so the tokens are allocated once per thread instead of once per file
+	unsigned int slotsCount;
+} internal_batch;
+
+/// @brief parses one file of a batch, may run on any thread
+/// @param taskData the internal_batch
+/// @param index which file to parse
+static void internal_batch_task(void* taskData, unsigned long long index) {
+	internal_batch* batch = (internal_batch*)taskData;
+	GLTF_BatchResult* result = batch->results + index;
+
+	// every file has it's own context, only it's first error is kept so huge batches stays small
+	GLTF_Context context;
+	GLTF_ParseOptions options = batch->options;
+	options.context = &context;
+
+	// takes the first free workspace, there's one per thread so there's always one unless the caller's dispatch runs more tasks at once
+	internal_batch_slot* slot = NULL;
+	for (unsigned int i = 0; i < batch->slotsCount && !slot; ++i) {
+		if (platform_atomic_add(&batch->slots[i].busy, 1) == 0) slot = batch->slots + i;
+		else platform_atomic_add(&batch->slots[i].busy, -1);
 	}
-	return tkindex;
+	options.workspace = slot ? &slot->workspace : NULL;
+
+	double start = platform_time();
+	result->data = GLTF_ParseFromFileWithOptions(batch->paths[index], &options);
+	result->seconds = platform_time() - start;
+
+	if (slot) platform_atomic_add(&slot->busy, -1);
+
+	result->parsed = result->data.arena != NULL;
+	result->errorsCount = context.errorsCount;
+	if (context.errorsCount > 0) result->error = context.errors[0];
+	else memset(&result->error, 0, sizeof(GLTF_Error));
 }
 
-/// @brief parses a scene
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param scene the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_scene(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Scene* scene) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-	int size = tokens[tkindex].size;
-	++tkindex;
+unsigned long long GLTF_ParseBatch(const char* const* paths, unsigned long long count, const GLTF_ParseOptions* options, GLTF_BatchResult* results, GLTF_BatchStats* outStats) {
+	GLTF_ParseOptions defaultOptions = { 0 };
+	if (!options) options = &defaultOptions;
 
-	for (int j = 0; j < size; ++j){
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+	if (outStats) memset(outStats, 0, sizeof(GLTF_BatchStats));
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) {
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &scene->name);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "nodes") == 0) {
-			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_Node*), (void**)&scene->nodes, &scene->nodesCount);
-			if (tkindex < 0) return tkindex;
+	internal_parse_state state;
+	internal_parse_begin(&state, options);
 
-			for (unsigned long long k = 0; k < scene->nodesCount; ++k) {
-				scene->nodes[k] = PTR_TO_INDEX(GLTF_Node, json_to_int(data, tokens + tkindex));
-				++tkindex;
+	int valid = 1;
+	if (count > 0 && (!paths || !results)) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid GLTF batch (NULL paths or results)");
+		valid = 0;
+	}
+	else if (!internal_options_valid(options)) {
+		valid = 0;
+	}
+
+	internal_parse_end(&state);
+	if (!valid || count == 0) return 0;
+
+	memset(results, 0, sizeof(GLTF_BatchResult) * count);
+
+	// the files are spread across the threads, so each of them loads it's external files by itself
+	internal_batch batch;
+	batch.paths = paths;
+	batch.options = *options;
+	batch.options.loadThreads = 1;
+	batch.options.parseThreads = 1;
+	batch.options.taskDispatch = NULL;
+	batch.options.taskUserData = NULL;
+	batch.options.workspace = NULL;
+	batch.results = results;
+
+	unsigned int threads = options->loadThreads ? options->loadThreads : platform_cpu_count();
+	if (threads > count) threads = (unsigned int)count;
+
+	// without workspaces every file simply allocates it's own tokens
+	batch.slotsCount = options->taskDispatch ? platform_cpu_count() : threads;
+	batch.slots = (internal_batch_slot*)gltfmemory_allocate(&options->allocator, sizeof(internal_batch_slot) * batch.slotsCount, 1);
+	if (!batch.slots) batch.slotsCount = 0;
+
+	double start = platform_time();
+	if (options->taskDispatch) options->taskDispatch(options->taskUserData, internal_batch_task, &batch, count);
+	else platform_parallel_for(threads, count, internal_batch_task, &batch, &options->allocator);
+	double seconds = platform_time() - start;
+
+	for (unsigned int i = 0; i < batch.slotsCount; ++i) {
+		GLTF_ReleaseWorkspace(&batch.slots[i].workspace);
+	}
+	gltfmemory_deallocate(&options->allocator, batch.slots);
+
+	unsigned long long parsedCount = 0;
+	for (unsigned long long i = 0; i < count; ++i) {
+		if (results[i].parsed) parsedCount++;
+	}
+
+	if (outStats) {
+		outStats->filesCount = count;
+		outStats->parsedCount = parsedCount;
+		outStats->threadsCount = options->taskDispatch ? 0 : threads;
+		outStats->seconds = seconds;
+		for (unsigned long long i = 0; i < count; ++i) {
+			outStats->filesSeconds += results[i].seconds;
+			if (results[i].seconds > outStats->slowestSeconds) {
+				outStats->slowestSeconds = results[i].seconds;
+				outStats->slowestIndex = i;
 			}
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
-			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &scene->extras);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
-			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &scene->extensionsCount, &scene->extensions);
-		}
-		else {
-			tkindex = json_parse_skip(tokens, tkindex + 1);
-		}
+	}
+	return parsedCount;
+}
 
-		if (tkindex < 0) return tkindex;
+/// @brief tells where a probe keeps the element count of a root key
+/// @param key the root key
+/// @param info the probed metadata
+/// @return the element count of the key, NULL when the key isn't a counted collection
+static unsigned long long* internal_probe_count(internal_json_key key, GLTF_ProbeInfo* info) {
+	switch (key) {
+	case JsonKey_Accessors: return &info->accessorsCount;
+	case JsonKey_Animations: return &info->animationsCount;
+	case JsonKey_BufferViews: return &info->bufferViewsCount;
+	case JsonKey_Cameras: return &info->camerasCount;
+	case JsonKey_Images: return &info->imagesCount;
+	case JsonKey_Materials: return &info->materialsCount;
+	case JsonKey_Meshes: return &info->meshesCount;
+	case JsonKey_Nodes: return &info->nodesCount;
+	case JsonKey_Samplers: return &info->imageSamplersCount;
+	case JsonKey_Scenes: return &info->scenesCount;
+	case JsonKey_Skins: return &info->skinsCount;
+	case JsonKey_Textures: return &info->texturesCount;
+	default: return NULL;
 	}
-	return tkindex;
 }
 
-/// @brief parses the scenes
+/// @brief reads the byteLength of every buffer, anything else of them is skipped
 /// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outData the output data with the parsed information
+/// @param tokens the json tokens
+/// @param tkindex the json token index of the buffers array
+/// @param outInfo the probed metadata
 /// @return the next token index to be analyzed
-static int internal_parse_scenes(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Scene), (void**)&outData->scenes, &outData->scenesCount);
+static int internal_probe_buffers(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_ProbeInfo* outInfo) {
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(unsigned long long), (void**)&outInfo->bufferSizes, &outInfo->buffersCount, s_gState->arena);
 	if (tkindex < 0) return tkindex;
 
-	for (unsigned long long j = 0; j < outData->scenesCount; ++j) {
-		tkindex = internal_parse_scene(data, tokens, tkindex, &outData->scenes[j]);
-		if (tkindex < 0) return tkindex;
+	for (unsigned long long i = 0; i < outInfo->buffersCount; ++i) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected buffer is not a json valid object");
+		int size = tokens[tkindex].size;
+		++tkindex;
+
+		for (int j = 0; j < size; ++j) {
+			if (internal_json_key_lookup(data, tokens + tkindex) == JsonKey_ByteLength) {
+				++tkindex;
+				GLTF_ASSERT(json_read_size(data, tokens + tkindex, &outInfo->bufferSizes[i]), ErrorCode_InvalidDocument, "Invalid json number");
+				++tkindex;
+			}
+			else {
+				tkindex = json_parse_skip(tokens, tkindex + 1);
+			}
+
+			if (tkindex < 0) return tkindex;
+		}
 	}
 	return tkindex;
 }
 
-/// @brief parses a texture
+/// @brief reads the metadata of the json root, collections are only counted
 /// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param texture the output data with the parsed information
+/// @param tokens the json tokens
+/// @param tkindex the initial token index to start probing from
+/// @param outInfo the probed metadata
 /// @return the next token index to be analyzed
-static int internal_parse_texture(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Texture* texture) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+static int internal_probe_jsonroot(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_ProbeInfo* outInfo) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected json root is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
-	for (int j = 0; j < size; ++j){
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) {
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &texture->name);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "sampler") == 0) {
-			++tkindex;
-			texture->sampler = PTR_TO_INDEX(GLTF_ImageSampler, json_to_int(data, tokens + tkindex));
-			++tkindex;
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		unsigned long long* count = internal_probe_count(key, outInfo);
+		if (key == JsonKey_Asset) {
+			tkindex = internal_parse_asset(data, tokens, tkindex + 1, &outInfo->asset);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "source") == 0) {
-			++tkindex;
-			texture->image = PTR_TO_INDEX(GLTF_Image, json_to_int(data, tokens + tkindex));
-			++tkindex;
+		else if (key == JsonKey_Buffers && tokens[tkindex + 1].type == JSMN_ARRAY) {
+			tkindex = internal_probe_buffers(data, tokens, tkindex + 1, outInfo);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
-			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &texture->extras);
+		else if (key == JsonKey_ExtensionsUsed) {
+			tkindex = internal_parse_string_array(data, tokens, tkindex + 1, &outInfo->extensionsUsed, &outInfo->extensionsUsedCount);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
-			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &texture->extensionsCount, &texture->extensions);
+		else if (key == JsonKey_ExtensionsRequired) {
+			tkindex = internal_parse_string_array(data, tokens, tkindex + 1, &outInfo->extensionsRequired, &outInfo->extensionsRequiredCount);
 		}
 		else {
+			// legacy documents keeps their collections in objects, which aren't counted
+			if (count && tokens[tkindex + 1].type == JSMN_ARRAY) *count = tokens[tkindex + 1].size;
 			tkindex = json_parse_skip(tokens, tkindex + 1);
 		}
 
@@ -2942,722 +7641,672 @@ static int internal_parse_texture(const char* data, const jsmntok_t* tokens, int
 	return tkindex;
 }
 
-/// @brief parses the textures
-/// @param data the json entire data
-/// @param tokens the json token to read
-/// @param tkindex the json token index
-/// @param outData the output data with the parsed information
-/// @return the next token index to be analyzed
-static int internal_parse_textures(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Texture), (void**)&outData->textures, &outData->texturesCount);
-	if (tkindex < 0) return tkindex;
-
-	for (unsigned long long j = 0; j < outData->texturesCount; ++j) {
-		tkindex = internal_parse_texture(data, tokens, tkindex, &outData->textures[j]);
-		if (tkindex < 0) return tkindex;
-	}
-	return tkindex;
-}
-
-/// @brief parses the json by it's root
-/// @param data the json entire data
-/// @param tokens the json tokens
-/// @param tkindex the initial token index to start parsing from
-/// @param outData the output data with the parsed information
+/// @brief brings the json of a file into memory, only the header and the json chunk are read from a glb file
+/// @param path the disk path of the file
+/// @param options how the file is read
+/// @param outJson the json, or the whole file when it's not a glb file
+/// @param outInfo receives the glb sizes
 /// @return 1 on success, 0 on failure
-static int internal_parse_jsonroot(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
-	int size = tokens[tkindex].size;
-	++tkindex;
-
-	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+static int internal_probe_file(const char* path, const GLTF_ParseOptions* options, GLTF_Storage* outJson, GLTF_ProbeInfo* outInfo) {
+	unsigned char header[GLB_HEADER_SIZE + GLB_CHUNK_HEADER_SIZE];
 
-		if (json_strncmp(data, tokens + tkindex, "accessors") == 0) {
-			tkindex = internal_parse_accessors(data, tokens, tkindex + 1, outData);
-		}
-		else if(json_strncmp(data, tokens + tkindex, "animation") == 0) {
-			tkindex = internal_parse_animations(data, tokens, tkindex + 1, outData);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "asset") == 0) {
-			tkindex = internal_parse_asset(data, tokens, tkindex + 1, &outData->asset);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "bufferViews") == 0) {
-			tkindex = internal_parse_bufferviews(data, tokens, tkindex + 1, outData);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "buffers") == 0) {
-			tkindex = internal_parse_buffers(data, tokens, tkindex + 1, outData);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "cameras") == 0) {
-			tkindex = internal_parse_cameras(data, tokens, tkindex + 1, outData);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "images") == 0) {
-			tkindex = internal_parse_images(data, tokens, tkindex + 1, outData);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "materials") == 0) {
-			tkindex = internal_parse_materials(data, tokens, tkindex + 1, outData);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "meshes") == 0) {
-			tkindex = internal_parse_meshes(data, tokens, tkindex + 1, outData);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "nodes") == 0) {
-			tkindex = internal_parse_nodes(data, tokens, tkindex + 1, outData);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "samplers") == 0) {
-			tkindex = internal_parse_image_samplers(data, tokens, tkindex + 1, outData);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "scenes") == 0){
-			tkindex = internal_parse_scenes(data, tokens, tkindex + 1, outData);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "scene") == 0) {
-			++tkindex;
-			outData->scene = PTR_TO_INDEX(GLTF_Scene, json_to_int(data, tokens + tkindex));
-			++tkindex;
-		}
-		else if (json_strncmp(data, tokens + tkindex, "skins") == 0) {
-			tkindex = internal_parse_skins(data, tokens, tkindex + 1, outData);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "textures") == 0) {
-			tkindex = internal_parse_textures(data, tokens, tkindex + 1, outData);
+	// anything that isn't a glb, including files smaller than it's header, is read as a whole
+	if (!internal_file_read_range(path, &options->io, 0, sizeof(header), header) || strncmp_impl((const char*)header, "glTF", 4) != 0) {
+		if (!internal_file_load(path, options->fileMode, &options->io, &options->allocator, 1, outJson)) {
+			internal_log_error(ErrorCode_File, "Failed to read file: %s", path);
+			return 0;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
-			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex + 1, &outData->extensionsCount, &outData->extensions);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extensionsUsed") == 0){
-			tkindex = json_parse_array_string(data, tokens, tkindex + 1, &outData->extensionsUsed, &outData->extensionsUsedCount);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extensionsRequired") == 0) {
-			tkindex = json_parse_array_string(data, tokens, tkindex + 1, &outData->extensionsRequired, &outData->extensionsRequiredCount);
-		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
-			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outData->extras);
-		}
-		else {
-			tkindex = json_parse_skip(tokens, tkindex + 1);
+		if (outJson->size >= 4 && strncmp_impl((const char*)outJson->data, "glTF", 4) == 0) {
+			internal_log_error(ErrorCode_InvalidGLB, "GLB file too small (header incomplete)");
+			return 0;
 		}
+		outInfo->jsonSize = outJson->size;
+		return 1;
+	}
 
-		if (tkindex < 0) return tkindex;
+	unsigned int version, totalLength, jsonLength, jsonType;
+	memcpy(&version, header + 4, 4);
+	memcpy(&totalLength, header + 8, 4);
+	memcpy(&jsonLength, header + GLB_HEADER_SIZE, 4);
+	memcpy(&jsonType, header + GLB_HEADER_SIZE + 4, 4);
+
+	if (version != 2) {
+		internal_log_error(ErrorCode_Unsupported, "Unsupported GLB version: %u (expected 2)", version);
+		return 0;
 	}
-	return tkindex;
-}
 
+	if (jsonType != JSON_CHUNK_TYPE) {
+		internal_log_error(ErrorCode_InvalidGLB, "Missing JSON chunk (found type: 0x%X)", jsonType);
+		return 0;
+	}
 
-// @brief returns the number of components for a given gltf data type
-unsigned long long internal_get_components_number(GLTF_Type type) {
-	switch (type)
-	{
-	case Type_Vec2: return 2;
-	case Type_Vec3: return 3;
-	case Type_Vec4: return 4;
-	case Type_Mat2: return 4;
-	case Type_Mat3: return 9;
-	case Type_Mat4: return 16;
-	case Type_Scalar: return 1;
+	unsigned long long jsonEnd = (unsigned long long)sizeof(header) + jsonLength;
+	if (jsonLength == 0 || jsonEnd > totalLength) {
+		internal_log_error(ErrorCode_InvalidGLB, "JSON chunk size overflow (%u > %llu)", jsonLength, (unsigned long long)totalLength - sizeof(header));
+		return 0;
+	}
+
+	outInfo->isGlb = 1;
+	outInfo->jsonSize = jsonLength;
+	outInfo->binSize = totalLength - jsonEnd > GLB_CHUNK_HEADER_SIZE ? totalLength - jsonEnd - GLB_CHUNK_HEADER_SIZE : 0;
+
+	outJson->data = gltfmemory_allocate(&options->allocator, jsonLength, 0);
+	if (!outJson->data) {
+		internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for the JSON chunk");
+		return 0;
+	}
+	outJson->size = jsonLength;
+	outJson->type = StorageType_Heap;
+
+	if (!internal_file_read_range(path, &options->io, sizeof(header), jsonLength, outJson->data)) {
+		internal_log_error(ErrorCode_File, "Failed to read the JSON chunk of file: %s", path);
+		return 0;
 	}
 	return 1;
 }
 
-// returns the size in bytes of a single component based on its data type
-unsigned long long internal_component_size(GLTF_ComponentType componentType) {
-	switch (componentType)
-	{
-	case ComponentType_R8:
-	case ComponentType_R8_UNSIGNED:
-		return 1;
-	case ComponentType_R16:
-	case ComponentType_R16_UNSIGNED:
-		return 2;
-	case ComponentType_R32_UNSIGNED:
-	case ComponentType_R32_FLOAT:
-		return 4;
-	}
-	return 0; // invalid components
+GLTF_ProbeInfo GLTF_Probe(const char* path) {
+	return GLTF_ProbeWithOptions(path, NULL);
 }
 
-/// @brief calculates the total byte size for a gltf attribute by combining component count and component size
-unsigned long long internal_calculate_attribute_size(GLTF_Type type, GLTF_ComponentType componentType) {
-	unsigned long long componentSize = internal_component_size(componentType);
+GLTF_ProbeInfo GLTF_ProbeWithOptions(const char* path, const GLTF_ParseOptions* options) {
+	GLTF_ProbeInfo info = { 0 };
 
-	if (type == Type_Mat2 && componentSize == 1) return 8 * componentSize;
-	else if (type == Type_Mat3 && (componentSize == 1 || componentSize == 2)) return 12 * componentSize;
+	GLTF_ParseOptions defaultOptions = { 0 };
+	if (!options) options = &defaultOptions;
 
-	return componentSize * internal_get_components_number(type);
+	internal_parse_state state;
+	internal_parse_begin(&state, options);
+
+	if (!path || !path[0]) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid GLTF path (NULL or empty)");
+	}
+	else if (internal_options_valid(options)) {
+		GLTF_Storage json = { 0 };
+		s_gState->arena = &info.arena;
+		info.arena = gltfarena_create(&options->allocator);
+
+		if (!info.arena) {
+			internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for the probed data");
+		}
+		else if (internal_probe_file(path, options, &json, &info)) {
+			jsmntok_t* tokens = NULL;
+			unsigned int capacity = 0;
+			const char* data = (const char*)json.data;
+			int tokenCount = internal_json_tokenize(data, info.jsonSize, 0, &tokens, &capacity);
+
+			if (tokenCount > 0) {
+				s_gState->json = data;
+				s_gState->tokens = tokens;
+				s_gState->tokensCount = tokenCount;
+
+				info.valid = internal_probe_jsonroot(data, tokens, 0, &info) >= 0;
+
+				s_gState->json = NULL;
+				s_gState->tokens = NULL;
+				s_gState->tokensCount = 0;
+				internal_tokens_release(tokens, capacity);
+			}
+		}
+
+		internal_storage_release(&json, &options->allocator);
+		s_gState->arena = NULL;
+	}
+
+	internal_parse_end(&state);
+	return info;
 }
 
-/// @brief conrrects the pointer of loaded members of a gltf file
-/// @param data the gltf parsed data
-/// @return 1 on success, 0 otherwise
-static int internal_fix_pointers(GLTF2* data) {
+int GLTF_RequireBufferView(GLTF2* data, GLTF_BufferView* view) {
+	if (!data || !view || !view->buffer) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid buffer view to require");
+		return 0;
+	}
 
-	// meshes pointers
-	for (unsigned long long i = 0; i < data->meshesCount; ++i) {
-		for (unsigned long long j = 0; j < data->meshes[i].primitivesCount; ++j) {
-			PTR_FIX(data->meshes[i].primitives[j].indices, data->accessors, data->accessorsCount);
-			PTR_FIX(data->meshes[i].primitives[j].material, data->materials, data->materialsCount);
+	if (view->data) return 1;
 
-			for (unsigned long long k = 0; k < data->meshes[i].primitives[j].attributesCount; ++k) {
-				PTR_FIX(data->meshes[i].primitives[j].attributes[k].data, data->accessors, data->accessorsCount);
-			}
+	GLTF_Buffer* buffer = view->buffer;
+	if (view->offset > buffer->size || view->size > buffer->size - view->offset) {
+		internal_log_error(ErrorCode_InvalidDocument, "Buffer view is out of it's buffer bounds");
+		return 0;
+	}
 
-			for (unsigned long long k = 0; k < data->meshes[i].primitives[j].targetsCount; ++k) {
-				for (unsigned long long m = 0; m < data->meshes[i].primitives[j].targets[k].attributesCount; ++m) {
-					PTR_FIX_REQUIRED(data->meshes[i].primitives[j].targets[k].attributes[m].data, data->accessors, data->accessorsCount);
-				}
-			}
-		}
+	if (!buffer->data && buffer->URI && strncmp_impl(buffer->URI, "data:", 5) == 0) {
+		if (!internal_decode_buffer_uri(buffer, &data->fileInfo.allocator)) return 0;
 	}
 
-	// accessors
-	for (unsigned long long i = 0; i < data->accessorsCount; ++i) {
-		PTR_FIX(data->accessors[i].bufferView, data->bufferViews, data->bufferViewsCount);
+	if (buffer->data) {
+		view->data = (unsigned char*)buffer->data + view->offset;
+		return 1;
+	}
 
-		if (data->accessors[i].isSparse) {
-			PTR_FIX_REQUIRED(data->accessors[i].sparse.indicesBufferView, data->bufferViews, data->bufferViewsCount);
-			PTR_FIX_REQUIRED(data->accessors[i].sparse.valuesBufferView, data->bufferViews, data->bufferViewsCount);
-		}
+	if (!buffer->path) {
+		internal_log_error(ErrorCode_InvalidArgument, "Buffer view has no data to be loaded, the document must be parsed with BufferMode_Lazy");
+		return 0;
+	}
 
-		if (data->accessors[i].bufferView) {
-			data->accessors[i].stride = data->accessors[i].bufferView->stride;
+	// mapping the whole file is cheap, the system only pages in what is touched, and the next views reuse it
+	if (data->fileInfo.fileMode == FileMode_Map && buffer->storage.type == StorageType_None && internal_file_map(buffer->path, &data->fileInfo.io, 0, &buffer->storage)) {
+		if (buffer->storage.size < buffer->fileOffset || buffer->storage.size - buffer->fileOffset < buffer->size) {
+			internal_log_error(ErrorCode_InvalidDocument, "Buffer file is smaller than its byteLength: %s", buffer->path);
+			internal_storage_release(&buffer->storage, &data->fileInfo.allocator);
+			return 0;
 		}
 
-		if (data->accessors[i].stride == 0) {
-			data->accessors[i].stride = internal_calculate_attribute_size(data->accessors[i].type, data->accessors[i].componentType);
-		}
+		buffer->data = (unsigned char*)buffer->storage.data + buffer->fileOffset;
+		view->data = (unsigned char*)buffer->data + view->offset;
+		return 1;
 	}
 
-	// textures
-	for (unsigned long long i = 0; i < data->texturesCount; ++i) {
-		PTR_FIX(data->textures[i].image, data->images, data->imagesCount);
-		PTR_FIX(data->textures[i].sampler, data->imageSamplers, data->imageSamplersCount);
+	// otherwise only the bytes of this view are read
+	void* bytes = gltfmemory_allocate(&data->fileInfo.allocator, view->size > 0 ? view->size : 1, 0);
+	if (!bytes) {
+		internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for a buffer view");
+		return 0;
 	}
 
-	// images
-	for (unsigned long long i = 0; i < data->imagesCount; ++i) {
-		PTR_FIX(data->images[i].bufferView, data->bufferViews, data->bufferViewsCount);
+	if (!internal_file_read_range(buffer->path, &data->fileInfo.io, buffer->fileOffset + view->offset, view->size, bytes)) {
+		gltfmemory_deallocate(&data->fileInfo.allocator, bytes);
+		internal_log_error(ErrorCode_File, "Failed to read buffer view range [%llu, %llu) of %s", buffer->fileOffset + view->offset, buffer->fileOffset + view->offset + view->size, buffer->path);
+		return 0;
 	}
 
-	// materials
-	for (unsigned long long i = 0; i < data->materialsCount; ++i) {
-		PTR_FIX(data->materials[i].normalTexture.texture, data->textures, data->texturesCount);
-		PTR_FIX(data->materials[i].emissiveTexture.texture, data->textures, data->texturesCount);
-		PTR_FIX(data->materials[i].occlusionTexture.texture, data->textures, data->texturesCount);
+	view->storage.data = bytes;
+	view->storage.size = view->size;
+	view->storage.type = StorageType_Heap;
+	view->data = bytes;
+	return 1;
+}
 
-		PTR_FIX(data->materials[i].PBRmetallicRoughness.baseColorTexture.texture, data->textures, data->texturesCount);
-		PTR_FIX(data->materials[i].PBRmetallicRoughness.metallicRoughnessTexture.texture, data->textures, data->texturesCount);
+int GLTF_RequireAccessor(GLTF2* data, GLTF_Accessor* accessor) {
+	if (!data || !accessor) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid accessor to require");
+		return 0;
 	}
 
-	// buffer views
-	for (unsigned long long i = 0; i < data->bufferViewsCount; ++i) {
-		PTR_FIX_REQUIRED(data->bufferViews[i].buffer, data->buffers, data->buffersCount);
+	// accessors without buffer view are initialized with zeros
+	if (accessor->bufferView && !GLTF_RequireBufferView(data, accessor->bufferView)) return 0;
+
+	if (accessor->isSparse) {
+		if (!GLTF_RequireBufferView(data, accessor->sparse.indicesBufferView)) return 0;
+		if (!GLTF_RequireBufferView(data, accessor->sparse.valuesBufferView)) return 0;
 	}
 
-	// skins
-	for (unsigned long long i = 0; i < data->skinsCount; ++i) {
-		for (unsigned long long j = 0; j < data->skins[i].jointsCount; ++j) {
-			PTR_FIX_REQUIRED(data->skins[i].joints[j], data->nodes, data->nodesCount);
-		}
+	return 1;
+}
 
-		PTR_FIX(data->skins[i].skeleton, data->nodes, data->nodesCount);
-		PTR_FIX(data->skins[i].inverseBindMatrices, data->accessors, data->accessorsCount);
+/// @brief what accessor elements are converted into when they're read
+typedef enum {
+	AccessorOutput_Float,
+	AccessorOutput_U32,
+	AccessorOutput_U16
+} internal_accessor_output;
+
+/// @brief the elements of an accessor to be read
+typedef struct {
+	const unsigned char* data;          // the first element to be read, NULL when the accessor has no buffer view
+	unsigned long long stride;          // how many bytes there are from an element of data to the next one
+	unsigned long long elementSize;     // how many bytes every element has, padding of the matrix columns included
+	unsigned long long count;           // how many elements are read
+	unsigned long long columns;         // how many columns every element is read as, matrices with padded columns are read one column at a time
+	unsigned long long rows;            // how many components every column has
+	unsigned long long columnStride;    // how many bytes there are from a column to the next one
+	const unsigned char* sparseIndices; // the sparse indices to be applied over the elements, NULL when there's none
+	const unsigned char* sparseValues;  // the sparse values, one packed element per index
+} internal_accessor_range;
+
+/// @brief reads a sparse index
+/// @param indices the sparse indices
+/// @param componentType the component type of the indices
+/// @param k which index to read
+/// @return the index value
+static unsigned long long internal_sparse_index(const unsigned char* indices, GLTF_ComponentType componentType, unsigned long long k) {
+	if (componentType == ComponentType_R8_UNSIGNED) return indices[k];
+
+	if (componentType == ComponentType_R16_UNSIGNED) {
+		unsigned short index;
+		memcpy(&index, indices + k * 2, 2);
+		return index;
 	}
 
-	// nodes
-	for (unsigned long long i = 0; i < data->nodesCount; ++i) {
-		for (unsigned long long j = 0; j < data->nodes[i].childrenCount; ++j) {
-			PTR_FIX_REQUIRED(data->nodes[i].children[j], data->nodes, data->nodesCount);
+	unsigned int index;
+	memcpy(&index, indices + k * 4, 4);
+	return index;
+}
 
-			if (data->nodes[i].children[j]->parent) {
-				return -1;
-			}
+/// @brief finds the next run of consecutive sparse indices before end
+/// @param accessor the sparse accessor
+/// @param range the elements being read, with it's sparse indices
+/// @param end the element past the last one being read
+/// @param k the sparse entry to start from, it's index must not be below the first element being read, advanced past the run
+/// @param outIndex the element index the run starts at
+/// @return how many entries the run has, 0 when there's no more
+/// @note the indices must have been checked to be strictly increasing by internal_accessor_sparse_get
+static unsigned long long internal_sparse_next_run(const GLTF_Accessor* accessor, const internal_accessor_range* range, unsigned long long end, unsigned long long* k, unsigned long long* outIndex) {
+	const GLTF_ComponentType type = accessor->sparse.indicesComponentType;
+	const unsigned long long count = accessor->sparse.count;
+	if (*k >= count) return 0;
+
+	const unsigned long long index = internal_sparse_index(range->sparseIndices, type, *k);
+	if (index >= end) return 0;
+
+	unsigned long long run = 1;
+	while (*k + run < count && index + run < end && internal_sparse_index(range->sparseIndices, type, *k + run) == index + run) ++run;
+
+	*outIndex = index;
+	*k += run;
+	return run;
+}
 
-			data->nodes[i].children[j]->parent = &data->nodes[i];
-		}
+/// @brief finds the first sparse entry whose index is not below first, the indices being increasing
+/// @param accessor the sparse accessor
+/// @param range the elements being read, with it's sparse indices
+/// @param first the first element being read
+/// @return the sparse entry
+static unsigned long long internal_sparse_lower_bound(const GLTF_Accessor* accessor, const internal_accessor_range* range, unsigned long long first) {
+	unsigned long long low = 0;
+	unsigned long long high = accessor->sparse.count;
+	while (low < high) {
+		const unsigned long long middle = low + (high - low) / 2;
+		if (internal_sparse_index(range->sparseIndices, accessor->sparse.indicesComponentType, middle) < first) low = middle + 1;
+		else high = middle;
+	}
+	return low;
+}
 
-		PTR_FIX(data->nodes[i].mesh, data->meshes, data->meshesCount);
-		PTR_FIX(data->nodes[i].skin, data->skins, data->skinsCount);
-		PTR_FIX(data->nodes[i].camera, data->cameras, data->camerasCount);
+/// @brief checks that the sparse indices and values of an accessor can be read
+/// @param accessor the sparse accessor
+/// @param elementSize how many bytes every element has
+/// @param outRange receives the sparse indices and values
+/// @return 1 on success, 0 on failure
+static int internal_accessor_sparse_get(const GLTF_Accessor* accessor, unsigned long long elementSize, internal_accessor_range* outRange) {
+	const GLTF_SparseAccessor* sparse = &accessor->sparse;
+	const GLTF_ComponentType indexType = sparse->indicesComponentType;
+	if (indexType != ComponentType_R8_UNSIGNED && indexType != ComponentType_R16_UNSIGNED && indexType != ComponentType_R32_UNSIGNED) {
+		internal_log_error(ErrorCode_InvalidDocument, "Invalid sparse indices component type %d", (int)indexType);
+		return 0;
 	}
 
-	// scenes
-	for (unsigned long long i = 0; i < data->scenesCount; ++i) {
-		for (unsigned long long j = 0; j < data->scenes[i].nodesCount; ++j) {
-			PTR_FIX_REQUIRED(data->scenes[i].nodes[j], data->nodes, data->nodesCount);
+	const GLTF_BufferView* indices = sparse->indicesBufferView;
+	const GLTF_BufferView* values = sparse->valuesBufferView;
+	if (!indices || !values || !indices->data || !values->data) {
+		internal_log_error(ErrorCode_InvalidArgument, "Sparse accessor data is not loaded, it must be required with GLTF_RequireAccessor");
+		return 0;
+	}
 
-			if (data->scenes[i].nodes[j]->parent) {
-				return -1;
-			}
-		}
+	const unsigned long long indexSize = internal_component_size(indexType);
+	if (sparse->count > accessor->count
+		|| sparse->indicesByteOffset > indices->size || sparse->count > (indices->size - sparse->indicesByteOffset) / indexSize
+		|| sparse->valueByteOffset > values->size || sparse->count > (values->size - sparse->valueByteOffset) / elementSize) {
+		internal_log_error(ErrorCode_InvalidDocument, "Sparse accessor entries are out of their buffer views bounds");
+		return 0;
 	}
-	PTR_FIX(data->scene, data->scenes, data->scenesCount);
 
-	// animations
-	for (unsigned long long i = 0; i < data->animationsCount; ++i) {
-		for (unsigned long long j = 0; j < data->animations[i].samplersCount; ++j) {
-			PTR_FIX_REQUIRED(data->animations[i].samplers[j].input, data->accessors, data->accessorsCount);
-			PTR_FIX_REQUIRED(data->animations[i].samplers[j].output, data->accessors, data->accessorsCount);
-		}
+	outRange->sparseIndices = (const unsigned char*)indices->data + sparse->indicesByteOffset;
+	outRange->sparseValues = (const unsigned char*)values->data + sparse->valueByteOffset;
 
-		for (unsigned long long j = 0; j < data->animations[i].channelsCount; ++j) {
-			PTR_FIX_REQUIRED(data->animations[i].channels[j].sampler, data->animations[i].samplers, data->animations[i].samplersCount);
-			PTR_FIX(data->animations[i].channels[j].targetNode, data->nodes, data->nodesCount);
+	// the runs and the binary search over the indices rely on them being strictly increasing, which also keeps them in bounds once the last one is
+	for (unsigned long long k = 1; k < sparse->count; ++k) {
+		if (internal_sparse_index(outRange->sparseIndices, indexType, k) <= internal_sparse_index(outRange->sparseIndices, indexType, k - 1)) {
+			internal_log_error(ErrorCode_InvalidDocument, "Sparse accessor indices are not strictly increasing (entry %llu)", k);
+			return 0;
 		}
 	}
 
+	if (sparse->count > 0 && internal_sparse_index(outRange->sparseIndices, indexType, sparse->count - 1) >= accessor->count) {
+		internal_log_error(ErrorCode_InvalidDocument, "Sparse accessor index is out of the accessor bounds");
+		return 0;
+	}
 	return 1;
 }
 
-/// @brief begins the parsing of the GLFW
-static int internal_parse_json(const char* data, unsigned long long size, GLTF2* outData) {
-	jsmn_parser parser = { 0, 0, 0 };
+/// @brief checks that the elements of an accessor can be read and finds where they are
+/// @param accessor the accessor
+/// @param first the first element to be read
+/// @param count how many elements to be read, clamped to the end of the accessor
+/// @param outRange the elements to be read
+/// @return 1 on success, 0 on failure
+static int internal_accessor_range_get(const GLTF_Accessor* accessor, unsigned long long first, unsigned long long count, internal_accessor_range* outRange) {
+	const unsigned long long componentSize = internal_component_size(accessor->componentType);
+	if (componentSize == 0) {
+		internal_log_error(ErrorCode_InvalidDocument, "Invalid accessor component type %d", (int)accessor->componentType);
+		return 0;
+	}
 
-	// get json token count
-	if (outData->fileInfo.jsonTkCount == 0) {
-		int tkCount = jsmn_parse(&parser, data, size, NULL, 0);
-		if (tkCount <= 0) return -1;
-		outData->fileInfo.jsonTkCount = tkCount;
+	if (first > accessor->count) {
+		internal_log_error(ErrorCode_InvalidArgument, "Accessor read starts past it's end (%llu > %llu)", first, accessor->count);
+		return 0;
 	}
 
-	// allocate memory for the parsing
-	jsmntok_t* tokens = (jsmntok_t*)gltfmemory_allocate(sizeof(jsmntok_t) * (outData->fileInfo.jsonTkCount + 1), 0);
-	if (!tokens) return -1;
+	memset(outRange, 0, sizeof(internal_accessor_range));
+	outRange->elementSize = internal_calculate_attribute_size(accessor->type, accessor->componentType);
+	outRange->stride = accessor->stride;
+	outRange->count = count < accessor->count - first ? count : accessor->count - first;
+	outRange->columns = 1;
+	outRange->rows = internal_get_components_number(accessor->type);
+
+	// the columns of matrices with 1 or 2 bytes components are aligned to 4 bytes
+	if ((accessor->type == Type_Mat2 && componentSize == 1) || (accessor->type == Type_Mat3 && componentSize <= 2)) {
+		outRange->columns = accessor->type == Type_Mat2 ? 2 : 3;
+		outRange->rows = outRange->columns;
+		outRange->columnStride = (outRange->rows * componentSize + 3) & ~3ull;
+	}
 
-	// parse
-	jsmn_init(&parser);
-	int tokenCount = jsmn_parse(&parser, data, size, tokens, outData->fileInfo.jsonTkCount);
-	if (tokenCount <= 0) {
-		gltfmemory_deallocate(tokens);
-		return -1;
+	if (outRange->count == 0) return 1;
+
+	// resolved sparse accessors are read as packed elements, with nothing left to apply
+	if (accessor->isSparse && accessor->sparse.resolved) {
+		outRange->data = (const unsigned char*)accessor->sparse.resolved + first * outRange->elementSize;
+		outRange->stride = outRange->elementSize;
+		return 1;
 	}
 
-	// this makes sure that we always have an UNDEFINED token at the end of the stream, for invalid JSON inputs this makes sure we don't perform out of bound reads of token data
-	tokens[tokenCount].type = JSMN_UNDEFINED;
+	if (accessor->isSparse && !internal_accessor_sparse_get(accessor, outRange->elementSize, outRange)) return 0;
 
-	// begins the parsing at the root-level
-	int i = internal_parse_jsonroot(data, tokens, 0, outData);
-	gltfmemory_deallocate(tokens);
+	// the elements of an accessor without buffer view are zeros
+	const GLTF_BufferView* view = accessor->bufferView;
+	if (!view) return 1;
 
-	if (i < 0) {
-		GLTF_Free(outData);
-		return -1;
+	if (!view->data) {
+		internal_log_error(ErrorCode_InvalidArgument, "Accessor data is not loaded, it must be required with GLTF_RequireAccessor");
+		return 0;
 	}
 
-	if (internal_fix_pointers(outData) < 0) {
-		GLTF_Free(outData);
-		return -1;
+	const unsigned long long elementSize = outRange->elementSize;
+	const unsigned long long last = first + outRange->count - 1;
+	if (accessor->offset > view->size || view->size - accessor->offset < elementSize || last > (view->size - accessor->offset - elementSize) / accessor->stride) {
+		internal_log_error(ErrorCode_InvalidDocument, "Accessor elements are out of it's buffer view bounds");
+		return 0;
 	}
 
-	outData->fileInfo.json = data;
-	outData->fileInfo.jsonSize = size;
-
+	outRange->data = (const unsigned char*)view->data + accessor->offset + first * accessor->stride;
 	return 1;
 }
 
-GLTF2 GLTF_ParseFromFile(const char* path) {
-	s_gErrors[0] = '\0';
-	GLTF2 parsedData = { 0 };
-
-	if (!path || !path[0]) {
-		internal_log_error("Invalid GLTF path (NULL or empty)");
-		return parsedData;
-	}
-
-	parsedData.fileInfo.path = path;
-
-	// read file
-	void* data = NULL;
-	unsigned long long size = 0;
-	if (!platform_fileread(path, &size, &data)) {
-		internal_log_error("Failed to read file: %s", path);
-		return parsedData;
+/// @brief converts the elements of a column, or of whole elements when they have a single column
+/// @param output what the elements are converted into
+/// @param accessor the accessor the elements belong to
+/// @param src the first component to be converted
+/// @param srcStride how many bytes there are from an element of src to the next one
+/// @param rows how many components are converted per element
+/// @param count how many elements are converted
+/// @param dst where the first component is written into
+/// @param dstStride how many bytes there are from an element of dst to the next one
+static void internal_accessor_convert(internal_accessor_output output, const GLTF_Accessor* accessor, const unsigned char* src, unsigned long long srcStride, unsigned long long rows, unsigned long long count, unsigned char* dst, unsigned long long dstStride) {
+	switch (output) {
+	case AccessorOutput_Float: accessor_convert_float(src, srcStride, accessor->componentType, accessor->normalized, rows, count, (float*)dst, dstStride); break;
+	case AccessorOutput_U32: accessor_convert_u32(src, srcStride, accessor->componentType, rows, count, (unsigned int*)dst, dstStride); break;
+	case AccessorOutput_U16: accessor_convert_u16(src, srcStride, accessor->componentType, rows, count, (unsigned short*)dst, dstStride); break;
 	}
+}
 
-	// validate minimum file size
-	if (size < 4) {
-		internal_log_error("File too small to be valid GLTF/GLB");
-		gltfmemory_deallocate(data);
-		return parsedData;
+/// @brief reads accessor elements, sparse values included
+/// @param accessor the accessor
+/// @param first the first element to be read
+/// @param count how many elements to be read
+/// @param out where the elements are written into
+/// @param outStride how many bytes there are from an element of out to the next one, 0 means packed elements
+/// @param output what the elements are converted into
+/// @param outComponentSize the size of an output component
+/// @return how many elements were read, 0 on failure
+static unsigned long long internal_accessor_read(const GLTF_Accessor* accessor, unsigned long long first, unsigned long long count, void* out, unsigned long long outStride, internal_accessor_output output, unsigned long long outComponentSize) {
+	if (!accessor || !out) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid accessor to read");
+		return 0;
 	}
 
-	const unsigned char* ptr = (const unsigned char*)data;
-	int isGlb = strncmp_impl((const char*)ptr, "glTF", 4) == 0 ? 1 : 0;
-
-	if (isGlb) {
-		parsedData.fileInfo.type = 0; // GLB
+	internal_accessor_range range;
+	if (!internal_accessor_range_get(accessor, first, count, &range)) return 0;
 
-		// validate GLB header
-		if (size < GLB_HEADER_SIZE) {
-			internal_log_error("GLB file too small (header incomplete)");
-			gltfmemory_deallocate(data);
-			return parsedData;
-		}
+	const unsigned long long columnSize = range.rows * outComponentSize;
+	const unsigned long long elementSize = range.columns * columnSize;
+	if (outStride == 0) outStride = elementSize;
 
-		// check version
-		unsigned int version;
-		memcpy(&version, ptr + 4, 4);
-		if (version != 2) {
-			internal_log_error("Unsupported GLB version: %u (expected 2)", version);
-			gltfmemory_deallocate(data);
-			return parsedData;
-		}
+	unsigned char* o = (unsigned char*)out;
+	for (unsigned long long i = 0; i < range.count && !range.data; ++i) {
+		memset(o + i * outStride, 0, elementSize);
+	}
 
-		// verify total length
-		unsigned int totalLength;
-		memcpy(&totalLength, ptr + 8, 4);
-		if (totalLength != size) {
-			internal_log_error("GLB size mismatch (header: %u, actual: %llu)", totalLength, size);
-			gltfmemory_deallocate(data);
-			return parsedData;
-		}
+	for (unsigned long long c = 0; c < range.columns && range.data; ++c) {
+		internal_accessor_convert(output, accessor, range.data + c * range.columnStride, range.stride, range.rows, range.count, o + c * columnSize, outStride);
+	}
 
-		// Process chunks
-		unsigned int offset = GLB_HEADER_SIZE;
+	if (!range.sparseIndices) return range.count;
 
-		// JSON chunk (required)
-		if (offset + GLB_CHUNK_HEADER_SIZE > size) {
-			internal_log_error("Invalid GLB chunk header (out of bounds)");
-			gltfmemory_deallocate(data);
-			return parsedData;
+	// every run of consecutive sparse indices is converted at once over the base elements
+	unsigned long long k = internal_sparse_lower_bound(accessor, &range, first);
+	unsigned long long index = 0;
+	unsigned long long run;
+	while ((run = internal_sparse_next_run(accessor, &range, first + range.count, &k, &index)) > 0) {
+		const unsigned char* values = range.sparseValues + (k - run) * range.elementSize;
+		for (unsigned long long c = 0; c < range.columns; ++c) {
+			internal_accessor_convert(output, accessor, values + c * range.columnStride, range.elementSize, range.rows, run, o + (index - first) * outStride + c * columnSize, outStride);
 		}
+	}
+	return range.count;
+}
 
-		unsigned int jsonLength;
-		memcpy(&jsonLength, ptr + offset, 4);
-		offset += 4;
+unsigned long long GLTF_AccessorReadFloat(const GLTF_Accessor* accessor, unsigned long long first, unsigned long long count, float* out, unsigned long long outStride) {
+	return internal_accessor_read(accessor, first, count, out, outStride, AccessorOutput_Float, sizeof(float));
+}
 
-		unsigned int jsonType;
-		memcpy(&jsonType, ptr + offset, 4);
-		offset += 4;
+unsigned long long GLTF_AccessorReadU32(const GLTF_Accessor* accessor, unsigned long long first, unsigned long long count, unsigned int* out, unsigned long long outStride) {
+	return internal_accessor_read(accessor, first, count, out, outStride, AccessorOutput_U32, sizeof(unsigned int));
+}
 
-		if (jsonType != JSON_CHUNK_TYPE) {
-			internal_log_error("Missing JSON chunk (found type: 0x%X)", jsonType);
-			gltfmemory_deallocate(data);
-			return parsedData;
-		}
+unsigned long long GLTF_AccessorReadU16(const GLTF_Accessor* accessor, unsigned long long first, unsigned long long count, unsigned short* out, unsigned long long outStride) {
+	return internal_accessor_read(accessor, first, count, out, outStride, AccessorOutput_U16, sizeof(unsigned short));
+}
 
-		if (offset + jsonLength > size) {
-			internal_log_error("JSON chunk size overflow (%u > %llu)", jsonLength, size - offset);
-			gltfmemory_deallocate(data);
-			return parsedData;
-		}
+unsigned long long GLTF_AccessorMaterialize(const GLTF_Accessor* accessor, void* out, unsigned long long outSize) {
+	if (!accessor) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid accessor to materialize");
+		return 0;
+	}
 
-		// parse JSON
-		int parseResult = internal_parse_json((const char*)ptr + offset, jsonLength, &parsedData);
-		if (parseResult < 0) {
-			internal_log_error("JSON parsing failed with error: %d", parseResult);
-			gltfmemory_deallocate(data);
-			GLTF_Free(&parsedData); // Clean up any partial parsing
-			memset(&parsedData, 0, sizeof(parsedData)); // Ensure we return clean state
-			return parsedData;
-		}
-		offset += jsonLength;
-
-		// BIN chunk (optional)
-		if (offset < size) {
-			if (offset + GLB_CHUNK_HEADER_SIZE > size) {
-				internal_log_error("Invalid BIN chunk header (out of bounds)");
-				gltfmemory_deallocate(data);
-				GLTF_Free(&parsedData);
-				return parsedData;
-			}
+	const unsigned long long elementSize = internal_calculate_attribute_size(accessor->type, accessor->componentType);
+	if (elementSize == 0 || accessor->count > ~0ull / elementSize) {
+		internal_log_error(ErrorCode_InvalidDocument, "Invalid accessor component type %d", (int)accessor->componentType);
+		return 0;
+	}
 
-			unsigned int binLength;
-			memcpy(&binLength, ptr + offset, 4);
-			offset += 4;
+	const unsigned long long size = accessor->count * elementSize;
+	if (!out) return size;
 
-			unsigned int binType;
-			memcpy(&binType, ptr + offset, 4);
-			offset += 4;
+	if (outSize < size) {
+		internal_log_error(ErrorCode_InvalidArgument, "Accessor materialization needs %llu bytes, only %llu were given", size, outSize);
+		return 0;
+	}
 
-			if (binType == BIN_CHUNK_TYPE) {
-				if (offset + binLength > size) {
-					internal_log_error("BIN chunk size overflow (%u > %llu)", binLength, size - offset);
-					gltfmemory_deallocate(data);
-					GLTF_Free(&parsedData);
-					return parsedData;
-				}
+	internal_accessor_range range;
+	if (!internal_accessor_range_get(accessor, 0, accessor->count, &range)) return 0;
 
-				parsedData.fileInfo.bin = gltfmemory_allocate(binLength, 0);
-				if (!parsedData.fileInfo.bin) {
-					internal_log_error("Failed to allocate memory for BIN chunk");
-					gltfmemory_deallocate(data);
-					GLTF_Free(&parsedData);
-					return parsedData;
-				}
-				memcpy(parsedData.fileInfo.bin, ptr + offset, binLength);
-				parsedData.fileInfo.binSize = binLength;
-			}
+	// the base elements are copied as they are, packed
+	unsigned char* o = (unsigned char*)out;
+	if (!range.data) memset(o, 0, size);
+	else if (range.stride == elementSize) memcpy(o, range.data, size);
+	else {
+		for (unsigned long long i = 0; i < range.count; ++i) {
+			memcpy(o + i * elementSize, range.data + i * range.stride, elementSize);
 		}
 	}
-	else {
-		// regular GLTF (JSON)
-		parsedData.fileInfo.type = 1;
 
-		int parseResult = internal_parse_json((const char*)data, size, &parsedData);
-		if (parseResult < 0) {
-			internal_log_error("GLTF JSON parsing failed with error: %d", parseResult);
-			gltfmemory_deallocate(data);
-			GLTF_Free(&parsedData);
-			memset(&parsedData, 0, sizeof(parsedData));
-			return parsedData;
-		}
+	if (!range.sparseIndices) return size;
+
+	// then the sparse values are scattered over them, a run of consecutive indices at a time
+	unsigned long long k = 0;
+	unsigned long long index = 0;
+	unsigned long long run;
+	while ((run = internal_sparse_next_run(accessor, &range, accessor->count, &k, &index)) > 0) {
+		memcpy(o + index * elementSize, range.sparseValues + (k - run) * elementSize, run * elementSize);
 	}
-	
-	gltfmemory_deallocate(data);
-	return parsedData;
+	return size;
 }
 
-void GLTF_Free(GLTF2* data) {
+int GLTF_AccessorResolveSparse(GLTF2* data, GLTF_Accessor* accessor) {
+	if (!data || !accessor) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid accessor to resolve");
+		return 0;
+	}
 
-	if (!data) return;
+	if (!accessor->isSparse || accessor->sparse.resolved) return 1;
 
-	// asset
-	gltfmemory_deallocate(data->asset.copyright);
-	gltfmemory_deallocate(data->asset.generator);
-	gltfmemory_deallocate(data->asset.version);
-	gltfmemory_deallocate(data->asset.minVersion);
-	gltfmemory_deallocate(data->asset.extras);
-	for (unsigned long long i = 0; i < data->asset.extensionsCount; i++) {
-		gltfmemory_deallocate(data->asset.extensions[i].name);
-		gltfmemory_deallocate(data->asset.extensions[i].data);
-	}
+	const unsigned long long size = GLTF_AccessorMaterialize(accessor, NULL, 0);
+	if (size == 0) return accessor->count == 0;
 
-	// accessors
-	for (unsigned long long i = 0; i < data->accessorsCount; i++){
-		gltfmemory_deallocate(data->accessors[i].name);
-		gltfmemory_deallocate(&data->accessors[i].extras);
-		for (unsigned long long j = 0; j < data->accessors[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->accessors[i].extensions[j].name);
-			gltfmemory_deallocate(data->accessors[i].extensions[j].data);
-		}
+	void* elements = gltfmemory_allocate(&data->fileInfo.allocator, size, 0);
+	if (!elements) {
+		internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for a sparse accessor");
+		return 0;
 	}
-	gltfmemory_deallocate(data->accessors);
 
-	// buffer views
-	for (unsigned long long i = 0; i < data->bufferViewsCount; i++){
-		gltfmemory_deallocate(data->bufferViews[i].name);
-		gltfmemory_deallocate(data->bufferViews[i].data);
-		gltfmemory_deallocate(&data->bufferViews[i].extras);
-		for (unsigned long long j = 0; j < data->bufferViews[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->bufferViews[i].extensions[j].name);
-			gltfmemory_deallocate(data->bufferViews[i].extensions[j].data);
-		}
+	if (!GLTF_AccessorMaterialize(accessor, elements, size)) {
+		gltfmemory_deallocate(&data->fileInfo.allocator, elements);
+		return 0;
 	}
-	gltfmemory_deallocate(data->bufferViews);
 
-	// buffers
-	for (unsigned long long i = 0; i < data->buffersCount; i++) {
-		gltfmemory_deallocate(data->buffers[i].name);
-		gltfmemory_deallocate(data->buffers[i].URI);
-		gltfmemory_deallocate(&data->buffers[i].extras);
-		for (unsigned long long j = 0; j < data->buffers[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->buffers[i].extensions[j].name);
-			gltfmemory_deallocate(data->buffers[i].extensions[j].data);
-		}
-	}
-	gltfmemory_deallocate(data->buffers);
-
-	// meshes
-	for (unsigned long long i = 0; i < data->meshesCount; i++) {
-		gltfmemory_deallocate(data->meshes[i].name);
-		// primitives
-		for (unsigned long long j = 0; j < data->meshes[i].primitivesCount; j++) {
-			// attributes
-			for (unsigned long long k = 0; k < data->meshes[i].primitives[j].attributesCount; k++){
-				gltfmemory_deallocate(data->meshes[i].primitives[j].attributes[k].name);
-			}
-			gltfmemory_deallocate(data->meshes[i].primitives[j].attributes);
-			// targets
-			for (unsigned long long k = 0; k < data->meshes[i].primitives[j].targetsCount; k++) {
-				for (unsigned long long m = 0; m < data->meshes[i].primitives[j].targets[k].attributesCount; ++m) {
-					gltfmemory_deallocate(data->meshes[i].primitives[j].targets[k].attributes[m].name);
-				}
-				gltfmemory_deallocate(data->meshes[i].primitives[j].targets[k].attributes);
-			}
-			gltfmemory_deallocate(data->meshes[i].primitives[j].targets);
-			// extras and extensions
-			gltfmemory_deallocate(data->meshes[i].primitives[j].extras);
-			for (unsigned long long k = 0; k < data->meshes[i].primitives[j].extensionsCount; k++) {
-				gltfmemory_deallocate(data->meshes[i].primitives[j].extensions[k].name);
-				gltfmemory_deallocate(data->meshes[i].primitives[j].extensions[k].data);
-			}
-		}
-		gltfmemory_deallocate(data->meshes[i].primitives);
-		gltfmemory_deallocate(data->meshes[i].weights);
-		// target names
-		for (unsigned long long j = 0; j < data->meshes[i].targetNamesCount; j++) {
-			gltfmemory_deallocate(data->meshes[i].targetNames[j]);
-		}
-		// extras and extensions
-		gltfmemory_deallocate(data->meshes[i].extras);
-		for (unsigned long long k = 0; k < data->meshes[i].extensionsCount; k++) {
-			gltfmemory_deallocate(data->meshes[i].extensions[k].name);
-			gltfmemory_deallocate(data->meshes[i].extensions[k].data);
-		}
-		gltfmemory_deallocate(data->meshes[i].targetNames);
-	}
-	gltfmemory_deallocate(data->meshes);
+	accessor->sparse.storage.data = elements;
+	accessor->sparse.storage.size = size;
+	accessor->sparse.storage.type = StorageType_Heap;
+	accessor->sparse.resolved = elements;
+	return 1;
+}
 
-	// materials
-	for (unsigned long long i = 0; i < data->materialsCount; i++) {
-		gltfmemory_deallocate(data->materials[i].name);
-		gltfmemory_deallocate(data->materials[i].extras);
-		for (unsigned long long j = 0; j < data->materials[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->materials[i].extensions[j].name);
-			gltfmemory_deallocate(data->materials[i].extensions[j].data);
-		}
+unsigned long long GLTF_AccessorReadIndices(const GLTF_Accessor* accessor, GLTF_IndexFormat format, int rebase, void* out, unsigned long long outSize, GLTF_IndexInfo* outInfo) {
+	if (!accessor) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid accessor to read indices from");
+		return 0;
 	}
-	gltfmemory_deallocate(data->materials);
 
-	// images
-	for (unsigned long long i = 0; i < data->imagesCount; i++) {
-		gltfmemory_deallocate(data->images[i].name);
-		gltfmemory_deallocate(data->images[i].URI);
-		gltfmemory_deallocate(data->images[i].mime_type);
-		gltfmemory_deallocate(data->images[i].extras);
-		for (unsigned long long j = 0; j < data->images[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->images[i].extensions[j].name);
-			gltfmemory_deallocate(data->images[i].extensions[j].data);
-		}
+	const GLTF_ComponentType componentType = accessor->componentType;
+	if (accessor->type != Type_Scalar || (componentType != ComponentType_R8_UNSIGNED && componentType != ComponentType_R16_UNSIGNED && componentType != ComponentType_R32_UNSIGNED)) {
+		internal_log_error(ErrorCode_InvalidDocument, "Indices accessor must be a scalar of unsigned integers");
+		return 0;
 	}
-	gltfmemory_deallocate(data->images);
 
-	// textures
-	for (unsigned long long i = 0; i < data->texturesCount; i++){
-		gltfmemory_deallocate(data->textures[i].name);
-		gltfmemory_deallocate(data->textures[i].extras);
-		for (unsigned long long j = 0; j < data->textures[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->textures[i].extensions[j].name);
-			gltfmemory_deallocate(data->textures[i].extensions[j].data);
-		}
+	// accessors have at least one element, which keeps 0 for failures only
+	if (accessor->count == 0) {
+		internal_log_error(ErrorCode_InvalidDocument, "Indices accessor has no index");
+		return 0;
 	}
-	gltfmemory_deallocate(data->textures);
 
-	// image samplers
-	for (unsigned long long i = 0; i < data->imageSamplersCount; i++) {
-		gltfmemory_deallocate(data->imageSamplers[i].name);
-		gltfmemory_deallocate(data->imageSamplers[i].extras);
-		for (unsigned long long j = 0; j < data->imageSamplers[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->imageSamplers[i].extensions[j].name);
-			gltfmemory_deallocate(data->imageSamplers[i].extensions[j].data);
-		}
-	}
-	gltfmemory_deallocate(data->imageSamplers);
+	internal_accessor_range range;
+	if (!internal_accessor_range_get(accessor, 0, accessor->count, &range)) return 0;
 
-	// skins
-	for (unsigned long long i = 0; i < data->skinsCount; i++) {
-		gltfmemory_deallocate(data->skins[i].name);
-		gltfmemory_deallocate(data->skins[i].joints);
-		gltfmemory_deallocate(data->skins[i].extras);
-		for (unsigned long long j = 0; j < data->skins[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->skins[i].extensions[j].name);
-			gltfmemory_deallocate(data->skins[i].extensions[j].data);
+	// packed indices are scanned straight from the buffer view, anything else is read a chunk at a time
+	unsigned int min = ~0u;
+	unsigned int max = 0;
+	unsigned int chunk[1024];
+	if (range.data && !range.sparseIndices && range.stride == range.elementSize) accessor_index_range(range.data, componentType, range.count, &min, &max);
+	else {
+		for (unsigned long long first = 0; first < range.count; first += 1024) {
+			const unsigned long long expected = range.count - first < 1024 ? range.count - first : 1024;
+			const unsigned long long read = internal_accessor_read(accessor, first, expected, chunk, 0, AccessorOutput_U32, sizeof(unsigned int));
+			if (read != expected) return 0;
+
+			unsigned int low = min, high = max;
+			accessor_index_range(chunk, ComponentType_R32_UNSIGNED, read, &low, &high);
+			if (low < min) min = low;
+			if (high > max) max = high;
 		}
 	}
-	gltfmemory_deallocate(data->skins);
 
-	// cameras
-	for (unsigned long long i = 0; i < data->camerasCount; i++) {
-		gltfmemory_deallocate(data->cameras[i].name);
-		if (data->cameras[i].type == CameraType_Perspective) {
-			gltfmemory_deallocate(&data->cameras[i].data.perspective.extras);
-		}
-		else if (data->cameras[i].type == CameraType_Orthographic) {
-			gltfmemory_deallocate(&data->cameras[i].data.orthographic.extras);
-		}
+	const unsigned int base = rebase ? min : 0;
+	const int wide = format == IndexFormat_U32 || (format == IndexFormat_Auto && max - base >= 65535);
+	if (format == IndexFormat_U16 && max - base > 65535) {
+		internal_log_error(ErrorCode_InvalidArgument, "Indices up to %u don't fit in 16 bits", max - base);
+		return 0;
+	}
 
-		gltfmemory_deallocate(data->cameras[i].extras);
-		for (unsigned long long j = 0; j < data->cameras[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->cameras[i].extensions[j].name);
-			gltfmemory_deallocate(data->cameras[i].extensions[j].data);
-		}
+	const unsigned long long size = range.count * (wide ? sizeof(unsigned int) : sizeof(unsigned short));
+	if (outInfo) {
+		outInfo->componentType = wide ? ComponentType_R32_UNSIGNED : ComponentType_R16_UNSIGNED;
+		outInfo->count = range.count;
+		outInfo->min = min;
+		outInfo->max = max;
+		outInfo->base = base;
 	}
-	gltfmemory_deallocate(data->cameras);
+	if (!out) return size;
 
-	// nodes
-	for (unsigned long long i = 0; i < data->nodesCount; i++) {
-		gltfmemory_deallocate(data->nodes[i].name);
-		gltfmemory_deallocate(data->nodes[i].children);
-		gltfmemory_deallocate(data->nodes[i].weights);
+	if (outSize < size) {
+		internal_log_error(ErrorCode_InvalidArgument, "Indices need %llu bytes, only %llu were given", size, outSize);
+		return 0;
+	}
 
-		gltfmemory_deallocate(data->nodes[i].extras);
-		for (unsigned long long j = 0; j < data->nodes[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->nodes[i].extensions[j].name);
-			gltfmemory_deallocate(data->nodes[i].extensions[j].data);
-		}
+	if (wide) {
+		if (internal_accessor_read(accessor, 0, range.count, out, 0, AccessorOutput_U32, sizeof(unsigned int)) != range.count) return 0;
+		accessor_index_rebase(out, ComponentType_R32_UNSIGNED, range.count, base);
+		return size;
 	}
-	gltfmemory_deallocate(data->nodes);
 
-	// scenes
-	for (unsigned long long i = 0; i < data->scenesCount; i++) {
-		gltfmemory_deallocate(data->scenes[i].name);
-		gltfmemory_deallocate(data->scenes[i].nodes);
+	// indices above 16 bits are only rebased into it's range, which must be done before narrowing them
+	if (max > 65535) {
+		unsigned short* o = (unsigned short*)out;
+		for (unsigned long long first = 0; first < range.count; first += 1024) {
+			const unsigned long long expected = range.count - first < 1024 ? range.count - first : 1024;
+			const unsigned long long read = internal_accessor_read(accessor, first, expected, chunk, 0, AccessorOutput_U32, sizeof(unsigned int));
+			if (read != expected) return 0;
 
-		gltfmemory_deallocate(data->scenes[i].extras);
-		for (unsigned long long j = 0; j < data->scenes[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->scenes[i].extensions[j].name);
-			gltfmemory_deallocate(data->scenes[i].extensions[j].data);
+			accessor_index_rebase(chunk, ComponentType_R32_UNSIGNED, read, base);
+			accessor_convert_u16(chunk, sizeof(unsigned int), ComponentType_R32_UNSIGNED, 1, read, o + first, sizeof(unsigned short));
 		}
+		return size;
 	}
-	gltfmemory_deallocate(data->scenes);
 
-	// animations
-	for (unsigned long long i = 0; i < data->animationsCount; i++) {
-		gltfmemory_deallocate(data->animations[i].name);
-
-		for (unsigned long long j = 0; j < data->animations[i].samplersCount; j++) {
-			gltfmemory_deallocate(data->animations[i].samplers[j].extras);
-			for (unsigned long long k = 0; k < data->animations[i].samplers[j].extensionsCount; k++) {
-				gltfmemory_deallocate(data->animations[i].samplers[j].extensions[k].name);
-				gltfmemory_deallocate(data->animations[i].samplers[j].extensions[k].data);
-			}
-		}
-		gltfmemory_deallocate(data->animations[i].samplers);
+	if (internal_accessor_read(accessor, 0, range.count, out, 0, AccessorOutput_U16, sizeof(unsigned short)) != range.count) return 0;
+	accessor_index_rebase(out, ComponentType_R16_UNSIGNED, range.count, base);
+	return size;
+}
 
-		for (unsigned long long j = 0; j < data->animations[i].channelsCount; j++) {
-			for (unsigned long long j = 0; j < data->animations[i].channelsCount; j++) {
-				gltfmemory_deallocate(data->animations[i].channels[j].extras);
-				for (unsigned long long k = 0; k < data->animations[i].channels[j].extensionsCount; j++) {
-					gltfmemory_deallocate(data->animations[i].channels[j].extensions[k].name);
-					gltfmemory_deallocate(data->animations[i].channels[j].extensions[k].data);
-				}
-			}
-		}
-		gltfmemory_deallocate(data->animations[i].channels);
+void GLTF_Free(GLTF2* data) {
+	if (!data) return;
 
-		gltfmemory_deallocate(data->animations[i].extras);
-		for (unsigned long long j = 0; j < data->animations[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->animations[i].extensions[j].name);
-			gltfmemory_deallocate(data->animations[i].extensions[j].data);
-		}
+	// the data that is loaded, mapped or decoded has it's own storage
+	for (unsigned long long i = 0; i < data->bufferViewsCount; i++) {
+		internal_storage_release(&data->bufferViews[i].storage, &data->fileInfo.allocator);
 	}
-	gltfmemory_deallocate(data->animations);
 
-	// extensions
-	gltfmemory_deallocate(data->extras);
-	for (unsigned long long i = 0; i < data->extensionsCount; i++) {
-		gltfmemory_deallocate(data->extensions[i].name);
-		gltfmemory_deallocate(data->extensions[i].data);
+	for (unsigned long long i = 0; i < data->buffersCount; i++) {
+		internal_storage_release(&data->buffers[i].storage, &data->fileInfo.allocator);
 	}
 
-	for (unsigned long long i = 0; i < data->extensionsUsedCount; i++){
-		gltfmemory_deallocate(data->extensionsUsed[i]);
+	for (unsigned long long i = 0; i < data->imagesCount; i++) {
+		internal_storage_release(&data->images[i].storage, &data->fileInfo.allocator);
 	}
-	gltfmemory_deallocate(data->extensionsUsed);
 
-	for (unsigned long long i = 0; i < data->extensionsRequiredCount; i++) {
-		gltfmemory_deallocate(data->extensionsRequired[i]);
+	for (unsigned long long i = 0; i < data->accessorsCount; i++) {
+		internal_storage_release(&data->accessors[i].sparse.storage, &data->fileInfo.allocator);
 	}
-	gltfmemory_deallocate(data->extensionsRequired);
 
-	// binary values if opened .glb instead of a .gltf
-	if (data->fileInfo.type == 0) {
-		gltfmemory_deallocate(data->fileInfo.bin);
-	}
+	// the retained file
+	internal_storage_release(&data->fileInfo.storage, &data->fileInfo.allocator);
+
+	// everything else, names, extras, extensions, the object arrays and the glb bin copy, is owned by the arena
+	gltfarena_release(&data->arena);
 
-	gltfmemory_deallocate(data);
+	memset(data, 0, sizeof(GLTF2));
+}
+
+void GLTF_FreeProbe(GLTF_ProbeInfo* info) {
+	if (!info) return;
+
+	gltfarena_release(&info->arena);
+	memset(info, 0, sizeof(GLTF_ProbeInfo));
+}
+
+void GLTF_ReleaseWorkspace(GLTF_Workspace* workspace) {
+	if (!workspace) return;
+
+	gltfmemory_deallocate(&workspace->allocator, workspace->tokens);
+	memset(workspace, 0, sizeof(GLTF_Workspace));
 }
 
 GLTF_API const char* GLTF_GetErrors() {
-	return s_gErrors;
+	return s_gContext.log;
+}
+
+GLTF_API const GLTF_Context* GLTF_GetContext() {
+	return &s_gContext;
 }
 #endif // GLTFPARSER_IMPLEMENTATION
 
@@ -13,14 +13,136 @@ extern "C" {
 /// @return a parsed output data
 GLTF_API GLTF2 GLTF_ParseFromFile(const char* path);
 
+/// @brief attempts to parse a gltf formatted file with custom options
+/// @param path the disk path of the gltf file
+/// @param options how the file should be parsed, NULL means the default options
+/// @return a parsed output data
+GLTF_API GLTF2 GLTF_ParseFromFileWithOptions(const char* path, const GLTF_ParseOptions* options);
+
+/// @brief attempts to parse a gltf or glb document that is already in memory, without copying it
+/// @param data the document data, owned by the caller
+/// @param size the document size in bytes
+/// @param options how the document should be parsed, NULL means the default options
+/// @return a parsed output data
+/// @note with retainFileData the memory must outlive the parsed data, otherwise it's no longer referenced once this returns
+GLTF_API GLTF2 GLTF_ParseFromMemory(const void* data, unsigned long long size, const GLTF_ParseOptions* options);
+
+/// @brief parses many gltf or glb files at once, every idle thread takes the next file that hasn't been started yet
+/// @param paths the disk path of every file
+/// @param count how many files there are
+/// @param options how every file should be parsed, NULL means the default options
+/// @param results receives the outcome of every file, in the same order as paths
+/// @param outStats receives the batch totals, may be NULL
+/// @return how many files were parsed
+/// @note loadThreads and taskDispatch spreads the files instead, one per processor by default, each file loads it's external files on the thread that parses it
+/// @note every thread reuses it's own workspace across the files it parses, options workspace is not used
+/// @note errors that prevents the batch from starting are reported like a single parse, those of each file only in it's result
+GLTF_API unsigned long long GLTF_ParseBatch(const char* const* paths, unsigned long long count, const GLTF_ParseOptions* options, GLTF_BatchResult* results, GLTF_BatchStats* outStats);
+
+/// @brief reads the metadata of a gltf or glb file without building it's data, only the header and the json chunk of a glb file are read
+/// @param path the disk path of the file
+/// @return the file metadata, it must be released with GLTF_FreeProbe even on failure, errors are reported like a parse
+/// @note the metadata is complete only when valid is 1, on failure it holds what was probed before the error
+GLTF_API GLTF_ProbeInfo GLTF_Probe(const char* path);
+
+/// @brief reads the metadata of a gltf or glb file with custom options
+/// @param path the disk path of the file
+/// @param options the fileMode, io, allocator, context and workspace are used, NULL means the default options
+/// @return the file metadata, it must be released with GLTF_FreeProbe even on failure, errors are reported like a parse
+/// @note the metadata is complete only when valid is 1, on failure it holds what was probed before the error
+GLTF_API GLTF_ProbeInfo GLTF_ProbeWithOptions(const char* path, const GLTF_ParseOptions* options);
+
+/// @brief makes sure a buffer view data is in memory, loading only it's byte range when the document was parsed with BufferMode_Lazy
+/// @param data the gltf2 data the buffer view belongs to
+/// @param view the buffer view to be loaded
+/// @return 1 when the view data is available, 0 on failure
+/// @note not thread-safe, the same document must not be required from several threads at once
+GLTF_API int GLTF_RequireBufferView(GLTF2* data, GLTF_BufferView* view);
+
+/// @brief makes sure every buffer view an accessor reads from is in memory, including the sparse ones
+/// @param data the gltf2 data the accessor belongs to
+/// @param accessor the accessor to be loaded
+/// @return 1 when the accessor data is available, 0 on failure
+/// @note not thread-safe, the same document must not be required from several threads at once
+GLTF_API int GLTF_RequireAccessor(GLTF2* data, GLTF_Accessor* accessor);
+
+/// @brief reads accessor elements as floats, integer components are converted and normalized ones are mapped into [0, 1] or [-1, 1]
+/// @param accessor the accessor, it's buffer view data must be in memory, see GLTF_RequireAccessor
+/// @param first the first element to be read
+/// @param count how many elements to be read, those past the end of the accessor are not
+/// @param out where the elements are written into, with as many components as the accessor type, matrices column after column without padding
+/// @param outStride how many bytes there are from an element of out to the next one, 0 means packed elements
+/// @return how many elements were read, 0 on failure
+/// @note the elements of an accessor without buffer view are zeros, sparse values are applied over them
+GLTF_API unsigned long long GLTF_AccessorReadFloat(const GLTF_Accessor* accessor, unsigned long long first, unsigned long long count, float* out, unsigned long long outStride);
+
+/// @brief reads accessor elements as unsigned 32 bits integers, negative values are clamped to 0 and floats are truncated
+/// @param accessor the accessor, it's buffer view data must be in memory, see GLTF_RequireAccessor
+/// @param first the first element to be read
+/// @param count how many elements to be read, those past the end of the accessor are not
+/// @param out where the elements are written into, with as many components as the accessor type, matrices column after column without padding
+/// @param outStride how many bytes there are from an element of out to the next one, 0 means packed elements
+/// @return how many elements were read, 0 on failure
+/// @note the elements of an accessor without buffer view are zeros, sparse values are applied over them
+GLTF_API unsigned long long GLTF_AccessorReadU32(const GLTF_Accessor* accessor, unsigned long long first, unsigned long long count, unsigned int* out, unsigned long long outStride);
+
+/// @brief reads accessor elements as unsigned 16 bits integers, values out of it's range are clamped and floats are truncated
+/// @param accessor the accessor, it's buffer view data must be in memory, see GLTF_RequireAccessor
+/// @param first the first element to be read
+/// @param count how many elements to be read, those past the end of the accessor are not
+/// @param out where the elements are written into, with as many components as the accessor type, matrices column after column without padding
+/// @param outStride how many bytes there are from an element of out to the next one, 0 means packed elements
+/// @return how many elements were read, 0 on failure
+/// @note the elements of an accessor without buffer view are zeros, sparse values are applied over them
+GLTF_API unsigned long long GLTF_AccessorReadU16(const GLTF_Accessor* accessor, unsigned long long first, unsigned long long count, unsigned short* out, unsigned long long outStride);
+
+/// @brief writes every element of an accessor packed in it's own component type, with the sparse values applied
+/// @param accessor the accessor, it's buffer views data must be in memory, see GLTF_RequireAccessor
+/// @param out where the elements are written into, NULL to only get the size they need
+/// @param outSize how many bytes out can hold
+/// @return how many bytes the elements take, 0 on failure
+GLTF_API unsigned long long GLTF_AccessorMaterialize(const GLTF_Accessor* accessor, void* out, unsigned long long outSize);
+
+/// @brief materializes a sparse accessor once and keeps it in GLTF_SparseAccessor::resolved, so the next reads of it are plain reads
+/// @param data the gltf2 data the accessor belongs to, it's allocator is used and GLTF_Free releases the elements
+/// @param accessor the accessor, nothing is done when it's not sparse or it's already resolved
+/// @return 1 on success, 0 on failure
+/// @note not thread-safe, the same document must not be resolved from several threads at once
+GLTF_API int GLTF_AccessorResolveSparse(GLTF2* data, GLTF_Accessor* accessor);
+
+/// @brief reads the indices of a primitive into a uniform width, finding the lowest and highest of them
+/// @param accessor the indices accessor, a scalar of unsigned 8, 16 or 32 bits integers whose buffer view data is in memory, see GLTF_RequireAccessor
+/// @param format the width the indices are written with, IndexFormat_Auto picks 16 bits when they fit
+/// @param rebase 1 to subtract the lowest index from every index, so a primitive using a window of a big vertex buffer fits in 16 bits
+/// @param out where the packed indices are written into, NULL to only get the size they need and outInfo
+/// @param outSize how many bytes out can hold
+/// @param outInfo receives the width, count, range and base of the indices, it may be NULL
+/// @return how many bytes the indices take, 0 on failure, an accessor without any index is invalid and fails too
+/// @note packed indices are scanned and widened or narrowed with sse4.1 or avx2 when the cpu supports it, sparse values are applied
+GLTF_API unsigned long long GLTF_AccessorReadIndices(const GLTF_Accessor* accessor, GLTF_IndexFormat format, int rebase, void* out, unsigned long long outSize, GLTF_IndexInfo* outInfo);
+
+/// @brief releases the memory a workspace has kept between parses
+/// @param workspace the workspace, it's left zero-initialized and ready to be used again
+GLTF_API void GLTF_ReleaseWorkspace(GLTF_Workspace* workspace);
+
 /// @brief release the resources used by a GLTF2 object
 /// @param data the gltf2 data
 GLTF_API void GLTF_Free(GLTF2* data);
 
-/// @brief get all errors that has happened since last parse has occured
+/// @brief release the resources used by a GLTF_ProbeInfo object
+/// @param info the probed metadata
+GLTF_API void GLTF_FreeProbe(GLTF_ProbeInfo* info);
+
+/// @brief get all errors that has happened since last parse has occured on the calling thread
 /// @return the list of errors
+/// @note errors of parses given their own GLTF_ParseOptions::context are only found in that context
 GLTF_API const char* GLTF_GetErrors();
 
+/// @brief get the structured errors that has happened since last parse has occured on the calling thread
+/// @return the calling thread context, it's cleared by it's next parse
+/// @note errors of parses given their own GLTF_ParseOptions::context are only found in that context
+GLTF_API const GLTF_Context* GLTF_GetContext();
+
 #ifdef __cplusplus
 }
 #endif
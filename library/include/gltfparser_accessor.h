@@ -0,0 +1,61 @@
+#ifndef GLTFPARSER_ACCESSOR_INCLUDED
+#define GLTFPARSER_ACCESSOR_INCLUDED
+
+#include "gltfparser_defines.h"
+#include "gltfparser_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @brief converts accessor elements into floats, normalized integers are mapped into [0, 1] or [-1, 1], using sse4.1 or avx2 when the cpu supports it
+/// @param src the first component of the first element
+/// @param srcStride how many bytes there are from an element of src to the next one
+/// @param componentType the type of the components of src
+/// @param normalized 1 when the integer components of src are normalized
+/// @param components how many components every element has
+/// @param count how many elements are converted
+/// @param dst where the first element is written into
+/// @param dstStride how many bytes there are from an element of dst to the next one
+GLTF_API void accessor_convert_float(const void* src, unsigned long long srcStride, GLTF_ComponentType componentType, int normalized, unsigned long long components, unsigned long long count, float* dst, unsigned long long dstStride);
+
+/// @brief converts accessor elements into unsigned 32 bits integers, negative values are clamped to 0 and floats are truncated, using sse4.1 or avx2 when the cpu supports it
+/// @param src the first component of the first element
+/// @param srcStride how many bytes there are from an element of src to the next one
+/// @param componentType the type of the components of src
+/// @param components how many components every element has
+/// @param count how many elements are converted
+/// @param dst where the first element is written into
+/// @param dstStride how many bytes there are from an element of dst to the next one
+GLTF_API void accessor_convert_u32(const void* src, unsigned long long srcStride, GLTF_ComponentType componentType, unsigned long long components, unsigned long long count, unsigned int* dst, unsigned long long dstStride);
+
+/// @brief converts accessor elements into unsigned 16 bits integers, values out of it's range are clamped and floats are truncated, using sse4.1 or avx2 when the cpu supports it
+/// @param src the first component of the first element
+/// @param srcStride how many bytes there are from an element of src to the next one
+/// @param componentType the type of the components of src
+/// @param components how many components every element has
+/// @param count how many elements are converted
+/// @param dst where the first element is written into
+/// @param dstStride how many bytes there are from an element of dst to the next one
+GLTF_API void accessor_convert_u16(const void* src, unsigned long long srcStride, GLTF_ComponentType componentType, unsigned long long components, unsigned long long count, unsigned short* dst, unsigned long long dstStride);
+
+/// @brief finds the lowest and highest of packed unsigned indices, using sse4.1 or avx2 when the cpu supports it
+/// @param src the first index
+/// @param componentType the type of the indices, ComponentType_R8_UNSIGNED, ComponentType_R16_UNSIGNED or ComponentType_R32_UNSIGNED
+/// @param count how many indices there are
+/// @param outMin receives the lowest index, it's left untouched when count is 0
+/// @param outMax receives the highest index, it's left untouched when count is 0
+GLTF_API void accessor_index_range(const void* src, GLTF_ComponentType componentType, unsigned long long count, unsigned int* outMin, unsigned int* outMax);
+
+/// @brief subtracts a base from every packed index, using sse4.1 or avx2 when the cpu supports it
+/// @param indices the first index
+/// @param componentType the type of the indices, ComponentType_R16_UNSIGNED or ComponentType_R32_UNSIGNED
+/// @param count how many indices there are
+/// @param base what is subtracted, it must not be above any index
+GLTF_API void accessor_index_rebase(void* indices, GLTF_ComponentType componentType, unsigned long long count, unsigned int base);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GLTFPARSER_ACCESSOR_INCLUDED
@@ -0,0 +1,27 @@
+#ifndef GLTFPARSER_BASE64_INCLUDED
+#define GLTFPARSER_BASE64_INCLUDED
+
+#include "gltfparser_defines.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @brief calculates the maximum amount of bytes a base64 string decodes into
+/// @param length how many characters the base64 string has
+/// @return the maximum decoded size in bytes
+GLTF_API unsigned long long base64_decoded_size(unsigned long long length);
+
+/// @brief decodes a base64 string, using ssse3 or avx2 when the cpu supports it
+/// @param src the base64 characters, json escaped slashes are accepted
+/// @param length how many characters src has
+/// @param dst where the decoded bytes are written into, must hold at least base64_decoded_size(length) bytes
+/// @param outSize how many bytes were decoded
+/// @return 1 on success, 0 if src is not a valid base64 string
+GLTF_API int base64_decode(const char* src, unsigned long long length, void* dst, unsigned long long* outSize);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GLTFPARSER_BASE64_INCLUDED
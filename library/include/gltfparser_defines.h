@@ -16,9 +16,58 @@
 	#define GLTF_API
 #endif
 
+/// @brief enables the x86 simd code paths, they're selected at runtime based on what the cpu supports
+#if !defined(GLTF_DISABLE_SIMD) && (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+	#define GLTF_SIMD_X86
+#endif
+
+/// @brief allows a single function to use instructions the library is not compiled with
+#if defined(__GNUC__) || defined(__clang__)
+	#define GLTF_TARGET(x) __attribute__((target(x)))
+#else
+	#define GLTF_TARGET(x)
+#endif
+
+/// @brief gives every thread it's own copy of a variable
+#if defined(_MSC_VER)
+	#define GLTF_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+	#define GLTF_THREAD_LOCAL _Thread_local
+#else
+	#define GLTF_THREAD_LOCAL __thread
+#endif
+
 /// @brief sets how many characters the loging system can hold
 #ifndef GLTF_LOG_BUFFER_SIZE
 #define GLTF_LOG_BUFFER_SIZE 2048
 #endif
 
+/// @brief sets how many structured errors a GLTF_Context keeps, the following ones are only counted and logged
+#ifndef GLTF_MAX_ERRORS
+#define GLTF_MAX_ERRORS 8
+#endif
+
+/// @brief sets how many characters the message and the json path of a GLTF_Error can hold
+#ifndef GLTF_ERROR_MESSAGE_SIZE
+#define GLTF_ERROR_MESSAGE_SIZE 192
+#endif
+
+#ifndef GLTF_ERROR_PATH_SIZE
+#define GLTF_ERROR_PATH_SIZE 128
+#endif
+
+/// @brief sets the size of the first chunk of the parse arena, following chunks double it up to GLTF_ARENA_CHUNK_SIZE_MAX
+#ifndef GLTF_ARENA_CHUNK_SIZE
+#define GLTF_ARENA_CHUNK_SIZE (64 * 1024)
+#endif
+
+#ifndef GLTF_ARENA_CHUNK_SIZE_MAX
+#define GLTF_ARENA_CHUNK_SIZE_MAX (16 * 1024 * 1024)
+#endif
+
+/// @brief sets how many elements a top-level array needs to be parsed by several threads, see GLTF_ParseOptions::parseThreads
+#ifndef GLTF_PARALLEL_ELEMENTS_MIN
+#define GLTF_PARALLEL_ELEMENTS_MIN 4096
+#endif
+
 #endif // GLTFPARSER_DEFINES_INCLUDED
@@ -2,40 +2,48 @@
 #define GLTFPARSER_JSON_INCLUDED
 
 #include "gltfparser_defines.h"
+#include "gltfparser_util.h"
 #include "jsmn.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-/// @brief compares a string and the json string
+/// @brief compares a string and the json string, both must have the same length to be equal
 GLTF_API int json_strncmp(const char* data, const jsmntok_t* tok, const char* str);
 
 /// @brief converts a json data in to an integer bool
 GLTF_API int json_to_bool(const char* data, const jsmntok_t* tok);
 
-/// @brief converts json data into an integer
-GLTF_API int json_to_int(const char* data, jsmntok_t const* tok);
+/// @brief reads json data as an integer, returns 1 on success, 0 if it's not a valid integer
+GLTF_API int json_read_int(const char* data, const jsmntok_t* tok, int* outValue);
 
-/// @brief converts json data into a float
-GLTF_API float json_to_float(const char* data, const jsmntok_t* tok);
+/// @brief reads json data as the nearest float, returns 1 on success, 0 if it's not a valid number
+GLTF_API int json_read_float(const char* data, const jsmntok_t* tok, float* outValue);
 
-/// @brief converts a json data into a size_t
-GLTF_API unsigned long long json_to_size(const char* data, const jsmntok_t* tok);
+/// @brief reads json data as a size, returns 1 on success, 0 if it's not a valid non negative integer
+GLTF_API int json_read_size(const char* data, const jsmntok_t* tok, unsigned long long* outValue);
 
-/// @brief parses a json string
-GLTF_API int json_parse_string(const char* data, const jsmntok_t* tokens, int i, char** outString);
+/// @brief parses a json string, the copy is allocated from arena and it has it's escapes decoded
+GLTF_API int json_parse_string(const char* data, const jsmntok_t* tokens, int i, char** outString, GLTF_Arena** arena);
 
-/// @brief parses the json array
-GLTF_API int json_parse_array(const char* data, const jsmntok_t* tokens, int i, unsigned long long elementSize, void** outArr, unsigned long long* outSize);
+/// @brief parses a json string in place, the output points into data, whose closing quote becomes the terminator and escapes are decoded over the original characters
+GLTF_API int json_parse_string_view(char* data, const jsmntok_t* tokens, int i, char** outString);
+
+/// @brief parses the json array, the zeroed elements are allocated from arena
+GLTF_API int json_parse_array(const char* data, const jsmntok_t* tokens, int i, unsigned long long elementSize, void** outArr, unsigned long long* outSize, GLTF_Arena** arena);
 
 /// @brief parses a json float array
 GLTF_API int json_parse_array_float(const char* data, const jsmntok_t* tokens, int i, float* outArray, int size);
 
-/// @brief parses a json strign array
-GLTF_API int json_parse_array_string(const char* data, const jsmntok_t* tokens, int i, char*** outArr, unsigned long long* outSize);
+/// @brief parses a json float array of any length, only the first capacity floats are kept but every element must be a number
+GLTF_API int json_parse_array_float_partial(const char* data, const jsmntok_t* tokens, int i, float* outArray, int capacity);
+
+/// @brief parses a json strign array, the array and its strings are allocated from arena
+GLTF_API int json_parse_array_string(const char* data, const jsmntok_t* tokens, int i, char*** outArr, unsigned long long* outSize, GLTF_Arena** arena);
 
-/// @brief skips the parsing to next iteration
+/// @brief skips the parsing to next iteration, the token and it's whole subtree are skipped in constant time
+/// @return the token after the subtree, -1 for the trailing UNDEFINED token
 GLTF_API int json_parse_skip(const jsmntok_t* tokens, int i);
 
 #ifdef __cplusplus
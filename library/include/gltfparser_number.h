@@ -0,0 +1,35 @@
+#ifndef GLTFPARSER_NUMBER_INCLUDED
+#define GLTFPARSER_NUMBER_INCLUDED
+
+#include "gltfparser_defines.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @brief parses a json number into the nearest float, independently of the current locale
+/// @param str the number characters, it doesn't need to be null terminated
+/// @param length how many characters str has, all of them must belong to the number
+/// @param outValue the parsed value, correctly rounded to nearest even
+/// @return 1 on success, 0 if str is not a json number or it's out of the float range
+GLTF_API int number_parse_float(const char* str, unsigned long long length, float* outValue);
+
+/// @brief parses a json integer, a fractional part made only of zeros is accepted
+/// @param str the number characters, it doesn't need to be null terminated
+/// @param length how many characters str has, all of them must belong to the number
+/// @param outValue the parsed value
+/// @return 1 on success, 0 if str is not an integer or it doesn't fit in 64 bits
+GLTF_API int number_parse_int64(const char* str, unsigned long long length, long long* outValue);
+
+/// @brief parses a non negative json integer, a fractional part made only of zeros is accepted
+/// @param str the number characters, it doesn't need to be null terminated
+/// @param length how many characters str has, all of them must belong to the number
+/// @param outValue the parsed value
+/// @return 1 on success, 0 if str is not a non negative integer or it doesn't fit in 64 bits
+GLTF_API int number_parse_uint64(const char* str, unsigned long long length, unsigned long long* outValue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GLTFPARSER_NUMBER_INCLUDED
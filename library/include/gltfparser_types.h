@@ -114,6 +114,28 @@ typedef enum {
 /// @brief forward declaration
 typedef struct GLTF_Node GLTF_Node;
 
+/// @brief who is responsible for releasing a block of memory
+typedef enum {
+    StorageType_None,                   // nothing to release, the memory is empty or owned by someone else
+    StorageType_Heap,                   // allocated with gltfmemory_allocate
+    StorageType_Mapped,                 // mapped with platform_filemap
+    StorageType_Borrowed,               // owned by the caller, which must keep it alive while it's referenced
+    StorageType_FileIO                  // mapped through the GLTF_FileIO callbacks, released by closing it's file
+} GLTF_StorageType;
+
+/// @brief closes a file opened by GLTF_FileIO, along with anything mapped from it
+typedef void (*GLTF_FileRelease)(void* userData, void* file);
+
+/// @brief a block of memory owned by the parsed data
+typedef struct {
+    void* data;
+    unsigned long long size;
+    GLTF_StorageType type;
+    void* file;                         // the GLTF_FileIO file the data was mapped from, if applicable
+    GLTF_FileRelease release;           // closes the GLTF_FileIO file, if applicable
+    void* userData;                     // passed to release
+} GLTF_Storage;
+
 /// @brief information about a extension
 typedef struct {
     char* name;
@@ -133,13 +155,16 @@ typedef struct {
 
 // GLTF 2.0 specification https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html#buffers-and-buffer-views
 typedef struct {
-    void* data; // loaded uppon load buffer
+    void* data; // loaded uppon load buffer, either points to storage or to the glb bin chunk
     char* name;
     unsigned long long size;
     char* URI;
     unsigned long long extensionsCount;
     GLTF_Extension* extensions;
     char* extras;
+    GLTF_Storage storage; // the external file loaded for this buffer, if any
+    char* path; // the file lazy buffer views are loaded from, if any
+    unsigned long long fileOffset; // where the buffer starts inside of path
 } GLTF_Buffer;
 
 /// GLTF 2.0 specification https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html#buffers-and-buffer-views
@@ -150,10 +175,11 @@ typedef struct {
     unsigned long long offset;
     unsigned long long size;
     unsigned long long stride;
-    void* data;
+    void* data; // points inside of buffer's data, NULL when the buffer is not loaded
     char* extras;
     unsigned long long extensionsCount;
     GLTF_Extension* extensions;
+    GLTF_Storage storage; // the byte range read when lazily required, if any
 } GLTF_BufferView;
 
 // GLTF 2.0 specification https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html#sparse-accessors
@@ -164,6 +190,8 @@ typedef struct {
     GLTF_ComponentType indicesComponentType;
     GLTF_BufferView* valuesBufferView;
     unsigned long long valueByteOffset;
+    void* resolved;                     // every element of the accessor with the sparse values applied, packed, NULL until GLTF_AccessorResolveSparse is called
+    GLTF_Storage storage;               // owns the resolved elements
 } GLTF_SparseAccessor;
 
 /// GLTF 2.0 specification https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html#accessors
@@ -276,6 +304,9 @@ typedef struct {
     char* extras;
     unsigned long long extensionsCount;
     GLTF_Extension* extensions;
+    void* data; // the encoded image, either decoded from a data uri or pointing to the buffer view's data
+    unsigned long long size;
+    GLTF_Storage storage; // the decoded data uri, if any
 } GLTF_Image;
 
 /// @brief GLTF 2.0 specification https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html#samplers
@@ -417,16 +448,132 @@ struct GLTF_Node {
 // API structs
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// @brief how the parser brings a file into memory
+typedef enum {
+    FileMode_Read,                      // reads the whole file into a heap buffer
+    FileMode_Map                        // maps the file read-only, falls back to FileMode_Read when mapping fails or GLTF_FileIO has no map
+} GLTF_FileMode;
+
+/// @brief callbacks that replaces the platform file access, used for the main file and every external uri
+/// @note the callbacks may be called from several threads at once while external files are loaded
+typedef struct {
+    void* userData;                                                                                             // passed to every callback
+    void* (*open)(void* userData, const char* path);                                                            // opens a file, returns NULL on failure
+    unsigned long long (*size)(void* userData, void* file);                                                     // returns the file size in bytes
+    int (*read)(void* userData, void* file, unsigned long long offset, unsigned long long size, void* dst);      // reads a range of the file into dst, returns 1 on success
+    const void* (*map)(void* userData, void* file, unsigned long long* outSize);                                // optional, exposes the whole file without copying it, returns NULL on failure
+    GLTF_FileRelease release;                                                                                   // closes the file, along with anything mapped from it
+} GLTF_FileIO;
+
+/// @brief callbacks that replaces the heap, used for the parsed data and for the memory the parser needs while working
+/// @note the callbacks may be called from several threads at once while external files are loaded
+typedef struct {
+    void* userData;                                                                                             // passed to every callback
+    void* (*allocate)(void* userData, unsigned long long size);                                                 // returns NULL on failure
+    void* (*reallocate)(void* userData, void* ptr, unsigned long long size);                                    // ptr may be NULL, returns NULL on failure leaving ptr untouched
+    void (*deallocate)(void* userData, void* ptr);                                                              // ptr may be NULL
+} GLTF_Allocator;
+
 typedef struct {
-    const char* path;                   // the path on disk
+    const char* path;                   // the path on disk, or the options basePath when parsed from memory
     void* bin;                          // glb bin data, if applicable
     unsigned long long binSize;                     // glb bin size, if applicable
     int type;                           // 1: GLFW file 0: GLB file
     unsigned int jsonTkCount;           // holds how many tokens the json has
-    const char* json;                   // json data, for latter reference
+    const char* json;                   // json data, for latter reference, only valid when the file data is retained
     unsigned long long jsonSize;                    // json data size, for latter reference
+    GLTF_Storage storage;               // the whole file when it's retained, bin and json then points inside of it
+    unsigned long long binOffset;       // where the glb bin data starts inside of the file, if applicable
+    GLTF_FileMode fileMode;             // the file mode used while parsing, lazy buffers are loaded with it
+    GLTF_FileIO io;                     // the file access used while parsing, lazy buffers are loaded with it
+    GLTF_Allocator allocator;           // the allocator used while parsing, lazy buffers and GLTF_Free uses it
+    int stringViews;                    // 1: names, uris, extras and extensions points into json instead of the arena, json is no longer valid json
 } GLTF_FileInfo;
 
+/// @brief the top-level collections of a document, combined as flags to choose which ones are built
+typedef enum {
+    Section_Accessors       = 1 << 0,
+    Section_Animations      = 1 << 1,
+    Section_BufferViews     = 1 << 2,
+    Section_Buffers         = 1 << 3,   // skipped buffers are neither loaded
+    Section_Cameras         = 1 << 4,
+    Section_Images          = 1 << 5,   // skipped images are neither loaded
+    Section_Materials       = 1 << 6,
+    Section_Meshes          = 1 << 7,
+    Section_Nodes           = 1 << 8,
+    Section_Samplers        = 1 << 9,
+    Section_Scenes          = 1 << 10,  // scenes and the default scene
+    Section_Skins           = 1 << 11,
+    Section_Textures        = 1 << 12,
+    Section_All             = (1 << 13) - 1
+} GLTF_Section;
+
+/// @brief how the parser deals with the buffers data
+typedef enum {
+    BufferMode_Load,                    // every buffer and image is loaded while parsing, external files are loaded concurrently with the same file mode as the main file and base64 data uris are decoded
+    BufferMode_Skip,                    // no buffer or image is loaded, GLTF_Buffer::data, GLTF_BufferView::data and GLTF_Image::data stays NULL
+    BufferMode_Lazy                     // like BufferMode_Skip, but GLTF_RequireBufferView and GLTF_RequireAccessor loads the data on demand
+} GLTF_BufferMode;
+
+/// @brief a unit of work the parser wants done, called once for each index in [0, count)
+typedef void (*GLTF_TaskFunction)(void* taskData, unsigned long long index);
+
+/// @brief runs a task for every index in [0, count), possibly concurrently, must only return once every call has finished
+typedef void (*GLTF_TaskDispatch)(void* userData, GLTF_TaskFunction task, void* taskData, unsigned long long count);
+
+/// @brief what kind of failure an error is
+typedef enum {
+    ErrorCode_None,
+    ErrorCode_InvalidArgument,          // a NULL or empty path or memory, invalid options or an object that can't be required
+    ErrorCode_OutOfMemory,              // an allocation has failed
+    ErrorCode_File,                     // a file couldn't be opened or read
+    ErrorCode_InvalidJson,              // the json text is malformed
+    ErrorCode_InvalidGLB,               // the glb container is malformed
+    ErrorCode_InvalidDocument,          // the json is valid but it's not a valid gltf document
+    ErrorCode_Unsupported               // a valid document that uses something the parser doesn't support
+} GLTF_ErrorCode;
+
+/// @brief a single error that has happened while parsing
+typedef struct {
+    GLTF_ErrorCode code;                // what kind of failure it is
+    long long offset;                   // the byte offset into the json text where it happened, -1 when it's not tied to the json
+    char path[GLTF_ERROR_PATH_SIZE];    // the json path where it happened, like "meshes[2].primitives[0].mode", empty when it's not tied to the json
+    char message[GLTF_ERROR_MESSAGE_SIZE];
+} GLTF_Error;
+
+/// @brief receives the errors of a parse, every parse uses it's own so several threads can parse at once
+typedef struct {
+    unsigned int errorsCount;           // how many errors has happened, only the first GLTF_MAX_ERRORS are kept in errors, the first one is the cause of the failure
+    GLTF_Error errors[GLTF_MAX_ERRORS];
+    char log[GLTF_LOG_BUFFER_SIZE];     // every error message one per line, with it's path when it has one
+} GLTF_Context;
+
+/// @brief memory a parse needs only while it's working, kept between parses so loading many files doesn't allocate it each time
+/// @note zero-initialize it before it's first use, a workspace must not be used by several parses at once
+typedef struct {
+    void* tokens;                       // the json tokens of the largest json parsed so far
+    unsigned int tokensCapacity;        // how many tokens fits in tokens
+    GLTF_Allocator allocator;           // the allocator of the parse that has created it, it keeps using it
+} GLTF_Workspace;
+
+/// @brief options that changes how a file is parsed, a zero-initialized struct means the default behaviour
+typedef struct {
+    GLTF_FileMode fileMode;             // how the main file and external buffers are loaded
+    int retainFileData;                 // 1: keeps the loaded file alive until GLTF_Free, the glb bin chunk is used in place instead of copied, when parsing from memory the caller's memory keeps being referenced instead
+    GLTF_BufferMode bufferMode;         // how buffers are loaded
+    unsigned int loadThreads;           // how many threads loads the external files at once, 0: one per processor, 1: loads them on the calling thread
+    unsigned int parseThreads;          // how many threads parses the accessors, buffer views, materials, meshes and nodes arrays with at least GLTF_PARALLEL_ELEMENTS_MIN elements, 0 or 1: the calling thread only
+    GLTF_TaskDispatch taskDispatch;     // runs the parser work on the caller's own job system instead of the internal threads, may be NULL
+    void* taskUserData;                 // passed to taskDispatch
+    const char* basePath;               // when parsing from memory, the path of the document that external uris are relative to, may be NULL
+    GLTF_FileIO io;                     // custom file access, all but map must be set when open is set, zero-initialized means the platform file access
+    GLTF_Allocator allocator;           // custom memory allocation, the three functions must be set together, zero-initialized means malloc, realloc and free
+    int stringViews;                    // 1: strings points into the retained json instead of being copied, only with retainFileData on a file read into memory, see GLTF_FileInfo::stringViews
+    GLTF_Context* context;              // receives the errors, it's cleared when the parse starts, NULL: the calling thread context returned by GLTF_GetContext
+    GLTF_Workspace* workspace;          // reused by the parse instead of allocating it's temporary memory, NULL: it's allocated and released by the parse
+    unsigned int sections;              // GLTF_Section flags of the collections to build, the others are skipped and any reference into them is NULL, 0: all of them, the asset and the root extensions are always parsed
+} GLTF_ParseOptions;
+
 /// @brief final structure for the parsed data
 typedef struct {
     GLTF_FileInfo fileInfo;
@@ -465,8 +612,73 @@ typedef struct {
     char** extensionsRequired;
     unsigned long long extensionsRequiredCount;
     char* extras;
+    struct GLTF_Arena* arena;           // owns every allocation of the parsed data but the buffers and images storages, released by GLTF_Free
 } GLTF2;
 
+/// @brief the metadata of a document, read by GLTF_Probe without building it
+typedef struct {
+    int valid;                          // 1 when the file was read, tokenized and probed without errors, otherwise the rest of the metadata is partial
+    int isGlb;                          // 1 for a glb file, 0 for a gltf json file
+    unsigned long long jsonSize;        // the json size in bytes
+    unsigned long long binSize;         // the glb bin chunk size in bytes as told by the glb header, 0 when there's none
+    GLTF_Asset asset;                   // the version, generator, copyright... legacy documents are reported too
+    unsigned long long accessorsCount;
+    unsigned long long animationsCount;
+    unsigned long long bufferViewsCount;
+    unsigned long long buffersCount;
+    unsigned long long* bufferSizes;    // the byteLength of every buffer, buffersCount of them
+    unsigned long long camerasCount;
+    unsigned long long imagesCount;
+    unsigned long long materialsCount;
+    unsigned long long meshesCount;
+    unsigned long long nodesCount;
+    unsigned long long imageSamplersCount;
+    unsigned long long scenesCount;
+    unsigned long long skinsCount;
+    unsigned long long texturesCount;
+    char** extensionsUsed;
+    unsigned long long extensionsUsedCount;
+    char** extensionsRequired;
+    unsigned long long extensionsRequiredCount;
+    struct GLTF_Arena* arena;           // owns every allocation of the probe, released by GLTF_FreeProbe
+} GLTF_ProbeInfo;
+
+/// @brief the outcome of one file of a batch
+typedef struct {
+    GLTF2 data;                         // the parsed data, it must be released with GLTF_Free even when parsing has failed
+    int parsed;                         // 1 when the file was parsed, otherwise error tells why
+    unsigned int errorsCount;           // how many errors the file had
+    GLTF_Error error;                   // the first error of the file, the cause of the failure
+    double seconds;                     // how long loading and parsing the file took
+} GLTF_BatchResult;
+
+/// @brief the totals of a batch
+typedef struct {
+    unsigned long long filesCount;      // how many files the batch had
+    unsigned long long parsedCount;     // how many of them were parsed
+    unsigned int threadsCount;          // how many threads parsed them, 0 when they were run by taskDispatch
+    double seconds;                     // how long the whole batch took
+    double filesSeconds;                // the sum of every file time, divided by seconds it's how many files were parsed at once on average
+    double slowestSeconds;              // the time of the slowest file
+    unsigned long long slowestIndex;    // the index of the slowest file
+} GLTF_BatchStats;
+
+/// @brief the width GLTF_AccessorReadIndices writes indices with
+typedef enum {
+    IndexFormat_Auto,                   // 16 bits when every index is below 65535, the 16 bits primitive restart value, 32 bits otherwise
+    IndexFormat_U16,                    // 16 bits, failing when an index doesn't fit
+    IndexFormat_U32                     // 32 bits
+} GLTF_IndexFormat;
+
+/// @brief what GLTF_AccessorReadIndices found and wrote
+typedef struct {
+    GLTF_ComponentType componentType;   // ComponentType_R16_UNSIGNED or ComponentType_R32_UNSIGNED, the width the indices are written with
+    unsigned long long count;           // how many indices there are
+    unsigned int min;                   // the lowest index of the accessor, before rebasing
+    unsigned int max;                   // the highest index of the accessor, before rebasing
+    unsigned int base;                  // what was subtracted from every index, min when they are rebased and 0 otherwise
+} GLTF_IndexInfo;
+
 #ifdef __cplusplus
 }
 #endif
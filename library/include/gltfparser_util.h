@@ -2,6 +2,7 @@
 #define GLTFPARSER_UTILS_INCLUDED
 
 #include "gltfparser_defines.h"
+#include "gltfparser_types.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -9,21 +10,24 @@ extern "C" {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// memory
 
-/// @brief allocates memory using default malloc, this is usefull if allocating functions are to be modified
+/// @brief allocates memory using the given allocator, or default malloc when it's NULL or zero-initialized
+/// @param allocator the allocator, may be NULL
 /// @param size how many bytes to be allocated
 /// @param empty erases all contents within specified size
 /// @return the memory's address
-GLTF_API void* gltfmemory_allocate(unsigned long long size, int empty);
+GLTF_API void* gltfmemory_allocate(const GLTF_Allocator* allocator, unsigned long long size, int empty);
 
 /// @brief dealocates memory previously allocated
+/// @param allocator the allocator the memory came from, may be NULL
 /// @param ptr address to the memory's block
-GLTF_API void gltfmemory_deallocate(void* ptr);
+GLTF_API void gltfmemory_deallocate(const GLTF_Allocator* allocator, void* ptr);
 
 /// @brief reallocates previouly allocated memory to fit a new size
+/// @param allocator the allocator the memory came from, may be NULL
 /// @param ptr address to the memory
 /// @param size new size of the memory's block
 /// @return the new ptr of the memory
-GLTF_API void* gltfmemory_reallocate(void* ptr, unsigned long long size);
+GLTF_API void* gltfmemory_reallocate(const GLTF_Allocator* allocator, void* ptr, unsigned long long size);
 
 /// @brief erases all content exists in the given address
 /// @param ptr memory's address
@@ -44,14 +48,110 @@ GLTF_API void* gltfmemory_copy(void* dest, const void* src, unsigned long long s
 /// @return 0 if both are equal, negative if s1 is less than s2, positve if s1 is greater than s2
 GLTF_API int gltfmemory_cmp(const void* s1, const void* s2, unsigned long long n);
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// arena
+
+/// @brief a chunk of a bump allocator, an arena is a pointer to its newest chunk which links to the older ones
+typedef struct GLTF_Arena {
+    struct GLTF_Arena* next;
+    unsigned long long used;
+    unsigned long long capacity;
+    GLTF_Allocator allocator;
+} GLTF_Arena;
+
+/// @brief creates an arena with a first chunk, every chunk of it comes from the given allocator
+/// @param allocator the allocator, may be NULL
+/// @return the arena, NULL on failure
+GLTF_API GLTF_Arena* gltfarena_create(const GLTF_Allocator* allocator);
+
+/// @brief allocates memory from an arena, a new chunk is added when the newest one can't fit the size
+/// @param arena the arena, it may point to NULL for an empty arena that uses default malloc
+/// @param size how many bytes to be allocated
+/// @param empty erases all contents within specified size
+/// @return the memory's address, it's released with the whole arena
+GLTF_API void* gltfarena_allocate(GLTF_Arena** arena, unsigned long long size, int empty);
+
+/// @brief moves every chunk of an arena into another one, behind it's newest chunk so it keeps allocating from it
+/// @param arena the arena that receives the chunks, it may point to NULL
+/// @param other the arena whose chunks are moved, it must not be used afterwards, may be NULL
+GLTF_API void gltfarena_merge(GLTF_Arena** arena, GLTF_Arena* other);
+
+/// @brief releases every chunk of an arena and leaves it empty
+/// @param arena the arena
+GLTF_API void gltfarena_release(GLTF_Arena** arena);
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// others
 
+/// @brief cpu features used by the optional simd code paths
+#define CPU_FEATURE_SSSE3   (1 << 0)
+#define CPU_FEATURE_SSE41   (1 << 1)
+#define CPU_FEATURE_SSE42   (1 << 2)
+#define CPU_FEATURE_AVX2    (1 << 3)
+#define CPU_FEATURE_SSE2    (1 << 4)
+
+/// @brief queries which simd instructions the cpu and the operating system supports
+/// @return a combination of CPU_FEATURE_* bits, 0 when not running on x86 or GLTF_DISABLE_SIMD is defined
+GLTF_API unsigned int platform_cpu_features();
+
 /// @brief reads the contents of a file
 /// @param path the path on disk of the file
 /// @param size the file output size
 /// @param data the read data
+/// @param allocator where the data is allocated from, may be NULL
 /// @return 1 on success, 0 on failure
-GLTF_API int platform_fileread(const char* path, unsigned long long* size, void** data);
+GLTF_API int platform_fileread(const char* path, unsigned long long* size, void** data, const GLTF_Allocator* allocator);
+
+/// @brief reads a range of bytes of a file
+/// @param path the path on disk of the file
+/// @param offset where the range starts inside of the file
+/// @param size how many bytes to read
+/// @param dst where the bytes are written into, must hold at least size bytes
+/// @return 1 on success, 0 on failure (including ranges past the end of the file)
+GLTF_API int platform_filereadrange(const char* path, unsigned long long offset, unsigned long long size, void* dst);
+
+/// @brief maps the contents of a file into memory as read-only, without copying it
+/// @param path the path on disk of the file
+/// @param sequential 1 when the file is read once from start to end, so the system reads ahead and drops the pages behind, 0 when it's accessed in any order
+/// @param size the file output size
+/// @param data the mapped address
+/// @return 1 on success, 0 on failure (empty files can't be mapped)
+GLTF_API int platform_filemap(const char* path, int sequential, unsigned long long* size, void** data);
+
+/// @brief releases a file previously mapped with platform_filemap
+/// @param data the mapped address
+/// @param size the mapped size
+GLTF_API void platform_fileunmap(void* data, unsigned long long size);
+
+/// @brief the work executed for each index of platform_parallel_for
+typedef void (*platform_task)(void* taskData, unsigned long long index);
+
+/// @brief queries how many logical processors are available
+/// @return the processor count, at least 1
+GLTF_API unsigned int platform_cpu_count();
+
+/// @brief reads a monotonic clock, only the difference between two reads is meaningful
+/// @return the clock time in seconds
+GLTF_API double platform_time();
+
+/// @brief atomically adds a value to a 64 bits integer
+/// @param value the integer to be modified
+/// @param amount how much to add
+/// @return the integer value before the addition
+GLTF_API long long platform_atomic_add(volatile long long* value, long long amount);
+
+/// @brief atomically lowers a 64 bits integer to a value, it's left as is when it's already lower
+/// @param value the integer to be modified
+/// @param candidate the value it's lowered to
+/// @return the integer value before the operation
+GLTF_API long long platform_atomic_min(volatile long long* value, long long candidate);
+
+/// @brief runs a task for every index in [0, count) across worker threads, the calling thread also takes part
+/// @param threadCount the maximum amount of threads working at once, 0 uses one per processor
+/// @param count how many times the task must run
+/// @param task the work to be done
+/// @param taskData data passed to every task
+/// @param allocator where the threads bookkeeping is allocated from, may be NULL
+/// @note only returns once every task has finished
+GLTF_API void platform_parallel_for(unsigned int threadCount, unsigned long long count, platform_task task, void* taskData, const GLTF_Allocator* allocator);
 
 /// @brief copies a string into another string
 /// @param dest destiny string
@@ -26,6 +26,7 @@
 #define JSMN_INCLUDED
 
 #include "gltfparser_defines.h"
+#include "gltfparser_types.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -45,15 +46,20 @@ enum jsmnerr {
 	
 	JSMN_ERROR_NOMEM = -1, // not enough tokens were provided
 	JSMN_ERROR_INVAL = -2, // invalid char inside json string
-	JSMN_ERROR_PART = -3 // string is no a full json packet, more were expected
+	JSMN_ERROR_PART = -3, // string is no a full json packet, more were expected
+	JSMN_ERROR_SIZE = -4 // an object or array has more than JSMN_SIZE_MAX children
 };
 
-/// @brief token structure
+/// @brief the most children a single token can have
+#define JSMN_SIZE_MAX 0x0FFFFFFF
+
+/// @brief token structure, the type is packed along with the size so a token takes 16 bytes
 typedef struct jsmntok {
-	jsmntype_t type;
+	unsigned int type : 4; // a jsmntype_t
+	unsigned int size : 28;
 	int start;
 	int end;
-	int size;
+	int next;             // the token that follows this one's subtree, so skipping an object or array is a single read
 #ifdef JSMN_PARENT_LINKS
 	int parent;
 #endif
@@ -64,6 +70,7 @@ typedef struct jsmn_parser {
 	unsigned int pos;     // offset in the JSON string
 	unsigned int toknext; // next token to allocate
 	int toksuper;         // superior token node, e.g. parent object or array
+	int tokopen;          // innermost object or array not closed yet, each one links to the one it's inside of through it's next
 } jsmn_parser;
 
 /// @brief create a JSON parser over an array of tokens
@@ -72,6 +79,13 @@ GLTF_API void jsmn_init(jsmn_parser* parser);
 /// @brief parses a JSON data string into and array of tokens, each describing a single JSON object
 GLTF_API int jsmn_parse(jsmn_parser* parser, const char* js, const unsigned long long len, jsmntok_t* tokens, const unsigned int num_tokens);
 
+/// @brief parses a JSON data string in a single pass, growing the array of tokens whenever it runs out of them
+/// @param tokens the array of tokens, may point to NULL, it's reallocated with gltfmemory_reallocate and must be released with gltfmemory_deallocate
+/// @param num_tokens the capacity of the array of tokens, updated whenever it grows, 0 starts with an estimate taken from the data length
+/// @param allocator the allocator the array of tokens comes from, may be NULL
+/// @return the amount of tokens parsed or a negative jsmnerr, JSMN_ERROR_NOMEM only when the allocation fails
+GLTF_API int jsmn_parse_alloc(jsmn_parser* parser, const char* js, const unsigned long long len, jsmntok_t** tokens, unsigned int* num_tokens, const GLTF_Allocator* allocator);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,9 +1,12 @@
 #include "gltfparser.h"
 
+#include "gltfparser_accessor.h"
+#include "gltfparser_base64.h"
 #include "gltfparser_json.h"
 #include "gltfparser_util.h"
 
 #include <stdio.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <stdarg.h>
 #include <string.h>
@@ -29,45 +32,183 @@
 /// @macro little-endian "BIN"
 #define BIN_CHUNK_TYPE 0x004E4942
 
-/// @brief hold all errors that has happened when parsing
-static char s_gErrors[GLTF_LOG_BUFFER_SIZE] = { 0 };
+/// @brief the state of a parse in progress, it lives on the stack of the parse entry point
+typedef struct internal_parse_state {
+	GLTF_ParseOptions options;          // the options of the parse
+	GLTF_Context* context;              // where the errors are recorded
+	GLTF_Arena** arena;                 // every allocation the output data owns comes from it, NULL until the parsed data exists
+	int stringViews;                    // 1 when strings points into the json instead of being copied
+	const char* json;                   // the json text while it's tokens are alive, used to report error paths
+	const jsmntok_t* tokens;
+	int tokensCount;
+	struct internal_parse_state* previous; // the parse this one has interrupted on the same thread, if any
+} internal_parse_state;
+
+/// @brief the errors of the calling thread when a parse doesn't provide it's own context
+static GLTF_THREAD_LOCAL GLTF_Context s_gContext;
+
+/// @brief the parse in progress on the calling thread, NULL outside of a parse
+static GLTF_THREAD_LOCAL internal_parse_state* s_gState = NULL;
+
+/// @brief starts a parse on the calling thread, clearing it's context
+/// @param state the state of the new parse
+/// @param options the parse options, never NULL
+static void internal_parse_begin(internal_parse_state* state, const GLTF_ParseOptions* options) {
+	memset(state, 0, sizeof(internal_parse_state));
+	state->options = *options;
+	state->context = options->context ? options->context : &s_gContext;
+	state->previous = s_gState;
+	if (state->options.sections == 0) state->options.sections = Section_All;
+
+	state->context->errorsCount = 0;
+	state->context->log[0] = '\0';
+	s_gState = state;
+}
+
+/// @brief finishes the parse started by internal_parse_begin
+/// @param state the state of the parse
+static void internal_parse_end(internal_parse_state* state) {
+	s_gState = state->previous;
+}
+
+/// @brief appends text to a bounded string, truncating it when it doesn't fit
+/// @param str the string
+/// @param length the current string length, updated with the appended text
+/// @param size the string capacity
+/// @param format the printf format of the text
+static void internal_append(char* str, unsigned long long* length, unsigned long long size, const char* format, ...) {
+	if (*length + 1 >= size) return;
 
-// log an error message (appends to the buffer with newline)
-void internal_log_error(const char* format, ...) {
 	va_list args;
 	va_start(args, format);
+	int written = vsnprintf(str + *length, size - *length, format, args);
+	va_end(args);
 
-	size_t currentLen = strlen(s_gErrors);
-	size_t remainingSpace = GLTF_LOG_BUFFER_SIZE - currentLen - 1; // -1 for null terminator
+	if (written > 0) *length += (unsigned long long)written < size - *length ? (unsigned long long)written : size - *length - 1;
+}
 
-	if (remainingSpace > 1) {  // need space for at least 1 char + null terminator
-		if (currentLen > 0) {
-			s_gErrors[currentLen] = '\n';
-			currentLen++;
-			remainingSpace--;
+/// @brief writes the json path of a token, like "meshes[2].primitives[0].mode"
+/// @param json the json text
+/// @param tokens the json tokens, the first one is the root
+/// @param count how many tokens there are
+/// @param target the token whose path is written
+/// @param outPath the output path
+/// @param size the output path capacity
+static void internal_token_path(const char* json, const jsmntok_t* tokens, int count, int target, char* outPath, unsigned long long size) {
+	unsigned long long length = 0;
+	outPath[0] = '\0';
+
+	int parent = 0;
+	while (parent != target && parent < count) {
+		if (tokens[parent].type != JSMN_OBJECT && tokens[parent].type != JSMN_ARRAY) break;
+
+		// finds the member of the parent whose subtree holds the target
+		int child = parent + 1;
+		int found = -1;
+		for (int k = 0; k < tokens[parent].size && child < count; ++k) {
+			int key = child;
+			if (tokens[parent].type == JSMN_OBJECT) child++;
+
+			int next = json_parse_skip(tokens, child);
+			if (target >= key && target < next) {
+				if (tokens[parent].type == JSMN_OBJECT) {
+					internal_append(outPath, &length, size, "%s%.*s", length ? "." : "", tokens[key].end - tokens[key].start, json + tokens[key].start);
+				}
+				else {
+					internal_append(outPath, &length, size, "[%d]", k);
+				}
+				found = target == key ? target : child;
+				break;
+			}
+			child = next;
 		}
 
-		vsnprintf(s_gErrors + currentLen, remainingSpace, format, args);
-		s_gErrors[GLTF_LOG_BUFFER_SIZE - 1] = '\0'; // ensure null-termination
+		if (found < 0) break;
+		parent = found;
+	}
+}
+
+/// @brief records an error in the context of the calling thread parse
+/// @param code what kind of failure it is
+/// @param tkindex the json token it has happened at, -1 when it's not tied to a token
+/// @param offset the byte offset into the json it has happened at, -1 when it's not tied to the json, ignored when tkindex is valid
+/// @param format the printf format of the message
+/// @param args the message arguments
+static void internal_log_record(GLTF_ErrorCode code, int tkindex, long long offset, const char* format, va_list args) {
+	internal_parse_state* state = s_gState;
+	GLTF_Context* context = state ? state->context : &s_gContext;
+
+	GLTF_Error error;
+	error.code = code;
+	error.offset = offset;
+	error.path[0] = '\0';
+	vsnprintf(error.message, GLTF_ERROR_MESSAGE_SIZE, format, args);
+
+	if (state && state->tokens && tkindex >= 0 && tkindex < state->tokensCount) {
+		error.offset = state->tokens[tkindex].start;
+		internal_token_path(state->json, state->tokens, state->tokensCount, tkindex, error.path, GLTF_ERROR_PATH_SIZE);
+	}
+
+	if (context->errorsCount < GLTF_MAX_ERRORS) {
+		context->errors[context->errorsCount] = error;
 	}
+	context->errorsCount++;
+
+	// the log keeps the messages along with where they've happened
+	unsigned long long length = strlen(context->log);
+	if (length > 0) internal_append(context->log, &length, GLTF_LOG_BUFFER_SIZE, "\n");
+	internal_append(context->log, &length, GLTF_LOG_BUFFER_SIZE, "%s", error.message);
+	if (error.path[0]) internal_append(context->log, &length, GLTF_LOG_BUFFER_SIZE, " (at %s, byte %lld)", error.path, error.offset);
+	else if (error.offset >= 0) internal_append(context->log, &length, GLTF_LOG_BUFFER_SIZE, " (at byte %lld)", error.offset);
+}
+
+/// @brief records an error that isn't tied to the json
+/// @param code what kind of failure it is
+/// @param format the printf format of the message
+static void internal_log_error(GLTF_ErrorCode code, const char* format, ...) {
+	va_list args;
+	va_start(args, format);
+	internal_log_record(code, -1, -1, format, args);
+	va_end(args);
+}
+
+/// @brief records an error at a json token, the context gets it's byte offset and json path
+/// @param code what kind of failure it is
+/// @param tkindex the json token index
+/// @param format the printf format of the message
+static void internal_log_error_at(GLTF_ErrorCode code, int tkindex, const char* format, ...) {
+	va_list args;
+	va_start(args, format);
+	internal_log_record(code, tkindex, -1, format, args);
+	va_end(args);
+}
+
+/// @brief records an error at a byte offset of the json
+/// @param code what kind of failure it is
+/// @param offset the byte offset into the json
+/// @param format the printf format of the message
+static void internal_log_error_offset(GLTF_ErrorCode code, long long offset, const char* format, ...) {
+	va_list args;
+	va_start(args, format);
+	internal_log_record(code, -1, offset, format, args);
 	va_end(args);
 }
 
-// @brief assertions
+// @brief assertions, they're reported at the json token tkindex of the function they're used in
 #ifdef GLTF_ENABLE_ASSERTS
 #include <assert.h>
-#define GLTF_ASSERT(exp, msg) \
+#define GLTF_ASSERT(exp, code, msg) \
     do { \
         if (!(exp)) { \
-			internal_log_error(msg); \
+			internal_log_error_at(code, tkindex, "%s", msg); \
             fprintf(stderr, "[GLTF:Assertion] %s\n", msg); \
             abort(); \
         } \
     } while (0)
 #else
-#define GLTF_ASSERT(exp, msg) \
+#define GLTF_ASSERT(exp, code, msg) \
 	if(!(exp)) { \
-		internal_log_error(msg); \
+		internal_log_error_at(code, tkindex, "%s", msg); \
 		return -1; \
 	}
 #endif
@@ -75,13 +216,27 @@ void internal_log_error(const char* format, ...) {
 /// @macro for converting index into a pointer 
 #define PTR_TO_INDEX(type, idx) (type*)((unsigned long long)idx + 1)
 
+/// @macro reads the json index at tkindex into a pointer that PTR_FIX resolves later, a non integer or negative index fails the parse
+#define JSON_READ_INDEX(var, type) do { \
+	int index = 0; \
+	GLTF_ASSERT(json_read_int(data, tokens + tkindex, &index) && index >= 0, ErrorCode_InvalidDocument, "Invalid json index"); \
+	var = PTR_TO_INDEX(type, index); \
+} while (0)
+
+/// @macro reads the json integer at tkindex into an enum, a non integer fails the parse
+#define JSON_READ_ENUM(var, type) do { \
+	int value = 0; \
+	GLTF_ASSERT(json_read_int(data, tokens + tkindex, &value), ErrorCode_InvalidDocument, "Invalid json integer"); \
+	var = (type)value; \
+} while (0)
+
 /// @macro null check, bounds check and pointer adjustment.
 #define PTR_FIX(var, data, size) do { \
     if (var) { \
-        unsigned long long index = (size_t)((uintptr_t)var - 1); \
+        unsigned long long index = (unsigned long long)((uintptr_t)var - 1); \
         if (index >= size) { \
-            internal_log_error("Invalid pointer index %zu (max %zu)", index, size); \
-            return 0; \
+            internal_log_error(ErrorCode_InvalidDocument, "Invalid pointer index %llu (max %llu)", index, (unsigned long long)(size)); \
+            return -1; \
         } \
         var = &(data)[index]; \
     } \
@@ -89,14 +244,396 @@ void internal_log_error(const char* format, ...) {
 
 /// @macro same as PTR_FIX but enforces not nullptr, for required fields
 #define PTR_FIX_REQUIRED(var, data, size) do { \
-    size_t index = (size_t)((uintptr_t)var - 1); \
+    unsigned long long index = (unsigned long long)((uintptr_t)var - 1); \
     if (!var || index >= size) { \
-        internal_log_error("Required pointer invalid (index %zu, max %zu)", index, size); \
-        return 0; \
+        internal_log_error(ErrorCode_InvalidDocument, "Required pointer invalid (index %llu, max %llu)", index, (unsigned long long)(size)); \
+        return -1; \
     } \
     var = &(data)[index]; \
 } while (0)
 
+/// @macro PTR_FIX into a section that may have been skipped, the pointer is cleared when it was, an invalid index into a built section still fails the parse.
+#define PTR_FIX_SECTION(var, data, size, built) do { \
+    if (!(built)) var = NULL; \
+    else PTR_FIX(var, data, size); \
+} while (0)
+
+/// @macro PTR_FIX_REQUIRED into a section that may have been skipped, the pointer is cleared when it was, a missing or invalid index into a built section still fails the parse.
+#define PTR_FIX_REQUIRED_SECTION(var, data, size, built) do { \
+    if (!(built)) var = NULL; \
+    else PTR_FIX_REQUIRED(var, data, size); \
+} while (0)
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// json keys
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief every json key and enum string the parser understands, resolved once per token by internal_json_key_lookup
+typedef enum {
+	JsonKey_Unknown = 0,
+	JsonKey_Accessors,
+	JsonKey_AlphaCutoff,
+	JsonKey_AlphaMode,
+	JsonKey_Animations,
+	JsonKey_AspectRatio,
+	JsonKey_Asset,
+	JsonKey_Attributes,
+	JsonKey_BaseColorFactor,
+	JsonKey_BaseColorTexture,
+	JsonKey_Blend,
+	JsonKey_Buffer,
+	JsonKey_Buffers,
+	JsonKey_BufferView,
+	JsonKey_BufferViews,
+	JsonKey_ByteLength,
+	JsonKey_ByteOffset,
+	JsonKey_ByteStride,
+	JsonKey_Camera,
+	JsonKey_Cameras,
+	JsonKey_Channels,
+	JsonKey_Children,
+	JsonKey_ComponentType,
+	JsonKey_Copyright,
+	JsonKey_Count,
+	JsonKey_CubicSpline,
+	JsonKey_DoubleSided,
+	JsonKey_EmissiveFactor,
+	JsonKey_EmissiveTexture,
+	JsonKey_Extensions,
+	JsonKey_ExtensionsRequired,
+	JsonKey_ExtensionsUsed,
+	JsonKey_Extras,
+	JsonKey_Generator,
+	JsonKey_Images,
+	JsonKey_Index,
+	JsonKey_Indices,
+	JsonKey_Input,
+	JsonKey_Interpolation,
+	JsonKey_InverseBindMatrices,
+	JsonKey_Joints,
+	JsonKey_Linear,
+	JsonKey_MagFilter,
+	JsonKey_Mask,
+	JsonKey_Mat2,
+	JsonKey_Mat3,
+	JsonKey_Mat4,
+	JsonKey_Material,
+	JsonKey_Materials,
+	JsonKey_Matrix,
+	JsonKey_Max,
+	JsonKey_Mesh,
+	JsonKey_Meshes,
+	JsonKey_MetallicFactor,
+	JsonKey_MetallicRoughnessTexture,
+	JsonKey_MimeType,
+	JsonKey_Min,
+	JsonKey_MinFilter,
+	JsonKey_MinVersion,
+	JsonKey_Mode,
+	JsonKey_Name,
+	JsonKey_Node,
+	JsonKey_Nodes,
+	JsonKey_Normalized,
+	JsonKey_NormalTexture,
+	JsonKey_OcclusionTexture,
+	JsonKey_Opaque,
+	JsonKey_Orthographic,
+	JsonKey_Output,
+	JsonKey_Path,
+	JsonKey_PbrMetallicRoughness,
+	JsonKey_Perspective,
+	JsonKey_Primitives,
+	JsonKey_Rotation,
+	JsonKey_RoughnessFactor,
+	JsonKey_Sampler,
+	JsonKey_Samplers,
+	JsonKey_Scalar,
+	JsonKey_Scale,
+	JsonKey_Scene,
+	JsonKey_Scenes,
+	JsonKey_Skeleton,
+	JsonKey_Skin,
+	JsonKey_Skins,
+	JsonKey_Source,
+	JsonKey_Sparse,
+	JsonKey_Step,
+	JsonKey_Strength,
+	JsonKey_Target,
+	JsonKey_Targets,
+	JsonKey_TexCoord,
+	JsonKey_Textures,
+	JsonKey_Translation,
+	JsonKey_Type,
+	JsonKey_Uri,
+	JsonKey_Values,
+	JsonKey_Vec2,
+	JsonKey_Vec3,
+	JsonKey_Vec4,
+	JsonKey_Version,
+	JsonKey_Weights,
+	JsonKey_WrapS,
+	JsonKey_WrapT,
+	JsonKey_Xmag,
+	JsonKey_Yfov,
+	JsonKey_Ymag,
+	JsonKey_Zfar,
+	JsonKey_Znear,
+} internal_json_key;
+
+/// @brief resolves a json string token to its key with a switch on the length and the first character,
+/// so each token costs a single exact-length compare no matter how many keys the object schema has
+/// @param data the json entire data
+/// @param tok the json token to read
+/// @return the matching key, JsonKey_Unknown if the token is not a string or not a known key
+static internal_json_key internal_json_key_lookup(const char* data, const jsmntok_t* tok) {
+	if (tok->type != JSMN_STRING) return JsonKey_Unknown;
+
+	const char* str = data + tok->start;
+	switch (tok->end - tok->start)
+	{
+	case 3:
+		switch (str[0])
+		{
+		case 'm':
+			if (gltfmemory_cmp(str, "max", 3) == 0) return JsonKey_Max;
+			if (gltfmemory_cmp(str, "min", 3) == 0) return JsonKey_Min;
+			break;
+		case 'u': if (gltfmemory_cmp(str, "uri", 3) == 0) return JsonKey_Uri; break;
+		}
+		break;
+	case 4:
+		switch (str[0])
+		{
+		case 'M':
+			if (gltfmemory_cmp(str, "MASK", 4) == 0) return JsonKey_Mask;
+			if (gltfmemory_cmp(str, "MAT2", 4) == 0) return JsonKey_Mat2;
+			if (gltfmemory_cmp(str, "MAT3", 4) == 0) return JsonKey_Mat3;
+			if (gltfmemory_cmp(str, "MAT4", 4) == 0) return JsonKey_Mat4;
+			break;
+		case 'S': if (gltfmemory_cmp(str, "STEP", 4) == 0) return JsonKey_Step; break;
+		case 'V':
+			if (gltfmemory_cmp(str, "VEC2", 4) == 0) return JsonKey_Vec2;
+			if (gltfmemory_cmp(str, "VEC3", 4) == 0) return JsonKey_Vec3;
+			if (gltfmemory_cmp(str, "VEC4", 4) == 0) return JsonKey_Vec4;
+			break;
+		case 'm':
+			if (gltfmemory_cmp(str, "mesh", 4) == 0) return JsonKey_Mesh;
+			if (gltfmemory_cmp(str, "mode", 4) == 0) return JsonKey_Mode;
+			break;
+		case 'n':
+			if (gltfmemory_cmp(str, "name", 4) == 0) return JsonKey_Name;
+			if (gltfmemory_cmp(str, "node", 4) == 0) return JsonKey_Node;
+			break;
+		case 'p': if (gltfmemory_cmp(str, "path", 4) == 0) return JsonKey_Path; break;
+		case 's': if (gltfmemory_cmp(str, "skin", 4) == 0) return JsonKey_Skin; break;
+		case 't': if (gltfmemory_cmp(str, "type", 4) == 0) return JsonKey_Type; break;
+		case 'x': if (gltfmemory_cmp(str, "xmag", 4) == 0) return JsonKey_Xmag; break;
+		case 'y':
+			if (gltfmemory_cmp(str, "yfov", 4) == 0) return JsonKey_Yfov;
+			if (gltfmemory_cmp(str, "ymag", 4) == 0) return JsonKey_Ymag;
+			break;
+		case 'z': if (gltfmemory_cmp(str, "zfar", 4) == 0) return JsonKey_Zfar; break;
+		}
+		break;
+	case 5:
+		switch (str[0])
+		{
+		case 'B': if (gltfmemory_cmp(str, "BLEND", 5) == 0) return JsonKey_Blend; break;
+		case 'a': if (gltfmemory_cmp(str, "asset", 5) == 0) return JsonKey_Asset; break;
+		case 'c': if (gltfmemory_cmp(str, "count", 5) == 0) return JsonKey_Count; break;
+		case 'i':
+			if (gltfmemory_cmp(str, "index", 5) == 0) return JsonKey_Index;
+			if (gltfmemory_cmp(str, "input", 5) == 0) return JsonKey_Input;
+			break;
+		case 'n': if (gltfmemory_cmp(str, "nodes", 5) == 0) return JsonKey_Nodes; break;
+		case 's':
+			if (gltfmemory_cmp(str, "scale", 5) == 0) return JsonKey_Scale;
+			if (gltfmemory_cmp(str, "scene", 5) == 0) return JsonKey_Scene;
+			if (gltfmemory_cmp(str, "skins", 5) == 0) return JsonKey_Skins;
+			break;
+		case 'w':
+			if (gltfmemory_cmp(str, "wrapS", 5) == 0) return JsonKey_WrapS;
+			if (gltfmemory_cmp(str, "wrapT", 5) == 0) return JsonKey_WrapT;
+			break;
+		case 'z': if (gltfmemory_cmp(str, "znear", 5) == 0) return JsonKey_Znear; break;
+		}
+		break;
+	case 6:
+		switch (str[0])
+		{
+		case 'L': if (gltfmemory_cmp(str, "LINEAR", 6) == 0) return JsonKey_Linear; break;
+		case 'O': if (gltfmemory_cmp(str, "OPAQUE", 6) == 0) return JsonKey_Opaque; break;
+		case 'S': if (gltfmemory_cmp(str, "SCALAR", 6) == 0) return JsonKey_Scalar; break;
+		case 'b': if (gltfmemory_cmp(str, "buffer", 6) == 0) return JsonKey_Buffer; break;
+		case 'c': if (gltfmemory_cmp(str, "camera", 6) == 0) return JsonKey_Camera; break;
+		case 'e': if (gltfmemory_cmp(str, "extras", 6) == 0) return JsonKey_Extras; break;
+		case 'i': if (gltfmemory_cmp(str, "images", 6) == 0) return JsonKey_Images; break;
+		case 'j': if (gltfmemory_cmp(str, "joints", 6) == 0) return JsonKey_Joints; break;
+		case 'm':
+			if (gltfmemory_cmp(str, "matrix", 6) == 0) return JsonKey_Matrix;
+			if (gltfmemory_cmp(str, "meshes", 6) == 0) return JsonKey_Meshes;
+			break;
+		case 'o': if (gltfmemory_cmp(str, "output", 6) == 0) return JsonKey_Output; break;
+		case 's':
+			if (gltfmemory_cmp(str, "scenes", 6) == 0) return JsonKey_Scenes;
+			if (gltfmemory_cmp(str, "source", 6) == 0) return JsonKey_Source;
+			if (gltfmemory_cmp(str, "sparse", 6) == 0) return JsonKey_Sparse;
+			break;
+		case 't': if (gltfmemory_cmp(str, "target", 6) == 0) return JsonKey_Target; break;
+		case 'v': if (gltfmemory_cmp(str, "values", 6) == 0) return JsonKey_Values; break;
+		}
+		break;
+	case 7:
+		switch (str[0])
+		{
+		case 'b': if (gltfmemory_cmp(str, "buffers", 7) == 0) return JsonKey_Buffers; break;
+		case 'c': if (gltfmemory_cmp(str, "cameras", 7) == 0) return JsonKey_Cameras; break;
+		case 'i': if (gltfmemory_cmp(str, "indices", 7) == 0) return JsonKey_Indices; break;
+		case 's': if (gltfmemory_cmp(str, "sampler", 7) == 0) return JsonKey_Sampler; break;
+		case 't': if (gltfmemory_cmp(str, "targets", 7) == 0) return JsonKey_Targets; break;
+		case 'v': if (gltfmemory_cmp(str, "version", 7) == 0) return JsonKey_Version; break;
+		case 'w': if (gltfmemory_cmp(str, "weights", 7) == 0) return JsonKey_Weights; break;
+		}
+		break;
+	case 8:
+		switch (str[0])
+		{
+		case 'c':
+			if (gltfmemory_cmp(str, "channels", 8) == 0) return JsonKey_Channels;
+			if (gltfmemory_cmp(str, "children", 8) == 0) return JsonKey_Children;
+			break;
+		case 'm':
+			if (gltfmemory_cmp(str, "material", 8) == 0) return JsonKey_Material;
+			if (gltfmemory_cmp(str, "mimeType", 8) == 0) return JsonKey_MimeType;
+			break;
+		case 'r': if (gltfmemory_cmp(str, "rotation", 8) == 0) return JsonKey_Rotation; break;
+		case 's':
+			if (gltfmemory_cmp(str, "samplers", 8) == 0) return JsonKey_Samplers;
+			if (gltfmemory_cmp(str, "skeleton", 8) == 0) return JsonKey_Skeleton;
+			if (gltfmemory_cmp(str, "strength", 8) == 0) return JsonKey_Strength;
+			break;
+		case 't':
+			if (gltfmemory_cmp(str, "texCoord", 8) == 0) return JsonKey_TexCoord;
+			if (gltfmemory_cmp(str, "textures", 8) == 0) return JsonKey_Textures;
+			break;
+		}
+		break;
+	case 9:
+		switch (str[0])
+		{
+		case 'a':
+			if (gltfmemory_cmp(str, "accessors", 9) == 0) return JsonKey_Accessors;
+			if (gltfmemory_cmp(str, "alphaMode", 9) == 0) return JsonKey_AlphaMode;
+			break;
+		case 'c': if (gltfmemory_cmp(str, "copyright", 9) == 0) return JsonKey_Copyright; break;
+		case 'g': if (gltfmemory_cmp(str, "generator", 9) == 0) return JsonKey_Generator; break;
+		case 'm':
+			if (gltfmemory_cmp(str, "magFilter", 9) == 0) return JsonKey_MagFilter;
+			if (gltfmemory_cmp(str, "materials", 9) == 0) return JsonKey_Materials;
+			if (gltfmemory_cmp(str, "minFilter", 9) == 0) return JsonKey_MinFilter;
+			break;
+		}
+		break;
+	case 10:
+		switch (str[0])
+		{
+		case 'a':
+			if (gltfmemory_cmp(str, "animations", 10) == 0) return JsonKey_Animations;
+			if (gltfmemory_cmp(str, "attributes", 10) == 0) return JsonKey_Attributes;
+			break;
+		case 'b':
+			if (gltfmemory_cmp(str, "bufferView", 10) == 0) return JsonKey_BufferView;
+			if (gltfmemory_cmp(str, "byteLength", 10) == 0) return JsonKey_ByteLength;
+			if (gltfmemory_cmp(str, "byteOffset", 10) == 0) return JsonKey_ByteOffset;
+			if (gltfmemory_cmp(str, "byteStride", 10) == 0) return JsonKey_ByteStride;
+			break;
+		case 'e': if (gltfmemory_cmp(str, "extensions", 10) == 0) return JsonKey_Extensions; break;
+		case 'm': if (gltfmemory_cmp(str, "minVersion", 10) == 0) return JsonKey_MinVersion; break;
+		case 'n': if (gltfmemory_cmp(str, "normalized", 10) == 0) return JsonKey_Normalized; break;
+		case 'p': if (gltfmemory_cmp(str, "primitives", 10) == 0) return JsonKey_Primitives; break;
+		}
+		break;
+	case 11:
+		switch (str[0])
+		{
+		case 'C': if (gltfmemory_cmp(str, "CUBICSPLINE", 11) == 0) return JsonKey_CubicSpline; break;
+		case 'a':
+			if (gltfmemory_cmp(str, "alphaCutoff", 11) == 0) return JsonKey_AlphaCutoff;
+			if (gltfmemory_cmp(str, "aspectRatio", 11) == 0) return JsonKey_AspectRatio;
+			break;
+		case 'b': if (gltfmemory_cmp(str, "bufferViews", 11) == 0) return JsonKey_BufferViews; break;
+		case 'd': if (gltfmemory_cmp(str, "doubleSided", 11) == 0) return JsonKey_DoubleSided; break;
+		case 'p': if (gltfmemory_cmp(str, "perspective", 11) == 0) return JsonKey_Perspective; break;
+		case 't': if (gltfmemory_cmp(str, "translation", 11) == 0) return JsonKey_Translation; break;
+		}
+		break;
+	case 12:
+		switch (str[0])
+		{
+		case 'o': if (gltfmemory_cmp(str, "orthographic", 12) == 0) return JsonKey_Orthographic; break;
+		}
+		break;
+	case 13:
+		switch (str[0])
+		{
+		case 'c': if (gltfmemory_cmp(str, "componentType", 13) == 0) return JsonKey_ComponentType; break;
+		case 'i': if (gltfmemory_cmp(str, "interpolation", 13) == 0) return JsonKey_Interpolation; break;
+		case 'n': if (gltfmemory_cmp(str, "normalTexture", 13) == 0) return JsonKey_NormalTexture; break;
+		}
+		break;
+	case 14:
+		switch (str[0])
+		{
+		case 'e':
+			if (gltfmemory_cmp(str, "emissiveFactor", 14) == 0) return JsonKey_EmissiveFactor;
+			if (gltfmemory_cmp(str, "extensionsUsed", 14) == 0) return JsonKey_ExtensionsUsed;
+			break;
+		case 'm': if (gltfmemory_cmp(str, "metallicFactor", 14) == 0) return JsonKey_MetallicFactor; break;
+		}
+		break;
+	case 15:
+		switch (str[0])
+		{
+		case 'b': if (gltfmemory_cmp(str, "baseColorFactor", 15) == 0) return JsonKey_BaseColorFactor; break;
+		case 'e': if (gltfmemory_cmp(str, "emissiveTexture", 15) == 0) return JsonKey_EmissiveTexture; break;
+		case 'r': if (gltfmemory_cmp(str, "roughnessFactor", 15) == 0) return JsonKey_RoughnessFactor; break;
+		}
+		break;
+	case 16:
+		switch (str[0])
+		{
+		case 'b': if (gltfmemory_cmp(str, "baseColorTexture", 16) == 0) return JsonKey_BaseColorTexture; break;
+		case 'o': if (gltfmemory_cmp(str, "occlusionTexture", 16) == 0) return JsonKey_OcclusionTexture; break;
+		}
+		break;
+	case 18:
+		switch (str[0])
+		{
+		case 'e': if (gltfmemory_cmp(str, "extensionsRequired", 18) == 0) return JsonKey_ExtensionsRequired; break;
+		}
+		break;
+	case 19:
+		switch (str[0])
+		{
+		case 'i': if (gltfmemory_cmp(str, "inverseBindMatrices", 19) == 0) return JsonKey_InverseBindMatrices; break;
+		}
+		break;
+	case 20:
+		switch (str[0])
+		{
+		case 'p': if (gltfmemory_cmp(str, "pbrMetallicRoughness", 20) == 0) return JsonKey_PbrMetallicRoughness; break;
+		}
+		break;
+	case 24:
+		switch (str[0])
+		{
+		case 'm': if (gltfmemory_cmp(str, "metallicRoughnessTexture", 24) == 0) return JsonKey_MetallicRoughnessTexture; break;
+		}
+		break;
+	}
+	return JsonKey_Unknown;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // parsing GLTF objects
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -106,7 +643,9 @@ void internal_log_error(const char* format, ...) {
 /// @param tok the json token to read
 /// @return the component
 static GLTF_ComponentType internal_json_to_component_type(const char* data, const jsmntok_t* tok) {
-	int type = json_to_int(data, tok);
+	// anything that isn't an integer is reported as an invalid component type below
+	int type = 0;
+	json_read_int(data, tok, &type);
 
 	switch (type)
 	{
@@ -118,10 +657,228 @@ static GLTF_ComponentType internal_json_to_component_type(const char* data, cons
 	case 5126: return ComponentType_R32_FLOAT;
 	}
 
-	internal_log_error("An invalid component type has been parsed");
+	internal_log_error(ErrorCode_InvalidDocument, "An invalid component type has been parsed");
 	return (GLTF_ComponentType)0;
 }
 
+/// @brief parses a json array of floats, logging the element that is wrong
+/// @param data the json entire data
+/// @param tokens the json tokens
+/// @param tkindex the json array token index
+/// @param outArray the output floats
+/// @param size how many floats the array must have
+/// @param exact 1 when the array must have exactly size floats, 0 when it may have any count of them and only the first size are kept
+/// @return the next token index to be analyzed
+static int internal_parse_float_array(const char* data, const jsmntok_t* tokens, int tkindex, float* outArray, int size, int exact) {
+	int next = exact ? json_parse_array_float(data, tokens, tkindex, outArray, size) : json_parse_array_float_partial(data, tokens, tkindex, outArray, size);
+	if (next < 0) {
+		if (exact) internal_log_error_at(ErrorCode_InvalidDocument, tkindex, "Expected an array of %d numbers", size);
+		else internal_log_error_at(ErrorCode_InvalidDocument, tkindex, "Expected an array of numbers");
+	}
+	return next;
+}
+
+/// @brief parses one element of an array, see internal_parse_elements
+typedef int (*internal_element_parser)(const char* data, const jsmntok_t* tokens, int tkindex, void* outElement);
+
+/// @brief a range of array elements parsed by a single task of internal_parse_elements
+typedef struct {
+	unsigned long long first;
+	unsigned long long last;
+	GLTF_Arena* arena;                  // what the elements allocates, merged into the parse arena afterwards
+	GLTF_Context context;               // the errors of the elements, merged into the parse context afterwards
+	int failed;
+} internal_elements_chunk;
+
+/// @brief the array shared by every task of internal_parse_elements
+typedef struct {
+	const char* data;
+	const jsmntok_t* tokens;
+	const int* starts;                  // the token every element starts at
+	unsigned char* elements;
+	unsigned long long elementSize;
+	internal_element_parser parse;
+	const internal_parse_state* state;
+	internal_elements_chunk* chunks;
+	volatile long long failedChunk;     // the first chunk that has failed so far, the chunks after it are not parsed
+} internal_elements_work;
+
+/// @brief appends the errors of a context to another one
+/// @param context where the errors are appended
+/// @param other the errors to append
+static void internal_context_merge(GLTF_Context* context, const GLTF_Context* other) {
+	unsigned int kept = other->errorsCount < GLTF_MAX_ERRORS ? other->errorsCount : GLTF_MAX_ERRORS;
+	for (unsigned int i = 0; i < kept && context->errorsCount + i < GLTF_MAX_ERRORS; ++i) {
+		context->errors[context->errorsCount + i] = other->errors[i];
+	}
+	context->errorsCount += other->errorsCount;
+
+	if (other->log[0]) {
+		unsigned long long length = strlen(context->log);
+		if (length > 0) internal_append(context->log, &length, GLTF_LOG_BUFFER_SIZE, "\n");
+		internal_append(context->log, &length, GLTF_LOG_BUFFER_SIZE, "%s", other->log);
+	}
+}
+
+/// @brief parses a chunk of array elements, may run on any thread
+/// @param taskData the internal_elements_work
+/// @param index which chunk to parse
+static void internal_elements_task(void* taskData, unsigned long long index) {
+	internal_elements_work* work = (internal_elements_work*)taskData;
+	internal_elements_chunk* chunk = work->chunks + index;
+
+	// the chunk is parsed like the rest of the document, but it allocates and logs on it's own so no locking is needed
+	internal_parse_state state = *work->state;
+	state.arena = &chunk->arena;
+	state.context = &chunk->context;
+	state.previous = s_gState;
+	s_gState = &state;
+
+	chunk->arena = gltfarena_create(&state.options.allocator);
+	if (!chunk->arena) {
+		internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for the parsed data");
+		chunk->failed = 1;
+	}
+
+	// once an earlier chunk has failed nothing after it is reported, so there's no point in parsing it
+	for (unsigned long long j = chunk->first; j < chunk->last && !chunk->failed; ++j) {
+		if (platform_atomic_add(&work->failedChunk, 0) < (long long)index) break;
+		if (work->parse(work->data, work->tokens, work->starts[j], work->elements + j * work->elementSize) < 0) chunk->failed = 1;
+	}
+
+	if (chunk->failed) platform_atomic_min(&work->failedChunk, (long long)index);
+	internal_parse_end(&state);
+}
+
+/// @brief parses the elements of an array already allocated by json_parse_array, big arrays are split across threads when the options allows it
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the token of the first element
+/// @param count how many elements the array has
+/// @param elementSize the size of each element
+/// @param elements the array elements
+/// @param parse parses a single element
+/// @return the next token index to be analyzed
+static int internal_parse_elements(const char* data, const jsmntok_t* tokens, int tkindex, unsigned long long count, unsigned long long elementSize, void* elements, internal_element_parser parse) {
+	const GLTF_ParseOptions* options = &s_gState->options;
+	if (options->parseThreads <= 1 || count < GLTF_PARALLEL_ELEMENTS_MIN) {
+		for (unsigned long long j = 0; j < count; ++j) {
+			tkindex = parse(data, tokens, tkindex, (unsigned char*)elements + j * elementSize);
+			if (tkindex < 0) return tkindex;
+		}
+		return tkindex;
+	}
+
+	// the elements are independent once it's known where each one starts
+	int* starts = (int*)gltfmemory_allocate(&options->allocator, sizeof(int) * count, 0);
+	if (!starts) {
+		internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for the array elements");
+		return -1;
+	}
+
+	for (unsigned long long j = 0; j < count; ++j) {
+		starts[j] = tkindex;
+		tkindex = json_parse_skip(tokens, tkindex);
+	}
+
+	// a few chunks per thread keeps them busy when some elements are heavier than others
+	unsigned long long chunkSize = count / ((unsigned long long)options->parseThreads * 4);
+	if (chunkSize < GLTF_PARALLEL_ELEMENTS_MIN / 4) chunkSize = GLTF_PARALLEL_ELEMENTS_MIN / 4;
+	unsigned long long chunksCount = (count + chunkSize - 1) / chunkSize;
+
+	internal_elements_chunk* chunks = (internal_elements_chunk*)gltfmemory_allocate(&options->allocator, sizeof(internal_elements_chunk) * chunksCount, 0);
+	if (!chunks) {
+		gltfmemory_deallocate(&options->allocator, starts);
+		internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for the array elements");
+		return -1;
+	}
+
+	for (unsigned long long c = 0; c < chunksCount; ++c) {
+		chunks[c].first = c * chunkSize;
+		chunks[c].last = c * chunkSize + chunkSize < count ? c * chunkSize + chunkSize : count;
+		chunks[c].arena = NULL;
+		chunks[c].context.errorsCount = 0;
+		chunks[c].context.log[0] = '\0';
+		chunks[c].failed = 0;
+	}
+
+	internal_elements_work work;
+	work.data = data;
+	work.tokens = tokens;
+	work.starts = starts;
+	work.elements = (unsigned char*)elements;
+	work.elementSize = elementSize;
+	work.parse = parse;
+	work.state = s_gState;
+	work.chunks = chunks;
+	work.failedChunk = (long long)chunksCount;
+
+	if (options->taskDispatch) options->taskDispatch(options->taskUserData, internal_elements_task, &work, chunksCount);
+	else platform_parallel_for(options->parseThreads, chunksCount, internal_elements_task, &work, &options->allocator);
+
+	// the chunks are merged in order, so the errors are reported as if they were parsed one after the other:
+	// a sequential parse stops at the first failing element, the errors of the chunks after it are dropped but their arenas are still kept to be released
+	int failed = 0;
+	for (unsigned long long c = 0; c < chunksCount; ++c) {
+		gltfarena_merge(s_gState->arena, chunks[c].arena);
+		if (!failed) internal_context_merge(s_gState->context, &chunks[c].context);
+		failed |= chunks[c].failed;
+	}
+
+	gltfmemory_deallocate(&options->allocator, chunks);
+	gltfmemory_deallocate(&options->allocator, starts);
+	return failed ? -1 : tkindex;
+}
+
+/// @brief parses a json string, it points into the json when the parse uses string views, otherwise it's copied into the arena
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outString the output
+/// @return the next token index to be analyzed
+static int internal_parse_string(const char* data, const jsmntok_t* tokens, int tkindex, char** outString) {
+	// string views are only used when the json is a heap copy owned by the parsed data, so it can be written
+	if (s_gState->stringViews) return json_parse_string_view((char*)data, tokens, tkindex, outString);
+	return json_parse_string(data, tokens, tkindex, outString, s_gState->arena);
+}
+
+/// @brief parses a json array of strings, each one like internal_parse_string does
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param outArr the output
+/// @param outSize how many strings the array has
+/// @return the next token index to be analyzed
+static int internal_parse_string_array(const char* data, const jsmntok_t* tokens, int tkindex, char*** outArr, unsigned long long* outSize) {
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(char*), (void**)outArr, outSize, s_gState->arena);
+	for (unsigned long long j = 0; j < *outSize && tkindex >= 0; ++j) {
+		tkindex = internal_parse_string(data, tokens, tkindex, j + (*outArr));
+	}
+	return tkindex;
+}
+
+/// @brief keeps the raw json text of a token, like extras and extension objects, as a string view or an arena copy
+/// @param data the json entire data
+/// @param tok the json token to keep
+/// @return the raw json text, NULL on failure
+static char* internal_parse_raw(const char* data, const jsmntok_t* tok) {
+	unsigned long long size = tok->end - tok->start;
+
+	// the character after an object or array is a separator the tokens never look at again
+	if (s_gState->stringViews) {
+		char* raw = (char*)data + tok->start;
+		raw[size] = '\0';
+		return raw;
+	}
+
+	char* raw = (char*)gltfarena_allocate(s_gState->arena, size + 1, 0);
+	if (!raw) return NULL;
+
+	gltfmemory_copy(raw, data + tok->start, size);
+	raw[size] = '\0';
+	return raw;
+}
+
 /// @brief any extra information a gltf object may have will be dealed as a char*
 /// @param data the json entire data
 /// @param tokens the json token to read
@@ -129,18 +886,71 @@ static GLTF_ComponentType internal_json_to_component_type(const char* data, cons
 /// @param outExtra the output
 /// @return the next token index to be analyzed
 static int internal_parse_extras(const char* data, const jsmntok_t* tokens, int tkindex, char** outExtra) {
-	unsigned long long start = tokens[tkindex].start;
-	unsigned long long size = tokens[tkindex].end - start;
-	*outExtra = (char*)gltfmemory_allocate(size + 1, 0);
-	GLTF_ASSERT(outExtra, "Failed to allocate memory for extra data parsing");
-
-	strncpy_impl(*outExtra, (const char*)data + start, size);
-	(*outExtra)[size] = '\0';  // Fixed parentheses
+	*outExtra = internal_parse_raw(data, tokens + tkindex);
+	GLTF_ASSERT(*outExtra, ErrorCode_OutOfMemory, "Failed to allocate memory for extra data parsing");
 
 	tkindex = json_parse_skip(tokens, tkindex);
 	return tkindex;
 }
 
+/// @brief checks if a json string is a base64 encoded data uri
+/// @param data the json entire data
+/// @param tok the json token to check
+/// @param outPayload the index in data where the base64 characters starts
+/// @return 1 if it's a base64 data uri, 0 otherwise
+static int internal_is_base64_uri(const char* data, const jsmntok_t* tok, int* outPayload) {
+	if (tok->type != JSMN_STRING || tok->end - tok->start < 5 || gltfmemory_cmp(data + tok->start, "data:", 5) != 0) return 0;
+
+	for (int i = tok->start + 5; i < tok->end; ++i) {
+		if (data[i] != ',') continue;
+
+		// the shortest header is "data:;base64"
+		if (i - tok->start >= 12 && gltfmemory_cmp(data + i - 7, ";base64", 7) == 0) {
+			*outPayload = i + 1;
+			return 1;
+		}
+		return 0;
+	}
+	return 0;
+}
+
+/// @brief decodes a base64 data uri straight from the json data into it's own storage, without copying the uri
+/// @param data the json entire data
+/// @param tokens the json token to read
+/// @param tkindex the json token index
+/// @param payload the index in data where the base64 characters starts
+/// @param outStorage the decoded data
+/// @param outMimeType the mime type the uri declares, NULL if not wanted
+/// @return the next token index to be analyzed
+static int internal_parse_base64_uri(const char* data, const jsmntok_t* tokens, int tkindex, int payload, GLTF_Storage* outStorage, char** outMimeType) {
+	unsigned long long length = tokens[tkindex].end - payload;
+	void* decoded = gltfmemory_allocate(&s_gState->options.allocator, base64_decoded_size(length), 0);
+	GLTF_ASSERT(decoded, ErrorCode_OutOfMemory, "Failed to allocate memory for a base64 data uri");
+
+	unsigned long long size = 0;
+	if (!base64_decode(data + payload, length, decoded, &size)) {
+		gltfmemory_deallocate(&s_gState->options.allocator, decoded);
+		internal_log_error(ErrorCode_InvalidDocument, "Invalid base64 data uri");
+		return -1;
+	}
+
+	outStorage->data = decoded;
+	outStorage->size = size;
+	outStorage->type = StorageType_Heap;
+
+	// the mime type sits between "data:" and ";base64"
+	unsigned long long mimeLength = payload - 8 - (tokens[tkindex].start + 5);
+	if (outMimeType && mimeLength > 0) {
+		*outMimeType = (char*)gltfarena_allocate(s_gState->arena, mimeLength + 1, 0);
+		GLTF_ASSERT(*outMimeType, ErrorCode_OutOfMemory, "Failed to allocate memory for a data uri mime type");
+
+		strncpy_impl(*outMimeType, data + tokens[tkindex].start + 5, mimeLength);
+		(*outMimeType)[mimeLength] = '\0';
+	}
+
+	return tkindex + 1;
+}
+
 /// @brief parses the extensions that are not processed yet
 /// @param data the json entire data
 /// @param tokens the json token to read
@@ -148,24 +958,15 @@ static int internal_parse_extras(const char* data, const jsmntok_t* tokens, int
 /// @param outExtension the output extension info
 /// @return the next token index to be analyzed
 static int internal_parse_unprocessed_extension(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Extension* outExtension) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING, "Unpprocessed extension token is not a string");
-	GLTF_ASSERT(tokens[tkindex + 1].type == JSMN_OBJECT, "Unprocessed extension token value is not an object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING, ErrorCode_InvalidDocument, "Unpprocessed extension token is not a string");
+	GLTF_ASSERT(tokens[tkindex + 1].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "Unprocessed extension token value is not an object");
 
-	unsigned long long nameLength = tokens[tkindex].end - tokens[tkindex].start;
-	outExtension->name = (char*)gltfmemory_allocate(nameLength + 1, 0);
-	GLTF_ASSERT(outExtension->name, "Failed to allocate memory for unprocessed extension name");
+	tkindex = internal_parse_string(data, tokens, tkindex, &outExtension->name);
+	GLTF_ASSERT(tkindex >= 0, ErrorCode_OutOfMemory, "Failed to allocate memory for unprocessed extension name");
 
-	strncpy_impl(outExtension->name, (const char*)data + tokens[tkindex].start, nameLength);
-	outExtension->name[nameLength] = 0;
-	tkindex++;
+	outExtension->data = internal_parse_raw(data, tokens + tkindex);
+	GLTF_ASSERT(outExtension->data, ErrorCode_OutOfMemory, "Failed to allocate memory for unprocessed extension data");
 
-	unsigned long long start = tokens[tkindex].start;
-	unsigned long long size = tokens[tkindex].end - start;
-	outExtension->data = (char*)gltfmemory_allocate(size + 1, 0);
-	GLTF_ASSERT(outExtension->data, "Failed to allocate memory for unprocessed extension data");
-
-	strncpy_impl(outExtension->data, (const char*)data + start, size);
-	outExtension->data[size] = '\0';
 	tkindex = json_parse_skip(tokens, tkindex);
 	return tkindex;
 }
@@ -179,16 +980,16 @@ static int internal_parse_unprocessed_extension(const char* data, const jsmntok_
 /// @return the next token index to be analyzed
 static int internal_parse_unprocessed_extensions(const char* data, const jsmntok_t* tokens, int tkindex, unsigned long long* outextensionsCount, GLTF_Extension** outExtensions) {
 	++tkindex;
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 
 	int extensionsSize = tokens[tkindex].size;
 	*outextensionsCount = 0;
-	*outExtensions = (GLTF_Extension*)gltfmemory_allocate(sizeof(GLTF_Extension) * extensionsSize, 0);
-	GLTF_ASSERT((*outExtensions), "Failed to allocate memory for extensions");
+	*outExtensions = (GLTF_Extension*)gltfarena_allocate(s_gState->arena, sizeof(GLTF_Extension) * extensionsSize, 0);
+	GLTF_ASSERT((*outExtensions), ErrorCode_OutOfMemory, "Failed to allocate memory for extensions");
 
 	++tkindex;
 	for (int j = 0; j < extensionsSize; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
 		unsigned long long extensionIndex = (*outextensionsCount)++;
 		GLTF_Extension* extension = &((*outExtensions)[extensionIndex]);
@@ -206,37 +1007,39 @@ static int internal_parse_unprocessed_extensions(const char* data, const jsmntok
 /// @param outAccessor the output acessor
 /// @return the next token index to be analyzed
 static int internal_json_parse_accessor_sparse(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_SparseAccessor* outAccessor) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
 	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "count") == 0) { 
-			++tkindex; outAccessor->count = json_to_size(data, tokens + tkindex); ++tkindex; 
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Count) { 
+			++tkindex; GLTF_ASSERT(json_read_size(data, tokens + tkindex, &outAccessor->count), ErrorCode_InvalidDocument, "Invalid json number"); ++tkindex; 
 		}
-		else if (json_strncmp(data, tokens + tkindex, "indices") == 0) {
+		else if (key == JsonKey_Indices) {
 			++tkindex;
-			GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+			GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 
 			int indicesSize = tokens[tkindex].size;
 			++tkindex;
 
 			for (int k = 0; k < indicesSize; ++k) {
-				GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+				GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-				if (json_strncmp(data, tokens + tkindex, "bufferView") == 0) {
+				const internal_json_key subkey = internal_json_key_lookup(data, tokens + tkindex);
+				if (subkey == JsonKey_BufferView) {
 					++tkindex;
-					outAccessor->indicesBufferView = PTR_TO_INDEX(GLTF_BufferView, json_to_int(data, tokens + tkindex)); 
+					JSON_READ_INDEX(outAccessor->indicesBufferView, GLTF_BufferView); 
 					++tkindex;
 				}
-				else if (json_strncmp(data, tokens + tkindex, "byteOffset") == 0) { 
+				else if (subkey == JsonKey_ByteOffset) { 
 					++tkindex;
-					outAccessor->indicesByteOffset = json_to_size(data, tokens + tkindex);
+					GLTF_ASSERT(json_read_size(data, tokens + tkindex, &outAccessor->indicesByteOffset), ErrorCode_InvalidDocument, "Invalid json number");
 					++tkindex;
 				}
-				else if (json_strncmp(data, tokens + tkindex, "componentType") == 0) {
+				else if (subkey == JsonKey_ComponentType) {
 					++tkindex;
 					outAccessor->indicesComponentType = internal_json_to_component_type(data, tokens + tkindex);
 					++tkindex;
@@ -248,24 +1051,25 @@ static int internal_json_parse_accessor_sparse(const char* data, const jsmntok_t
 				if (tkindex < 0) return tkindex;
 			}
 		}
-		else if (json_strncmp(data, tokens + tkindex, "values") == 0) {
+		else if (key == JsonKey_Values) {
 			++tkindex;
-			GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+			GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 
 			int valuesSize = tokens[tkindex].size;
 			++tkindex;
 
 			for (int k = 0; k < valuesSize; ++k) {
-				GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+				GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-				if (json_strncmp(data, tokens + tkindex, "bufferView") == 0) { 
+				const internal_json_key subkey = internal_json_key_lookup(data, tokens + tkindex);
+				if (subkey == JsonKey_BufferView) { 
 					++tkindex; 
-					outAccessor->valuesBufferView = PTR_TO_INDEX(GLTF_BufferView, json_to_int(data, tokens + tkindex)); 
+					JSON_READ_INDEX(outAccessor->valuesBufferView, GLTF_BufferView); 
 					++tkindex;
 				}
-				else if (json_strncmp(data, tokens + tkindex, "byteOffset") == 0) { 
+				else if (subkey == JsonKey_ByteOffset) { 
 					++tkindex;
-					outAccessor->valueByteOffset = json_to_size(data, tokens + tkindex);
+					GLTF_ASSERT(json_read_size(data, tokens + tkindex, &outAccessor->valueByteOffset), ErrorCode_InvalidDocument, "Invalid json number");
 					++tkindex;
 				}
 				else { 
@@ -291,84 +1095,86 @@ static int internal_json_parse_accessor_sparse(const char* data, const jsmntok_t
 /// @param outAccessor the output acessor
 /// @return the next token index to be analyzed
 static int internal_parse_json_accessor(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Accessor* outAccessor) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
 	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outAccessor->name);
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) { 
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outAccessor->name);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "bufferView") == 0) { 
+		else if (key == JsonKey_BufferView) { 
 			++tkindex;
-			outAccessor->bufferView = PTR_TO_INDEX(GLTF_BufferView, json_to_int(data, tokens + tkindex));
+			JSON_READ_INDEX(outAccessor->bufferView, GLTF_BufferView);
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "byteOffset") == 0) {
+		else if (key == JsonKey_ByteOffset) {
 			++tkindex;
-			outAccessor->offset = json_to_size(data, tokens + tkindex); 
+			GLTF_ASSERT(json_read_size(data, tokens + tkindex, &outAccessor->offset), ErrorCode_InvalidDocument, "Invalid json number"); 
 			++tkindex; 
 		}
-		else if (json_strncmp(data, tokens + tkindex, "componentType") == 0) {
+		else if (key == JsonKey_ComponentType) {
 			++tkindex; 
 			outAccessor->componentType = internal_json_to_component_type(data, tokens + tkindex); 
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "normalized") == 0) { 
+		else if (key == JsonKey_Normalized) { 
 			++tkindex;
 			outAccessor->normalized = json_to_bool(data, tokens + tkindex); 
 			++tkindex; 
 		}
-		else if (json_strncmp(data, tokens + tkindex, "count") == 0) { 
+		else if (key == JsonKey_Count) { 
 			++tkindex;
-			outAccessor->count = json_to_size(data, tokens + tkindex); 
+			GLTF_ASSERT(json_read_size(data, tokens + tkindex, &outAccessor->count), ErrorCode_InvalidDocument, "Invalid json number"); 
 			++tkindex; 
 		}
-		else if (json_strncmp(data, tokens + tkindex, "type") == 0) {
+		else if (key == JsonKey_Type) {
 			++tkindex;
-			if (json_strncmp(data, tokens + tkindex, "SCALAR") == 0) {
+			const internal_json_key value = internal_json_key_lookup(data, tokens + tkindex);
+			if (value == JsonKey_Scalar) {
 				outAccessor->type = Type_Scalar; 
 			}
-			else if (json_strncmp(data, tokens + tkindex, "VEC2") == 0) { 
+			else if (value == JsonKey_Vec2) { 
 				outAccessor->type = Type_Vec2;
 			}
-			else if (json_strncmp(data, tokens + tkindex, "VEC3") == 0) { 
+			else if (value == JsonKey_Vec3) { 
 				outAccessor->type = Type_Vec3;
 			}
-			else if (json_strncmp(data, tokens + tkindex, "VEC4") == 0) { 
+			else if (value == JsonKey_Vec4) { 
 				outAccessor->type = Type_Vec4;
 			}
-			else if (json_strncmp(data, tokens + tkindex, "MAT2") == 0) {
+			else if (value == JsonKey_Mat2) {
 				outAccessor->type = Type_Mat2; 
 			}
-			else if (json_strncmp(data, tokens + tkindex, "MAT3") == 0) { 
+			else if (value == JsonKey_Mat3) { 
 				outAccessor->type = Type_Mat3; 
 			}
-			else if (json_strncmp(data, tokens + tkindex, "MAT4") == 0) {
+			else if (value == JsonKey_Mat4) {
 				outAccessor->type = Type_Mat4;
 			}
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "sparse") == 0) { 
+		else if (key == JsonKey_Sparse) { 
 			outAccessor->isSparse = 1;
 			tkindex = internal_json_parse_accessor_sparse(data, tokens, tkindex + 1, &outAccessor->sparse);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "min") == 0) { 
+		else if (key == JsonKey_Min) { 
 			++tkindex; 
 			outAccessor->hasMin = 1;
-			tkindex = json_parse_array_float(data, tokens, tkindex, outAccessor->min, tokens[tkindex].size > 16 ? 16 : tokens[tkindex].size);
+			tkindex = internal_parse_float_array(data, tokens, tkindex, outAccessor->min, 16, 0);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "max") == 0) { 
+		else if (key == JsonKey_Max) { 
 			++tkindex;
 			outAccessor->hasMax = 1;
-			tkindex = json_parse_array_float(data, tokens, tkindex, outAccessor->max, tokens[tkindex].size > 16 ? 16 : tokens[tkindex].size);
+			tkindex = internal_parse_float_array(data, tokens, tkindex, outAccessor->max, 16, 0);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) { 
+		else if (key == JsonKey_Extras) { 
 			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outAccessor->extras);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
+		else if (key == JsonKey_Extensions) {
 			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outAccessor->extensionsCount, &outAccessor->extensions);
 		}
 		else { 
@@ -381,6 +1187,11 @@ static int internal_parse_json_accessor(const char* data, const jsmntok_t* token
 	return tkindex;
 }
 
+/// @brief internal_parse_json_accessor for internal_parse_elements
+static int internal_parse_json_accessor_element(const char* data, const jsmntok_t* tokens, int tkindex, void* outElement) {
+	return internal_parse_json_accessor(data, tokens, tkindex, (GLTF_Accessor*)outElement);
+}
+
 /// @brief parses the accessors field
 /// @param data the json entire data
 /// @param tokens the json token to read
@@ -388,14 +1199,10 @@ static int internal_parse_json_accessor(const char* data, const jsmntok_t* token
 /// @param outData the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_accessors(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Accessor), (void**)&outData->accessors, &outData->accessorsCount);
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Accessor), (void**)&outData->accessors, &outData->accessorsCount, s_gState->arena);
 	if (tkindex < 0) return tkindex;
 
-	for (unsigned long long j = 0; j < outData->accessorsCount; ++j) {
-		tkindex = internal_parse_json_accessor(data, tokens, tkindex, &outData->accessors[j]);
-		if (tkindex < 0) return tkindex;
-	}
-	return tkindex;
+	return internal_parse_elements(data, tokens, tkindex, outData->accessorsCount, sizeof(GLTF_Accessor), outData->accessors, internal_parse_json_accessor_element);
 }
 
 /// @brief parses the asset structure
@@ -405,29 +1212,30 @@ static int internal_parse_accessors(const char* data, const jsmntok_t* tokens, i
 /// @param outAsset the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_asset(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Asset* outAsset) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
 	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "copyright") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outAsset->copyright); 
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Copyright) { 
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outAsset->copyright); 
 		}
-		else if (json_strncmp(data, tokens + tkindex, "generator") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outAsset->generator);
+		else if (key == JsonKey_Generator) { 
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outAsset->generator);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "version") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outAsset->version);
+		else if (key == JsonKey_Version) { 
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outAsset->version);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "minVersion") == 0) {
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outAsset->minVersion);
+		else if (key == JsonKey_MinVersion) {
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outAsset->minVersion);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
+		else if (key == JsonKey_Extras) {
 			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outAsset->extras);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
+		else if (key == JsonKey_Extensions) {
 			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outAsset->extensionsCount, &outAsset->extensions);
 		}
 		else {
@@ -436,10 +1244,22 @@ static int internal_parse_asset(const char* data, const jsmntok_t* tokens, int t
 
 		if (tkindex < 0) return tkindex;
 	}
-	GLTF_ASSERT(!(outAsset->version && atof(outAsset->version) < 2), "Legacy GLTF is not supported");
 	return tkindex;
 }
 
+/// @brief reads the major number of an asset version, independently of the current locale
+/// @param version the version string, like "2.0"
+/// @return the major version, like 2, -1 when the version doesn't start with a digit
+static int internal_version_major(const char* version) {
+	if (version[0] < '0' || version[0] > '9') return -1;
+
+	int major = 0;
+	for (const char* c = version; *c >= '0' && *c <= '9' && major < 1000; ++c) {
+		major = major * 10 + (*c - '0');
+	}
+	return major;
+}
+
 /// @brief parses the buffer view
 /// @param data the json entire data
 /// @param tokens the json token to read
@@ -447,43 +1267,44 @@ static int internal_parse_asset(const char* data, const jsmntok_t* tokens, int t
 /// @param outBufferView the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_buffer_view(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_BufferView* outBufferView) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
 	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outBufferView->name);
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) { 
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outBufferView->name);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "buffer") == 0) {
+		else if (key == JsonKey_Buffer) {
 			++tkindex; 
-			outBufferView->buffer = PTR_TO_INDEX(GLTF_Buffer, json_to_int(data, tokens + tkindex)); 
+			JSON_READ_INDEX(outBufferView->buffer, GLTF_Buffer); 
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "byteOffset") == 0) { 
+		else if (key == JsonKey_ByteOffset) { 
 			++tkindex; 
-			outBufferView->offset = json_to_size(data, tokens + tkindex); 
+			GLTF_ASSERT(json_read_size(data, tokens + tkindex, &outBufferView->offset), ErrorCode_InvalidDocument, "Invalid json number"); 
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "byteLength") == 0) { 
-			++tkindex; outBufferView->size = json_to_size(data, tokens + tkindex); ++tkindex;
+		else if (key == JsonKey_ByteLength) { 
+			++tkindex; GLTF_ASSERT(json_read_size(data, tokens + tkindex, &outBufferView->size), ErrorCode_InvalidDocument, "Invalid json number"); ++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "byteStride") == 0) { 
+		else if (key == JsonKey_ByteStride) { 
 			++tkindex;
-			outBufferView->stride = json_to_size(data, tokens + tkindex);
+			GLTF_ASSERT(json_read_size(data, tokens + tkindex, &outBufferView->stride), ErrorCode_InvalidDocument, "Invalid json number");
 			++tkindex; 
 		}
-		else if (json_strncmp(data, tokens + tkindex, "target") == 0) { 
+		else if (key == JsonKey_Target) { 
 			++tkindex; 
-			outBufferView->type = (GLTF_BufferViewType)json_to_int(data, tokens + tkindex); 
+			JSON_READ_ENUM(outBufferView->type, GLTF_BufferViewType); 
 			tkindex++;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
+		else if (key == JsonKey_Extras) {
 			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outBufferView->extras);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
+		else if (key == JsonKey_Extensions) {
 			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outBufferView->extensionsCount, &outBufferView->extensions);
 		}
 		else { 
@@ -495,6 +1316,11 @@ static int internal_parse_buffer_view(const char* data, const jsmntok_t* tokens,
 	return tkindex;
 }
 
+/// @brief internal_parse_buffer_view for internal_parse_elements
+static int internal_parse_buffer_view_element(const char* data, const jsmntok_t* tokens, int tkindex, void* outElement) {
+	return internal_parse_buffer_view(data, tokens, tkindex, (GLTF_BufferView*)outElement);
+}
+
 /// @brief parses the buffer views
 /// @param data the json entire data
 /// @param tokens the json token to read
@@ -502,14 +1328,10 @@ static int internal_parse_buffer_view(const char* data, const jsmntok_t* tokens,
 /// @param outBufferView the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_bufferviews(const char* data, const jsmntok_t* tokens, int i, GLTF2* outData) {
-	i = json_parse_array(data, tokens, i, sizeof(GLTF_BufferView), (void**)&outData->bufferViews, &outData->bufferViewsCount);
+	i = json_parse_array(data, tokens, i, sizeof(GLTF_BufferView), (void**)&outData->bufferViews, &outData->bufferViewsCount, s_gState->arena);
 	if (i < 0) return i;
 
-	for (unsigned long long j = 0; j < outData->bufferViewsCount; ++j) {
-		i = internal_parse_buffer_view(data, tokens, i, &outData->bufferViews[j]);
-		if (i < 0) return i;
-	}
-	return i;
+	return internal_parse_elements(data, tokens, i, outData->bufferViewsCount, sizeof(GLTF_BufferView), outData->bufferViews, internal_parse_buffer_view_element);
 }
 
 /// @brief parses a buffer
@@ -519,28 +1341,36 @@ static int internal_parse_bufferviews(const char* data, const jsmntok_t* tokens,
 /// @param outBuffer the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_buffer(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Buffer* outBuffer) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
 	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) {
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outBuffer->name);
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) {
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outBuffer->name);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "byteLength") == 0) {
+		else if (key == JsonKey_ByteLength) {
 			++tkindex;
-			outBuffer->size = json_to_size(data, tokens + tkindex);
+			GLTF_ASSERT(json_read_size(data, tokens + tkindex, &outBuffer->size), ErrorCode_InvalidDocument, "Invalid json number");
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "uri") == 0) {
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outBuffer->URI);
+		else if (key == JsonKey_Uri) {
+			int payload = 0;
+			if (s_gState->options.bufferMode == BufferMode_Load && internal_is_base64_uri(data, tokens + tkindex + 1, &payload)) {
+				tkindex = internal_parse_base64_uri(data, tokens, tkindex + 1, payload, &outBuffer->storage, NULL);
+				outBuffer->data = outBuffer->storage.data;
+			}
+			else {
+				tkindex = internal_parse_string(data, tokens, tkindex + 1, &outBuffer->URI);
+			}
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) { 
+		else if (key == JsonKey_Extras) { 
 			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outBuffer->extras);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
+		else if (key == JsonKey_Extensions) {
 			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outBuffer->extensionsCount, &outBuffer->extensions);
 		}
 		else { 
@@ -559,7 +1389,7 @@ static int internal_parse_buffer(const char* data, const jsmntok_t* tokens, int
 /// @param outData the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_buffers(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Buffer), (void**)&outData->buffers, &outData->buffersCount);
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Buffer), (void**)&outData->buffers, &outData->buffersCount, s_gState->arena);
 	if (tkindex < 0) return tkindex;
 
 	for (unsigned long long j = 0; j < outData->buffersCount; ++j) {
@@ -576,40 +1406,42 @@ static int internal_parse_buffers(const char* data, const jsmntok_t* tokens, int
 /// @param outSampler the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_animation_sampler(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_AnimationSampler* outSampler) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
 	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "input") == 0) { 
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Input) { 
 			++tkindex; 
-			outSampler->input = PTR_TO_INDEX(GLTF_Accessor, json_to_int(data, tokens + tkindex)); 
+			JSON_READ_INDEX(outSampler->input, GLTF_Accessor); 
 			++tkindex; 
 		}
-		else if (json_strncmp(data, tokens + tkindex, "output") == 0) { 
+		else if (key == JsonKey_Output) { 
 			++tkindex;
-			outSampler->output = PTR_TO_INDEX(GLTF_Accessor, json_to_int(data, tokens + tkindex));
+			JSON_READ_INDEX(outSampler->output, GLTF_Accessor);
 			++tkindex; 
 		}
-		else if (json_strncmp(data, tokens + tkindex, "interpolation") == 0) {
+		else if (key == JsonKey_Interpolation) {
 			++tkindex;
-			if (json_strncmp(data, tokens + tkindex, "LINEAR") == 0) {
+			const internal_json_key value = internal_json_key_lookup(data, tokens + tkindex);
+			if (value == JsonKey_Linear) {
 				outSampler->interpolation = InterpolationType_Linear;
 			}
-			else if (json_strncmp(data, tokens + tkindex, "STEP") == 0) {
+			else if (value == JsonKey_Step) {
 				outSampler->interpolation = InterpolationType_Step;
 			}
-			else if (json_strncmp(data, tokens + tkindex, "CUBICSPLINE") == 0) {
+			else if (value == JsonKey_CubicSpline) {
 				outSampler->interpolation = InterpolationType_CubicSpline; 
 			}
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) { 
+		else if (key == JsonKey_Extras) { 
 			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outSampler->extras);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) { 
+		else if (key == JsonKey_Extensions) { 
 			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outSampler->extensionsCount, &outSampler->extensions);
 		}
 		else {
@@ -628,48 +1460,51 @@ static int internal_parse_animation_sampler(const char* data, const jsmntok_t* t
 /// @param outChannel the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_animation_channel(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_AnimationChannel* outChannel) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
 	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "sampler") == 0) { 
-			++tkindex; outChannel->sampler = PTR_TO_INDEX(GLTF_AnimationSampler, json_to_int(data, tokens + tkindex));
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Sampler) { 
+			++tkindex; JSON_READ_INDEX(outChannel->sampler, GLTF_AnimationSampler);
 			++tkindex; 
 		}
-		else if (json_strncmp(data, tokens + tkindex, "target") == 0) {
+		else if (key == JsonKey_Target) {
 			++tkindex;
-			GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+			GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 			int target_size = tokens[tkindex].size;
 			++tkindex;
 
 			for (int k = 0; k < target_size; ++k) {
-				GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+				GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-				if (json_strncmp(data, tokens + tkindex, "node") == 0) { 
-					++tkindex; outChannel->targetNode = PTR_TO_INDEX(GLTF_Node, json_to_int(data, tokens + tkindex)); ++tkindex; }
-				else if (json_strncmp(data, tokens + tkindex, "path") == 0) {
+				const internal_json_key subkey = internal_json_key_lookup(data, tokens + tkindex);
+				if (subkey == JsonKey_Node) { 
+					++tkindex; JSON_READ_INDEX(outChannel->targetNode, GLTF_Node); ++tkindex; }
+				else if (subkey == JsonKey_Path) {
 					++tkindex;
-					if (json_strncmp(data, tokens + tkindex, "translation") == 0) { 
+					const internal_json_key value = internal_json_key_lookup(data, tokens + tkindex);
+					if (value == JsonKey_Translation) { 
 						outChannel->targetPath = AnimationPathType_Translation; 
 					}
-					else if (json_strncmp(data, tokens + tkindex, "rotation") == 0) { 
+					else if (value == JsonKey_Rotation) { 
 						outChannel->targetPath = AnimationPathType_Rotation; 
 					}
-					else if (json_strncmp(data, tokens + tkindex, "scale") == 0) { 
+					else if (value == JsonKey_Scale) { 
 						outChannel->targetPath = AnimationPathType_Scale;
 					}
-					else if (json_strncmp(data, tokens + tkindex, "weights") == 0) {
+					else if (value == JsonKey_Weights) {
 						outChannel->targetPath = AnimationPathType_Weights; 
 					}
 					++tkindex;
 				}
-				else if (json_strncmp(data, tokens + tkindex, "extras") == 0) { 
+				else if (subkey == JsonKey_Extras) { 
 					tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outChannel->extras);
 				}
-				else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) { 
+				else if (subkey == JsonKey_Extensions) { 
 					tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outChannel->extensionsCount, &outChannel->extensions);
 				}
 				else { 
@@ -695,18 +1530,19 @@ static int internal_parse_animation_channel(const char* data, const jsmntok_t* t
 /// @param outAnimation the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_animation(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Animation* outAnimation) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
 	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outAnimation->name);
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) { 
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outAnimation->name);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "samplers") == 0) {
-			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_AnimationSampler), (void**)&outAnimation->samplers, &outAnimation->samplersCount);
+		else if (key == JsonKey_Samplers) {
+			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_AnimationSampler), (void**)&outAnimation->samplers, &outAnimation->samplersCount, s_gState->arena);
 			if (tkindex < 0) return tkindex;
 
 			for (unsigned long long k = 0; k < outAnimation->samplersCount; ++k) {
@@ -714,8 +1550,8 @@ static int internal_parse_animation(const char* data, const jsmntok_t* tokens, i
 				if (tkindex < 0) return tkindex;
 			}
 		}
-		else if (json_strncmp(data, tokens + tkindex, "channels") == 0) {
-			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_AnimationChannel), (void**)&outAnimation->channels, &outAnimation->channelsCount);
+		else if (key == JsonKey_Channels) {
+			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_AnimationChannel), (void**)&outAnimation->channels, &outAnimation->channelsCount, s_gState->arena);
 			if (tkindex < 0) return tkindex;
 
 			for (unsigned long long k = 0; k < outAnimation->channelsCount; ++k) {
@@ -723,10 +1559,10 @@ static int internal_parse_animation(const char* data, const jsmntok_t* tokens, i
 				if (tkindex < 0) return tkindex;
 			}
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) { 
+		else if (key == JsonKey_Extras) { 
 			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outAnimation->extras);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) { 
+		else if (key == JsonKey_Extensions) { 
 			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outAnimation->extensionsCount, &outAnimation->extensions);
 		}
 		else { 
@@ -745,7 +1581,7 @@ static int internal_parse_animation(const char* data, const jsmntok_t* tokens, i
 /// @param outData the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_animations(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Animation), (void**)&outData->animations, &outData->animationsCount);
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Animation), (void**)&outData->animations, &outData->animationsCount, s_gState->arena);
 	if (tkindex < 0) return tkindex;
 
 	for (unsigned long long j = 0; j < outData->animationsCount; ++j) {
@@ -762,50 +1598,52 @@ static int internal_parse_animations(const char* data, const jsmntok_t* tokens,
 /// @param outCamera the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_camera(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Camera* outCamera) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
 	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outCamera->name);
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) { 
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outCamera->name);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "perspective") == 0) {
+		else if (key == JsonKey_Perspective) {
 			++tkindex;
-			GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+			GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 			int data_size = tokens[tkindex].size;
 			++tkindex;
 
 			outCamera->type = CameraType_Perspective;
 
 			for (int k = 0; k < data_size; ++k) {
-				GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+				GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-				if (json_strncmp(data, tokens + tkindex, "aspectRatio") == 0) {
+				const internal_json_key subkey = internal_json_key_lookup(data, tokens + tkindex);
+				if (subkey == JsonKey_AspectRatio) {
 					++tkindex;
 					outCamera->data.perspective.hasAspectRatio = 1;
-					outCamera->data.perspective.aspectRatio = json_to_float(data, tokens + tkindex);
+					GLTF_ASSERT(json_read_float(data, tokens + tkindex, &outCamera->data.perspective.aspectRatio), ErrorCode_InvalidDocument, "Invalid json number");
 					++tkindex;
 				}
-				else if (json_strncmp(data, tokens + tkindex, "yfov") == 0) { 
+				else if (subkey == JsonKey_Yfov) { 
 					++tkindex;
-					outCamera->data.perspective.yFOV = json_to_float(data, tokens + tkindex);
+					GLTF_ASSERT(json_read_float(data, tokens + tkindex, &outCamera->data.perspective.yFOV), ErrorCode_InvalidDocument, "Invalid json number");
 					++tkindex;
 				}
-				else if (json_strncmp(data, tokens + tkindex, "zfar") == 0) {
+				else if (subkey == JsonKey_Zfar) {
 					++tkindex;
 					outCamera->data.perspective.hasZFar = 1;
-					outCamera->data.perspective.zFar = json_to_float(data, tokens + tkindex);
+					GLTF_ASSERT(json_read_float(data, tokens + tkindex, &outCamera->data.perspective.zFar), ErrorCode_InvalidDocument, "Invalid json number");
 					++tkindex;
 				}
-				else if (json_strncmp(data, tokens + tkindex, "znear") == 0) { 
+				else if (subkey == JsonKey_Znear) { 
 					++tkindex;
-					outCamera->data.perspective.zNear = json_to_float(data, tokens + tkindex); 
+					GLTF_ASSERT(json_read_float(data, tokens + tkindex, &outCamera->data.perspective.zNear), ErrorCode_InvalidDocument, "Invalid json number"); 
 					++tkindex; 
 				}
-				else if (json_strncmp(data, tokens + tkindex, "extras") == 0) { 
+				else if (subkey == JsonKey_Extras) { 
 					tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outCamera->data.perspective.extras);
 				}
 				else {
@@ -815,37 +1653,38 @@ static int internal_parse_camera(const char* data, const jsmntok_t* tokens, int
 				if (tkindex < 0)  return tkindex;
 			}
 		}
-		else if (json_strncmp(data, tokens + tkindex, "orthographic") == 0) {
+		else if (key == JsonKey_Orthographic) {
 			++tkindex;
-			GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+			GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 			int data_size = tokens[tkindex].size;
 			++tkindex;
 			outCamera->type = CameraType_Orthographic;
 
 			for (int k = 0; k < data_size; ++k) {
-				GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+				GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-				if (json_strncmp(data, tokens + tkindex, "xmag") == 0) { 
+				const internal_json_key subkey = internal_json_key_lookup(data, tokens + tkindex);
+				if (subkey == JsonKey_Xmag) { 
 					++tkindex; 
-					outCamera->data.orthographic.xMag = json_to_float(data, tokens + tkindex);
+					GLTF_ASSERT(json_read_float(data, tokens + tkindex, &outCamera->data.orthographic.xMag), ErrorCode_InvalidDocument, "Invalid json number");
 					++tkindex;
 				}
-				else if (json_strncmp(data, tokens + tkindex, "ymag") == 0) {
+				else if (subkey == JsonKey_Ymag) {
 					++tkindex; 
-					outCamera->data.orthographic.yMag = json_to_float(data, tokens + tkindex); 
+					GLTF_ASSERT(json_read_float(data, tokens + tkindex, &outCamera->data.orthographic.yMag), ErrorCode_InvalidDocument, "Invalid json number"); 
 					++tkindex;
 				}
-				else if (json_strncmp(data, tokens + tkindex, "zfar") == 0) { 
+				else if (subkey == JsonKey_Zfar) { 
 					++tkindex; 
-					outCamera->data.orthographic.zFar = json_to_float(data, tokens + tkindex); 
+					GLTF_ASSERT(json_read_float(data, tokens + tkindex, &outCamera->data.orthographic.zFar), ErrorCode_InvalidDocument, "Invalid json number"); 
 					++tkindex; 
 				}
-				else if (json_strncmp(data, tokens + tkindex, "znear") == 0) {
+				else if (subkey == JsonKey_Znear) {
 					++tkindex; 
-					outCamera->data.orthographic.zNear = json_to_float(data, tokens + tkindex);
+					GLTF_ASSERT(json_read_float(data, tokens + tkindex, &outCamera->data.orthographic.zNear), ErrorCode_InvalidDocument, "Invalid json number");
 					++tkindex;
 				}
-				else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
+				else if (subkey == JsonKey_Extras) {
 					tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outCamera->data.orthographic.extras);
 				}
 				else { 
@@ -855,10 +1694,10 @@ static int internal_parse_camera(const char* data, const jsmntok_t* tokens, int
 				if (tkindex < 0) return tkindex;
 			}
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
+		else if (key == JsonKey_Extras) {
 			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outCamera->extras);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) { 
+		else if (key == JsonKey_Extensions) { 
 			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outCamera->extensionsCount, &outCamera->extensions);
 		}
 		else { 
@@ -877,7 +1716,7 @@ static int internal_parse_camera(const char* data, const jsmntok_t* tokens, int
 /// @param outData the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_cameras(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Camera), (void**)&outData->cameras, &outData->camerasCount);
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Camera), (void**)&outData->cameras, &outData->camerasCount, s_gState->arena);
 	if (tkindex < 0) return tkindex;
 
 	for (unsigned long long j = 0; j < outData->camerasCount; ++j) {
@@ -894,31 +1733,42 @@ static int internal_parse_cameras(const char* data, const jsmntok_t* tokens, int
 /// @param outImage the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_image(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Image* outImage) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
-	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+	char* uriMimeType = NULL;
 
-		if (json_strncmp(data, tokens + tkindex, "uri") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outImage->URI);
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Uri) { 
+			int payload = 0;
+			if (s_gState->options.bufferMode == BufferMode_Load && internal_is_base64_uri(data, tokens + tkindex + 1, &payload)) {
+				tkindex = internal_parse_base64_uri(data, tokens, tkindex + 1, payload, &outImage->storage, &uriMimeType);
+				outImage->data = outImage->storage.data;
+				outImage->size = outImage->storage.size;
+			}
+			else {
+				tkindex = internal_parse_string(data, tokens, tkindex + 1, &outImage->URI);
+			}
 		}
-		else if (json_strncmp(data, tokens + tkindex, "bufferView") == 0) { 
+		else if (key == JsonKey_BufferView) { 
 			++tkindex; 
-			outImage->bufferView = PTR_TO_INDEX(GLTF_BufferView, json_to_int(data, tokens + tkindex)); 
+			JSON_READ_INDEX(outImage->bufferView, GLTF_BufferView); 
 			++tkindex; 
 		}
-		else if (json_strncmp(data, tokens + tkindex, "mimeType") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outImage->mime_type); 
+		else if (key == JsonKey_MimeType) { 
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outImage->mime_type); 
 		}
-		else if (json_strncmp(data, tokens + tkindex, "name") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &outImage->name); 
+		else if (key == JsonKey_Name) { 
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &outImage->name); 
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) { 
+		else if (key == JsonKey_Extras) { 
 			tkindex = internal_parse_extras(data , tokens, tkindex + 1, &outImage->extras);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) { 
+		else if (key == JsonKey_Extensions) { 
 			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outImage->extensionsCount, &outImage->extensions);
 		}
 		else { 
@@ -927,6 +1777,10 @@ static int internal_parse_image(const char* data, const jsmntok_t* tokens, int t
 
 		if (tkindex < 0) return tkindex;
 	}
+
+	// an explicit mime type has priority over the one the data uri declares
+	if (!outImage->mime_type) outImage->mime_type = uriMimeType;
+
 	return tkindex;
 }
 
@@ -937,7 +1791,7 @@ static int internal_parse_image(const char* data, const jsmntok_t* tokens, int t
 /// @param outData the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_images(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Image), (void**)&outData->images, &outData->imagesCount);
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Image), (void**)&outData->images, &outData->imagesCount, s_gState->arena);
 	if (tkindex < 0) return tkindex;
 
 	for (unsigned long long j = 0; j < outData->imagesCount; ++j) {
@@ -954,33 +1808,34 @@ static int internal_parse_images(const char* data, const jsmntok_t* tokens, int
 /// @param textureView the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_texture_view(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_TextureView* textureView) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
 	textureView->scale = 1.0f;
 
 	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "index") == 0) { 
-			++tkindex; textureView->texture = PTR_TO_INDEX(GLTF_Texture, json_to_int(data, tokens + tkindex)); 
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Index) { 
+			++tkindex; JSON_READ_INDEX(textureView->texture, GLTF_Texture); 
 			++tkindex; 
 		}
-		else if (json_strncmp(data, tokens + tkindex, "texCoord") == 0) { 
+		else if (key == JsonKey_TexCoord) { 
 			++tkindex; 
-			textureView->texCoord = json_to_int(data, tokens + tkindex);
+			GLTF_ASSERT(json_read_int(data, tokens + tkindex, &textureView->texCoord), ErrorCode_InvalidDocument, "Invalid json number");
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "scale") == 0) { 
+		else if (key == JsonKey_Scale) { 
 			++tkindex; 
-			textureView->scale = json_to_float(data, tokens + tkindex); ++tkindex;
+			GLTF_ASSERT(json_read_float(data, tokens + tkindex, &textureView->scale), ErrorCode_InvalidDocument, "Invalid json number"); ++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "strength") == 0) { 
+		else if (key == JsonKey_Strength) { 
 			++tkindex; 
-			textureView->scale = json_to_float(data, tokens + tkindex); ++tkindex;
+			GLTF_ASSERT(json_read_float(data, tokens + tkindex, &textureView->scale), ErrorCode_InvalidDocument, "Invalid json number"); ++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) { 
+		else if (key == JsonKey_Extensions) { 
 			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &textureView->extensionsCount, &textureView->extensions);
 		}
 		else { 
@@ -999,30 +1854,31 @@ static int internal_parse_texture_view(const char* data, const jsmntok_t* tokens
 /// @param textureView the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_pbr_metallic_roughness(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_PBRMetallicRoughness* pbr) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
 	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "metallicFactor") == 0) {
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_MetallicFactor) {
 			++tkindex;
-			pbr->metallicFactor = json_to_float(data, tokens + tkindex);
+			GLTF_ASSERT(json_read_float(data, tokens + tkindex, &pbr->metallicFactor), ErrorCode_InvalidDocument, "Invalid json number");
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "roughnessFactor") == 0) {
+		else if (key == JsonKey_RoughnessFactor) {
 			++tkindex;
-			pbr->roughnessFactor = json_to_float(data, tokens + tkindex);
+			GLTF_ASSERT(json_read_float(data, tokens + tkindex, &pbr->roughnessFactor), ErrorCode_InvalidDocument, "Invalid json number");
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "baseColorFactor") == 0) {
-			tkindex = json_parse_array_float(data, tokens, tkindex + 1, pbr->baseColor, 4);
+		else if (key == JsonKey_BaseColorFactor) {
+			tkindex = internal_parse_float_array(data, tokens, tkindex + 1, pbr->baseColor, 4, 1);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "baseColorTexture") == 0) {
+		else if (key == JsonKey_BaseColorTexture) {
 			tkindex = internal_parse_texture_view(data, tokens, tkindex + 1, &pbr->baseColorTexture);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "metallicRoughnessTexture") == 0) {
+		else if (key == JsonKey_MetallicRoughnessTexture) {
 			tkindex = internal_parse_texture_view(data, tokens, tkindex + 1, &pbr->metallicRoughnessTexture);
 		}
 		else {
@@ -1041,7 +1897,7 @@ static int internal_parse_pbr_metallic_roughness(const char* data, const jsmntok
 /// @param textureView the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_material(const char* data, jsmntok_t const* tokens, int tkindex, GLTF_Material* material) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
@@ -1054,53 +1910,55 @@ static int internal_parse_material(const char* data, jsmntok_t const* tokens, in
 	material->alphaCutoff = 0.5f;
 
 	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) { 
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &material->name);
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) { 
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &material->name);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "pbrMetallicRoughness") == 0) { 
+		else if (key == JsonKey_PbrMetallicRoughness) { 
 			tkindex = internal_parse_pbr_metallic_roughness(data, tokens, tkindex + 1, &material->PBRmetallicRoughness);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "emissiveFactor") == 0) { 
-			tkindex = json_parse_array_float(data, tokens, tkindex + 1, material->emissiveFactor, 3);
+		else if (key == JsonKey_EmissiveFactor) { 
+			tkindex = internal_parse_float_array(data, tokens, tkindex + 1, material->emissiveFactor, 3, 1);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "normalTexture") == 0) { 
+		else if (key == JsonKey_NormalTexture) { 
 			tkindex = internal_parse_texture_view(data, tokens, tkindex + 1, &material->normalTexture);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "occlusionTexture") == 0) { 
+		else if (key == JsonKey_OcclusionTexture) { 
 			tkindex = internal_parse_texture_view(data, tokens, tkindex + 1, &material->occlusionTexture);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "emissiveTexture") == 0) { 
+		else if (key == JsonKey_EmissiveTexture) { 
 			tkindex = internal_parse_texture_view(data, tokens, tkindex + 1, &material->emissiveTexture);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "alphaCutoff") == 0) {
+		else if (key == JsonKey_AlphaCutoff) {
 			++tkindex; 
-			material->alphaCutoff = json_to_float(data, tokens + tkindex); 
+			GLTF_ASSERT(json_read_float(data, tokens + tkindex, &material->alphaCutoff), ErrorCode_InvalidDocument, "Invalid json number"); 
 			++tkindex; 
 		}
-		else if (json_strncmp(data, tokens + tkindex, "doubleSided") == 0) { 
+		else if (key == JsonKey_DoubleSided) { 
 			++tkindex;
 			material->doubleSided = json_to_bool(data, tokens + tkindex);
 			++tkindex; 
 		}
-		else if (json_strncmp(data, tokens + tkindex, "alphaMode") == 0) {
+		else if (key == JsonKey_AlphaMode) {
 			++tkindex;
-			if (json_strncmp(data, tokens + tkindex, "OPAQUE") == 0) { 
+			const internal_json_key value = internal_json_key_lookup(data, tokens + tkindex);
+			if (value == JsonKey_Opaque) { 
 				material->alphaMode = AlphaMode_Opaque; 
 			}
-			else if (json_strncmp(data, tokens + tkindex, "MASK") == 0) { 
+			else if (value == JsonKey_Mask) { 
 				material->alphaMode = AlphaMode_Mask; 
 			}
-			else if (json_strncmp(data, tokens + tkindex, "BLEND") == 0) {
+			else if (value == JsonKey_Blend) {
 				material->alphaMode = AlphaMode_Blend;
 			}
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) { 
+		else if (key == JsonKey_Extras) { 
 			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &material->extras);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
+		else if (key == JsonKey_Extensions) {
 			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &material->extensionsCount, &material->extensions);
 		}
 		else {
@@ -1112,6 +1970,11 @@ static int internal_parse_material(const char* data, jsmntok_t const* tokens, in
 	return tkindex;
 }
 
+/// @brief internal_parse_material for internal_parse_elements
+static int internal_parse_material_element(const char* data, const jsmntok_t* tokens, int tkindex, void* outElement) {
+	return internal_parse_material(data, tokens, tkindex, (GLTF_Material*)outElement);
+}
+
 /// @brief parses the json materials
 /// @param data the json entire data
 /// @param tokens the json token to read
@@ -1119,14 +1982,10 @@ static int internal_parse_material(const char* data, jsmntok_t const* tokens, in
 /// @param outData the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_materials(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Material), (void**)&outData->materials, &outData->materialsCount);
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Material), (void**)&outData->materials, &outData->materialsCount, s_gState->arena);
 	if (tkindex < 0) return tkindex;
 
-	for (unsigned long long j = 0; j < outData->materialsCount; ++j) {
-		tkindex = internal_parse_material(data, tokens, tkindex, &outData->materials[j]);
-		if (tkindex < 0) return tkindex;
-	}
-	return tkindex;
+	return internal_parse_elements(data, tokens, tkindex, outData->materialsCount, sizeof(GLTF_Material), outData->materials, internal_parse_material_element);
 }
 
 /// @brief converts attribute type given it's string name
@@ -1184,20 +2043,20 @@ static void internal_parse_attribute_type(const char* name, GLTF_AttributeType*
 /// @param attributesCount the parsed attributes count
 /// @return the next token index to be analyzed
 static int internal_parse_attribute_list(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Attribute** attributes, unsigned long long* attributesCount) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 
 	*attributesCount = tokens[tkindex].size;
-	*attributes = (GLTF_Attribute*)gltfmemory_allocate(sizeof(GLTF_Attribute) * (*attributesCount), 1);
+	*attributes = (GLTF_Attribute*)gltfarena_allocate(s_gState->arena, sizeof(GLTF_Attribute) * (*attributesCount), 1);
 	++tkindex;
 
 	for (unsigned long long j = 0; j < *attributesCount; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		tkindex = json_parse_string(data, tokens, tkindex, &(*attributes)[j].name);
-		GLTF_ASSERT(attributes > 0, "There was an error when parsing attributes");
+		tkindex = internal_parse_string(data, tokens, tkindex, &(*attributes)[j].name);
+		GLTF_ASSERT(attributes > 0, ErrorCode_InvalidDocument, "There was an error when parsing attributes");
 
 		internal_parse_attribute_type((*attributes)[j].name, &(*attributes)[j].type, &(*attributes)[j].index);
-		(*attributes)[j].data = PTR_TO_INDEX(GLTF_Accessor, json_to_int(data, tokens + tkindex));
+		JSON_READ_INDEX((*attributes)[j].data, GLTF_Accessor);
 		++tkindex;
 	}
 	return tkindex;
@@ -1210,35 +2069,36 @@ static int internal_parse_attribute_list(const char* data, const jsmntok_t* toke
 /// @param primitive the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_primitive(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Primitive* primitive) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
 	primitive->type = PrimitiveType_Triangles;
 
 	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "mode") == 0) {
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Mode) {
 			++tkindex;
-			primitive->type = (GLTF_PrimitiveType)json_to_int(data, tokens + tkindex);
+			JSON_READ_ENUM(primitive->type, GLTF_PrimitiveType);
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "indices") == 0) {
+		else if (key == JsonKey_Indices) {
 			++tkindex;
-			primitive->indices = PTR_TO_INDEX(GLTF_Accessor, json_to_int(data, tokens + tkindex));
+			JSON_READ_INDEX(primitive->indices, GLTF_Accessor);
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "material") == 0) {
+		else if (key == JsonKey_Material) {
 			++tkindex;
-			primitive->material = PTR_TO_INDEX(GLTF_Material, json_to_int(data, tokens + tkindex));
+			JSON_READ_INDEX(primitive->material, GLTF_Material);
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "attributes") == 0) {
+		else if (key == JsonKey_Attributes) {
 			tkindex = internal_parse_attribute_list(data, tokens, tkindex + 1, &primitive->attributes, &primitive->attributesCount);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "targets") == 0) {
-			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_MorphTarget), (void**)&primitive->targets, &primitive->targetsCount);
+		else if (key == JsonKey_Targets) {
+			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_MorphTarget), (void**)&primitive->targets, &primitive->targetsCount, s_gState->arena);
 			if (tkindex  < 0) return tkindex;
 
 			for (unsigned long long k = 0; k < primitive->targetsCount; ++k) {
@@ -1246,10 +2106,10 @@ static int internal_parse_primitive(const char* data, const jsmntok_t* tokens, i
 				if (tkindex < 0) return tkindex;
 			}
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
+		else if (key == JsonKey_Extras) {
 			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &primitive->extras);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
+		else if (key == JsonKey_Extensions) {
 			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &primitive->extensionsCount, &primitive->extensions);
 		}
 		else {
@@ -1268,18 +2128,19 @@ static int internal_parse_primitive(const char* data, const jsmntok_t* tokens, i
 /// @param mesh the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_mesh(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Mesh* mesh) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
 	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) {
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &mesh->name);
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) {
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &mesh->name);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "primitives") == 0) {
-			tkindex = json_parse_array(data , tokens, tkindex + 1, sizeof(GLTF_Primitive), (void**)&mesh->primitives, &mesh->primitivesCount);
+		else if (key == JsonKey_Primitives) {
+			tkindex = json_parse_array(data , tokens, tkindex + 1, sizeof(GLTF_Primitive), (void**)&mesh->primitives, &mesh->primitivesCount, s_gState->arena);
 			if (tkindex < 0) return tkindex;
 
 			for (unsigned long long prim_index = 0; prim_index < mesh->primitivesCount; ++prim_index) {
@@ -1287,15 +2148,15 @@ static int internal_parse_mesh(const char* data, const jsmntok_t* tokens, int tk
 				if (tkindex < 0) return tkindex;
 			}
 		}
-		else if (json_strncmp(data, tokens + tkindex, "weights") == 0) {
-			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(float), (void**)&mesh->weights, &mesh->weightsCount);
+		else if (key == JsonKey_Weights) {
+			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(float), (void**)&mesh->weights, &mesh->weightsCount, s_gState->arena);
 			if (tkindex < 0) return tkindex;
-			tkindex = json_parse_array_float(data, tokens, tkindex - 1, mesh->weights, (int)mesh->weightsCount);
+			tkindex = internal_parse_float_array(data, tokens, tkindex - 1, mesh->weights, (int)mesh->weightsCount, 1);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) { 
+		else if (key == JsonKey_Extras) { 
 			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &mesh->extras);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
+		else if (key == JsonKey_Extensions) {
 			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &mesh->extensionsCount, &mesh->extensions); 
 		}
 		else {
@@ -1307,6 +2168,11 @@ static int internal_parse_mesh(const char* data, const jsmntok_t* tokens, int tk
 	return tkindex;
 }
 
+/// @brief internal_parse_mesh for internal_parse_elements
+static int internal_parse_mesh_element(const char* data, const jsmntok_t* tokens, int tkindex, void* outElement) {
+	return internal_parse_mesh(data, tokens, tkindex, (GLTF_Mesh*)outElement);
+}
+
 /// @brief parses the meshes
 /// @param data the json entire data
 /// @param tokens the json token to read
@@ -1314,14 +2180,10 @@ static int internal_parse_mesh(const char* data, const jsmntok_t* tokens, int tk
 /// @param outData the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_meshes(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Mesh), (void**)&outData->meshes, &outData->meshesCount);
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Mesh), (void**)&outData->meshes, &outData->meshesCount, s_gState->arena);
 	if (tkindex < 0) return tkindex;
 
-	for (unsigned long long j = 0; j < outData->meshesCount; ++j) {
-		tkindex = internal_parse_mesh(data, tokens, tkindex, &outData->meshes[j]);
-		if (tkindex < 0) return tkindex;
-	}
-	return tkindex;
+	return internal_parse_elements(data, tokens, tkindex, outData->meshesCount, sizeof(GLTF_Mesh), outData->meshes, internal_parse_mesh_element);
 }
 
 /// @brief parses a single node
@@ -1331,7 +2193,7 @@ static int internal_parse_meshes(const char* data, const jsmntok_t* tokens, int
 /// @param node the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_node(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Node* node) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
@@ -1345,59 +2207,60 @@ static int internal_parse_node(const char* data, const jsmntok_t* tokens, int tk
 	node->matrix[15] = 1.0f;
 
 	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) {
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &node->name);
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) {
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &node->name);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "children") == 0) {
-			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_Node*), (void**)&node->children, &node->childrenCount);
+		else if (key == JsonKey_Children) {
+			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_Node*), (void**)&node->children, &node->childrenCount, s_gState->arena);
 			if (tkindex < 0) return tkindex;
 
 			for (unsigned long long k = 0; k < node->childrenCount; ++k) {
-				node->children[k] = PTR_TO_INDEX(GLTF_Node, json_to_int(data, tokens + tkindex));
+				JSON_READ_INDEX(node->children[k], GLTF_Node);
 				++tkindex;
 			}
 		}
-		else if (json_strncmp(data, tokens + tkindex, "mesh") == 0) {
+		else if (key == JsonKey_Mesh) {
 			++tkindex;
-			GLTF_ASSERT(tokens[tkindex].type == JSMN_PRIMITIVE, "The expected unprocessed extension is not a json valid primitive");
-			node->mesh = PTR_TO_INDEX(GLTF_Mesh, json_to_int(data, tokens + tkindex));
+			GLTF_ASSERT(tokens[tkindex].type == JSMN_PRIMITIVE, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid primitive");
+			JSON_READ_INDEX(node->mesh, GLTF_Mesh);
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "skin") == 0) {
+		else if (key == JsonKey_Skin) {
 			++tkindex;
-			GLTF_ASSERT(tokens[tkindex].type == JSMN_PRIMITIVE, "The expected unprocessed extension is not a json valid primitive");
-			node->skin = PTR_TO_INDEX(GLTF_Skin, json_to_int(data, tokens + tkindex));
+			GLTF_ASSERT(tokens[tkindex].type == JSMN_PRIMITIVE, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid primitive");
+			JSON_READ_INDEX(node->skin, GLTF_Skin);
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "camera") == 0) {
+		else if (key == JsonKey_Camera) {
 			++tkindex;
-			GLTF_ASSERT(tokens[tkindex].type == JSMN_PRIMITIVE, "The expected unprocessed extension is not a json valid primitive");
-			node->camera = PTR_TO_INDEX(GLTF_Camera, json_to_int(data, tokens + tkindex));
+			GLTF_ASSERT(tokens[tkindex].type == JSMN_PRIMITIVE, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid primitive");
+			JSON_READ_INDEX(node->camera, GLTF_Camera);
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "translation") == 0) { 
-			tkindex = json_parse_array_float(data, tokens, tkindex + 1, node->translation, 3);
+		else if (key == JsonKey_Translation) { 
+			tkindex = internal_parse_float_array(data, tokens, tkindex + 1, node->translation, 3, 1);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "rotation") == 0) { 
-			tkindex = json_parse_array_float(data, tokens, tkindex + 1, node->rotation, 4);
+		else if (key == JsonKey_Rotation) { 
+			tkindex = internal_parse_float_array(data, tokens, tkindex + 1, node->rotation, 4, 1);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "scale") == 0) { 
-			tkindex = json_parse_array_float(data, tokens, tkindex + 1, node->scale, 3);
+		else if (key == JsonKey_Scale) { 
+			tkindex = internal_parse_float_array(data, tokens, tkindex + 1, node->scale, 3, 1);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "matrix") == 0) { 
-			tkindex = json_parse_array_float(data, tokens, tkindex + 1, node->matrix, 16);
+		else if (key == JsonKey_Matrix) { 
+			tkindex = internal_parse_float_array(data, tokens, tkindex + 1, node->matrix, 16, 1);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "weights") == 0) {
-			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(float), (void**)&node->weights, &node->weightsCount);
+		else if (key == JsonKey_Weights) {
+			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(float), (void**)&node->weights, &node->weightsCount, s_gState->arena);
 			if (tkindex < 0) return tkindex;
-			tkindex = json_parse_array_float(data, tokens, tkindex - 1, node->weights, (int)node->weightsCount);
+			tkindex = internal_parse_float_array(data, tokens, tkindex - 1, node->weights, (int)node->weightsCount, 1);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
+		else if (key == JsonKey_Extras) {
 			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &node->extras);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
+		else if (key == JsonKey_Extensions) {
 			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &node->extensionsCount, &node->extensions);
 		}
 		else { 
@@ -1409,6 +2272,11 @@ static int internal_parse_node(const char* data, const jsmntok_t* tokens, int tk
 	return tkindex;
 }
 
+/// @brief internal_parse_node for internal_parse_elements
+static int internal_parse_node_element(const char* data, const jsmntok_t* tokens, int tkindex, void* outElement) {
+	return internal_parse_node(data, tokens, tkindex, (GLTF_Node*)outElement);
+}
+
 /// @brief parses the nodes
 /// @param data the json entire data
 /// @param tokens the json token to read
@@ -1416,14 +2284,10 @@ static int internal_parse_node(const char* data, const jsmntok_t* tokens, int tk
 /// @param outData the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_nodes(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Node), (void**)&outData->nodes, &outData->nodesCount);
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Node), (void**)&outData->nodes, &outData->nodesCount, s_gState->arena);
 	if (tkindex < 0) return tkindex;
 
-	for (unsigned long long j = 0; j < outData->nodesCount; ++j) {
-		tkindex = internal_parse_node(data, tokens, tkindex, &outData->nodes[j]);
-		if (tkindex < 0) return tkindex;
-	}
-	return tkindex;
+	return internal_parse_elements(data, tokens, tkindex, outData->nodesCount, sizeof(GLTF_Node), outData->nodes, internal_parse_node_element);
 }
 
 /// @brief parses a single sampler
@@ -1433,7 +2297,7 @@ static int internal_parse_nodes(const char* data, const jsmntok_t* tokens, int t
 /// @param sampler the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_image_sampler(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_ImageSampler* sampler) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
@@ -1441,34 +2305,35 @@ static int internal_parse_image_sampler(const char* data, const jsmntok_t* token
 	sampler->wrapT = WrapMode_Repeat;
 
 	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) {
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &sampler->name);
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) {
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &sampler->name);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "magFilter") == 0) {
+		else if (key == JsonKey_MagFilter) {
 			++tkindex; 
-			sampler->magFilter = (GLTF_FilterType)json_to_int(data, tokens + tkindex); 
+			JSON_READ_ENUM(sampler->magFilter, GLTF_FilterType); 
 			++tkindex; 
 		}
-		else if (json_strncmp(data, tokens + tkindex, "minFilter") == 0) {
-			++tkindex; sampler->minFilter = (GLTF_FilterType)json_to_int(data, tokens + tkindex); 
+		else if (key == JsonKey_MinFilter) {
+			++tkindex; JSON_READ_ENUM(sampler->minFilter, GLTF_FilterType); 
 			++tkindex; 
 		}
-		else if (json_strncmp(data, tokens + tkindex, "wrapS") == 0) { 
+		else if (key == JsonKey_WrapS) { 
 			++tkindex; 
-			sampler->wrapS = (GLTF_WrapMode)json_to_int(data, tokens + tkindex); 
+			JSON_READ_ENUM(sampler->wrapS, GLTF_WrapMode); 
 			++tkindex; 
 		}
-		else if (json_strncmp(data, tokens + tkindex, "wrapT") == 0) { 
+		else if (key == JsonKey_WrapT) { 
 			++tkindex; 
-			sampler->wrapT = (GLTF_WrapMode)json_to_int(data, tokens + tkindex); 
+			JSON_READ_ENUM(sampler->wrapT, GLTF_WrapMode); 
 			++tkindex; 
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
+		else if (key == JsonKey_Extras) {
 			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &sampler->extras);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) { 
+		else if (key == JsonKey_Extensions) { 
 			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &sampler->extensionsCount, &sampler->extensions);
 		}
 		else { 
@@ -1487,7 +2352,7 @@ static int internal_parse_image_sampler(const char* data, const jsmntok_t* token
 /// @param outData the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_image_samplers(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_ImageSampler), (void**)&outData->imageSamplers, &outData->imageSamplersCount);
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_ImageSampler), (void**)&outData->imageSamplers, &outData->imageSamplersCount, s_gState->arena);
 	if (tkindex < 0) return tkindex;
 
 	for (unsigned long long j = 0; j < outData->imageSamplersCount; ++j) {
@@ -1504,41 +2369,42 @@ static int internal_parse_image_samplers(const char* data, const jsmntok_t* toke
 /// @param skin the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_skin(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Skin* skin) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
 	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) {
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &skin->name);
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) {
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &skin->name);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "joints") == 0) {
-			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_Node*), (void**)&skin->joints, &skin->jointsCount);
+		else if (key == JsonKey_Joints) {
+			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_Node*), (void**)&skin->joints, &skin->jointsCount, s_gState->arena);
 			if (tkindex < 0) return tkindex;
 
 			for (unsigned long long k = 0; k < skin->jointsCount; ++k) {
-				skin->joints[k] = PTR_TO_INDEX(GLTF_Node, json_to_int(data, tokens + tkindex));
+				JSON_READ_INDEX(skin->joints[k], GLTF_Node);
 				++tkindex;
 			}
 		}
-		else if (json_strncmp(data, tokens + tkindex, "skeleton") == 0) {
+		else if (key == JsonKey_Skeleton) {
 			++tkindex;
-			GLTF_ASSERT(tokens[tkindex].type == JSMN_PRIMITIVE, "The expected unprocessed extension is not a json valid primitive");
-			skin->skeleton = PTR_TO_INDEX(GLTF_Node, json_to_int(data, tokens + tkindex));
+			GLTF_ASSERT(tokens[tkindex].type == JSMN_PRIMITIVE, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid primitive");
+			JSON_READ_INDEX(skin->skeleton, GLTF_Node);
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "inverseBindMatrices") == 0) {
+		else if (key == JsonKey_InverseBindMatrices) {
 			++tkindex;
-			GLTF_ASSERT(tokens[tkindex].type == JSMN_PRIMITIVE, "The expected unprocessed extension is not a json valid primitive");
-			skin->inverseBindMatrices = PTR_TO_INDEX(GLTF_Accessor, json_to_int(data, tokens + tkindex));
+			GLTF_ASSERT(tokens[tkindex].type == JSMN_PRIMITIVE, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid primitive");
+			JSON_READ_INDEX(skin->inverseBindMatrices, GLTF_Accessor);
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
+		else if (key == JsonKey_Extras) {
 			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &skin->extras);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
+		else if (key == JsonKey_Extensions) {
 			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &skin->extensionsCount, &skin->extensions);
 		}
 		else {
@@ -1557,7 +2423,7 @@ static int internal_parse_skin(const char* data, const jsmntok_t* tokens, int tk
 /// @param outData the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_skins(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Skin), (void**)&outData->skins, &outData->skinsCount);
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Skin), (void**)&outData->skins, &outData->skinsCount, s_gState->arena);
 	if (tkindex < 0) return tkindex;
 
 	for (unsigned long long j = 0; j < outData->skinsCount; ++j) {
@@ -1574,29 +2440,30 @@ static int internal_parse_skins(const char* data, const jsmntok_t* tokens, int t
 /// @param scene the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_scene(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Scene* scene) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
 	for (int j = 0; j < size; ++j){
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) {
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &scene->name);
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) {
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &scene->name);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "nodes") == 0) {
-			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_Node*), (void**)&scene->nodes, &scene->nodesCount);
+		else if (key == JsonKey_Nodes) {
+			tkindex = json_parse_array(data, tokens, tkindex + 1, sizeof(GLTF_Node*), (void**)&scene->nodes, &scene->nodesCount, s_gState->arena);
 			if (tkindex < 0) return tkindex;
 
 			for (unsigned long long k = 0; k < scene->nodesCount; ++k) {
-				scene->nodes[k] = PTR_TO_INDEX(GLTF_Node, json_to_int(data, tokens + tkindex));
+				JSON_READ_INDEX(scene->nodes[k], GLTF_Node);
 				++tkindex;
 			}
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
+		else if (key == JsonKey_Extras) {
 			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &scene->extras);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
+		else if (key == JsonKey_Extensions) {
 			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &scene->extensionsCount, &scene->extensions);
 		}
 		else {
@@ -1615,7 +2482,7 @@ static int internal_parse_scene(const char* data, const jsmntok_t* tokens, int t
 /// @param outData the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_scenes(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Scene), (void**)&outData->scenes, &outData->scenesCount);
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Scene), (void**)&outData->scenes, &outData->scenesCount, s_gState->arena);
 	if (tkindex < 0) return tkindex;
 
 	for (unsigned long long j = 0; j < outData->scenesCount; ++j) {
@@ -1632,30 +2499,31 @@ static int internal_parse_scenes(const char* data, const jsmntok_t* tokens, int
 /// @param texture the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_texture(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_Texture* texture) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
 	for (int j = 0; j < size; ++j){
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "name") == 0) {
-			tkindex = json_parse_string(data, tokens, tkindex + 1, &texture->name);
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		if (key == JsonKey_Name) {
+			tkindex = internal_parse_string(data, tokens, tkindex + 1, &texture->name);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "sampler") == 0) {
+		else if (key == JsonKey_Sampler) {
 			++tkindex;
-			texture->sampler = PTR_TO_INDEX(GLTF_ImageSampler, json_to_int(data, tokens + tkindex));
+			JSON_READ_INDEX(texture->sampler, GLTF_ImageSampler);
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "source") == 0) {
+		else if (key == JsonKey_Source) {
 			++tkindex;
-			texture->image = PTR_TO_INDEX(GLTF_Image, json_to_int(data, tokens + tkindex));
+			JSON_READ_INDEX(texture->image, GLTF_Image);
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
+		else if (key == JsonKey_Extras) {
 			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &texture->extras);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
+		else if (key == JsonKey_Extensions) {
 			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &texture->extensionsCount, &texture->extensions);
 		}
 		else {
@@ -1674,7 +2542,7 @@ static int internal_parse_texture(const char* data, const jsmntok_t* tokens, int
 /// @param outData the output data with the parsed information
 /// @return the next token index to be analyzed
 static int internal_parse_textures(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Texture), (void**)&outData->textures, &outData->texturesCount);
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(GLTF_Texture), (void**)&outData->textures, &outData->texturesCount, s_gState->arena);
 	if (tkindex < 0) return tkindex;
 
 	for (unsigned long long j = 0; j < outData->texturesCount; ++j) {
@@ -1684,6 +2552,29 @@ static int internal_parse_textures(const char* data, const jsmntok_t* tokens, in
 	return tkindex;
 }
 
+/// @brief tells which section a root key builds
+/// @param key the root key
+/// @return the GLTF_Section flag of the key, 0 when it isn't a collection that can be skipped
+static unsigned int internal_json_key_section(internal_json_key key) {
+	switch (key) {
+	case JsonKey_Accessors: return Section_Accessors;
+	case JsonKey_Animations: return Section_Animations;
+	case JsonKey_BufferViews: return Section_BufferViews;
+	case JsonKey_Buffers: return Section_Buffers;
+	case JsonKey_Cameras: return Section_Cameras;
+	case JsonKey_Images: return Section_Images;
+	case JsonKey_Materials: return Section_Materials;
+	case JsonKey_Meshes: return Section_Meshes;
+	case JsonKey_Nodes: return Section_Nodes;
+	case JsonKey_Samplers: return Section_Samplers;
+	case JsonKey_Scenes:
+	case JsonKey_Scene: return Section_Scenes;
+	case JsonKey_Skins: return Section_Skins;
+	case JsonKey_Textures: return Section_Textures;
+	default: return 0;
+	}
+}
+
 /// @brief parses the json by it's root
 /// @param data the json entire data
 /// @param tokens the json tokens
@@ -1691,70 +2582,82 @@ static int internal_parse_textures(const char* data, const jsmntok_t* tokens, in
 /// @param outData the output data with the parsed information
 /// @return 1 on success, 0 on failure
 static int internal_parse_jsonroot(const char* data, const jsmntok_t* tokens, int tkindex, GLTF2* outData) {
-	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, "The expected unprocessed extension is not a json valid object");
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected unprocessed extension is not a json valid object");
 	int size = tokens[tkindex].size;
 	++tkindex;
 
 	for (int j = 0; j < size; ++j) {
-		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, "The expected json data is not a string");
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
 
-		if (json_strncmp(data, tokens + tkindex, "accessors") == 0) {
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		const unsigned int section = internal_json_key_section(key);
+		if (section && !(s_gState->options.sections & section)) {
+			// the sections that aren't wanted are skipped without being built
+			tkindex = json_parse_skip(tokens, tkindex + 1);
+		}
+		else if (key == JsonKey_Accessors) {
 			tkindex = internal_parse_accessors(data, tokens, tkindex + 1, outData);
 		}
-		else if(json_strncmp(data, tokens + tkindex, "animation") == 0) {
+		else if (key == JsonKey_Animations) {
 			tkindex = internal_parse_animations(data, tokens, tkindex + 1, outData);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "asset") == 0) {
-			tkindex = internal_parse_asset(data, tokens, tkindex + 1, &outData->asset);
+		else if (key == JsonKey_Asset) {
+			const int assetIndex = tkindex + 1;
+			tkindex = internal_parse_asset(data, tokens, assetIndex, &outData->asset);
+
+			if (tkindex >= 0 && outData->asset.version && internal_version_major(outData->asset.version) < 2) {
+				internal_log_error_at(ErrorCode_Unsupported, assetIndex, "Legacy GLTF is not supported");
+				return -1;
+			}
 		}
-		else if (json_strncmp(data, tokens + tkindex, "bufferViews") == 0) {
+		else if (key == JsonKey_BufferViews) {
 			tkindex = internal_parse_bufferviews(data, tokens, tkindex + 1, outData);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "buffers") == 0) {
+		else if (key == JsonKey_Buffers) {
 			tkindex = internal_parse_buffers(data, tokens, tkindex + 1, outData);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "cameras") == 0) {
+		else if (key == JsonKey_Cameras) {
 			tkindex = internal_parse_cameras(data, tokens, tkindex + 1, outData);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "images") == 0) {
+		else if (key == JsonKey_Images) {
 			tkindex = internal_parse_images(data, tokens, tkindex + 1, outData);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "materials") == 0) {
+		else if (key == JsonKey_Materials) {
 			tkindex = internal_parse_materials(data, tokens, tkindex + 1, outData);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "meshes") == 0) {
+		else if (key == JsonKey_Meshes) {
 			tkindex = internal_parse_meshes(data, tokens, tkindex + 1, outData);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "nodes") == 0) {
+		else if (key == JsonKey_Nodes) {
 			tkindex = internal_parse_nodes(data, tokens, tkindex + 1, outData);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "samplers") == 0) {
+		else if (key == JsonKey_Samplers) {
 			tkindex = internal_parse_image_samplers(data, tokens, tkindex + 1, outData);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "scenes") == 0){
+		else if (key == JsonKey_Scenes){
 			tkindex = internal_parse_scenes(data, tokens, tkindex + 1, outData);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "scene") == 0) {
+		else if (key == JsonKey_Scene) {
 			++tkindex;
-			outData->scene = PTR_TO_INDEX(GLTF_Scene, json_to_int(data, tokens + tkindex));
+			JSON_READ_INDEX(outData->scene, GLTF_Scene);
 			++tkindex;
 		}
-		else if (json_strncmp(data, tokens + tkindex, "skins") == 0) {
+		else if (key == JsonKey_Skins) {
 			tkindex = internal_parse_skins(data, tokens, tkindex + 1, outData);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "textures") == 0) {
+		else if (key == JsonKey_Textures) {
 			tkindex = internal_parse_textures(data, tokens, tkindex + 1, outData);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensions") == 0) {
-			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex + 1, &outData->extensionsCount, &outData->extensions);
+		else if (key == JsonKey_Extensions) {
+			tkindex = internal_parse_unprocessed_extensions(data, tokens, tkindex, &outData->extensionsCount, &outData->extensions);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensionsUsed") == 0){
-			tkindex = json_parse_array_string(data, tokens, tkindex + 1, &outData->extensionsUsed, &outData->extensionsUsedCount);
+		else if (key == JsonKey_ExtensionsUsed){
+			tkindex = internal_parse_string_array(data, tokens, tkindex + 1, &outData->extensionsUsed, &outData->extensionsUsedCount);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extensionsRequired") == 0) {
-			tkindex = json_parse_array_string(data, tokens, tkindex + 1, &outData->extensionsRequired, &outData->extensionsRequiredCount);
+		else if (key == JsonKey_ExtensionsRequired) {
+			tkindex = internal_parse_string_array(data, tokens, tkindex + 1, &outData->extensionsRequired, &outData->extensionsRequiredCount);
 		}
-		else if (json_strncmp(data, tokens + tkindex, "extras") == 0) {
+		else if (key == JsonKey_Extras) {
 			tkindex = internal_parse_extras(data, tokens, tkindex + 1, &outData->extras);
 		}
 		else {
@@ -1811,22 +2714,23 @@ unsigned long long internal_calculate_attribute_size(GLTF_Type type, GLTF_Compon
 
 /// @brief conrrects the pointer of loaded members of a gltf file
 /// @param data the gltf parsed data
-/// @return 1 on success, 0 otherwise
+/// @return 1 on success, -1 otherwise
 static int internal_fix_pointers(GLTF2* data) {
+	const unsigned int sections = s_gState->options.sections;
 
 	// meshes pointers
 	for (unsigned long long i = 0; i < data->meshesCount; ++i) {
 		for (unsigned long long j = 0; j < data->meshes[i].primitivesCount; ++j) {
-			PTR_FIX(data->meshes[i].primitives[j].indices, data->accessors, data->accessorsCount);
-			PTR_FIX(data->meshes[i].primitives[j].material, data->materials, data->materialsCount);
+			PTR_FIX_SECTION(data->meshes[i].primitives[j].indices, data->accessors, data->accessorsCount, sections & Section_Accessors);
+			PTR_FIX_SECTION(data->meshes[i].primitives[j].material, data->materials, data->materialsCount, sections & Section_Materials);
 
 			for (unsigned long long k = 0; k < data->meshes[i].primitives[j].attributesCount; ++k) {
-				PTR_FIX(data->meshes[i].primitives[j].attributes[k].data, data->accessors, data->accessorsCount);
+				PTR_FIX_SECTION(data->meshes[i].primitives[j].attributes[k].data, data->accessors, data->accessorsCount, sections & Section_Accessors);
 			}
 
 			for (unsigned long long k = 0; k < data->meshes[i].primitives[j].targetsCount; ++k) {
 				for (unsigned long long m = 0; m < data->meshes[i].primitives[j].targets[k].attributesCount; ++m) {
-					PTR_FIX_REQUIRED(data->meshes[i].primitives[j].targets[k].attributes[m].data, data->accessors, data->accessorsCount);
+					PTR_FIX_REQUIRED_SECTION(data->meshes[i].primitives[j].targets[k].attributes[m].data, data->accessors, data->accessorsCount, sections & Section_Accessors);
 				}
 			}
 		}
@@ -1834,11 +2738,11 @@ static int internal_fix_pointers(GLTF2* data) {
 
 	// accessors
 	for (unsigned long long i = 0; i < data->accessorsCount; ++i) {
-		PTR_FIX(data->accessors[i].bufferView, data->bufferViews, data->bufferViewsCount);
+		PTR_FIX_SECTION(data->accessors[i].bufferView, data->bufferViews, data->bufferViewsCount, sections & Section_BufferViews);
 
 		if (data->accessors[i].isSparse) {
-			PTR_FIX_REQUIRED(data->accessors[i].sparse.indicesBufferView, data->bufferViews, data->bufferViewsCount);
-			PTR_FIX_REQUIRED(data->accessors[i].sparse.valuesBufferView, data->bufferViews, data->bufferViewsCount);
+			PTR_FIX_REQUIRED_SECTION(data->accessors[i].sparse.indicesBufferView, data->bufferViews, data->bufferViewsCount, sections & Section_BufferViews);
+			PTR_FIX_REQUIRED_SECTION(data->accessors[i].sparse.valuesBufferView, data->bufferViews, data->bufferViewsCount, sections & Section_BufferViews);
 		}
 
 		if (data->accessors[i].bufferView) {
@@ -1852,44 +2756,44 @@ static int internal_fix_pointers(GLTF2* data) {
 
 	// textures
 	for (unsigned long long i = 0; i < data->texturesCount; ++i) {
-		PTR_FIX(data->textures[i].image, data->images, data->imagesCount);
-		PTR_FIX(data->textures[i].sampler, data->imageSamplers, data->imageSamplersCount);
+		PTR_FIX_SECTION(data->textures[i].image, data->images, data->imagesCount, sections & Section_Images);
+		PTR_FIX_SECTION(data->textures[i].sampler, data->imageSamplers, data->imageSamplersCount, sections & Section_Samplers);
 	}
 
 	// images
 	for (unsigned long long i = 0; i < data->imagesCount; ++i) {
-		PTR_FIX(data->images[i].bufferView, data->bufferViews, data->bufferViewsCount);
+		PTR_FIX_SECTION(data->images[i].bufferView, data->bufferViews, data->bufferViewsCount, sections & Section_BufferViews);
 	}
 
 	// materials
 	for (unsigned long long i = 0; i < data->materialsCount; ++i) {
-		PTR_FIX(data->materials[i].normalTexture.texture, data->textures, data->texturesCount);
-		PTR_FIX(data->materials[i].emissiveTexture.texture, data->textures, data->texturesCount);
-		PTR_FIX(data->materials[i].occlusionTexture.texture, data->textures, data->texturesCount);
+		PTR_FIX_SECTION(data->materials[i].normalTexture.texture, data->textures, data->texturesCount, sections & Section_Textures);
+		PTR_FIX_SECTION(data->materials[i].emissiveTexture.texture, data->textures, data->texturesCount, sections & Section_Textures);
+		PTR_FIX_SECTION(data->materials[i].occlusionTexture.texture, data->textures, data->texturesCount, sections & Section_Textures);
 
-		PTR_FIX(data->materials[i].PBRmetallicRoughness.baseColorTexture.texture, data->textures, data->texturesCount);
-		PTR_FIX(data->materials[i].PBRmetallicRoughness.metallicRoughnessTexture.texture, data->textures, data->texturesCount);
+		PTR_FIX_SECTION(data->materials[i].PBRmetallicRoughness.baseColorTexture.texture, data->textures, data->texturesCount, sections & Section_Textures);
+		PTR_FIX_SECTION(data->materials[i].PBRmetallicRoughness.metallicRoughnessTexture.texture, data->textures, data->texturesCount, sections & Section_Textures);
 	}
 
 	// buffer views
 	for (unsigned long long i = 0; i < data->bufferViewsCount; ++i) {
-		PTR_FIX_REQUIRED(data->bufferViews[i].buffer, data->buffers, data->buffersCount);
+		PTR_FIX_REQUIRED_SECTION(data->bufferViews[i].buffer, data->buffers, data->buffersCount, sections & Section_Buffers);
 	}
 
 	// skins
 	for (unsigned long long i = 0; i < data->skinsCount; ++i) {
 		for (unsigned long long j = 0; j < data->skins[i].jointsCount; ++j) {
-			PTR_FIX_REQUIRED(data->skins[i].joints[j], data->nodes, data->nodesCount);
+			PTR_FIX_REQUIRED_SECTION(data->skins[i].joints[j], data->nodes, data->nodesCount, sections & Section_Nodes);
 		}
 
-		PTR_FIX(data->skins[i].skeleton, data->nodes, data->nodesCount);
-		PTR_FIX(data->skins[i].inverseBindMatrices, data->accessors, data->accessorsCount);
+		PTR_FIX_SECTION(data->skins[i].skeleton, data->nodes, data->nodesCount, sections & Section_Nodes);
+		PTR_FIX_SECTION(data->skins[i].inverseBindMatrices, data->accessors, data->accessorsCount, sections & Section_Accessors);
 	}
 
 	// nodes
 	for (unsigned long long i = 0; i < data->nodesCount; ++i) {
 		for (unsigned long long j = 0; j < data->nodes[i].childrenCount; ++j) {
-			PTR_FIX_REQUIRED(data->nodes[i].children[j], data->nodes, data->nodesCount);
+			PTR_FIX_REQUIRED_SECTION(data->nodes[i].children[j], data->nodes, data->nodesCount, sections & Section_Nodes);
 
 			if (data->nodes[i].children[j]->parent) {
 				return -1;
@@ -1898,76 +2802,143 @@ static int internal_fix_pointers(GLTF2* data) {
 			data->nodes[i].children[j]->parent = &data->nodes[i];
 		}
 
-		PTR_FIX(data->nodes[i].mesh, data->meshes, data->meshesCount);
-		PTR_FIX(data->nodes[i].skin, data->skins, data->skinsCount);
-		PTR_FIX(data->nodes[i].camera, data->cameras, data->camerasCount);
+		PTR_FIX_SECTION(data->nodes[i].mesh, data->meshes, data->meshesCount, sections & Section_Meshes);
+		PTR_FIX_SECTION(data->nodes[i].skin, data->skins, data->skinsCount, sections & Section_Skins);
+		PTR_FIX_SECTION(data->nodes[i].camera, data->cameras, data->camerasCount, sections & Section_Cameras);
 	}
 
 	// scenes
 	for (unsigned long long i = 0; i < data->scenesCount; ++i) {
 		for (unsigned long long j = 0; j < data->scenes[i].nodesCount; ++j) {
-			PTR_FIX_REQUIRED(data->scenes[i].nodes[j], data->nodes, data->nodesCount);
+			PTR_FIX_REQUIRED_SECTION(data->scenes[i].nodes[j], data->nodes, data->nodesCount, sections & Section_Nodes);
 
-			if (data->scenes[i].nodes[j]->parent) {
+			if (data->scenes[i].nodes[j] && data->scenes[i].nodes[j]->parent) {
 				return -1;
 			}
 		}
 	}
-	PTR_FIX(data->scene, data->scenes, data->scenesCount);
+	PTR_FIX_SECTION(data->scene, data->scenes, data->scenesCount, sections & Section_Scenes);
 
 	// animations
 	for (unsigned long long i = 0; i < data->animationsCount; ++i) {
 		for (unsigned long long j = 0; j < data->animations[i].samplersCount; ++j) {
-			PTR_FIX_REQUIRED(data->animations[i].samplers[j].input, data->accessors, data->accessorsCount);
-			PTR_FIX_REQUIRED(data->animations[i].samplers[j].output, data->accessors, data->accessorsCount);
+			PTR_FIX_REQUIRED_SECTION(data->animations[i].samplers[j].input, data->accessors, data->accessorsCount, sections & Section_Accessors);
+			PTR_FIX_REQUIRED_SECTION(data->animations[i].samplers[j].output, data->accessors, data->accessorsCount, sections & Section_Accessors);
 		}
 
 		for (unsigned long long j = 0; j < data->animations[i].channelsCount; ++j) {
 			PTR_FIX_REQUIRED(data->animations[i].channels[j].sampler, data->animations[i].samplers, data->animations[i].samplersCount);
-			PTR_FIX(data->animations[i].channels[j].targetNode, data->nodes, data->nodesCount);
+			PTR_FIX_SECTION(data->animations[i].channels[j].targetNode, data->nodes, data->nodesCount, sections & Section_Nodes);
 		}
 	}
 
 	return 1;
 }
 
-/// @brief begins the parsing of the GLFW
-static int internal_parse_json(const char* data, unsigned long long size, GLTF2* outData) {
-	jsmn_parser parser = { 0, 0, 0 };
+/// @brief gives the json tokens back to the workspace of the parse, or releases them when there's none
+/// @param tokens the json tokens, may be NULL
+/// @param capacity how many tokens fits in them
+static void internal_tokens_release(jsmntok_t* tokens, unsigned int capacity) {
+	GLTF_Workspace* workspace = s_gState->options.workspace;
+	if (workspace) {
+		workspace->tokens = tokens;
+		workspace->tokensCapacity = tokens ? capacity : 0;
+	}
+	else {
+		gltfmemory_deallocate(&s_gState->options.allocator, tokens);
+	}
+}
 
-	// get json token count
-	if (outData->fileInfo.jsonTkCount == 0) {
-		int tkCount = jsmn_parse(&parser, data, size, NULL, 0);
-		if (tkCount <= 0) return -1;
-		outData->fileInfo.jsonTkCount = tkCount;
+/// @brief splits a json into tokens, the tokens of the parse workspace are reused when there's one
+/// @param data the json text
+/// @param size the json size in bytes
+/// @param known how many tokens the json is known to have, 0 when it's unknown
+/// @param outTokens the json tokens followed by an UNDEFINED token, release them with internal_tokens_release
+/// @param outCapacity how many tokens fits in outTokens
+/// @return how many tokens the json has, -1 on failure
+static int internal_json_tokenize(const char* data, unsigned long long size, unsigned int known, jsmntok_t** outTokens, unsigned int* outCapacity) {
+	jsmn_parser parser;
+	jsmn_init(&parser);
+
+	// the tokens of a workspace are reused, with the allocator it was created with
+	GLTF_Workspace* workspace = s_gState->options.workspace;
+	const GLTF_Allocator* allocator = &s_gState->options.allocator;
+	jsmntok_t* tokens = NULL;
+	unsigned int capacity = 0;
+	if (workspace) {
+		if (!workspace->tokens) workspace->allocator = *allocator;
+		allocator = &workspace->allocator;
+		tokens = (jsmntok_t*)workspace->tokens;
+		capacity = workspace->tokensCapacity;
 	}
 
-	// allocate memory for the parsing
-	jsmntok_t* tokens = (jsmntok_t*)gltfmemory_allocate(sizeof(jsmntok_t) * (outData->fileInfo.jsonTkCount + 1), 0);
-	if (!tokens) return -1;
+	// a single pass that grows the tokens as needed, a known token count avoids any growth
+	if (known > 0 && capacity <= known) {
+		jsmntok_t* grown = (jsmntok_t*)gltfmemory_reallocate(allocator, tokens, sizeof(jsmntok_t) * (known + 1));
+		if (!grown) {
+			internal_tokens_release(tokens, capacity);
+			internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for the json tokens");
+			return -1;
+		}
+		tokens = grown;
+		capacity = known + 1;
+	}
 
-	// parse
-	jsmn_init(&parser);
-	int tokenCount = jsmn_parse(&parser, data, size, tokens, outData->fileInfo.jsonTkCount);
+	int tokenCount = jsmn_parse_alloc(&parser, data, size, &tokens, &capacity, allocator);
 	if (tokenCount <= 0) {
-		gltfmemory_deallocate(tokens);
+		internal_tokens_release(tokens, capacity);
+		if (tokenCount == JSMN_ERROR_NOMEM) internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for the json tokens");
+		else internal_log_error_offset(ErrorCode_InvalidJson, parser.pos, "Invalid json (error %d)", tokenCount);
 		return -1;
 	}
 
+	// there must be room for the trailing UNDEFINED token
+	if ((unsigned int)tokenCount >= capacity) {
+		jsmntok_t* grown = (jsmntok_t*)gltfmemory_reallocate(allocator, tokens, sizeof(jsmntok_t) * (tokenCount + 1));
+		if (!grown) {
+			internal_tokens_release(tokens, capacity);
+			internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for the json tokens");
+			return -1;
+		}
+		tokens = grown;
+		capacity = tokenCount + 1;
+	}
+
 	// this makes sure that we always have an UNDEFINED token at the end of the stream, for invalid JSON inputs this makes sure we don't perform out of bound reads of token data
 	tokens[tokenCount].type = JSMN_UNDEFINED;
 
-	// begins the parsing at the root-level
+	*outTokens = tokens;
+	*outCapacity = capacity;
+	return tokenCount;
+}
+
+/// @brief begins the parsing of the GLFW
+static int internal_parse_json(const char* data, unsigned long long size, GLTF2* outData) {
+	jsmntok_t* tokens = NULL;
+	unsigned int capacity = 0;
+	int tokenCount = internal_json_tokenize(data, size, outData->fileInfo.jsonTkCount, &tokens, &capacity);
+	if (tokenCount < 0) {
+		return -1;
+	}
+	outData->fileInfo.jsonTkCount = tokenCount;
+
+	// begins the parsing at the root-level, errors are reported with their json path meanwhile
+	s_gState->json = data;
+	s_gState->tokens = tokens;
+	s_gState->tokensCount = tokenCount;
+
 	int i = internal_parse_jsonroot(data, tokens, 0, outData);
-	gltfmemory_deallocate(tokens);
+
+	s_gState->json = NULL;
+	s_gState->tokens = NULL;
+	s_gState->tokensCount = 0;
+	internal_tokens_release(tokens, capacity);
 
 	if (i < 0) {
-		GLTF_Free(outData);
 		return -1;
 	}
 
 	if (internal_fix_pointers(outData) < 0) {
-		GLTF_Free(outData);
 		return -1;
 	}
 
@@ -1977,410 +2948,1576 @@ static int internal_parse_json(const char* data, unsigned long long size, GLTF2*
 	return 1;
 }
 
-GLTF2 GLTF_ParseFromFile(const char* path) {
-	s_gErrors[0] = '\0';
-	GLTF2 parsedData = { 0 };
+/// @brief parses the contents of a gltf or glb file already in memory, the caller must release outData on failure
+/// @param ptr the file contents
+/// @param size the file size
+/// @param copyBin 1 to copy the glb bin chunk, 0 to point into ptr, which must then outlive outData
+/// @param outData the output data with the parsed information
+/// @return 1 on success, 0 on failure
+static int internal_parse_document(const unsigned char* ptr, unsigned long long size, int copyBin, GLTF2* outData) {
 
-	if (!path || !path[0]) {
-		internal_log_error("Invalid GLTF path (NULL or empty)");
-		return parsedData;
+	// validate minimum file size
+	if (size < 4) {
+		internal_log_error(ErrorCode_InvalidDocument, "File too small to be valid GLTF/GLB");
+		return 0;
 	}
 
-	parsedData.fileInfo.path = path;
+	int isGlb = strncmp_impl((const char*)ptr, "glTF", 4) == 0 ? 1 : 0;
 
-	// read file
-	void* data = NULL;
-	unsigned long long size = 0;
-	if (!platform_fileread(path, &size, &data)) {
-		internal_log_error("Failed to read file: %s", path);
-		return parsedData;
+	if (!isGlb) {
+		// regular GLTF (JSON)
+		outData->fileInfo.type = 1;
+
+		int parseResult = internal_parse_json((const char*)ptr, size, outData);
+		if (parseResult < 0) {
+			internal_log_error(ErrorCode_InvalidJson, "GLTF JSON parsing failed with error: %d", parseResult);
+			return 0;
+		}
+		return 1;
 	}
 
-	// validate minimum file size
-	if (size < 4) {
-		internal_log_error("File too small to be valid GLTF/GLB");
-		gltfmemory_deallocate(data);
-		return parsedData;
+	outData->fileInfo.type = 0; // GLB
+
+	// validate GLB header
+	if (size < GLB_HEADER_SIZE) {
+		internal_log_error(ErrorCode_InvalidGLB, "GLB file too small (header incomplete)");
+		return 0;
 	}
 
-	const unsigned char* ptr = (const unsigned char*)data;
-	int isGlb = strncmp_impl((const char*)ptr, "glTF", 4) == 0 ? 1 : 0;
+	// check version
+	unsigned int version;
+	memcpy(&version, ptr + 4, 4);
+	if (version != 2) {
+		internal_log_error(ErrorCode_Unsupported, "Unsupported GLB version: %u (expected 2)", version);
+		return 0;
+	}
 
-	if (isGlb) {
-		parsedData.fileInfo.type = 0; // GLB
+	// verify total length
+	unsigned int totalLength;
+	memcpy(&totalLength, ptr + 8, 4);
+	if (totalLength != size) {
+		internal_log_error(ErrorCode_InvalidGLB, "GLB size mismatch (header: %u, actual: %llu)", totalLength, size);
+		return 0;
+	}
 
-		// validate GLB header
-		if (size < GLB_HEADER_SIZE) {
-			internal_log_error("GLB file too small (header incomplete)");
-			gltfmemory_deallocate(data);
-			return parsedData;
-		}
+	// Process chunks
+	unsigned long long offset = GLB_HEADER_SIZE;
 
-		// check version
-		unsigned int version;
-		memcpy(&version, ptr + 4, 4);
-		if (version != 2) {
-			internal_log_error("Unsupported GLB version: %u (expected 2)", version);
-			gltfmemory_deallocate(data);
-			return parsedData;
-		}
+	// JSON chunk (required)
+	if (offset + GLB_CHUNK_HEADER_SIZE > size) {
+		internal_log_error(ErrorCode_InvalidGLB, "Invalid GLB chunk header (out of bounds)");
+		return 0;
+	}
 
-		// verify total length
-		unsigned int totalLength;
-		memcpy(&totalLength, ptr + 8, 4);
-		if (totalLength != size) {
-			internal_log_error("GLB size mismatch (header: %u, actual: %llu)", totalLength, size);
-			gltfmemory_deallocate(data);
-			return parsedData;
-		}
+	unsigned int jsonLength;
+	memcpy(&jsonLength, ptr + offset, 4);
+	offset += 4;
+
+	unsigned int jsonType;
+	memcpy(&jsonType, ptr + offset, 4);
+	offset += 4;
+
+	if (jsonType != JSON_CHUNK_TYPE) {
+		internal_log_error(ErrorCode_InvalidGLB, "Missing JSON chunk (found type: 0x%X)", jsonType);
+		return 0;
+	}
 
-		// Process chunks
-		unsigned int offset = GLB_HEADER_SIZE;
+	if (offset + jsonLength > size) {
+		internal_log_error(ErrorCode_InvalidGLB, "JSON chunk size overflow (%u > %llu)", jsonLength, size - offset);
+		return 0;
+	}
+
+	// parse JSON
+	int parseResult = internal_parse_json((const char*)ptr + offset, jsonLength, outData);
+	if (parseResult < 0) {
+		internal_log_error(ErrorCode_InvalidJson, "JSON parsing failed with error: %d", parseResult);
+		return 0;
+	}
+	offset += jsonLength;
 
-		// JSON chunk (required)
+	// BIN chunk (optional)
+	if (offset < size) {
 		if (offset + GLB_CHUNK_HEADER_SIZE > size) {
-			internal_log_error("Invalid GLB chunk header (out of bounds)");
-			gltfmemory_deallocate(data);
-			return parsedData;
+			internal_log_error(ErrorCode_InvalidGLB, "Invalid BIN chunk header (out of bounds)");
+			return 0;
 		}
 
-		unsigned int jsonLength;
-		memcpy(&jsonLength, ptr + offset, 4);
+		unsigned int binLength;
+		memcpy(&binLength, ptr + offset, 4);
 		offset += 4;
 
-		unsigned int jsonType;
-		memcpy(&jsonType, ptr + offset, 4);
+		unsigned int binType;
+		memcpy(&binType, ptr + offset, 4);
 		offset += 4;
 
-		if (jsonType != JSON_CHUNK_TYPE) {
-			internal_log_error("Missing JSON chunk (found type: 0x%X)", jsonType);
-			gltfmemory_deallocate(data);
-			return parsedData;
-		}
-
-		if (offset + jsonLength > size) {
-			internal_log_error("JSON chunk size overflow (%u > %llu)", jsonLength, size - offset);
-			gltfmemory_deallocate(data);
-			return parsedData;
-		}
-
-		// parse JSON
-		int parseResult = internal_parse_json((const char*)ptr + offset, jsonLength, &parsedData);
-		if (parseResult < 0) {
-			internal_log_error("JSON parsing failed with error: %d", parseResult);
-			gltfmemory_deallocate(data);
-			GLTF_Free(&parsedData); // Clean up any partial parsing
-			memset(&parsedData, 0, sizeof(parsedData)); // Ensure we return clean state
-			return parsedData;
-		}
-		offset += jsonLength;
-
-		// BIN chunk (optional)
-		if (offset < size) {
-			if (offset + GLB_CHUNK_HEADER_SIZE > size) {
-				internal_log_error("Invalid BIN chunk header (out of bounds)");
-				gltfmemory_deallocate(data);
-				GLTF_Free(&parsedData);
-				return parsedData;
+		if (binType == BIN_CHUNK_TYPE) {
+			if (offset + binLength > size) {
+				internal_log_error(ErrorCode_InvalidGLB, "BIN chunk size overflow (%u > %llu)", binLength, size - offset);
+				return 0;
 			}
 
-			unsigned int binLength;
-			memcpy(&binLength, ptr + offset, 4);
-			offset += 4;
-
-			unsigned int binType;
-			memcpy(&binType, ptr + offset, 4);
-			offset += 4;
-
-			if (binType == BIN_CHUNK_TYPE) {
-				if (offset + binLength > size) {
-					internal_log_error("BIN chunk size overflow (%u > %llu)", binLength, size - offset);
-					gltfmemory_deallocate(data);
-					GLTF_Free(&parsedData);
-					return parsedData;
-				}
-
-				parsedData.fileInfo.bin = gltfmemory_allocate(binLength, 0);
-				if (!parsedData.fileInfo.bin) {
-					internal_log_error("Failed to allocate memory for BIN chunk");
-					gltfmemory_deallocate(data);
-					GLTF_Free(&parsedData);
-					return parsedData;
+			if (copyBin) {
+				outData->fileInfo.bin = gltfarena_allocate(s_gState->arena, binLength, 0);
+				if (!outData->fileInfo.bin) {
+					internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for BIN chunk");
+					return 0;
 				}
-				memcpy(parsedData.fileInfo.bin, ptr + offset, binLength);
-				parsedData.fileInfo.binSize = binLength;
+				memcpy(outData->fileInfo.bin, ptr + offset, binLength);
 			}
+			else {
+				outData->fileInfo.bin = (void*)(ptr + offset);
+			}
+			outData->fileInfo.binSize = binLength;
+			outData->fileInfo.binOffset = offset;
 		}
 	}
-	else {
-		// regular GLTF (JSON)
-		parsedData.fileInfo.type = 1;
-
-		int parseResult = internal_parse_json((const char*)data, size, &parsedData);
-		if (parseResult < 0) {
-			internal_log_error("GLTF JSON parsing failed with error: %d", parseResult);
-			gltfmemory_deallocate(data);
-			GLTF_Free(&parsedData);
-			memset(&parsedData, 0, sizeof(parsedData));
-			return parsedData;
-		}
-	}
-	
-	gltfmemory_deallocate(data);
-	return parsedData;
+	return 1;
 }
 
-void GLTF_Free(GLTF2* data) {
+/// @brief maps a whole file into memory, without copying it
+/// @param path the disk path of the file
+/// @param io the custom file access, unused when it has no open callback
+/// @param sequential 1 when the file is read once from start to end, 0 when it's accessed in any order
+/// @param outStorage the mapped file
+/// @return 1 on success, 0 when the file can't be mapped
+static int internal_file_map(const char* path, const GLTF_FileIO* io, int sequential, GLTF_Storage* outStorage) {
+	outStorage->size = 0;
+
+	if (!io->open) {
+		if (!platform_filemap(path, sequential, &outStorage->size, &outStorage->data)) return 0;
+		outStorage->type = StorageType_Mapped;
+		return 1;
+	}
 
-	if (!data) return;
+	if (!io->map) return 0;
 
-	// asset
-	gltfmemory_deallocate(data->asset.copyright);
-	gltfmemory_deallocate(data->asset.generator);
-	gltfmemory_deallocate(data->asset.version);
-	gltfmemory_deallocate(data->asset.minVersion);
-	gltfmemory_deallocate(data->asset.extras);
-	for (unsigned long long i = 0; i < data->asset.extensionsCount; i++) {
-		gltfmemory_deallocate(data->asset.extensions[i].name);
-		gltfmemory_deallocate(data->asset.extensions[i].data);
-	}
+	void* file = io->open(io->userData, path);
+	if (!file) return 0;
 
-	// accessors
-	for (unsigned long long i = 0; i < data->accessorsCount; i++){
-		gltfmemory_deallocate(data->accessors[i].name);
-		gltfmemory_deallocate(&data->accessors[i].extras);
-		for (unsigned long long j = 0; j < data->accessors[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->accessors[i].extensions[j].name);
-			gltfmemory_deallocate(data->accessors[i].extensions[j].data);
-		}
+	// a mapped file stays open until the storage is released
+	const void* mapped = io->map(io->userData, file, &outStorage->size);
+	if (!mapped) {
+		io->release(io->userData, file);
+		return 0;
 	}
-	gltfmemory_deallocate(data->accessors);
 
-	// buffer views
-	for (unsigned long long i = 0; i < data->bufferViewsCount; i++){
-		gltfmemory_deallocate(data->bufferViews[i].name);
-		gltfmemory_deallocate(data->bufferViews[i].data);
-		gltfmemory_deallocate(&data->bufferViews[i].extras);
-		for (unsigned long long j = 0; j < data->bufferViews[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->bufferViews[i].extensions[j].name);
-			gltfmemory_deallocate(data->bufferViews[i].extensions[j].data);
+	outStorage->data = (void*)mapped;
+	outStorage->type = StorageType_FileIO;
+	outStorage->file = file;
+	outStorage->release = io->release;
+	outStorage->userData = io->userData;
+	return 1;
+}
+
+/// @brief reads a range of bytes of a file
+/// @param path the disk path of the file
+/// @param io the custom file access, unused when it has no open callback
+/// @param offset where the range starts inside of the file
+/// @param size how many bytes to read
+/// @param dst where the bytes are written into
+/// @return 1 on success, 0 on failure
+static int internal_file_read_range(const char* path, const GLTF_FileIO* io, unsigned long long offset, unsigned long long size, void* dst) {
+	if (!io->open) return platform_filereadrange(path, offset, size, dst);
+
+	void* file = io->open(io->userData, path);
+	if (!file) return 0;
+
+	int result = io->read(io->userData, file, offset, size, dst);
+	io->release(io->userData, file);
+	return result;
+}
+
+/// @brief brings a file into memory according to the requested file mode
+/// @param path the disk path of the file
+/// @param mode how the file should be loaded
+/// @param io the custom file access, unused when it has no open callback
+/// @param allocator where a read file is allocated from
+/// @param sequential 1 when the file is read once from start to end, 0 when it's accessed in any order
+/// @param outStorage the loaded file
+/// @return 1 on success, 0 on failure
+static int internal_file_load(const char* path, GLTF_FileMode mode, const GLTF_FileIO* io, const GLTF_Allocator* allocator, int sequential, GLTF_Storage* outStorage) {
+	if (mode == FileMode_Map && internal_file_map(path, io, sequential, outStorage)) {
+		return 1;
+	}
+
+	// either mapping was not requested or it has failed, fallback to reading the file
+	outStorage->size = 0;
+
+	if (!io->open) {
+		if (!platform_fileread(path, &outStorage->size, &outStorage->data, allocator)) return 0;
+		outStorage->type = StorageType_Heap;
+		return 1;
+	}
+
+	void* file = io->open(io->userData, path);
+	if (!file) return 0;
+
+	unsigned long long size = io->size(io->userData, file);
+	void* data = size > 0 ? gltfmemory_allocate(allocator, size, 0) : NULL;
+	if (!data || !io->read(io->userData, file, 0, size, data)) {
+		gltfmemory_deallocate(allocator, data);
+		io->release(io->userData, file);
+		return 0;
+	}
+	io->release(io->userData, file);
+
+	outStorage->data = data;
+	outStorage->size = size;
+	outStorage->type = StorageType_Heap;
+	return 1;
+}
+
+/// @brief releases a storage according to it's type
+/// @param storage the storage to be released
+/// @param allocator the allocator a heap storage comes from
+static void internal_storage_release(GLTF_Storage* storage, const GLTF_Allocator* allocator) {
+	if (storage->type == StorageType_Heap) gltfmemory_deallocate(allocator, storage->data);
+	else if (storage->type == StorageType_Mapped) platform_fileunmap(storage->data, storage->size);
+	else if (storage->type == StorageType_FileIO) storage->release(storage->userData, storage->file);
+
+	gltfmemory_zero(storage, sizeof(GLTF_Storage));
+}
+
+/// @brief checks if a character is an hexadecimal digit and converts it
+/// @param c the character
+/// @return the digit value, -1 if it's not an hexadecimal digit
+static int internal_hex_value(char c) {
+	if (c >= '0' && c <= '9') return c - '0';
+	if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+	return -1;
+}
+
+/// @brief checks if a character is an ascii letter, independently of the current locale
+/// @param c the character
+/// @return 1 if it's a letter, 0 otherwise
+static int internal_is_letter(char c) {
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+/// @brief checks if an uri starts with a scheme, like "http:" or "file:"
+/// @param uri the uri
+/// @return 1 if it has a scheme, 0 otherwise, a single letter followed by ':' is a windows drive and not a scheme
+static int internal_uri_has_scheme(const char* uri) {
+	if (!internal_is_letter(uri[0])) return 0;
+
+	unsigned long long i = 1;
+	while (internal_is_letter(uri[i]) || (uri[i] >= '0' && uri[i] <= '9') || uri[i] == '+' || uri[i] == '-' || uri[i] == '.') ++i;
+	return uri[i] == ':' && i > 1;
+}
+
+/// @brief checks if a path is absolute, from the root or a windows drive
+/// @param path the path
+/// @return 1 if it's absolute, 0 if it's relative
+static int internal_path_is_absolute(const char* path) {
+	if (path[0] == '/' || path[0] == '\\') return 1;
+	return internal_is_letter(path[0]) && path[1] == ':';
+}
+
+/// @brief decodes the percent-encoded characters of an uri and joins it to the directory of a base path
+/// @param basePath the path the uri is relative to, may be NULL
+/// @param uri the uri to be resolved, it must not have a scheme
+/// @return the resolved path, allocated from the parse arena, NULL on failure
+static char* internal_resolve_uri(const char* basePath, const char* uri) {
+	unsigned long long dirLength = 0;
+
+	// absolute paths are not relative to anything
+	if (basePath && !internal_path_is_absolute(uri)) {
+		for (unsigned long long i = 0; basePath[i] != '\0'; ++i) {
+			if (basePath[i] == '/' || basePath[i] == '\\') dirLength = i + 1;
 		}
 	}
-	gltfmemory_deallocate(data->bufferViews);
 
-	// buffers
-	for (unsigned long long i = 0; i < data->buffersCount; i++) {
-		gltfmemory_deallocate(data->buffers[i].name);
-		gltfmemory_deallocate(data->buffers[i].URI);
-		gltfmemory_deallocate(&data->buffers[i].extras);
-		for (unsigned long long j = 0; j < data->buffers[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->buffers[i].extensions[j].name);
-			gltfmemory_deallocate(data->buffers[i].extensions[j].data);
-		}
-	}
-	gltfmemory_deallocate(data->buffers);
-
-	// meshes
-	for (unsigned long long i = 0; i < data->meshesCount; i++) {
-		gltfmemory_deallocate(data->meshes[i].name);
-		// primitives
-		for (unsigned long long j = 0; j < data->meshes[i].primitivesCount; j++) {
-			// attributes
-			for (unsigned long long k = 0; k < data->meshes[i].primitives[j].attributesCount; k++){
-				gltfmemory_deallocate(data->meshes[i].primitives[j].attributes[k].name);
+	unsigned long long uriLength = strlen(uri);
+	char* path = (char*)gltfarena_allocate(s_gState->arena, dirLength + uriLength + 1, 0);
+	if (!path) return NULL;
+
+	memcpy(path, basePath, dirLength);
+	char* out = path + dirLength;
+
+	for (unsigned long long i = 0; i < uriLength; ++i) {
+		if (uri[i] == '%' && i + 2 < uriLength) {
+			int high = internal_hex_value(uri[i + 1]);
+			int low = internal_hex_value(uri[i + 2]);
+			if (high >= 0 && low >= 0) {
+				*out++ = (char)(high * 16 + low);
+				i += 2;
+				continue;
 			}
-			gltfmemory_deallocate(data->meshes[i].primitives[j].attributes);
-			// targets
-			for (unsigned long long k = 0; k < data->meshes[i].primitives[j].targetsCount; k++) {
-				for (unsigned long long m = 0; m < data->meshes[i].primitives[j].targets[k].attributesCount; ++m) {
-					gltfmemory_deallocate(data->meshes[i].primitives[j].targets[k].attributes[m].name);
-				}
-				gltfmemory_deallocate(data->meshes[i].primitives[j].targets[k].attributes);
+		}
+		*out++ = uri[i];
+	}
+	*out = '\0';
+	return path;
+}
+
+/// @brief an external file to be loaded by internal_file_task
+typedef struct {
+	const char* kind;
+	unsigned long long index;
+	char* path;
+	GLTF_FileMode mode;
+	const GLTF_FileIO* io;
+	const GLTF_Allocator* allocator;
+	GLTF_Storage* storage;
+	int loaded;
+} internal_file_job;
+
+/// @brief loads one of the external files, may run on any thread so it must not log errors
+/// @note the application reads external buffers in any order, so they are not mapped for sequential access
+/// @param taskData the internal_file_job array
+/// @param index which job to run
+static void internal_file_task(void* taskData, unsigned long long index) {
+	internal_file_job* job = (internal_file_job*)taskData + index;
+	job->loaded = internal_file_load(job->path, job->mode, job->io, job->allocator, 0, job->storage);
+}
+
+/// @brief checks if an uri refers to an external file and prepares the job that loads it
+/// @param data the gltf parsed data
+/// @param kind what is being loaded, used in error messages
+/// @param index the index of what is being loaded, used in error messages
+/// @param uri the uri to be loaded, may be NULL
+/// @param storage where the file will be loaded into
+/// @param outJob the prepared job
+/// @return 1 if a job was prepared, 0 if there's nothing to load, -1 on failure
+static int internal_file_job_prepare(GLTF2* data, const char* kind, unsigned long long index, const char* uri, GLTF_Storage* storage, internal_file_job* outJob) {
+	if (!uri) {
+		return 0;
+	}
+
+	// only base64 data uris are supported, they are decoded while parsing the json so any other is left here
+	if (strncmp_impl(uri, "data:", 5) == 0) {
+		internal_log_error(ErrorCode_Unsupported, "%s %llu data uri is not base64, only base64 data uris are supported", kind, index);
+		return -1;
+	}
+
+	if (internal_uri_has_scheme(uri)) {
+		internal_log_error(ErrorCode_Unsupported, "%s %llu uri is not a file path: %s", kind, index, uri);
+		return -1;
+	}
+
+	outJob->path = internal_resolve_uri(data->fileInfo.path, uri);
+	if (!outJob->path) {
+		internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for %s %llu path", kind, index);
+		return -1;
+	}
+
+	outJob->kind = kind;
+	outJob->index = index;
+	outJob->mode = data->fileInfo.fileMode;
+	outJob->io = &data->fileInfo.io;
+	outJob->allocator = &data->fileInfo.allocator;
+	outJob->storage = storage;
+	outJob->loaded = 0;
+	return 1;
+}
+
+/// @brief loads every external buffer and image at once, then points buffer views and images into their data
+/// @param data the gltf parsed data
+/// @return 1 on success, 0 on failure
+static int internal_load_external(GLTF2* data) {
+	internal_file_job* jobs = NULL;
+	unsigned long long jobsCount = 0;
+	int result = 1;
+
+	if (data->buffersCount + data->imagesCount > 0) {
+		jobs = (internal_file_job*)gltfmemory_allocate(&s_gState->options.allocator, sizeof(internal_file_job) * (data->buffersCount + data->imagesCount), 0);
+		if (!jobs) {
+			internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for the external files");
+			return 0;
+		}
+	}
+
+	for (unsigned long long i = 0; i < data->buffersCount && result; ++i) {
+		GLTF_Buffer* buffer = &data->buffers[i];
+
+		// base64 data uris were already decoded while parsing the json
+		if (buffer->storage.type != StorageType_None) {
+			if (buffer->storage.size < buffer->size) {
+				internal_log_error(ErrorCode_InvalidDocument, "Buffer %llu data uri is smaller than its byteLength (%llu < %llu)", i, buffer->storage.size, buffer->size);
+				result = 0;
 			}
-			gltfmemory_deallocate(data->meshes[i].primitives[j].targets);
-			// extras and extensions
-			gltfmemory_deallocate(data->meshes[i].primitives[j].extras);
-			for (unsigned long long k = 0; k < data->meshes[i].primitives[j].extensionsCount; k++) {
-				gltfmemory_deallocate(data->meshes[i].primitives[j].extensions[k].name);
-				gltfmemory_deallocate(data->meshes[i].primitives[j].extensions[k].data);
+			continue;
+		}
+
+		// the glb bin chunk is referenced by the first buffer, which has no uri
+		if (!buffer->URI) {
+			if (i == 0 && data->fileInfo.type == 0 && data->fileInfo.bin) {
+				if (data->fileInfo.binSize < buffer->size) {
+					internal_log_error(ErrorCode_InvalidGLB, "GLB bin chunk is smaller than the buffer byteLength (%llu < %llu)", data->fileInfo.binSize, buffer->size);
+					result = 0;
+				}
+				buffer->data = data->fileInfo.bin;
 			}
+			continue;
 		}
-		gltfmemory_deallocate(data->meshes[i].primitives);
-		gltfmemory_deallocate(data->meshes[i].weights);
-		// target names
-		for (unsigned long long j = 0; j < data->meshes[i].targetNamesCount; j++) {
-			gltfmemory_deallocate(data->meshes[i].targetNames[j]);
+
+		int prepared = internal_file_job_prepare(data, "Buffer", i, buffer->URI, &buffer->storage, &jobs[jobsCount]);
+		if (prepared < 0) result = 0;
+		jobsCount += prepared > 0;
+	}
+
+	for (unsigned long long i = 0; i < data->imagesCount && result; ++i) {
+		GLTF_Image* image = &data->images[i];
+		if (image->storage.type != StorageType_None) continue;
+
+		int prepared = internal_file_job_prepare(data, "Image", i, image->URI, &image->storage, &jobs[jobsCount]);
+		if (prepared < 0) result = 0;
+		jobsCount += prepared > 0;
+	}
+
+	// every file is read at once, the parsing only goes on when all of them are resident
+	if (result && jobsCount > 0) {
+		if (s_gState->options.taskDispatch) s_gState->options.taskDispatch(s_gState->options.taskUserData, internal_file_task, jobs, jobsCount);
+		else platform_parallel_for(s_gState->options.loadThreads, jobsCount, internal_file_task, jobs, &s_gState->options.allocator);
+	}
+
+	for (unsigned long long i = 0; i < jobsCount; ++i) {
+		if (result && !jobs[i].loaded) {
+			internal_log_error(ErrorCode_File, "Failed to read %s %llu: %s", jobs[i].kind, jobs[i].index, jobs[i].path);
+			result = 0;
 		}
-		// extras and extensions
-		gltfmemory_deallocate(data->meshes[i].extras);
-		for (unsigned long long k = 0; k < data->meshes[i].extensionsCount; k++) {
-			gltfmemory_deallocate(data->meshes[i].extensions[k].name);
-			gltfmemory_deallocate(data->meshes[i].extensions[k].data);
+	}
+	gltfmemory_deallocate(&s_gState->options.allocator, jobs);
+	if (!result) return 0;
+
+	for (unsigned long long i = 0; i < data->buffersCount; ++i) {
+		GLTF_Buffer* buffer = &data->buffers[i];
+		if (!buffer->URI || buffer->storage.type == StorageType_None) continue;
+
+		if (buffer->storage.size < buffer->size) {
+			internal_log_error(ErrorCode_InvalidDocument, "Buffer %llu file is smaller than its byteLength (%llu < %llu)", i, buffer->storage.size, buffer->size);
+			return 0;
 		}
-		gltfmemory_deallocate(data->meshes[i].targetNames);
+		buffer->data = buffer->storage.data;
 	}
-	gltfmemory_deallocate(data->meshes);
 
-	// materials
-	for (unsigned long long i = 0; i < data->materialsCount; i++) {
-		gltfmemory_deallocate(data->materials[i].name);
-		gltfmemory_deallocate(data->materials[i].extras);
-		for (unsigned long long j = 0; j < data->materials[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->materials[i].extensions[j].name);
-			gltfmemory_deallocate(data->materials[i].extensions[j].data);
+	for (unsigned long long i = 0; i < data->bufferViewsCount; ++i) {
+		GLTF_BufferView* view = &data->bufferViews[i];
+		if (!view->buffer || !view->buffer->data) continue;
+
+		if (view->offset > view->buffer->size || view->size > view->buffer->size - view->offset) {
+			internal_log_error(ErrorCode_InvalidDocument, "Buffer view %llu is out of it's buffer bounds", i);
+			return 0;
 		}
+		view->data = (unsigned char*)view->buffer->data + view->offset;
 	}
-	gltfmemory_deallocate(data->materials);
 
-	// images
-	for (unsigned long long i = 0; i < data->imagesCount; i++) {
-		gltfmemory_deallocate(data->images[i].name);
-		gltfmemory_deallocate(data->images[i].URI);
-		gltfmemory_deallocate(data->images[i].mime_type);
-		gltfmemory_deallocate(data->images[i].extras);
-		for (unsigned long long j = 0; j < data->images[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->images[i].extensions[j].name);
-			gltfmemory_deallocate(data->images[i].extensions[j].data);
+	// images are either loaded from their own file or stored inside buffer views
+	for (unsigned long long i = 0; i < data->imagesCount; ++i) {
+		GLTF_Image* image = &data->images[i];
+
+		if (image->storage.type != StorageType_None) {
+			image->data = image->storage.data;
+			image->size = image->storage.size;
+		}
+		else if (image->bufferView && image->bufferView->data) {
+			image->data = image->bufferView->data;
+			image->size = image->bufferView->size;
 		}
 	}
-	gltfmemory_deallocate(data->images);
 
-	// textures
-	for (unsigned long long i = 0; i < data->texturesCount; i++){
-		gltfmemory_deallocate(data->textures[i].name);
-		gltfmemory_deallocate(data->textures[i].extras);
-		for (unsigned long long j = 0; j < data->textures[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->textures[i].extensions[j].name);
-			gltfmemory_deallocate(data->textures[i].extensions[j].data);
+	return 1;
+}
+
+GLTF2 GLTF_ParseFromFile(const char* path) {
+	return GLTF_ParseFromFileWithOptions(path, NULL);
+}
+
+/// @brief remembers where every buffer is loaded from, so their buffer views can be required later on
+/// @param data the gltf parsed data
+/// @return 1 on success, 0 on failure
+static int internal_prepare_lazy(GLTF2* data) {
+
+	for (unsigned long long i = 0; i < data->buffersCount; ++i) {
+		GLTF_Buffer* buffer = &data->buffers[i];
+
+		// the glb bin chunk is referenced by the first buffer, which has no uri
+		if (!buffer->URI) {
+			if (i != 0 || data->fileInfo.type != 0 || data->fileInfo.binSize == 0) continue;
+
+			if (data->fileInfo.binSize < buffer->size) {
+				internal_log_error(ErrorCode_InvalidGLB, "GLB bin chunk is smaller than the buffer byteLength (%llu < %llu)", data->fileInfo.binSize, buffer->size);
+				return 0;
+			}
+
+			// the bin chunk is still in memory when it has been copied or the file is retained
+			if (data->fileInfo.bin) {
+				buffer->data = data->fileInfo.bin;
+				continue;
+			}
+
+			if (!data->fileInfo.path) continue;
+
+			unsigned long long length = strlen(data->fileInfo.path);
+			buffer->path = (char*)gltfarena_allocate(s_gState->arena, length + 1, 0);
+			if (!buffer->path) {
+				internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for buffer %llu path", i);
+				return 0;
+			}
+			memcpy(buffer->path, data->fileInfo.path, length + 1);
+			buffer->fileOffset = data->fileInfo.binOffset;
+			continue;
+		}
+
+		// data uris are decoded as a whole when required
+		if (strncmp_impl(buffer->URI, "data:", 5) == 0) {
+			continue;
+		}
+
+		if (internal_uri_has_scheme(buffer->URI)) {
+			internal_log_error(ErrorCode_Unsupported, "Buffer %llu uri is not a file path: %s", i, buffer->URI);
+			return 0;
+		}
+
+		buffer->path = internal_resolve_uri(data->fileInfo.path, buffer->URI);
+		if (!buffer->path) {
+			internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for buffer %llu path", i);
+			return 0;
 		}
 	}
-	gltfmemory_deallocate(data->textures);
 
-	// image samplers
-	for (unsigned long long i = 0; i < data->imageSamplersCount; i++) {
-		gltfmemory_deallocate(data->imageSamplers[i].name);
-		gltfmemory_deallocate(data->imageSamplers[i].extras);
-		for (unsigned long long j = 0; j < data->imageSamplers[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->imageSamplers[i].extensions[j].name);
-			gltfmemory_deallocate(data->imageSamplers[i].extensions[j].data);
+	return 1;
+}
+
+/// @brief decodes a buffer base64 data uri into the buffer's own storage
+/// @param buffer the buffer whose uri is decoded
+/// @param allocator where the decoded data is allocated from
+/// @return 1 on success, 0 on failure
+static int internal_decode_buffer_uri(GLTF_Buffer* buffer, const GLTF_Allocator* allocator) {
+	const char* payload = strchr_impl(buffer->URI, ',');
+	if (!payload || payload - buffer->URI < 12 || gltfmemory_cmp(payload - 7, ";base64", 7) != 0) {
+		internal_log_error(ErrorCode_Unsupported, "Only base64 data uris are supported");
+		return 0;
+	}
+	payload++;
+
+	unsigned long long length = strlen(payload);
+	void* decoded = gltfmemory_allocate(allocator, base64_decoded_size(length), 0);
+	if (!decoded) {
+		internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for a base64 data uri");
+		return 0;
+	}
+
+	unsigned long long size = 0;
+	if (!base64_decode(payload, length, decoded, &size) || size < buffer->size) {
+		gltfmemory_deallocate(allocator, decoded);
+		internal_log_error(ErrorCode_InvalidDocument, "Invalid base64 data uri");
+		return 0;
+	}
+
+	buffer->storage.data = decoded;
+	buffer->storage.size = size;
+	buffer->storage.type = StorageType_Heap;
+	buffer->data = decoded;
+	return 1;
+}
+
+/// @brief checks if the parse options can be used
+/// @param options the options to be checked
+/// @return 1 if they're valid, 0 otherwise
+static int internal_options_valid(const GLTF_ParseOptions* options) {
+	const GLTF_FileIO* io = &options->io;
+	if (io->open && (!io->size || !io->read || !io->release)) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid file io, size, read and release must be set along with open");
+		return 0;
+	}
+
+	const GLTF_Allocator* allocator = &options->allocator;
+	if ((allocator->allocate || allocator->reallocate || allocator->deallocate) && (!allocator->allocate || !allocator->reallocate || !allocator->deallocate)) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid allocator, allocate, reallocate and deallocate must be set together");
+		return 0;
+	}
+	return 1;
+}
+
+/// @brief parses a document that is already in memory and loads it's external data
+/// @param file the document data, released at the end unless the options retains it
+/// @param path the path external uris are relative to, may be NULL
+/// @param options how the document should be parsed, never NULL
+/// @return a parsed output data
+static GLTF2 internal_parse_storage(GLTF_Storage file, const char* path, const GLTF_ParseOptions* options) {
+	GLTF2 parsedData = { 0 };
+	parsedData.fileInfo.path = path;
+	parsedData.fileInfo.fileMode = options->fileMode;
+	parsedData.fileInfo.io = options->io;
+	parsedData.fileInfo.allocator = options->allocator;
+	s_gState->arena = &parsedData.arena;
+
+	parsedData.arena = gltfarena_create(&options->allocator);
+	if (!parsedData.arena) {
+		internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for the parsed data");
+		internal_storage_release(&file, &options->allocator);
+		s_gState->arena = NULL;
+		return parsedData;
+	}
+
+	// when retaining the file, GLTF_Free becomes responsible for releasing it
+	if (options->retainFileData) {
+		parsedData.fileInfo.storage = file;
+	}
+
+	// strings can only point into the json when it's a private copy that lives as long as the parsed data
+	parsedData.fileInfo.stringViews = options->stringViews && options->retainFileData && file.type == StorageType_Heap;
+	s_gState->stringViews = parsedData.fileInfo.stringViews;
+
+	// lazy files reads the glb bin chunk back from the file when it's required, instead of copying it
+	int lazyFile = options->bufferMode == BufferMode_Lazy && file.type != StorageType_Borrowed;
+	int copyBin = !options->retainFileData && !lazyFile;
+
+	int parsed = internal_parse_document((const unsigned char*)file.data, file.size, copyBin, &parsedData);
+
+	if (!options->retainFileData) {
+		internal_storage_release(&file, &options->allocator);
+		parsedData.fileInfo.json = NULL;
+		if (!copyBin) parsedData.fileInfo.bin = NULL;
+	}
+
+	if (parsed && options->bufferMode == BufferMode_Load) {
+		parsed = internal_load_external(&parsedData);
+	}
+	else if (parsed && options->bufferMode == BufferMode_Lazy) {
+		parsed = internal_prepare_lazy(&parsedData);
+	}
+
+	if (!parsed) {
+		GLTF_Free(&parsedData); // Clean up any partial parsing, including the retained file
+	}
+
+	s_gState->arena = NULL;
+	s_gState->stringViews = 0;
+	return parsedData;
+}
+
+GLTF2 GLTF_ParseFromFileWithOptions(const char* path, const GLTF_ParseOptions* options) {
+	GLTF2 parsedData = { 0 };
+
+	GLTF_ParseOptions defaultOptions = { 0 };
+	if (!options) options = &defaultOptions;
+
+	internal_parse_state state;
+	internal_parse_begin(&state, options);
+
+	if (!path || !path[0]) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid GLTF path (NULL or empty)");
+	}
+	else if (internal_options_valid(options)) {
+		// read file
+		GLTF_Storage file = { 0 };
+		if (internal_file_load(path, options->fileMode, &options->io, &options->allocator, 1, &file)) {
+			parsedData = internal_parse_storage(file, path, options);
+		}
+		else {
+			internal_log_error(ErrorCode_File, "Failed to read file: %s", path);
 		}
 	}
-	gltfmemory_deallocate(data->imageSamplers);
 
-	// skins
-	for (unsigned long long i = 0; i < data->skinsCount; i++) {
-		gltfmemory_deallocate(data->skins[i].name);
-		gltfmemory_deallocate(data->skins[i].joints);
-		gltfmemory_deallocate(data->skins[i].extras);
-		for (unsigned long long j = 0; j < data->skins[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->skins[i].extensions[j].name);
-			gltfmemory_deallocate(data->skins[i].extensions[j].data);
+	internal_parse_end(&state);
+	return parsedData;
+}
+
+GLTF2 GLTF_ParseFromMemory(const void* data, unsigned long long size, const GLTF_ParseOptions* options) {
+	GLTF2 parsedData = { 0 };
+
+	GLTF_ParseOptions defaultOptions = { 0 };
+	if (!options) options = &defaultOptions;
+
+	internal_parse_state state;
+	internal_parse_begin(&state, options);
+
+	if (!data || size == 0) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid GLTF memory (NULL or empty)");
+	}
+	else if (internal_options_valid(options)) {
+		// the caller owns the memory, it's never copied nor released
+		GLTF_Storage file = { 0 };
+		file.data = (void*)data;
+		file.size = size;
+		file.type = StorageType_Borrowed;
+
+		parsedData = internal_parse_storage(file, options->basePath, options);
+	}
+
+	internal_parse_end(&state);
+	return parsedData;
+}
+
+/// @brief a workspace of a batch, taken by one file at a time
+typedef struct {
+	GLTF_Workspace workspace;
+	volatile long long busy;
+} internal_batch_slot;
+
+/// @brief the files of a batch, shared by every thread parsing them
+typedef struct {
+	const char* const* paths;
+	GLTF_ParseOptions options;
+	GLTF_BatchResult* results;
+	internal_batch_slot* slots;         // one per thread, so the tokens are allocated once per thread instead of once per file
+	unsigned int slotsCount;
+} internal_batch;
+
+/// @brief parses one file of a batch, may run on any thread
+/// @param taskData the internal_batch
+/// @param index which file to parse
+static void internal_batch_task(void* taskData, unsigned long long index) {
+	internal_batch* batch = (internal_batch*)taskData;
+	GLTF_BatchResult* result = batch->results + index;
+
+	// every file has it's own context, only it's first error is kept so huge batches stays small
+	GLTF_Context context;
+	GLTF_ParseOptions options = batch->options;
+	options.context = &context;
+
+	// takes the first free workspace, there's one per thread so there's always one unless the caller's dispatch runs more tasks at once
+	internal_batch_slot* slot = NULL;
+	for (unsigned int i = 0; i < batch->slotsCount && !slot; ++i) {
+		if (platform_atomic_add(&batch->slots[i].busy, 1) == 0) slot = batch->slots + i;
+		else platform_atomic_add(&batch->slots[i].busy, -1);
+	}
+	options.workspace = slot ? &slot->workspace : NULL;
+
+	double start = platform_time();
+	result->data = GLTF_ParseFromFileWithOptions(batch->paths[index], &options);
+	result->seconds = platform_time() - start;
+
+	if (slot) platform_atomic_add(&slot->busy, -1);
+
+	result->parsed = result->data.arena != NULL;
+	result->errorsCount = context.errorsCount;
+	if (context.errorsCount > 0) result->error = context.errors[0];
+	else memset(&result->error, 0, sizeof(GLTF_Error));
+}
+
+unsigned long long GLTF_ParseBatch(const char* const* paths, unsigned long long count, const GLTF_ParseOptions* options, GLTF_BatchResult* results, GLTF_BatchStats* outStats) {
+	GLTF_ParseOptions defaultOptions = { 0 };
+	if (!options) options = &defaultOptions;
+
+	if (outStats) memset(outStats, 0, sizeof(GLTF_BatchStats));
+
+	internal_parse_state state;
+	internal_parse_begin(&state, options);
+
+	int valid = 1;
+	if (count > 0 && (!paths || !results)) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid GLTF batch (NULL paths or results)");
+		valid = 0;
+	}
+	else if (!internal_options_valid(options)) {
+		valid = 0;
+	}
+
+	internal_parse_end(&state);
+	if (!valid || count == 0) return 0;
+
+	memset(results, 0, sizeof(GLTF_BatchResult) * count);
+
+	// the files are spread across the threads, so each of them loads it's external files by itself
+	internal_batch batch;
+	batch.paths = paths;
+	batch.options = *options;
+	batch.options.loadThreads = 1;
+	batch.options.parseThreads = 1;
+	batch.options.taskDispatch = NULL;
+	batch.options.taskUserData = NULL;
+	batch.options.workspace = NULL;
+	batch.results = results;
+
+	unsigned int threads = options->loadThreads ? options->loadThreads : platform_cpu_count();
+	if (threads > count) threads = (unsigned int)count;
+
+	// without workspaces every file simply allocates it's own tokens
+	batch.slotsCount = options->taskDispatch ? platform_cpu_count() : threads;
+	batch.slots = (internal_batch_slot*)gltfmemory_allocate(&options->allocator, sizeof(internal_batch_slot) * batch.slotsCount, 1);
+	if (!batch.slots) batch.slotsCount = 0;
+
+	double start = platform_time();
+	if (options->taskDispatch) options->taskDispatch(options->taskUserData, internal_batch_task, &batch, count);
+	else platform_parallel_for(threads, count, internal_batch_task, &batch, &options->allocator);
+	double seconds = platform_time() - start;
+
+	for (unsigned int i = 0; i < batch.slotsCount; ++i) {
+		GLTF_ReleaseWorkspace(&batch.slots[i].workspace);
+	}
+	gltfmemory_deallocate(&options->allocator, batch.slots);
+
+	unsigned long long parsedCount = 0;
+	for (unsigned long long i = 0; i < count; ++i) {
+		if (results[i].parsed) parsedCount++;
+	}
+
+	if (outStats) {
+		outStats->filesCount = count;
+		outStats->parsedCount = parsedCount;
+		outStats->threadsCount = options->taskDispatch ? 0 : threads;
+		outStats->seconds = seconds;
+		for (unsigned long long i = 0; i < count; ++i) {
+			outStats->filesSeconds += results[i].seconds;
+			if (results[i].seconds > outStats->slowestSeconds) {
+				outStats->slowestSeconds = results[i].seconds;
+				outStats->slowestIndex = i;
+			}
 		}
 	}
-	gltfmemory_deallocate(data->skins);
+	return parsedCount;
+}
+
+/// @brief tells where a probe keeps the element count of a root key
+/// @param key the root key
+/// @param info the probed metadata
+/// @return the element count of the key, NULL when the key isn't a counted collection
+static unsigned long long* internal_probe_count(internal_json_key key, GLTF_ProbeInfo* info) {
+	switch (key) {
+	case JsonKey_Accessors: return &info->accessorsCount;
+	case JsonKey_Animations: return &info->animationsCount;
+	case JsonKey_BufferViews: return &info->bufferViewsCount;
+	case JsonKey_Cameras: return &info->camerasCount;
+	case JsonKey_Images: return &info->imagesCount;
+	case JsonKey_Materials: return &info->materialsCount;
+	case JsonKey_Meshes: return &info->meshesCount;
+	case JsonKey_Nodes: return &info->nodesCount;
+	case JsonKey_Samplers: return &info->imageSamplersCount;
+	case JsonKey_Scenes: return &info->scenesCount;
+	case JsonKey_Skins: return &info->skinsCount;
+	case JsonKey_Textures: return &info->texturesCount;
+	default: return NULL;
+	}
+}
+
+/// @brief reads the byteLength of every buffer, anything else of them is skipped
+/// @param data the json entire data
+/// @param tokens the json tokens
+/// @param tkindex the json token index of the buffers array
+/// @param outInfo the probed metadata
+/// @return the next token index to be analyzed
+static int internal_probe_buffers(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_ProbeInfo* outInfo) {
+	tkindex = json_parse_array(data, tokens, tkindex, sizeof(unsigned long long), (void**)&outInfo->bufferSizes, &outInfo->buffersCount, s_gState->arena);
+	if (tkindex < 0) return tkindex;
 
-	// cameras
-	for (unsigned long long i = 0; i < data->camerasCount; i++) {
-		gltfmemory_deallocate(data->cameras[i].name);
-		if (data->cameras[i].type == CameraType_Perspective) {
-			gltfmemory_deallocate(&data->cameras[i].data.perspective.extras);
+	for (unsigned long long i = 0; i < outInfo->buffersCount; ++i) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected buffer is not a json valid object");
+		int size = tokens[tkindex].size;
+		++tkindex;
+
+		for (int j = 0; j < size; ++j) {
+			if (internal_json_key_lookup(data, tokens + tkindex) == JsonKey_ByteLength) {
+				++tkindex;
+				GLTF_ASSERT(json_read_size(data, tokens + tkindex, &outInfo->bufferSizes[i]), ErrorCode_InvalidDocument, "Invalid json number");
+				++tkindex;
+			}
+			else {
+				tkindex = json_parse_skip(tokens, tkindex + 1);
+			}
+
+			if (tkindex < 0) return tkindex;
 		}
-		else if (data->cameras[i].type == CameraType_Orthographic) {
-			gltfmemory_deallocate(&data->cameras[i].data.orthographic.extras);
+	}
+	return tkindex;
+}
+
+/// @brief reads the metadata of the json root, collections are only counted
+/// @param data the json entire data
+/// @param tokens the json tokens
+/// @param tkindex the initial token index to start probing from
+/// @param outInfo the probed metadata
+/// @return the next token index to be analyzed
+static int internal_probe_jsonroot(const char* data, const jsmntok_t* tokens, int tkindex, GLTF_ProbeInfo* outInfo) {
+	GLTF_ASSERT(tokens[tkindex].type == JSMN_OBJECT, ErrorCode_InvalidDocument, "The expected json root is not a json valid object");
+	int size = tokens[tkindex].size;
+	++tkindex;
+
+	for (int j = 0; j < size; ++j) {
+		GLTF_ASSERT(tokens[tkindex].type == JSMN_STRING || tokens[tkindex].size != 0, ErrorCode_InvalidDocument, "The expected json data is not a string");
+
+		const internal_json_key key = internal_json_key_lookup(data, tokens + tkindex);
+		unsigned long long* count = internal_probe_count(key, outInfo);
+		if (key == JsonKey_Asset) {
+			tkindex = internal_parse_asset(data, tokens, tkindex + 1, &outInfo->asset);
+		}
+		else if (key == JsonKey_Buffers && tokens[tkindex + 1].type == JSMN_ARRAY) {
+			tkindex = internal_probe_buffers(data, tokens, tkindex + 1, outInfo);
 		}
+		else if (key == JsonKey_ExtensionsUsed) {
+			tkindex = internal_parse_string_array(data, tokens, tkindex + 1, &outInfo->extensionsUsed, &outInfo->extensionsUsedCount);
+		}
+		else if (key == JsonKey_ExtensionsRequired) {
+			tkindex = internal_parse_string_array(data, tokens, tkindex + 1, &outInfo->extensionsRequired, &outInfo->extensionsRequiredCount);
+		}
+		else {
+			// legacy documents keeps their collections in objects, which aren't counted
+			if (count && tokens[tkindex + 1].type == JSMN_ARRAY) *count = tokens[tkindex + 1].size;
+			tkindex = json_parse_skip(tokens, tkindex + 1);
+		}
+
+		if (tkindex < 0) return tkindex;
+	}
+	return tkindex;
+}
 
-		gltfmemory_deallocate(data->cameras[i].extras);
-		for (unsigned long long j = 0; j < data->cameras[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->cameras[i].extensions[j].name);
-			gltfmemory_deallocate(data->cameras[i].extensions[j].data);
+/// @brief brings the json of a file into memory, only the header and the json chunk are read from a glb file
+/// @param path the disk path of the file
+/// @param options how the file is read
+/// @param outJson the json, or the whole file when it's not a glb file
+/// @param outInfo receives the glb sizes
+/// @return 1 on success, 0 on failure
+static int internal_probe_file(const char* path, const GLTF_ParseOptions* options, GLTF_Storage* outJson, GLTF_ProbeInfo* outInfo) {
+	unsigned char header[GLB_HEADER_SIZE + GLB_CHUNK_HEADER_SIZE];
+
+	// anything that isn't a glb, including files smaller than it's header, is read as a whole
+	if (!internal_file_read_range(path, &options->io, 0, sizeof(header), header) || strncmp_impl((const char*)header, "glTF", 4) != 0) {
+		if (!internal_file_load(path, options->fileMode, &options->io, &options->allocator, 1, outJson)) {
+			internal_log_error(ErrorCode_File, "Failed to read file: %s", path);
+			return 0;
+		}
+		if (outJson->size >= 4 && strncmp_impl((const char*)outJson->data, "glTF", 4) == 0) {
+			internal_log_error(ErrorCode_InvalidGLB, "GLB file too small (header incomplete)");
+			return 0;
 		}
+		outInfo->jsonSize = outJson->size;
+		return 1;
 	}
-	gltfmemory_deallocate(data->cameras);
 
-	// nodes
-	for (unsigned long long i = 0; i < data->nodesCount; i++) {
-		gltfmemory_deallocate(data->nodes[i].name);
-		gltfmemory_deallocate(data->nodes[i].children);
-		gltfmemory_deallocate(data->nodes[i].weights);
+	unsigned int version, totalLength, jsonLength, jsonType;
+	memcpy(&version, header + 4, 4);
+	memcpy(&totalLength, header + 8, 4);
+	memcpy(&jsonLength, header + GLB_HEADER_SIZE, 4);
+	memcpy(&jsonType, header + GLB_HEADER_SIZE + 4, 4);
 
-		gltfmemory_deallocate(data->nodes[i].extras);
-		for (unsigned long long j = 0; j < data->nodes[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->nodes[i].extensions[j].name);
-			gltfmemory_deallocate(data->nodes[i].extensions[j].data);
+	if (version != 2) {
+		internal_log_error(ErrorCode_Unsupported, "Unsupported GLB version: %u (expected 2)", version);
+		return 0;
+	}
+
+	if (jsonType != JSON_CHUNK_TYPE) {
+		internal_log_error(ErrorCode_InvalidGLB, "Missing JSON chunk (found type: 0x%X)", jsonType);
+		return 0;
+	}
+
+	unsigned long long jsonEnd = (unsigned long long)sizeof(header) + jsonLength;
+	if (jsonLength == 0 || jsonEnd > totalLength) {
+		internal_log_error(ErrorCode_InvalidGLB, "JSON chunk size overflow (%u > %llu)", jsonLength, (unsigned long long)totalLength - sizeof(header));
+		return 0;
+	}
+
+	outInfo->isGlb = 1;
+	outInfo->jsonSize = jsonLength;
+	outInfo->binSize = totalLength - jsonEnd > GLB_CHUNK_HEADER_SIZE ? totalLength - jsonEnd - GLB_CHUNK_HEADER_SIZE : 0;
+
+	outJson->data = gltfmemory_allocate(&options->allocator, jsonLength, 0);
+	if (!outJson->data) {
+		internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for the JSON chunk");
+		return 0;
+	}
+	outJson->size = jsonLength;
+	outJson->type = StorageType_Heap;
+
+	if (!internal_file_read_range(path, &options->io, sizeof(header), jsonLength, outJson->data)) {
+		internal_log_error(ErrorCode_File, "Failed to read the JSON chunk of file: %s", path);
+		return 0;
+	}
+	return 1;
+}
+
+GLTF_ProbeInfo GLTF_Probe(const char* path) {
+	return GLTF_ProbeWithOptions(path, NULL);
+}
+
+GLTF_ProbeInfo GLTF_ProbeWithOptions(const char* path, const GLTF_ParseOptions* options) {
+	GLTF_ProbeInfo info = { 0 };
+
+	GLTF_ParseOptions defaultOptions = { 0 };
+	if (!options) options = &defaultOptions;
+
+	internal_parse_state state;
+	internal_parse_begin(&state, options);
+
+	if (!path || !path[0]) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid GLTF path (NULL or empty)");
+	}
+	else if (internal_options_valid(options)) {
+		GLTF_Storage json = { 0 };
+		s_gState->arena = &info.arena;
+		info.arena = gltfarena_create(&options->allocator);
+
+		if (!info.arena) {
+			internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for the probed data");
+		}
+		else if (internal_probe_file(path, options, &json, &info)) {
+			jsmntok_t* tokens = NULL;
+			unsigned int capacity = 0;
+			const char* data = (const char*)json.data;
+			int tokenCount = internal_json_tokenize(data, info.jsonSize, 0, &tokens, &capacity);
+
+			if (tokenCount > 0) {
+				s_gState->json = data;
+				s_gState->tokens = tokens;
+				s_gState->tokensCount = tokenCount;
+
+				info.valid = internal_probe_jsonroot(data, tokens, 0, &info) >= 0;
+
+				s_gState->json = NULL;
+				s_gState->tokens = NULL;
+				s_gState->tokensCount = 0;
+				internal_tokens_release(tokens, capacity);
+			}
 		}
+
+		internal_storage_release(&json, &options->allocator);
+		s_gState->arena = NULL;
 	}
-	gltfmemory_deallocate(data->nodes);
 
-	// scenes
-	for (unsigned long long i = 0; i < data->scenesCount; i++) {
-		gltfmemory_deallocate(data->scenes[i].name);
-		gltfmemory_deallocate(data->scenes[i].nodes);
+	internal_parse_end(&state);
+	return info;
+}
+
+int GLTF_RequireBufferView(GLTF2* data, GLTF_BufferView* view) {
+	if (!data || !view || !view->buffer) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid buffer view to require");
+		return 0;
+	}
+
+	if (view->data) return 1;
 
-		gltfmemory_deallocate(data->scenes[i].extras);
-		for (unsigned long long j = 0; j < data->scenes[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->scenes[i].extensions[j].name);
-			gltfmemory_deallocate(data->scenes[i].extensions[j].data);
+	GLTF_Buffer* buffer = view->buffer;
+	if (view->offset > buffer->size || view->size > buffer->size - view->offset) {
+		internal_log_error(ErrorCode_InvalidDocument, "Buffer view is out of it's buffer bounds");
+		return 0;
+	}
+
+	if (!buffer->data && buffer->URI && strncmp_impl(buffer->URI, "data:", 5) == 0) {
+		if (!internal_decode_buffer_uri(buffer, &data->fileInfo.allocator)) return 0;
+	}
+
+	if (buffer->data) {
+		view->data = (unsigned char*)buffer->data + view->offset;
+		return 1;
+	}
+
+	if (!buffer->path) {
+		internal_log_error(ErrorCode_InvalidArgument, "Buffer view has no data to be loaded, the document must be parsed with BufferMode_Lazy");
+		return 0;
+	}
+
+	// mapping the whole file is cheap, the system only pages in what is touched, and the next views reuse it
+	if (data->fileInfo.fileMode == FileMode_Map && buffer->storage.type == StorageType_None && internal_file_map(buffer->path, &data->fileInfo.io, 0, &buffer->storage)) {
+		if (buffer->storage.size < buffer->fileOffset || buffer->storage.size - buffer->fileOffset < buffer->size) {
+			internal_log_error(ErrorCode_InvalidDocument, "Buffer file is smaller than its byteLength: %s", buffer->path);
+			internal_storage_release(&buffer->storage, &data->fileInfo.allocator);
+			return 0;
 		}
+
+		buffer->data = (unsigned char*)buffer->storage.data + buffer->fileOffset;
+		view->data = (unsigned char*)buffer->data + view->offset;
+		return 1;
 	}
-	gltfmemory_deallocate(data->scenes);
 
-	// animations
-	for (unsigned long long i = 0; i < data->animationsCount; i++) {
-		gltfmemory_deallocate(data->animations[i].name);
-
-		for (unsigned long long j = 0; j < data->animations[i].samplersCount; j++) {
-			gltfmemory_deallocate(data->animations[i].samplers[j].extras);
-			for (unsigned long long k = 0; k < data->animations[i].samplers[j].extensionsCount; k++) {
-				gltfmemory_deallocate(data->animations[i].samplers[j].extensions[k].name);
-				gltfmemory_deallocate(data->animations[i].samplers[j].extensions[k].data);
-			}
+	// otherwise only the bytes of this view are read
+	void* bytes = gltfmemory_allocate(&data->fileInfo.allocator, view->size > 0 ? view->size : 1, 0);
+	if (!bytes) {
+		internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for a buffer view");
+		return 0;
+	}
+
+	if (!internal_file_read_range(buffer->path, &data->fileInfo.io, buffer->fileOffset + view->offset, view->size, bytes)) {
+		gltfmemory_deallocate(&data->fileInfo.allocator, bytes);
+		internal_log_error(ErrorCode_File, "Failed to read buffer view range [%llu, %llu) of %s", buffer->fileOffset + view->offset, buffer->fileOffset + view->offset + view->size, buffer->path);
+		return 0;
+	}
+
+	view->storage.data = bytes;
+	view->storage.size = view->size;
+	view->storage.type = StorageType_Heap;
+	view->data = bytes;
+	return 1;
+}
+
+int GLTF_RequireAccessor(GLTF2* data, GLTF_Accessor* accessor) {
+	if (!data || !accessor) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid accessor to require");
+		return 0;
+	}
+
+	// accessors without buffer view are initialized with zeros
+	if (accessor->bufferView && !GLTF_RequireBufferView(data, accessor->bufferView)) return 0;
+
+	if (accessor->isSparse) {
+		if (!GLTF_RequireBufferView(data, accessor->sparse.indicesBufferView)) return 0;
+		if (!GLTF_RequireBufferView(data, accessor->sparse.valuesBufferView)) return 0;
+	}
+
+	return 1;
+}
+
+/// @brief what accessor elements are converted into when they're read
+typedef enum {
+	AccessorOutput_Float,
+	AccessorOutput_U32,
+	AccessorOutput_U16
+} internal_accessor_output;
+
+/// @brief the elements of an accessor to be read
+typedef struct {
+	const unsigned char* data;          // the first element to be read, NULL when the accessor has no buffer view
+	unsigned long long stride;          // how many bytes there are from an element of data to the next one
+	unsigned long long elementSize;     // how many bytes every element has, padding of the matrix columns included
+	unsigned long long count;           // how many elements are read
+	unsigned long long columns;         // how many columns every element is read as, matrices with padded columns are read one column at a time
+	unsigned long long rows;            // how many components every column has
+	unsigned long long columnStride;    // how many bytes there are from a column to the next one
+	const unsigned char* sparseIndices; // the sparse indices to be applied over the elements, NULL when there's none
+	const unsigned char* sparseValues;  // the sparse values, one packed element per index
+} internal_accessor_range;
+
+/// @brief reads a sparse index
+/// @param indices the sparse indices
+/// @param componentType the component type of the indices
+/// @param k which index to read
+/// @return the index value
+static unsigned long long internal_sparse_index(const unsigned char* indices, GLTF_ComponentType componentType, unsigned long long k) {
+	if (componentType == ComponentType_R8_UNSIGNED) return indices[k];
+
+	if (componentType == ComponentType_R16_UNSIGNED) {
+		unsigned short index;
+		memcpy(&index, indices + k * 2, 2);
+		return index;
+	}
+
+	unsigned int index;
+	memcpy(&index, indices + k * 4, 4);
+	return index;
+}
+
+/// @brief finds the next run of consecutive sparse indices before end
+/// @param accessor the sparse accessor
+/// @param range the elements being read, with it's sparse indices
+/// @param end the element past the last one being read
+/// @param k the sparse entry to start from, it's index must not be below the first element being read, advanced past the run
+/// @param outIndex the element index the run starts at
+/// @return how many entries the run has, 0 when there's no more
+/// @note the indices must have been checked to be strictly increasing by internal_accessor_sparse_get
+static unsigned long long internal_sparse_next_run(const GLTF_Accessor* accessor, const internal_accessor_range* range, unsigned long long end, unsigned long long* k, unsigned long long* outIndex) {
+	const GLTF_ComponentType type = accessor->sparse.indicesComponentType;
+	const unsigned long long count = accessor->sparse.count;
+	if (*k >= count) return 0;
+
+	const unsigned long long index = internal_sparse_index(range->sparseIndices, type, *k);
+	if (index >= end) return 0;
+
+	unsigned long long run = 1;
+	while (*k + run < count && index + run < end && internal_sparse_index(range->sparseIndices, type, *k + run) == index + run) ++run;
+
+	*outIndex = index;
+	*k += run;
+	return run;
+}
+
+/// @brief finds the first sparse entry whose index is not below first, the indices being increasing
+/// @param accessor the sparse accessor
+/// @param range the elements being read, with it's sparse indices
+/// @param first the first element being read
+/// @return the sparse entry
+static unsigned long long internal_sparse_lower_bound(const GLTF_Accessor* accessor, const internal_accessor_range* range, unsigned long long first) {
+	unsigned long long low = 0;
+	unsigned long long high = accessor->sparse.count;
+	while (low < high) {
+		const unsigned long long middle = low + (high - low) / 2;
+		if (internal_sparse_index(range->sparseIndices, accessor->sparse.indicesComponentType, middle) < first) low = middle + 1;
+		else high = middle;
+	}
+	return low;
+}
+
+/// @brief checks that the sparse indices and values of an accessor can be read
+/// @param accessor the sparse accessor
+/// @param elementSize how many bytes every element has
+/// @param outRange receives the sparse indices and values
+/// @return 1 on success, 0 on failure
+static int internal_accessor_sparse_get(const GLTF_Accessor* accessor, unsigned long long elementSize, internal_accessor_range* outRange) {
+	const GLTF_SparseAccessor* sparse = &accessor->sparse;
+	const GLTF_ComponentType indexType = sparse->indicesComponentType;
+	if (indexType != ComponentType_R8_UNSIGNED && indexType != ComponentType_R16_UNSIGNED && indexType != ComponentType_R32_UNSIGNED) {
+		internal_log_error(ErrorCode_InvalidDocument, "Invalid sparse indices component type %d", (int)indexType);
+		return 0;
+	}
+
+	const GLTF_BufferView* indices = sparse->indicesBufferView;
+	const GLTF_BufferView* values = sparse->valuesBufferView;
+	if (!indices || !values || !indices->data || !values->data) {
+		internal_log_error(ErrorCode_InvalidArgument, "Sparse accessor data is not loaded, it must be required with GLTF_RequireAccessor");
+		return 0;
+	}
+
+	const unsigned long long indexSize = internal_component_size(indexType);
+	if (sparse->count > accessor->count
+		|| sparse->indicesByteOffset > indices->size || sparse->count > (indices->size - sparse->indicesByteOffset) / indexSize
+		|| sparse->valueByteOffset > values->size || sparse->count > (values->size - sparse->valueByteOffset) / elementSize) {
+		internal_log_error(ErrorCode_InvalidDocument, "Sparse accessor entries are out of their buffer views bounds");
+		return 0;
+	}
+
+	outRange->sparseIndices = (const unsigned char*)indices->data + sparse->indicesByteOffset;
+	outRange->sparseValues = (const unsigned char*)values->data + sparse->valueByteOffset;
+
+	// the runs and the binary search over the indices rely on them being strictly increasing, which also keeps them in bounds once the last one is
+	for (unsigned long long k = 1; k < sparse->count; ++k) {
+		if (internal_sparse_index(outRange->sparseIndices, indexType, k) <= internal_sparse_index(outRange->sparseIndices, indexType, k - 1)) {
+			internal_log_error(ErrorCode_InvalidDocument, "Sparse accessor indices are not strictly increasing (entry %llu)", k);
+			return 0;
 		}
-		gltfmemory_deallocate(data->animations[i].samplers);
+	}
 
-		for (unsigned long long j = 0; j < data->animations[i].channelsCount; j++) {
-			for (unsigned long long j = 0; j < data->animations[i].channelsCount; j++) {
-				gltfmemory_deallocate(data->animations[i].channels[j].extras);
-				for (unsigned long long k = 0; k < data->animations[i].channels[j].extensionsCount; j++) {
-					gltfmemory_deallocate(data->animations[i].channels[j].extensions[k].name);
-					gltfmemory_deallocate(data->animations[i].channels[j].extensions[k].data);
-				}
-			}
+	if (sparse->count > 0 && internal_sparse_index(outRange->sparseIndices, indexType, sparse->count - 1) >= accessor->count) {
+		internal_log_error(ErrorCode_InvalidDocument, "Sparse accessor index is out of the accessor bounds");
+		return 0;
+	}
+	return 1;
+}
+
+/// @brief checks that the elements of an accessor can be read and finds where they are
+/// @param accessor the accessor
+/// @param first the first element to be read
+/// @param count how many elements to be read, clamped to the end of the accessor
+/// @param outRange the elements to be read
+/// @return 1 on success, 0 on failure
+static int internal_accessor_range_get(const GLTF_Accessor* accessor, unsigned long long first, unsigned long long count, internal_accessor_range* outRange) {
+	const unsigned long long componentSize = internal_component_size(accessor->componentType);
+	if (componentSize == 0) {
+		internal_log_error(ErrorCode_InvalidDocument, "Invalid accessor component type %d", (int)accessor->componentType);
+		return 0;
+	}
+
+	if (first > accessor->count) {
+		internal_log_error(ErrorCode_InvalidArgument, "Accessor read starts past it's end (%llu > %llu)", first, accessor->count);
+		return 0;
+	}
+
+	memset(outRange, 0, sizeof(internal_accessor_range));
+	outRange->elementSize = internal_calculate_attribute_size(accessor->type, accessor->componentType);
+	outRange->stride = accessor->stride;
+	outRange->count = count < accessor->count - first ? count : accessor->count - first;
+	outRange->columns = 1;
+	outRange->rows = internal_get_components_number(accessor->type);
+
+	// the columns of matrices with 1 or 2 bytes components are aligned to 4 bytes
+	if ((accessor->type == Type_Mat2 && componentSize == 1) || (accessor->type == Type_Mat3 && componentSize <= 2)) {
+		outRange->columns = accessor->type == Type_Mat2 ? 2 : 3;
+		outRange->rows = outRange->columns;
+		outRange->columnStride = (outRange->rows * componentSize + 3) & ~3ull;
+	}
+
+	if (outRange->count == 0) return 1;
+
+	// resolved sparse accessors are read as packed elements, with nothing left to apply
+	if (accessor->isSparse && accessor->sparse.resolved) {
+		outRange->data = (const unsigned char*)accessor->sparse.resolved + first * outRange->elementSize;
+		outRange->stride = outRange->elementSize;
+		return 1;
+	}
+
+	if (accessor->isSparse && !internal_accessor_sparse_get(accessor, outRange->elementSize, outRange)) return 0;
+
+	// the elements of an accessor without buffer view are zeros
+	const GLTF_BufferView* view = accessor->bufferView;
+	if (!view) return 1;
+
+	if (!view->data) {
+		internal_log_error(ErrorCode_InvalidArgument, "Accessor data is not loaded, it must be required with GLTF_RequireAccessor");
+		return 0;
+	}
+
+	const unsigned long long elementSize = outRange->elementSize;
+	const unsigned long long last = first + outRange->count - 1;
+	if (accessor->offset > view->size || view->size - accessor->offset < elementSize || last > (view->size - accessor->offset - elementSize) / accessor->stride) {
+		internal_log_error(ErrorCode_InvalidDocument, "Accessor elements are out of it's buffer view bounds");
+		return 0;
+	}
+
+	outRange->data = (const unsigned char*)view->data + accessor->offset + first * accessor->stride;
+	return 1;
+}
+
+/// @brief converts the elements of a column, or of whole elements when they have a single column
+/// @param output what the elements are converted into
+/// @param accessor the accessor the elements belong to
+/// @param src the first component to be converted
+/// @param srcStride how many bytes there are from an element of src to the next one
+/// @param rows how many components are converted per element
+/// @param count how many elements are converted
+/// @param dst where the first component is written into
+/// @param dstStride how many bytes there are from an element of dst to the next one
+static void internal_accessor_convert(internal_accessor_output output, const GLTF_Accessor* accessor, const unsigned char* src, unsigned long long srcStride, unsigned long long rows, unsigned long long count, unsigned char* dst, unsigned long long dstStride) {
+	switch (output) {
+	case AccessorOutput_Float: accessor_convert_float(src, srcStride, accessor->componentType, accessor->normalized, rows, count, (float*)dst, dstStride); break;
+	case AccessorOutput_U32: accessor_convert_u32(src, srcStride, accessor->componentType, rows, count, (unsigned int*)dst, dstStride); break;
+	case AccessorOutput_U16: accessor_convert_u16(src, srcStride, accessor->componentType, rows, count, (unsigned short*)dst, dstStride); break;
+	}
+}
+
+/// @brief reads accessor elements, sparse values included
+/// @param accessor the accessor
+/// @param first the first element to be read
+/// @param count how many elements to be read
+/// @param out where the elements are written into
+/// @param outStride how many bytes there are from an element of out to the next one, 0 means packed elements
+/// @param output what the elements are converted into
+/// @param outComponentSize the size of an output component
+/// @return how many elements were read, 0 on failure
+static unsigned long long internal_accessor_read(const GLTF_Accessor* accessor, unsigned long long first, unsigned long long count, void* out, unsigned long long outStride, internal_accessor_output output, unsigned long long outComponentSize) {
+	if (!accessor || !out) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid accessor to read");
+		return 0;
+	}
+
+	internal_accessor_range range;
+	if (!internal_accessor_range_get(accessor, first, count, &range)) return 0;
+
+	const unsigned long long columnSize = range.rows * outComponentSize;
+	const unsigned long long elementSize = range.columns * columnSize;
+	if (outStride == 0) outStride = elementSize;
+
+	unsigned char* o = (unsigned char*)out;
+	for (unsigned long long i = 0; i < range.count && !range.data; ++i) {
+		memset(o + i * outStride, 0, elementSize);
+	}
+
+	for (unsigned long long c = 0; c < range.columns && range.data; ++c) {
+		internal_accessor_convert(output, accessor, range.data + c * range.columnStride, range.stride, range.rows, range.count, o + c * columnSize, outStride);
+	}
+
+	if (!range.sparseIndices) return range.count;
+
+	// every run of consecutive sparse indices is converted at once over the base elements
+	unsigned long long k = internal_sparse_lower_bound(accessor, &range, first);
+	unsigned long long index = 0;
+	unsigned long long run;
+	while ((run = internal_sparse_next_run(accessor, &range, first + range.count, &k, &index)) > 0) {
+		const unsigned char* values = range.sparseValues + (k - run) * range.elementSize;
+		for (unsigned long long c = 0; c < range.columns; ++c) {
+			internal_accessor_convert(output, accessor, values + c * range.columnStride, range.elementSize, range.rows, run, o + (index - first) * outStride + c * columnSize, outStride);
 		}
-		gltfmemory_deallocate(data->animations[i].channels);
+	}
+	return range.count;
+}
+
+unsigned long long GLTF_AccessorReadFloat(const GLTF_Accessor* accessor, unsigned long long first, unsigned long long count, float* out, unsigned long long outStride) {
+	return internal_accessor_read(accessor, first, count, out, outStride, AccessorOutput_Float, sizeof(float));
+}
+
+unsigned long long GLTF_AccessorReadU32(const GLTF_Accessor* accessor, unsigned long long first, unsigned long long count, unsigned int* out, unsigned long long outStride) {
+	return internal_accessor_read(accessor, first, count, out, outStride, AccessorOutput_U32, sizeof(unsigned int));
+}
+
+unsigned long long GLTF_AccessorReadU16(const GLTF_Accessor* accessor, unsigned long long first, unsigned long long count, unsigned short* out, unsigned long long outStride) {
+	return internal_accessor_read(accessor, first, count, out, outStride, AccessorOutput_U16, sizeof(unsigned short));
+}
 
-		gltfmemory_deallocate(data->animations[i].extras);
-		for (unsigned long long j = 0; j < data->animations[i].extensionsCount; j++) {
-			gltfmemory_deallocate(data->animations[i].extensions[j].name);
-			gltfmemory_deallocate(data->animations[i].extensions[j].data);
+unsigned long long GLTF_AccessorMaterialize(const GLTF_Accessor* accessor, void* out, unsigned long long outSize) {
+	if (!accessor) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid accessor to materialize");
+		return 0;
+	}
+
+	const unsigned long long elementSize = internal_calculate_attribute_size(accessor->type, accessor->componentType);
+	if (elementSize == 0 || accessor->count > ~0ull / elementSize) {
+		internal_log_error(ErrorCode_InvalidDocument, "Invalid accessor component type %d", (int)accessor->componentType);
+		return 0;
+	}
+
+	const unsigned long long size = accessor->count * elementSize;
+	if (!out) return size;
+
+	if (outSize < size) {
+		internal_log_error(ErrorCode_InvalidArgument, "Accessor materialization needs %llu bytes, only %llu were given", size, outSize);
+		return 0;
+	}
+
+	internal_accessor_range range;
+	if (!internal_accessor_range_get(accessor, 0, accessor->count, &range)) return 0;
+
+	// the base elements are copied as they are, packed
+	unsigned char* o = (unsigned char*)out;
+	if (!range.data) memset(o, 0, size);
+	else if (range.stride == elementSize) memcpy(o, range.data, size);
+	else {
+		for (unsigned long long i = 0; i < range.count; ++i) {
+			memcpy(o + i * elementSize, range.data + i * range.stride, elementSize);
 		}
 	}
-	gltfmemory_deallocate(data->animations);
 
-	// extensions
-	gltfmemory_deallocate(data->extras);
-	for (unsigned long long i = 0; i < data->extensionsCount; i++) {
-		gltfmemory_deallocate(data->extensions[i].name);
-		gltfmemory_deallocate(data->extensions[i].data);
+	if (!range.sparseIndices) return size;
+
+	// then the sparse values are scattered over them, a run of consecutive indices at a time
+	unsigned long long k = 0;
+	unsigned long long index = 0;
+	unsigned long long run;
+	while ((run = internal_sparse_next_run(accessor, &range, accessor->count, &k, &index)) > 0) {
+		memcpy(o + index * elementSize, range.sparseValues + (k - run) * elementSize, run * elementSize);
 	}
+	return size;
+}
 
-	for (unsigned long long i = 0; i < data->extensionsUsedCount; i++){
-		gltfmemory_deallocate(data->extensionsUsed[i]);
+int GLTF_AccessorResolveSparse(GLTF2* data, GLTF_Accessor* accessor) {
+	if (!data || !accessor) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid accessor to resolve");
+		return 0;
 	}
-	gltfmemory_deallocate(data->extensionsUsed);
 
-	for (unsigned long long i = 0; i < data->extensionsRequiredCount; i++) {
-		gltfmemory_deallocate(data->extensionsRequired[i]);
+	if (!accessor->isSparse || accessor->sparse.resolved) return 1;
+
+	const unsigned long long size = GLTF_AccessorMaterialize(accessor, NULL, 0);
+	if (size == 0) return accessor->count == 0;
+
+	void* elements = gltfmemory_allocate(&data->fileInfo.allocator, size, 0);
+	if (!elements) {
+		internal_log_error(ErrorCode_OutOfMemory, "Failed to allocate memory for a sparse accessor");
+		return 0;
 	}
-	gltfmemory_deallocate(data->extensionsRequired);
 
-	// binary values if opened .glb instead of a .gltf
-	if (data->fileInfo.type == 0) {
-		gltfmemory_deallocate(data->fileInfo.bin);
+	if (!GLTF_AccessorMaterialize(accessor, elements, size)) {
+		gltfmemory_deallocate(&data->fileInfo.allocator, elements);
+		return 0;
 	}
 
-	gltfmemory_deallocate(data);
+	accessor->sparse.storage.data = elements;
+	accessor->sparse.storage.size = size;
+	accessor->sparse.storage.type = StorageType_Heap;
+	accessor->sparse.resolved = elements;
+	return 1;
+}
+
+unsigned long long GLTF_AccessorReadIndices(const GLTF_Accessor* accessor, GLTF_IndexFormat format, int rebase, void* out, unsigned long long outSize, GLTF_IndexInfo* outInfo) {
+	if (!accessor) {
+		internal_log_error(ErrorCode_InvalidArgument, "Invalid accessor to read indices from");
+		return 0;
+	}
+
+	const GLTF_ComponentType componentType = accessor->componentType;
+	if (accessor->type != Type_Scalar || (componentType != ComponentType_R8_UNSIGNED && componentType != ComponentType_R16_UNSIGNED && componentType != ComponentType_R32_UNSIGNED)) {
+		internal_log_error(ErrorCode_InvalidDocument, "Indices accessor must be a scalar of unsigned integers");
+		return 0;
+	}
+
+	// accessors have at least one element, which keeps 0 for failures only
+	if (accessor->count == 0) {
+		internal_log_error(ErrorCode_InvalidDocument, "Indices accessor has no index");
+		return 0;
+	}
+
+	internal_accessor_range range;
+	if (!internal_accessor_range_get(accessor, 0, accessor->count, &range)) return 0;
+
+	// packed indices are scanned straight from the buffer view, anything else is read a chunk at a time
+	unsigned int min = ~0u;
+	unsigned int max = 0;
+	unsigned int chunk[1024];
+	if (range.data && !range.sparseIndices && range.stride == range.elementSize) accessor_index_range(range.data, componentType, range.count, &min, &max);
+	else {
+		for (unsigned long long first = 0; first < range.count; first += 1024) {
+			const unsigned long long expected = range.count - first < 1024 ? range.count - first : 1024;
+			const unsigned long long read = internal_accessor_read(accessor, first, expected, chunk, 0, AccessorOutput_U32, sizeof(unsigned int));
+			if (read != expected) return 0;
+
+			unsigned int low = min, high = max;
+			accessor_index_range(chunk, ComponentType_R32_UNSIGNED, read, &low, &high);
+			if (low < min) min = low;
+			if (high > max) max = high;
+		}
+	}
+
+	const unsigned int base = rebase ? min : 0;
+	const int wide = format == IndexFormat_U32 || (format == IndexFormat_Auto && max - base >= 65535);
+	if (format == IndexFormat_U16 && max - base > 65535) {
+		internal_log_error(ErrorCode_InvalidArgument, "Indices up to %u don't fit in 16 bits", max - base);
+		return 0;
+	}
+
+	const unsigned long long size = range.count * (wide ? sizeof(unsigned int) : sizeof(unsigned short));
+	if (outInfo) {
+		outInfo->componentType = wide ? ComponentType_R32_UNSIGNED : ComponentType_R16_UNSIGNED;
+		outInfo->count = range.count;
+		outInfo->min = min;
+		outInfo->max = max;
+		outInfo->base = base;
+	}
+	if (!out) return size;
+
+	if (outSize < size) {
+		internal_log_error(ErrorCode_InvalidArgument, "Indices need %llu bytes, only %llu were given", size, outSize);
+		return 0;
+	}
+
+	if (wide) {
+		if (internal_accessor_read(accessor, 0, range.count, out, 0, AccessorOutput_U32, sizeof(unsigned int)) != range.count) return 0;
+		accessor_index_rebase(out, ComponentType_R32_UNSIGNED, range.count, base);
+		return size;
+	}
+
+	// indices above 16 bits are only rebased into it's range, which must be done before narrowing them
+	if (max > 65535) {
+		unsigned short* o = (unsigned short*)out;
+		for (unsigned long long first = 0; first < range.count; first += 1024) {
+			const unsigned long long expected = range.count - first < 1024 ? range.count - first : 1024;
+			const unsigned long long read = internal_accessor_read(accessor, first, expected, chunk, 0, AccessorOutput_U32, sizeof(unsigned int));
+			if (read != expected) return 0;
+
+			accessor_index_rebase(chunk, ComponentType_R32_UNSIGNED, read, base);
+			accessor_convert_u16(chunk, sizeof(unsigned int), ComponentType_R32_UNSIGNED, 1, read, o + first, sizeof(unsigned short));
+		}
+		return size;
+	}
+
+	if (internal_accessor_read(accessor, 0, range.count, out, 0, AccessorOutput_U16, sizeof(unsigned short)) != range.count) return 0;
+	accessor_index_rebase(out, ComponentType_R16_UNSIGNED, range.count, base);
+	return size;
+}
+
+void GLTF_Free(GLTF2* data) {
+	if (!data) return;
+
+	// the data that is loaded, mapped or decoded has it's own storage
+	for (unsigned long long i = 0; i < data->bufferViewsCount; i++) {
+		internal_storage_release(&data->bufferViews[i].storage, &data->fileInfo.allocator);
+	}
+
+	for (unsigned long long i = 0; i < data->buffersCount; i++) {
+		internal_storage_release(&data->buffers[i].storage, &data->fileInfo.allocator);
+	}
+
+	for (unsigned long long i = 0; i < data->imagesCount; i++) {
+		internal_storage_release(&data->images[i].storage, &data->fileInfo.allocator);
+	}
+
+	for (unsigned long long i = 0; i < data->accessorsCount; i++) {
+		internal_storage_release(&data->accessors[i].sparse.storage, &data->fileInfo.allocator);
+	}
+
+	// the retained file
+	internal_storage_release(&data->fileInfo.storage, &data->fileInfo.allocator);
+
+	// everything else, names, extras, extensions, the object arrays and the glb bin copy, is owned by the arena
+	gltfarena_release(&data->arena);
+
+	memset(data, 0, sizeof(GLTF2));
+}
+
+void GLTF_FreeProbe(GLTF_ProbeInfo* info) {
+	if (!info) return;
+
+	gltfarena_release(&info->arena);
+	memset(info, 0, sizeof(GLTF_ProbeInfo));
+}
+
+void GLTF_ReleaseWorkspace(GLTF_Workspace* workspace) {
+	if (!workspace) return;
+
+	gltfmemory_deallocate(&workspace->allocator, workspace->tokens);
+	memset(workspace, 0, sizeof(GLTF_Workspace));
 }
 
 GLTF_API const char* GLTF_GetErrors() {
-	return s_gErrors;
+	return s_gContext.log;
+}
+
+GLTF_API const GLTF_Context* GLTF_GetContext() {
+	return &s_gContext;
 }
@@ -0,0 +1,586 @@
+#include "gltfparser_accessor.h"
+
+#include "gltfparser_util.h"
+
+#include <string.h>
+
+#if defined(GLTF_SIMD_X86)
+#include <immintrin.h>
+#endif
+
+/// @brief converts every component of every element with the given expression of the read component v
+/// @param type the c type of the source components
+/// @param outType the c type of the destination components
+/// @param expr the converted value of v
+#define ACCESSOR_CONVERT(type, outType, expr) do { \
+	for (unsigned long long e = 0; e < count; ++e) { \
+		const unsigned char* s = src + e * srcStride; \
+		outType* d = (outType*)(dst + e * dstStride); \
+		for (unsigned long long c = 0; c < components; ++c) { \
+			type v; \
+			memcpy(&v, s + c * sizeof(type), sizeof(type)); \
+			d[c] = (outType)(expr); \
+		} \
+	} \
+} while (0)
+
+/// @brief returns the size in bytes of a single component
+/// @param componentType the component type
+/// @return the component size, 0 for an invalid component type
+static unsigned long long internal_accessor_component_size(GLTF_ComponentType componentType) {
+	switch (componentType) {
+	case ComponentType_R8:
+	case ComponentType_R8_UNSIGNED: return 1;
+	case ComponentType_R16:
+	case ComponentType_R16_UNSIGNED: return 2;
+	case ComponentType_R32_UNSIGNED:
+	case ComponentType_R32_FLOAT: return 4;
+	}
+	return 0;
+}
+
+/// @brief converts elements into floats one component at a time
+static void internal_accessor_float_scalar(const unsigned char* src, unsigned long long srcStride, GLTF_ComponentType componentType, int normalized, unsigned long long components, unsigned long long count, unsigned char* dst, unsigned long long dstStride) {
+	switch (componentType) {
+	case ComponentType_R8:
+		if (normalized) ACCESSOR_CONVERT(signed char, float, v == -128 ? -1.0f : v / 127.0f);
+		else ACCESSOR_CONVERT(signed char, float, v);
+		break;
+	case ComponentType_R8_UNSIGNED:
+		if (normalized) ACCESSOR_CONVERT(unsigned char, float, v / 255.0f);
+		else ACCESSOR_CONVERT(unsigned char, float, v);
+		break;
+	case ComponentType_R16:
+		if (normalized) ACCESSOR_CONVERT(short, float, v == -32768 ? -1.0f : v / 32767.0f);
+		else ACCESSOR_CONVERT(short, float, v);
+		break;
+	case ComponentType_R16_UNSIGNED:
+		if (normalized) ACCESSOR_CONVERT(unsigned short, float, v / 65535.0f);
+		else ACCESSOR_CONVERT(unsigned short, float, v);
+		break;
+	case ComponentType_R32_UNSIGNED:
+		if (normalized) ACCESSOR_CONVERT(unsigned int, float, v / 4294967295.0);
+		else ACCESSOR_CONVERT(unsigned int, float, v);
+		break;
+	case ComponentType_R32_FLOAT:
+		ACCESSOR_CONVERT(float, float, v);
+		break;
+	}
+}
+
+/// @brief converts elements into unsigned 32 bits integers one component at a time
+static void internal_accessor_u32_scalar(const unsigned char* src, unsigned long long srcStride, GLTF_ComponentType componentType, unsigned long long components, unsigned long long count, unsigned char* dst, unsigned long long dstStride) {
+	switch (componentType) {
+	case ComponentType_R8: ACCESSOR_CONVERT(signed char, unsigned int, v < 0 ? 0 : v); break;
+	case ComponentType_R8_UNSIGNED: ACCESSOR_CONVERT(unsigned char, unsigned int, v); break;
+	case ComponentType_R16: ACCESSOR_CONVERT(short, unsigned int, v < 0 ? 0 : v); break;
+	case ComponentType_R16_UNSIGNED: ACCESSOR_CONVERT(unsigned short, unsigned int, v); break;
+	case ComponentType_R32_UNSIGNED: ACCESSOR_CONVERT(unsigned int, unsigned int, v); break;
+	case ComponentType_R32_FLOAT: ACCESSOR_CONVERT(float, unsigned int, !(v > 0.0f) ? 0u : v >= 4294967295.0f ? 4294967295u : (unsigned int)v); break;
+	}
+}
+
+/// @brief converts elements into unsigned 16 bits integers one component at a time
+static void internal_accessor_u16_scalar(const unsigned char* src, unsigned long long srcStride, GLTF_ComponentType componentType, unsigned long long components, unsigned long long count, unsigned char* dst, unsigned long long dstStride) {
+	switch (componentType) {
+	case ComponentType_R8: ACCESSOR_CONVERT(signed char, unsigned short, v < 0 ? 0 : v); break;
+	case ComponentType_R8_UNSIGNED: ACCESSOR_CONVERT(unsigned char, unsigned short, v); break;
+	case ComponentType_R16: ACCESSOR_CONVERT(short, unsigned short, v < 0 ? 0 : v); break;
+	case ComponentType_R16_UNSIGNED: ACCESSOR_CONVERT(unsigned short, unsigned short, v); break;
+	case ComponentType_R32_UNSIGNED: ACCESSOR_CONVERT(unsigned int, unsigned short, v > 65535u ? 65535u : v); break;
+	case ComponentType_R32_FLOAT: ACCESSOR_CONVERT(float, unsigned short, !(v > 0.0f) ? 0u : v >= 65535.0f ? 65535u : (unsigned int)v); break;
+	}
+}
+
+#if defined(GLTF_SIMD_X86)
+
+/// @brief converts blocks of 8 components of 8 or 16 bits into floats, other component types are left to the scalar loop
+/// @param src the components, advanced past the converted blocks
+/// @param length how many components remains in src, updated accordingly
+/// @param dst where the floats are written into, advanced past the written floats
+/// @param componentType the type of the components of src
+/// @param normalized 1 when the components of src are normalized
+GLTF_TARGET("sse4.1") static void internal_accessor_float_sse41(const unsigned char** src, unsigned long long* length, unsigned char** dst, GLTF_ComponentType componentType, int normalized) {
+	const int isSigned = componentType == ComponentType_R8 || componentType == ComponentType_R16;
+	const int isShort = componentType == ComponentType_R16 || componentType == ComponentType_R16_UNSIGNED;
+	if (!isShort && componentType != ComponentType_R8 && componentType != ComponentType_R8_UNSIGNED) return;
+
+	// dividing rather than multiplying by the inverse gives the same result as the scalar loop, the maximum maps exactly to 1
+	const float scale = !normalized ? 1.0f : isShort ? (isSigned ? 32767.0f : 65535.0f) : (isSigned ? 127.0f : 255.0f);
+	const __m128 divisor = _mm_set1_ps(scale);
+	const __m128 minusOne = _mm_set1_ps(-1.0f);
+	const int clamp = normalized && isSigned;
+
+	while (*length >= 8) {
+		__m128i low, high;
+		if (isShort) {
+			const __m128i v = _mm_loadu_si128((const __m128i*)*src);
+			low = isSigned ? _mm_cvtepi16_epi32(v) : _mm_cvtepu16_epi32(v);
+			high = isSigned ? _mm_cvtepi16_epi32(_mm_srli_si128(v, 8)) : _mm_cvtepu16_epi32(_mm_srli_si128(v, 8));
+			*src += 16;
+		}
+		else {
+			const __m128i v = _mm_loadl_epi64((const __m128i*)*src);
+			low = isSigned ? _mm_cvtepi8_epi32(v) : _mm_cvtepu8_epi32(v);
+			high = isSigned ? _mm_cvtepi8_epi32(_mm_srli_si128(v, 4)) : _mm_cvtepu8_epi32(_mm_srli_si128(v, 4));
+			*src += 8;
+		}
+
+		// the lowest signed value is below -1 once divided, it's clamped like the scalar loop does
+		__m128 first = _mm_div_ps(_mm_cvtepi32_ps(low), divisor);
+		__m128 second = _mm_div_ps(_mm_cvtepi32_ps(high), divisor);
+		if (clamp) {
+			first = _mm_max_ps(first, minusOne);
+			second = _mm_max_ps(second, minusOne);
+		}
+
+		_mm_storeu_ps((float*)*dst, first);
+		_mm_storeu_ps((float*)*dst + 4, second);
+		*dst += 32;
+		*length -= 8;
+	}
+}
+
+/// @brief converts blocks of 16 components of 8 or 16 bits into floats, other component types are left to the scalar loop
+/// @param src the components, advanced past the converted blocks
+/// @param length how many components remains in src, updated accordingly
+/// @param dst where the floats are written into, advanced past the written floats
+/// @param componentType the type of the components of src
+/// @param normalized 1 when the components of src are normalized
+GLTF_TARGET("avx2") static void internal_accessor_float_avx2(const unsigned char** src, unsigned long long* length, unsigned char** dst, GLTF_ComponentType componentType, int normalized) {
+	const int isSigned = componentType == ComponentType_R8 || componentType == ComponentType_R16;
+	const int isShort = componentType == ComponentType_R16 || componentType == ComponentType_R16_UNSIGNED;
+	if (!isShort && componentType != ComponentType_R8 && componentType != ComponentType_R8_UNSIGNED) return;
+
+	const float scale = !normalized ? 1.0f : isShort ? (isSigned ? 32767.0f : 65535.0f) : (isSigned ? 127.0f : 255.0f);
+	const __m256 divisor = _mm256_set1_ps(scale);
+	const __m256 minusOne = _mm256_set1_ps(-1.0f);
+	const int clamp = normalized && isSigned;
+
+	while (*length >= 16) {
+		__m256i low, high;
+		if (isShort) {
+			const __m128i v0 = _mm_loadu_si128((const __m128i*)*src);
+			const __m128i v1 = _mm_loadu_si128((const __m128i*)(*src + 16));
+			low = isSigned ? _mm256_cvtepi16_epi32(v0) : _mm256_cvtepu16_epi32(v0);
+			high = isSigned ? _mm256_cvtepi16_epi32(v1) : _mm256_cvtepu16_epi32(v1);
+			*src += 32;
+		}
+		else {
+			const __m128i v = _mm_loadu_si128((const __m128i*)*src);
+			low = isSigned ? _mm256_cvtepi8_epi32(v) : _mm256_cvtepu8_epi32(v);
+			high = isSigned ? _mm256_cvtepi8_epi32(_mm_srli_si128(v, 8)) : _mm256_cvtepu8_epi32(_mm_srli_si128(v, 8));
+			*src += 16;
+		}
+
+		__m256 first = _mm256_div_ps(_mm256_cvtepi32_ps(low), divisor);
+		__m256 second = _mm256_div_ps(_mm256_cvtepi32_ps(high), divisor);
+		if (clamp) {
+			first = _mm256_max_ps(first, minusOne);
+			second = _mm256_max_ps(second, minusOne);
+		}
+
+		_mm256_storeu_ps((float*)*dst, first);
+		_mm256_storeu_ps((float*)*dst + 8, second);
+		*dst += 64;
+		*length -= 16;
+	}
+}
+
+/// @brief widens blocks of 8 unsigned components of 8 or 16 bits into 32 bits, other component types are left to the scalar loop
+/// @param src the components, advanced past the converted blocks
+/// @param length how many components remains in src, updated accordingly
+/// @param dst where the integers are written into, advanced past the written integers
+/// @param componentType the type of the components of src
+GLTF_TARGET("sse4.1") static void internal_accessor_u32_sse41(const unsigned char** src, unsigned long long* length, unsigned char** dst, GLTF_ComponentType componentType) {
+	if (componentType == ComponentType_R16_UNSIGNED) {
+		while (*length >= 8) {
+			const __m128i v = _mm_loadu_si128((const __m128i*)*src);
+			_mm_storeu_si128((__m128i*)*dst, _mm_cvtepu16_epi32(v));
+			_mm_storeu_si128((__m128i*)*dst + 1, _mm_cvtepu16_epi32(_mm_srli_si128(v, 8)));
+			*src += 16;
+			*dst += 32;
+			*length -= 8;
+		}
+	}
+	else if (componentType == ComponentType_R8_UNSIGNED) {
+		while (*length >= 8) {
+			const __m128i v = _mm_loadl_epi64((const __m128i*)*src);
+			_mm_storeu_si128((__m128i*)*dst, _mm_cvtepu8_epi32(v));
+			_mm_storeu_si128((__m128i*)*dst + 1, _mm_cvtepu8_epi32(_mm_srli_si128(v, 4)));
+			*src += 8;
+			*dst += 32;
+			*length -= 8;
+		}
+	}
+}
+
+/// @brief widens blocks of 16 unsigned components of 8 or 16 bits into 32 bits, other component types are left to the scalar loop
+/// @param src the components, advanced past the converted blocks
+/// @param length how many components remains in src, updated accordingly
+/// @param dst where the integers are written into, advanced past the written integers
+/// @param componentType the type of the components of src
+GLTF_TARGET("avx2") static void internal_accessor_u32_avx2(const unsigned char** src, unsigned long long* length, unsigned char** dst, GLTF_ComponentType componentType) {
+	if (componentType == ComponentType_R16_UNSIGNED) {
+		while (*length >= 16) {
+			_mm256_storeu_si256((__m256i*)*dst, _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)*src)));
+			_mm256_storeu_si256((__m256i*)*dst + 1, _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(*src + 16))));
+			*src += 32;
+			*dst += 64;
+			*length -= 16;
+		}
+	}
+	else if (componentType == ComponentType_R8_UNSIGNED) {
+		while (*length >= 16) {
+			const __m128i v = _mm_loadu_si128((const __m128i*)*src);
+			_mm256_storeu_si256((__m256i*)*dst, _mm256_cvtepu8_epi32(v));
+			_mm256_storeu_si256((__m256i*)*dst + 1, _mm256_cvtepu8_epi32(_mm_srli_si128(v, 8)));
+			*src += 16;
+			*dst += 64;
+			*length -= 16;
+		}
+	}
+}
+
+/// @brief widens blocks of 8 unsigned bytes, or narrows blocks of 8 unsigned 32 bits components with saturation, into 16 bits, other component types are left to the scalar loop
+/// @param src the components, advanced past the converted blocks
+/// @param length how many components remains in src, updated accordingly
+/// @param dst where the integers are written into, advanced past the written integers
+/// @param componentType the type of the components of src
+GLTF_TARGET("sse4.1") static void internal_accessor_u16_sse41(const unsigned char** src, unsigned long long* length, unsigned char** dst, GLTF_ComponentType componentType) {
+	if (componentType == ComponentType_R32_UNSIGNED) {
+		// once clamped every value is a positive signed integer, which is what packus expects
+		const __m128i max = _mm_set1_epi32(65535);
+		while (*length >= 8) {
+			const __m128i v0 = _mm_min_epu32(_mm_loadu_si128((const __m128i*)*src), max);
+			const __m128i v1 = _mm_min_epu32(_mm_loadu_si128((const __m128i*)*src + 1), max);
+			_mm_storeu_si128((__m128i*)*dst, _mm_packus_epi32(v0, v1));
+			*src += 32;
+			*dst += 16;
+			*length -= 8;
+		}
+	}
+	else if (componentType == ComponentType_R8_UNSIGNED) {
+		while (*length >= 8) {
+			_mm_storeu_si128((__m128i*)*dst, _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*)*src)));
+			*src += 8;
+			*dst += 16;
+			*length -= 8;
+		}
+	}
+}
+
+/// @brief widens blocks of 16 unsigned bytes, or narrows blocks of 16 unsigned 32 bits components with saturation, into 16 bits, other component types are left to the scalar loop
+/// @param src the components, advanced past the converted blocks
+/// @param length how many components remains in src, updated accordingly
+/// @param dst where the integers are written into, advanced past the written integers
+/// @param componentType the type of the components of src
+GLTF_TARGET("avx2") static void internal_accessor_u16_avx2(const unsigned char** src, unsigned long long* length, unsigned char** dst, GLTF_ComponentType componentType) {
+	if (componentType == ComponentType_R32_UNSIGNED) {
+		const __m256i max = _mm256_set1_epi32(65535);
+		while (*length >= 16) {
+			const __m256i v0 = _mm256_min_epu32(_mm256_loadu_si256((const __m256i*)*src), max);
+			const __m256i v1 = _mm256_min_epu32(_mm256_loadu_si256((const __m256i*)*src + 1), max);
+
+			// packus works within each 128 bits lane, the 64 bits quarters are put back in order afterwards
+			_mm256_storeu_si256((__m256i*)*dst, _mm256_permute4x64_epi64(_mm256_packus_epi32(v0, v1), 0xD8));
+			*src += 64;
+			*dst += 32;
+			*length -= 16;
+		}
+	}
+	else if (componentType == ComponentType_R8_UNSIGNED) {
+		while (*length >= 16) {
+			_mm256_storeu_si256((__m256i*)*dst, _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)*src)));
+			*src += 16;
+			*dst += 32;
+			*length -= 16;
+		}
+	}
+}
+
+/// @brief folds the lanes of the lowest and highest vectors into min and max
+/// @param lows the lanes of the lowest indices vector
+/// @param highs the lanes of the highest indices vector
+/// @param size how many bytes the vectors have
+/// @param componentSize how many bytes every lane has
+/// @param min the lowest index, updated
+/// @param max the highest index, updated
+static void internal_accessor_range_fold(const unsigned char* lows, const unsigned char* highs, unsigned long long size, unsigned long long componentSize, unsigned int* min, unsigned int* max) {
+	for (unsigned long long i = 0; i < size; i += componentSize) {
+		unsigned int low = 0, high = 0;
+		if (componentSize == 1) {
+			low = lows[i];
+			high = highs[i];
+		}
+		else if (componentSize == 2) {
+			unsigned short l, h;
+			memcpy(&l, lows + i, 2);
+			memcpy(&h, highs + i, 2);
+			low = l;
+			high = h;
+		}
+		else {
+			memcpy(&low, lows + i, 4);
+			memcpy(&high, highs + i, 4);
+		}
+		if (low < *min) *min = low;
+		if (high > *max) *max = high;
+	}
+}
+
+/// @brief finds the lowest and highest of blocks of 16 bytes of unsigned indices, the remaining ones are left to the scalar loop
+/// @param src the indices, advanced past the read blocks
+/// @param length how many indices remains in src, updated accordingly
+/// @param componentType the type of the indices
+/// @param min the lowest index, updated
+/// @param max the highest index, updated
+GLTF_TARGET("sse4.1") static void internal_accessor_range_sse41(const unsigned char** src, unsigned long long* length, GLTF_ComponentType componentType, unsigned int* min, unsigned int* max) {
+	const unsigned long long componentSize = internal_accessor_component_size(componentType);
+	const unsigned long long block = 16 / componentSize;
+	if (*length < block) return;
+
+	__m128i low = _mm_loadu_si128((const __m128i*)*src);
+	__m128i high = low;
+	while (*length >= block) {
+		const __m128i v = _mm_loadu_si128((const __m128i*)*src);
+		if (componentType == ComponentType_R8_UNSIGNED) {
+			low = _mm_min_epu8(low, v);
+			high = _mm_max_epu8(high, v);
+		}
+		else if (componentType == ComponentType_R16_UNSIGNED) {
+			low = _mm_min_epu16(low, v);
+			high = _mm_max_epu16(high, v);
+		}
+		else {
+			low = _mm_min_epu32(low, v);
+			high = _mm_max_epu32(high, v);
+		}
+		*src += 16;
+		*length -= block;
+	}
+
+	unsigned char lows[16], highs[16];
+	_mm_storeu_si128((__m128i*)lows, low);
+	_mm_storeu_si128((__m128i*)highs, high);
+	internal_accessor_range_fold(lows, highs, 16, componentSize, min, max);
+}
+
+/// @brief finds the lowest and highest of blocks of 32 bytes of unsigned indices, the remaining ones are left to the scalar loop
+/// @param src the indices, advanced past the read blocks
+/// @param length how many indices remains in src, updated accordingly
+/// @param componentType the type of the indices
+/// @param min the lowest index, updated
+/// @param max the highest index, updated
+GLTF_TARGET("avx2") static void internal_accessor_range_avx2(const unsigned char** src, unsigned long long* length, GLTF_ComponentType componentType, unsigned int* min, unsigned int* max) {
+	const unsigned long long componentSize = internal_accessor_component_size(componentType);
+	const unsigned long long block = 32 / componentSize;
+	if (*length < block) return;
+
+	__m256i low = _mm256_loadu_si256((const __m256i*)*src);
+	__m256i high = low;
+	while (*length >= block) {
+		const __m256i v = _mm256_loadu_si256((const __m256i*)*src);
+		if (componentType == ComponentType_R8_UNSIGNED) {
+			low = _mm256_min_epu8(low, v);
+			high = _mm256_max_epu8(high, v);
+		}
+		else if (componentType == ComponentType_R16_UNSIGNED) {
+			low = _mm256_min_epu16(low, v);
+			high = _mm256_max_epu16(high, v);
+		}
+		else {
+			low = _mm256_min_epu32(low, v);
+			high = _mm256_max_epu32(high, v);
+		}
+		*src += 32;
+		*length -= block;
+	}
+
+	unsigned char lows[32], highs[32];
+	_mm256_storeu_si256((__m256i*)lows, low);
+	_mm256_storeu_si256((__m256i*)highs, high);
+	internal_accessor_range_fold(lows, highs, 32, componentSize, min, max);
+}
+
+/// @brief subtracts a base from blocks of 8 indices of 16 or 32 bits, the remaining ones are left to the scalar loop
+/// @param indices the indices, advanced past the rebased blocks
+/// @param length how many indices remains, updated accordingly
+/// @param componentType the type of the indices
+/// @param base what is subtracted
+GLTF_TARGET("sse4.1") static void internal_accessor_rebase_sse41(unsigned char** indices, unsigned long long* length, GLTF_ComponentType componentType, unsigned int base) {
+	if (componentType == ComponentType_R16_UNSIGNED) {
+		const __m128i b = _mm_set1_epi16((short)base);
+		while (*length >= 8) {
+			_mm_storeu_si128((__m128i*)*indices, _mm_sub_epi16(_mm_loadu_si128((const __m128i*)*indices), b));
+			*indices += 16;
+			*length -= 8;
+		}
+	}
+	else {
+		const __m128i b = _mm_set1_epi32((int)base);
+		while (*length >= 8) {
+			_mm_storeu_si128((__m128i*)*indices, _mm_sub_epi32(_mm_loadu_si128((const __m128i*)*indices), b));
+			_mm_storeu_si128((__m128i*)*indices + 1, _mm_sub_epi32(_mm_loadu_si128((const __m128i*)*indices + 1), b));
+			*indices += 32;
+			*length -= 8;
+		}
+	}
+}
+
+/// @brief subtracts a base from blocks of 16 indices of 16 or 32 bits, the remaining ones are left to the scalar loop
+/// @param indices the indices, advanced past the rebased blocks
+/// @param length how many indices remains, updated accordingly
+/// @param componentType the type of the indices
+/// @param base what is subtracted
+GLTF_TARGET("avx2") static void internal_accessor_rebase_avx2(unsigned char** indices, unsigned long long* length, GLTF_ComponentType componentType, unsigned int base) {
+	if (componentType == ComponentType_R16_UNSIGNED) {
+		const __m256i b = _mm256_set1_epi16((short)base);
+		while (*length >= 16) {
+			_mm256_storeu_si256((__m256i*)*indices, _mm256_sub_epi16(_mm256_loadu_si256((const __m256i*)*indices), b));
+			*indices += 32;
+			*length -= 16;
+		}
+	}
+	else {
+		const __m256i b = _mm256_set1_epi32((int)base);
+		while (*length >= 16) {
+			_mm256_storeu_si256((__m256i*)*indices, _mm256_sub_epi32(_mm256_loadu_si256((const __m256i*)*indices), b));
+			_mm256_storeu_si256((__m256i*)*indices + 1, _mm256_sub_epi32(_mm256_loadu_si256((const __m256i*)*indices + 1), b));
+			*indices += 64;
+			*length -= 16;
+		}
+	}
+}
+
+#endif
+
+void accessor_convert_float(const void* src, unsigned long long srcStride, GLTF_ComponentType componentType, int normalized, unsigned long long components, unsigned long long count, float* dst, unsigned long long dstStride) {
+	const unsigned char* s = (const unsigned char*)src;
+	unsigned char* d = (unsigned char*)dst;
+	const unsigned long long componentSize = internal_accessor_component_size(componentType);
+
+	// packed elements on both sides are a single run of components, converted in blocks
+	if (srcStride == components * componentSize && dstStride == components * sizeof(float)) {
+		unsigned long long length = count * components;
+		if (componentType == ComponentType_R32_FLOAT) {
+			memcpy(d, s, length * sizeof(float));
+			return;
+		}
+
+#if defined(GLTF_SIMD_X86)
+		unsigned int features = platform_cpu_features();
+		if (features & CPU_FEATURE_AVX2) internal_accessor_float_avx2(&s, &length, &d, componentType, normalized);
+		if (features & CPU_FEATURE_SSE41) internal_accessor_float_sse41(&s, &length, &d, componentType, normalized);
+#endif
+
+		internal_accessor_float_scalar(s, componentSize, componentType, normalized, 1, length, d, sizeof(float));
+		return;
+	}
+
+	internal_accessor_float_scalar(s, srcStride, componentType, normalized, components, count, d, dstStride);
+}
+
+void accessor_convert_u32(const void* src, unsigned long long srcStride, GLTF_ComponentType componentType, unsigned long long components, unsigned long long count, unsigned int* dst, unsigned long long dstStride) {
+	const unsigned char* s = (const unsigned char*)src;
+	unsigned char* d = (unsigned char*)dst;
+	const unsigned long long componentSize = internal_accessor_component_size(componentType);
+
+	if (srcStride == components * componentSize && dstStride == components * sizeof(unsigned int)) {
+		unsigned long long length = count * components;
+		if (componentType == ComponentType_R32_UNSIGNED) {
+			memcpy(d, s, length * sizeof(unsigned int));
+			return;
+		}
+
+#if defined(GLTF_SIMD_X86)
+		unsigned int features = platform_cpu_features();
+		if (features & CPU_FEATURE_AVX2) internal_accessor_u32_avx2(&s, &length, &d, componentType);
+		if (features & CPU_FEATURE_SSE41) internal_accessor_u32_sse41(&s, &length, &d, componentType);
+#endif
+
+		internal_accessor_u32_scalar(s, componentSize, componentType, 1, length, d, sizeof(unsigned int));
+		return;
+	}
+
+	internal_accessor_u32_scalar(s, srcStride, componentType, components, count, d, dstStride);
+}
+
+void accessor_convert_u16(const void* src, unsigned long long srcStride, GLTF_ComponentType componentType, unsigned long long components, unsigned long long count, unsigned short* dst, unsigned long long dstStride) {
+	const unsigned char* s = (const unsigned char*)src;
+	unsigned char* d = (unsigned char*)dst;
+	const unsigned long long componentSize = internal_accessor_component_size(componentType);
+
+	if (srcStride == components * componentSize && dstStride == components * sizeof(unsigned short)) {
+		unsigned long long length = count * components;
+		if (componentType == ComponentType_R16_UNSIGNED) {
+			memcpy(d, s, length * sizeof(unsigned short));
+			return;
+		}
+
+#if defined(GLTF_SIMD_X86)
+		unsigned int features = platform_cpu_features();
+		if (features & CPU_FEATURE_AVX2) internal_accessor_u16_avx2(&s, &length, &d, componentType);
+		if (features & CPU_FEATURE_SSE41) internal_accessor_u16_sse41(&s, &length, &d, componentType);
+#endif
+
+		internal_accessor_u16_scalar(s, componentSize, componentType, 1, length, d, sizeof(unsigned short));
+		return;
+	}
+
+	internal_accessor_u16_scalar(s, srcStride, componentType, components, count, d, dstStride);
+}
+
+void accessor_index_range(const void* src, GLTF_ComponentType componentType, unsigned long long count, unsigned int* outMin, unsigned int* outMax) {
+	const unsigned char* s = (const unsigned char*)src;
+	const unsigned long long componentSize = internal_accessor_component_size(componentType);
+	if (count == 0 || (componentType != ComponentType_R8_UNSIGNED && componentType != ComponentType_R16_UNSIGNED && componentType != ComponentType_R32_UNSIGNED)) return;
+
+	unsigned int min = ~0u;
+	unsigned int max = 0;
+	unsigned long long length = count;
+
+#if defined(GLTF_SIMD_X86)
+	unsigned int features = platform_cpu_features();
+	if (features & CPU_FEATURE_AVX2) internal_accessor_range_avx2(&s, &length, componentType, &min, &max);
+	if (features & CPU_FEATURE_SSE41) internal_accessor_range_sse41(&s, &length, componentType, &min, &max);
+#endif
+
+	for (unsigned long long i = 0; i < length; ++i) {
+		unsigned int v;
+		if (componentSize == 1) v = s[i];
+		else if (componentSize == 2) {
+			unsigned short index;
+			memcpy(&index, s + i * 2, 2);
+			v = index;
+		}
+		else memcpy(&v, s + i * 4, 4);
+
+		if (v < min) min = v;
+		if (v > max) max = v;
+	}
+
+	*outMin = min;
+	*outMax = max;
+}
+
+void accessor_index_rebase(void* indices, GLTF_ComponentType componentType, unsigned long long count, unsigned int base) {
+	unsigned char* d = (unsigned char*)indices;
+	unsigned long long length = count;
+	if (base == 0) return;
+
+#if defined(GLTF_SIMD_X86)
+	unsigned int features = platform_cpu_features();
+	if (features & CPU_FEATURE_AVX2) internal_accessor_rebase_avx2(&d, &length, componentType, base);
+	if (features & CPU_FEATURE_SSE41) internal_accessor_rebase_sse41(&d, &length, componentType, base);
+#endif
+
+	if (componentType == ComponentType_R16_UNSIGNED) {
+		unsigned short* i16 = (unsigned short*)d;
+		for (unsigned long long i = 0; i < length; ++i) i16[i] = (unsigned short)(i16[i] - base);
+	}
+	else {
+		unsigned int* i32 = (unsigned int*)d;
+		for (unsigned long long i = 0; i < length; ++i) i32[i] -= base;
+	}
+}
@@ -0,0 +1,193 @@
+#include "gltfparser_base64.h"
+
+#include "gltfparser_util.h"
+
+#if defined(GLTF_SIMD_X86)
+#include <immintrin.h>
+#endif
+
+/// @brief marks the padding character
+#define BASE64_PAD 0xFE
+
+/// @brief marks the backslash of a json escaped slash, which is skipped
+#define BASE64_SKIP 0xFD
+
+/// @brief maps every character to it's 6 bits value, 0xFF are invalid characters
+static const unsigned char s_gBase64Table[256] = {
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+	0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
+	0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+	0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+	0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+/// @brief decodes base64 characters one at a time, also handles padding and escaped slashes
+/// @param src the base64 characters
+/// @param length how many characters src has
+/// @param dst where the decoded bytes are written into
+/// @param outSize how many bytes were decoded
+/// @return 1 on success, 0 on invalid input
+static int internal_base64_decode_scalar(const unsigned char* src, unsigned long long length, unsigned char* dst, unsigned long long* outSize) {
+	unsigned int accumulator = 0;
+	int sextets = 0;
+	unsigned long long o = 0;
+
+	for (unsigned long long i = 0; i < length; ++i) {
+		unsigned char value = s_gBase64Table[src[i]];
+
+		if (value < 64) {
+			accumulator = (accumulator << 6) | value;
+			if (++sextets == 4) {
+				dst[o++] = (unsigned char)(accumulator >> 16);
+				dst[o++] = (unsigned char)(accumulator >> 8);
+				dst[o++] = (unsigned char)accumulator;
+				accumulator = 0;
+				sextets = 0;
+			}
+		}
+		else if (value == BASE64_SKIP) continue;
+		else if (value == BASE64_PAD) break;
+		else return 0;
+	}
+
+	// a single leftover character can't represent a byte
+	if (sextets == 1) return 0;
+	if (sextets == 2) {
+		dst[o++] = (unsigned char)(accumulator >> 4);
+	}
+	else if (sextets == 3) {
+		dst[o++] = (unsigned char)(accumulator >> 10);
+		dst[o++] = (unsigned char)(accumulator >> 2);
+	}
+
+	*outSize = o;
+	return 1;
+}
+
+#if defined(GLTF_SIMD_X86)
+
+/// @brief decodes blocks of 16 characters into 12 bytes, stops at the first block with anything other than the base64 alphabet
+/// @param src the base64 characters, advanced past the decoded blocks
+/// @param length how many characters remains in src, updated accordingly
+/// @param dst where the decoded bytes are written into, advanced past the written bytes
+GLTF_TARGET("ssse3") static void internal_base64_decode_ssse3(const unsigned char** src, unsigned long long* length, unsigned char** dst) {
+	const __m128i lutLow = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+	const __m128i lutHigh = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+	const __m128i lutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+	const __m128i mask2F = _mm_set1_epi8(0x2F);
+	const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+	// each store writes 16 bytes but only 12 are decoded, the remaining characters guarantee the extra bytes are inside dst
+	while (*length >= 24) {
+		__m128i str = _mm_loadu_si128((const __m128i*)*src);
+
+		// classify the characters by their nibbles, any invalid character has a bit in common in both lookups
+		const __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(str, 4), mask2F);
+		const __m128i lowNibbles = _mm_and_si128(str, mask2F);
+		const __m128i high = _mm_shuffle_epi8(lutHigh, highNibbles);
+		const __m128i low = _mm_shuffle_epi8(lutLow, lowNibbles);
+		if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(low, high), _mm_setzero_si128())) != 0) {
+			return;
+		}
+
+		// translate the characters into their 6 bits values, '/' shares the high nibble with '+' and needs it's own offset
+		const __m128i eq2F = _mm_cmpeq_epi8(str, mask2F);
+		const __m128i roll = _mm_shuffle_epi8(lutRoll, _mm_add_epi8(eq2F, highNibbles));
+		str = _mm_add_epi8(str, roll);
+
+		// merge the 6 bits values into 24 bits groups and pack them together
+		const __m128i merged = _mm_maddubs_epi16(str, _mm_set1_epi32(0x01400140));
+		const __m128i out = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+		_mm_storeu_si128((__m128i*)*dst, _mm_shuffle_epi8(out, pack));
+
+		*src += 16;
+		*length -= 16;
+		*dst += 12;
+	}
+}
+
+/// @brief decodes blocks of 32 characters into 24 bytes, stops at the first block with anything other than the base64 alphabet
+/// @param src the base64 characters, advanced past the decoded blocks
+/// @param length how many characters remains in src, updated accordingly
+/// @param dst where the decoded bytes are written into, advanced past the written bytes
+GLTF_TARGET("avx2") static void internal_base64_decode_avx2(const unsigned char** src, unsigned long long* length, unsigned char** dst) {
+	const __m256i lutLow = _mm256_setr_epi8(
+		0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+		0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+	const __m256i lutHigh = _mm256_setr_epi8(
+		0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+	const __m256i lutRoll = _mm256_setr_epi8(
+		0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+	const __m256i mask2F = _mm256_set1_epi8(0x2F);
+	const __m256i pack = _mm256_setr_epi8(
+		2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+		2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+	const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1);
+
+	// each store writes 32 bytes but only 24 are decoded, the remaining characters guarantee the extra bytes are inside dst
+	while (*length >= 45) {
+		__m256i str = _mm256_loadu_si256((const __m256i*)*src);
+
+		const __m256i highNibbles = _mm256_and_si256(_mm256_srli_epi32(str, 4), mask2F);
+		const __m256i lowNibbles = _mm256_and_si256(str, mask2F);
+		const __m256i high = _mm256_shuffle_epi8(lutHigh, highNibbles);
+		const __m256i low = _mm256_shuffle_epi8(lutLow, lowNibbles);
+		if (_mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_and_si256(low, high), _mm256_setzero_si256())) != 0) {
+			return;
+		}
+
+		const __m256i eq2F = _mm256_cmpeq_epi8(str, mask2F);
+		const __m256i roll = _mm256_shuffle_epi8(lutRoll, _mm256_add_epi8(eq2F, highNibbles));
+		str = _mm256_add_epi8(str, roll);
+
+		// same as the ssse3 version, but each 128 bits lane is packed on it's own and then the lanes are joined
+		const __m256i merged = _mm256_maddubs_epi16(str, _mm256_set1_epi32(0x01400140));
+		__m256i out = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+		out = _mm256_shuffle_epi8(out, pack);
+		out = _mm256_permutevar8x32_epi32(out, lanes);
+		_mm256_storeu_si256((__m256i*)*dst, out);
+
+		*src += 32;
+		*length -= 32;
+		*dst += 24;
+	}
+}
+
+#endif
+
+unsigned long long base64_decoded_size(unsigned long long length) {
+	return (length / 4) * 3 + 3;
+}
+
+int base64_decode(const char* src, unsigned long long length, void* dst, unsigned long long* outSize) {
+	const unsigned char* s = (const unsigned char*)src;
+	unsigned char* o = (unsigned char*)dst;
+
+#if defined(GLTF_SIMD_X86)
+	// the vectorized loops only consumes whole blocks, whatever is left (padding, escapes, tail) goes through the scalar loop
+	unsigned int features = platform_cpu_features();
+	if (features & CPU_FEATURE_AVX2) internal_base64_decode_avx2(&s, &length, &o);
+	if (features & CPU_FEATURE_SSSE3) internal_base64_decode_ssse3(&s, &length, &o);
+#endif
+
+	unsigned long long tailSize = 0;
+	if (!internal_base64_decode_scalar(s, length, o, &tailSize)) {
+		return 0;
+	}
+
+	*outSize = (unsigned long long)(o - (unsigned char*)dst) + tailSize;
+	return 1;
+}
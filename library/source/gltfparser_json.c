@@ -1,8 +1,8 @@
 #include "gltfparser_json.h"
 
+#include "gltfparser_number.h"
 #include "gltfparser_util.h"
 
-#include <stdlib.h>
 #include <string.h>
 
 int json_strncmp(const char* data, const jsmntok_t* tok, const char* str) {
@@ -10,7 +10,8 @@ int json_strncmp(const char* data, const jsmntok_t* tok, const char* str) {
 
 	unsigned long long strLen = strlen(str);
 	unsigned long long nameLength = (unsigned long long)(tok->end - tok->start);
-	return strncmp_impl((const char*)data + tok->start, str, strLen);
+	if (nameLength != strLen) return nameLength < strLen ? -1 : 1;
+	return gltfmemory_cmp((const char*)data + tok->start, str, strLen);
 }
 
 int json_to_bool(const char* data, const jsmntok_t* tok) {
@@ -18,55 +19,145 @@ int json_to_bool(const char* data, const jsmntok_t* tok) {
 	return size == 4 && gltfmemory_cmp(data + tok->start, "true", 4) == 0;
 }
 
-int json_to_int(const char* data, const jsmntok_t* tok) {
-	if (tok->type != JSMN_PRIMITIVE) return -1;
+int json_read_int(const char* data, const jsmntok_t* tok, int* outValue) {
+	if (tok->type != JSMN_PRIMITIVE) return 0;
 
-	char tmp[128];
-	int size = (unsigned long long)(tok->end - tok->start) < sizeof(tmp) ? (int)(tok->end - tok->start) : (int)(sizeof(tmp) - 1);
-	strncpy_impl(tmp, (const char*)data + tok->start, size);
-	tmp[size] = 0;
-	return atoi(tmp);
+	long long value = 0;
+	if (!number_parse_int64(data + tok->start, (unsigned long long)(tok->end - tok->start), &value)) return 0;
+	if (value < -2147483647 - 1 || value > 2147483647) return 0;
+
+	*outValue = (int)value;
+	return 1;
+}
+
+int json_read_float(const char* data, const jsmntok_t* tok, float* outValue) {
+	if (tok->type != JSMN_PRIMITIVE) return 0;
+	return number_parse_float(data + tok->start, (unsigned long long)(tok->end - tok->start), outValue);
 }
 
-float json_to_float(const char* data, const jsmntok_t* tok) {
-	if (tok->type != JSMN_PRIMITIVE) return -1;
+int json_read_size(const char* data, const jsmntok_t* tok, unsigned long long* outValue) {
+	if (tok->type != JSMN_PRIMITIVE) return 0;
+	return number_parse_uint64(data + tok->start, (unsigned long long)(tok->end - tok->start), outValue);
+}
+
+/// @brief checks if a json string has any escape sequence
+static int json_has_escapes(const char* str, unsigned long long length) {
+	for (unsigned long long i = 0; i < length; ++i) {
+		if (str[i] == '\\') return 1;
+	}
+	return 0;
+}
 
-	char tmp[128];
-	int size = (unsigned long long)(tok->end - tok->start) < sizeof(tmp) ? (int)(tok->end - tok->start) : (int)(sizeof(tmp) - 1);
-	strncpy_impl(tmp, (const char*)data + tok->start, size);
-	tmp[size] = 0;
-	return (float)atof(tmp);
+/// @brief converts 4 hexadecimal characters into their value, jsmn already made sure they're valid
+static unsigned int json_hex4(const char* str) {
+	unsigned int value = 0;
+	for (int i = 0; i < 4; ++i) {
+		char c = str[i];
+		value <<= 4;
+		if (c >= '0' && c <= '9') value |= (unsigned int)(c - '0');
+		else if (c >= 'a' && c <= 'f') value |= (unsigned int)(c - 'a' + 10);
+		else if (c >= 'A' && c <= 'F') value |= (unsigned int)(c - 'A' + 10);
+	}
+	return value;
 }
 
-unsigned long long json_to_size(const char* data, const jsmntok_t* tok) {
-	if (tok->type != JSMN_PRIMITIVE) return -1;
+/// @brief decodes the escape sequences of a json string, unicode escapes are written as utf-8
+/// @param dst where the decoded string is written, it may be str itself since the decoded string is never longer
+/// @param str the json string characters, without the quotes
+/// @param length how many characters str has
+/// @return the decoded length
+static unsigned long long json_decode_escapes(char* dst, const char* str, unsigned long long length) {
+	unsigned long long out = 0;
+	for (unsigned long long i = 0; i < length; ++i) {
+		if (str[i] != '\\' || i + 1 >= length) {
+			dst[out++] = str[i];
+			continue;
+		}
 
-	char tmp[128];
-	int size = (unsigned long long)(tok->end - tok->start) < sizeof(tmp) ? (int)(tok->end - tok->start) : (int)(sizeof(tmp) - 1);
-	strncpy_impl(tmp, (const char*)data + tok->start, size);
-	tmp[size] = 0;
-	long long res = atoll(tmp);
-	return res < 0 ? 0 : (unsigned long long)res;
+		char c = str[++i];
+		switch (c)
+		{
+			case 'b': dst[out++] = '\b'; break;
+			case 'f': dst[out++] = '\f'; break;
+			case 'n': dst[out++] = '\n'; break;
+			case 'r': dst[out++] = '\r'; break;
+			case 't': dst[out++] = '\t'; break;
+			case 'u': {
+				if (i + 4 >= length) return out;
+				unsigned int code = json_hex4(str + i + 1);
+				i += 4;
+
+				// a surrogate pair makes a single code point, a lone surrogate becomes the replacement character
+				if (code >= 0xD800 && code <= 0xDBFF && i + 6 < length && str[i + 1] == '\\' && str[i + 2] == 'u') {
+					unsigned int low = json_hex4(str + i + 3);
+					if (low >= 0xDC00 && low <= 0xDFFF) {
+						code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+						i += 6;
+					}
+				}
+				if (code >= 0xD800 && code <= 0xDFFF) code = 0xFFFD;
+
+				if (code < 0x80) {
+					dst[out++] = (char)code;
+				}
+				else if (code < 0x800) {
+					dst[out++] = (char)(0xC0 | (code >> 6));
+					dst[out++] = (char)(0x80 | (code & 0x3F));
+				}
+				else if (code < 0x10000) {
+					dst[out++] = (char)(0xE0 | (code >> 12));
+					dst[out++] = (char)(0x80 | ((code >> 6) & 0x3F));
+					dst[out++] = (char)(0x80 | (code & 0x3F));
+				}
+				else {
+					dst[out++] = (char)(0xF0 | (code >> 18));
+					dst[out++] = (char)(0x80 | ((code >> 12) & 0x3F));
+					dst[out++] = (char)(0x80 | ((code >> 6) & 0x3F));
+					dst[out++] = (char)(0x80 | (code & 0x3F));
+				}
+				break;
+			}
+			default: dst[out++] = c; break; // quotes, slashes and backslashes stands for themselves
+		}
+	}
+	return out;
 }
 
-int json_parse_string(const char* data, const jsmntok_t* tokens, int i, char** outString) {
+int json_parse_string(const char* data, const jsmntok_t* tokens, int i, char** outString, GLTF_Arena** arena) {
 	if (tokens[i].type != JSMN_STRING) return -1;
 
-	int size = (int)(tokens[i].end - tokens[i].start);
-	char* result = (char*)gltfmemory_allocate(size + 1, 0);
+	const char* str = data + tokens[i].start;
+	unsigned long long size = (unsigned long long)(tokens[i].end - tokens[i].start);
+	char* result = (char*)gltfarena_allocate(arena, size + 1, 0);
 	if (!result) return -1;
 
-	strncpy_impl(result, (const char*)data + tokens[i].start, size);
+	// most strings have no escapes and are simply copied
+	if (json_has_escapes(str, size)) size = json_decode_escapes(result, str, size);
+	else gltfmemory_copy(result, str, size);
+
 	result[size] = 0;
 	*outString = result;
 	return i + 1;
 }
 
-int json_parse_array(const char* data, const jsmntok_t* tokens, int i, unsigned long long elementSize, void** outArr, unsigned long long* outSize) { 
+int json_parse_string_view(char* data, const jsmntok_t* tokens, int i, char** outString) {
+	if (tokens[i].type != JSMN_STRING) return -1;
+
+	// the closing quote makes room for the terminator, escapes are decoded only when there's any
+	char* str = data + tokens[i].start;
+	unsigned long long size = (unsigned long long)(tokens[i].end - tokens[i].start);
+	if (json_has_escapes(str, size)) size = json_decode_escapes(str, str, size);
+
+	str[size] = 0;
+	*outString = str;
+	return i + 1;
+}
+
+int json_parse_array(const char* data, const jsmntok_t* tokens, int i, unsigned long long elementSize, void** outArr, unsigned long long* outSize, GLTF_Arena** arena) {
 	if (tokens[i].type != JSMN_ARRAY) return -1;
 
 	int size = tokens[i].size;
-	void* result = gltfmemory_allocate(elementSize * size, 1);
+	void* result = gltfarena_allocate(arena, elementSize * size, 1);
 	if (!result) return -1;
 
 	*outArr = result;
@@ -77,41 +168,38 @@ int json_parse_array(const char* data, const jsmntok_t* tokens, int i, unsigned
 int json_parse_array_float(const char* data, const jsmntok_t* tokens, int i, float* outArray, int size) {
 	if (tokens[i].type != JSMN_ARRAY) return -1;
 	if (tokens[i].size != size) return -1;
+	return json_parse_array_float_partial(data, tokens, i, outArray, size);
+}
 
-	++i;
-	for (int j = 0; j < size; ++j) {
-		if (tokens[i].type != JSMN_PRIMITIVE) return -1;
-		outArray[j] = json_to_float(data, tokens + i);
-		++i;
+int json_parse_array_float_partial(const char* data, const jsmntok_t* tokens, int i, float* outArray, int capacity) {
+	if (tokens[i].type != JSMN_ARRAY) return -1;
+	const int size = (int)tokens[i].size;
+
+	// the elements are consecutive tokens, each one is parsed straight from it's span
+	const jsmntok_t* element = tokens + i + 1;
+	for (int j = 0; j < size; ++j, ++element) {
+		float value = 0.0f;
+		if (element->type != JSMN_PRIMITIVE) return -1;
+		if (!number_parse_float(data + element->start, (unsigned long long)(element->end - element->start), &value)) return -1;
+		if (j < capacity) outArray[j] = value;
 	}
-	return i;
+	return i + 1 + size;
 }
 
-int json_parse_array_string(const char* data, const jsmntok_t* tokens, int i, char*** outArr, unsigned long long* outSize) {
+int json_parse_array_string(const char* data, const jsmntok_t* tokens, int i, char*** outArr, unsigned long long* outSize, GLTF_Arena** arena) {
 	if (tokens[i].type != JSMN_ARRAY) return -1;
-	i = json_parse_array(data, tokens, i, sizeof(char*), (void**)outArr, outSize);
+	i = json_parse_array(data, tokens, i, sizeof(char*), (void**)outArr, outSize, arena);
 	if (i < 0) return i;
 
 	for (unsigned long long j = 0; j < *outSize; ++j) {
-		i = json_parse_string(data, tokens, i, j + (*outArr));
+		i = json_parse_string(data, tokens, i, j + (*outArr), arena);
 		if (i < 0) return i;
 	}
 	return i;
 }
 
 int json_parse_skip(const jsmntok_t* tokens, int i) {
-	int end = i + 1;
-
-	while (i < end) {
-		switch (tokens[i].type)
-		{
-			case JSMN_OBJECT: { end += tokens[i].size * 2; break; }
-			case JSMN_ARRAY: { end += tokens[i].size; break; }
-			case JSMN_PRIMITIVE:
-			case JSMN_STRING: break;
-			default: return -1;
-		}
-		i++;
-	}
-	return i;
+	// the tokenizer links every token to the one after it's subtree, the trailing UNDEFINED token has no link
+	if (tokens[i].type == JSMN_UNDEFINED) return -1;
+	return tokens[i].next;
 }
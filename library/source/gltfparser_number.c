@@ -0,0 +1,473 @@
+#include "gltfparser_number.h"
+
+#include "gltfparser_util.h"
+
+#include <float.h>
+
+/// @brief how many digits the exact conversion keeps, any further digit only matters as being zero or not
+#define NUMBER_MAX_DIGITS 800
+
+/// @brief the fast paths need every float and double operation to be rounded right away, not kept in higher precision
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+	#define NUMBER_FAST_PATH
+#endif
+
+/// @brief the pieces of a json number
+typedef struct {
+	int negative;
+	const char* integer;                // integer digits
+	unsigned long long integerLength;
+	const char* fraction;               // fraction digits, may be empty
+	unsigned long long fractionLength;
+	long long exponent;                 // the explicit exponent, clamped to a magnitude that can't wrap around
+} internal_number;
+
+/// @brief an arbitrary precision decimal, used when the fast paths can't guarantee the exact rounding
+typedef struct {
+	unsigned char d[NUMBER_MAX_DIGITS]; // digits values, most significant first
+	int nd;                             // how many digits are used
+	int dp;                             // where the decimal point is, relative to the first digit
+	int trunc;                          // 1 if non zero digits were discarded after d[nd - 1]
+} internal_decimal;
+
+#if defined(NUMBER_FAST_PATH)
+/// @brief powers of ten exactly representable as a float
+static const float s_gPow10f[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+/// @brief powers of ten exactly representable as a double
+static const double s_gPow10[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+#endif
+
+/// @brief splits a json number into it's pieces, following the json grammar strictly
+/// @param str the number characters
+/// @param length how many characters str has
+/// @param outNumber the number pieces
+/// @return 1 if every character belongs to a valid json number, 0 otherwise
+static int internal_number_scan(const char* str, unsigned long long length, internal_number* outNumber) {
+	unsigned long long i = 0;
+
+	outNumber->negative = 0;
+	if (i < length && str[i] == '-') {
+		outNumber->negative = 1;
+		++i;
+	}
+
+	// json allows neither a missing integer part nor leading zeros
+	if (i >= length || str[i] < '0' || str[i] > '9') return 0;
+	outNumber->integer = str + i;
+	if (str[i] == '0') ++i;
+	else while (i < length && str[i] >= '0' && str[i] <= '9') ++i;
+	outNumber->integerLength = (unsigned long long)(str + i - outNumber->integer);
+
+	outNumber->fraction = str + i;
+	outNumber->fractionLength = 0;
+	if (i < length && str[i] == '.') {
+		++i;
+		outNumber->fraction = str + i;
+		while (i < length && str[i] >= '0' && str[i] <= '9') ++i;
+		outNumber->fractionLength = (unsigned long long)(str + i - outNumber->fraction);
+		if (outNumber->fractionLength == 0) return 0;
+	}
+
+	outNumber->exponent = 0;
+	if (i < length && (str[i] == 'e' || str[i] == 'E')) {
+		++i;
+		int negativeExponent = 0;
+		if (i < length && (str[i] == '+' || str[i] == '-')) {
+			negativeExponent = str[i] == '-';
+			++i;
+		}
+
+		if (i >= length || str[i] < '0' || str[i] > '9') return 0;
+		while (i < length && str[i] >= '0' && str[i] <= '9') {
+			// anything this big already overflows or underflows a float
+			if (outNumber->exponent < 100000) outNumber->exponent = outNumber->exponent * 10 + (str[i] - '0');
+			++i;
+		}
+		if (negativeExponent) outNumber->exponent = -outNumber->exponent;
+	}
+
+	return i == length;
+}
+
+/// @brief removes the trailing zeros of a decimal
+static void internal_decimal_trim(internal_decimal* a) {
+	while (a->nd > 0 && a->d[a->nd - 1] == 0) a->nd--;
+	if (a->nd == 0) a->dp = 0;
+}
+
+/// @brief divides a decimal by 2^k, k must be at most 28
+static void internal_decimal_right_shift(internal_decimal* a, unsigned int k) {
+	int r = 0;
+	int w = 0;
+	unsigned long long n = 0;
+
+	// picks up enough leading digits to produce the first output digit
+	for (; (n >> k) == 0; r++) {
+		if (r >= a->nd) {
+			if (n == 0) {
+				a->nd = 0;
+				return;
+			}
+			while ((n >> k) == 0) {
+				n *= 10;
+				r++;
+			}
+			break;
+		}
+		n = n * 10 + a->d[r];
+	}
+	a->dp -= r - 1;
+
+	unsigned long long mask = (1ull << k) - 1;
+	for (; r < a->nd; r++) {
+		unsigned char c = a->d[r];
+		a->d[w++] = (unsigned char)(n >> k);
+		n = (n & mask) * 10 + c;
+	}
+
+	// the remainder produces the remaining digits
+	while (n > 0) {
+		unsigned char digit = (unsigned char)(n >> k);
+		n &= mask;
+		if (w < NUMBER_MAX_DIGITS) a->d[w++] = digit;
+		else if (digit > 0) a->trunc = 1;
+		n *= 10;
+	}
+
+	a->nd = w;
+	internal_decimal_trim(a);
+}
+
+/// @brief multiplies a decimal by 2^k, k must be at most 28
+static void internal_decimal_left_shift(internal_decimal* a, unsigned int k) {
+	// each shifted bit adds at most log10(2) digits
+	int delta = (int)(k * 3 / 10 + 1);
+	int w = a->nd + delta;
+	unsigned long long n = 0;
+
+	// digits are produced from the least significant one, always ahead of the digits still being read
+	for (int r = a->nd - 1; r >= 0; r--) {
+		n += (unsigned long long)a->d[r] << k;
+		unsigned long long quotient = n / 10;
+		unsigned char remainder = (unsigned char)(n - 10 * quotient);
+		w--;
+		if (w < NUMBER_MAX_DIGITS) a->d[w] = remainder;
+		else if (remainder != 0) a->trunc = 1;
+		n = quotient;
+	}
+
+	while (n > 0) {
+		unsigned long long quotient = n / 10;
+		unsigned char remainder = (unsigned char)(n - 10 * quotient);
+		w--;
+		if (w < NUMBER_MAX_DIGITS) a->d[w] = remainder;
+		else if (remainder != 0) a->trunc = 1;
+		n = quotient;
+	}
+
+	a->nd += delta;
+	if (a->nd > NUMBER_MAX_DIGITS) a->nd = NUMBER_MAX_DIGITS;
+	a->dp += delta;
+
+	// delta may have overestimated the new digits, w is where the first one landed
+	if (w > 0) {
+		for (int i = w; i < a->nd; i++) a->d[i - w] = a->d[i];
+		a->nd -= w;
+		a->dp -= w;
+	}
+	internal_decimal_trim(a);
+}
+
+/// @brief multiplies (k > 0) or divides (k < 0) a decimal by 2^k
+static void internal_decimal_shift(internal_decimal* a, int k) {
+	if (a->nd == 0) return;
+
+	if (k > 0) {
+		while (k > 28) {
+			internal_decimal_left_shift(a, 28);
+			k -= 28;
+		}
+		internal_decimal_left_shift(a, (unsigned int)k);
+	}
+	else if (k < 0) {
+		while (k < -28) {
+			internal_decimal_right_shift(a, 28);
+			k += 28;
+		}
+		internal_decimal_right_shift(a, (unsigned int)-k);
+	}
+}
+
+/// @brief tells if rounding a decimal to nd digits rounds up, ties goes to even
+static int internal_decimal_round_up(const internal_decimal* a, int nd) {
+	if (nd < 0 || nd >= a->nd) return 0;
+
+	// exactly halfway, unless there are discarded digits
+	if (a->d[nd] == 5 && nd + 1 == a->nd) {
+		if (a->trunc) return 1;
+		return nd > 0 && (a->d[nd - 1] % 2) == 1;
+	}
+	return a->d[nd] >= 5;
+}
+
+/// @brief extracts the integer part of a decimal, rounded
+static unsigned long long internal_decimal_rounded_integer(const internal_decimal* a) {
+	if (a->dp > 20) return 0xFFFFFFFFFFFFFFFFull;
+
+	int i = 0;
+	unsigned long long n = 0;
+	for (; i < a->dp && i < a->nd; i++) n = n * 10 + a->d[i];
+	for (; i < a->dp; i++) n *= 10;
+
+	if (internal_decimal_round_up(a, a->dp)) n++;
+	return n;
+}
+
+/// @brief converts a decimal to the nearest float, by shifting it until the mantissa bits are in it's integer part
+/// @param a the decimal, it's modified
+/// @param negative the float sign
+/// @param outValue the converted value
+/// @return 1 on success, 0 on overflow
+static int internal_decimal_to_float(internal_decimal* a, int negative, float* outValue) {
+	static const int powtab[] = { 1, 3, 6, 9, 13, 16, 19, 23, 26 };
+	const int mantbits = 23;
+	const int bias = -127;
+
+	int exp = 0;
+	unsigned long long mant = 0;
+	int overflow = 0;
+
+	if (a->nd == 0) {
+		exp = bias;
+	}
+	else if (a->dp > 39) {
+		overflow = 1;
+	}
+	else if (a->dp < -46) {
+		exp = bias;
+	}
+	else {
+		// scales the value into [0.5, 1)
+		while (a->dp > 0) {
+			int n = a->dp >= 9 ? 27 : powtab[a->dp];
+			internal_decimal_shift(a, -n);
+			exp += n;
+		}
+		while (a->dp < 0 || (a->dp == 0 && a->d[0] < 5)) {
+			int n = a->dp == 0 ? 1 : (-a->dp >= 9 ? 27 : powtab[-a->dp]);
+			internal_decimal_shift(a, n);
+			exp -= n;
+		}
+
+		// floats are in [1, 2)
+		exp--;
+
+		// subnormals have less mantissa bits
+		if (exp < bias + 1) {
+			int n = bias + 1 - exp;
+			internal_decimal_shift(a, -n);
+			exp += n;
+		}
+
+		if (exp - bias >= 0xFF) {
+			overflow = 1;
+		}
+		else {
+			internal_decimal_shift(a, 1 + mantbits);
+			mant = internal_decimal_rounded_integer(a);
+
+			// rounding up may carry into a new bit
+			if (mant == (2ull << mantbits)) {
+				mant >>= 1;
+				exp++;
+				if (exp - bias >= 0xFF) overflow = 1;
+			}
+
+			if ((mant & (1ull << mantbits)) == 0) exp = bias;
+		}
+	}
+
+	unsigned int bits;
+	if (overflow) bits = 0xFFu << mantbits;
+	else bits = (unsigned int)(mant & ((1ull << mantbits) - 1)) | ((unsigned int)((exp - bias) & 0xFF) << mantbits);
+	if (negative) bits |= 0x80000000u;
+
+	gltfmemory_copy(outValue, &bits, sizeof(float));
+	return !overflow;
+}
+
+/// @brief converts the pieces of a number exactly, whatever amount of digits it has
+static int internal_number_to_float_exact(const internal_number* number, float* outValue) {
+	internal_decimal a;
+	a.nd = 0;
+	a.dp = 0;
+	a.trunc = 0;
+
+	int significant = 0;
+	long long dp = (long long)number->integerLength;
+
+	for (int part = 0; part < 2; ++part) {
+		const char* digits = part == 0 ? number->integer : number->fraction;
+		unsigned long long count = part == 0 ? number->integerLength : number->fractionLength;
+
+		for (unsigned long long i = 0; i < count; ++i) {
+			unsigned char digit = (unsigned char)(digits[i] - '0');
+
+			// leading zeros only move the decimal point
+			if (!significant && digit == 0) {
+				dp--;
+				continue;
+			}
+			significant = 1;
+
+			if (a.nd < NUMBER_MAX_DIGITS) a.d[a.nd++] = digit;
+			else if (digit != 0) a.trunc = 1;
+		}
+	}
+
+	dp += number->exponent;
+	if (dp > 100000) dp = 100000;
+	if (dp < -100000) dp = -100000;
+	a.dp = (int)dp;
+	internal_decimal_trim(&a);
+
+	return internal_decimal_to_float(&a, number->negative, outValue);
+}
+
+#if defined(NUMBER_FAST_PATH)
+/// @brief tells if converting a double to a float can't be trusted to give the nearest float of the original decimal
+/// @note a rounded double can only mislead the float rounding when it lands exactly between two floats
+static int internal_double_unsafe_for_float(double value) {
+	unsigned long long bits;
+	gltfmemory_copy(&bits, &value, sizeof(double));
+
+	// subnormal and overflowing floats have their own rounding, those are left to the exact conversion
+	int exponent = (int)((bits >> 52) & 0x7FF) - 1023;
+	if (exponent < -126 || exponent > 127) return 1;
+
+	return (bits & ((1ull << 29) - 1)) == (1ull << 28);
+}
+#endif
+
+int number_parse_float(const char* str, unsigned long long length, float* outValue) {
+	internal_number number;
+	if (!internal_number_scan(str, length, &number)) return 0;
+
+	// up to 19 significant digits always fits in 64 bits
+	unsigned long long mantissa = 0;
+	int digits = 0;
+	int manyDigits = 0;
+	long long exponent = number.exponent;
+
+	for (unsigned long long i = 0; i < number.integerLength && !manyDigits; ++i) {
+		unsigned int digit = (unsigned int)(number.integer[i] - '0');
+		if (digits == 0 && digit == 0) continue;
+		if (digits == 19) manyDigits = 1;
+		else {
+			mantissa = mantissa * 10 + digit;
+			digits++;
+		}
+	}
+	for (unsigned long long i = 0; i < number.fractionLength && !manyDigits; ++i) {
+		unsigned int digit = (unsigned int)(number.fraction[i] - '0');
+		if (digits == 0 && digit == 0) {
+			exponent--;
+			continue;
+		}
+		if (digits == 19) manyDigits = 1;
+		else {
+			mantissa = mantissa * 10 + digit;
+			digits++;
+			exponent--;
+		}
+	}
+
+	if (mantissa == 0 && !manyDigits) {
+		*outValue = number.negative ? -0.0f : 0.0f;
+		return 1;
+	}
+
+#if defined(NUMBER_FAST_PATH)
+	if (!manyDigits) {
+		// both the mantissa and the power of ten are exact floats, so a single rounding happens
+		if (mantissa <= (1ull << 24) && exponent >= -10 && exponent <= 10) {
+			float value = (float)mantissa;
+			value = exponent < 0 ? value / s_gPow10f[-exponent] : value * s_gPow10f[exponent];
+			*outValue = number.negative ? -value : value;
+			return 1;
+		}
+
+		// same with doubles, then rounded again to a float when that second rounding can be trusted
+		if (mantissa <= (1ull << 53) && exponent >= -22 && exponent <= 22) {
+			double value = (double)mantissa;
+			int exact = 0;
+			if (exponent < 0) value /= s_gPow10[-exponent];
+			else {
+				value *= s_gPow10[exponent];
+				exact = value <= 9007199254740992.0;
+			}
+
+			if (exact || !internal_double_unsafe_for_float(value)) {
+				*outValue = number.negative ? -(float)value : (float)value;
+				return 1;
+			}
+		}
+	}
+#endif
+
+	return internal_number_to_float_exact(&number, outValue);
+}
+
+/// @brief parses the magnitude of a json integer
+/// @param number the number pieces
+/// @param outValue the magnitude
+/// @return 1 on success, 0 if it's not an integer or doesn't fit in 64 bits
+static int internal_number_magnitude(const internal_number* number, unsigned long long* outValue) {
+	if (number->exponent != 0) return 0;
+
+	for (unsigned long long i = 0; i < number->fractionLength; ++i) {
+		if (number->fraction[i] != '0') return 0;
+	}
+
+	unsigned long long value = 0;
+	for (unsigned long long i = 0; i < number->integerLength; ++i) {
+		unsigned int digit = (unsigned int)(number->integer[i] - '0');
+		if (value > (0xFFFFFFFFFFFFFFFFull - digit) / 10) return 0;
+		value = value * 10 + digit;
+	}
+
+	*outValue = value;
+	return 1;
+}
+
+int number_parse_int64(const char* str, unsigned long long length, long long* outValue) {
+	internal_number number;
+	unsigned long long magnitude = 0;
+	if (!internal_number_scan(str, length, &number) || !internal_number_magnitude(&number, &magnitude)) return 0;
+
+	if (number.negative) {
+		if (magnitude > 0x8000000000000000ull) return 0;
+		*outValue = magnitude == 0x8000000000000000ull ? (-0x7FFFFFFFFFFFFFFFll - 1) : -(long long)magnitude;
+	}
+	else {
+		if (magnitude > 0x7FFFFFFFFFFFFFFFull) return 0;
+		*outValue = (long long)magnitude;
+	}
+	return 1;
+}
+
+int number_parse_uint64(const char* str, unsigned long long length, unsigned long long* outValue) {
+	internal_number number;
+	unsigned long long magnitude = 0;
+	if (!internal_number_scan(str, length, &number) || !internal_number_magnitude(&number, &magnitude)) return 0;
+
+	// "-0" is still zero
+	if (number.negative && magnitude != 0) return 0;
+
+	*outValue = magnitude;
+	return 1;
+}
@@ -3,20 +3,46 @@
 #include "gltfparser_defines.h"
 
 #include <stdio.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
-void* gltfmemory_allocate(unsigned long long size, int empty) {
-    void* ptr = malloc(size);
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <pthread.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <sys/time.h>
+    #include <time.h>
+    #include <unistd.h>
+#endif
+
+#if defined(GLTF_SIMD_X86)
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#endif
+
+void* gltfmemory_allocate(const GLTF_Allocator* allocator, unsigned long long size, int empty) {
+    void* ptr = allocator && allocator->allocate ? allocator->allocate(allocator->userData, size) : malloc(size);
     if(empty == 1 && ptr != NULL) memset(ptr, 0, size);
     return ptr;
 }
 
-void gltfmemory_deallocate(void* ptr) {
-    free(ptr);
+void gltfmemory_deallocate(const GLTF_Allocator* allocator, void* ptr) {
+    if (allocator && allocator->deallocate) allocator->deallocate(allocator->userData, ptr);
+    else free(ptr);
 }
 
-void* gltfmemory_reallocate(void* ptr, unsigned long long size) {
+void* gltfmemory_reallocate(const GLTF_Allocator* allocator, void* ptr, unsigned long long size) {
+    if (allocator && allocator->reallocate) return allocator->reallocate(allocator->userData, ptr, size);
     return realloc(ptr, size);
 }
 
@@ -47,7 +73,87 @@ int gltfmemory_cmp(const void* s1, const void* s2, unsigned long long n) {
     return 0; // all n bytes were equal
 }
 
-int platform_fileread(const char* path, unsigned long long* size, void** data) {
+// every allocation is aligned to this, the chunk header included
+#define GLTF_ARENA_ALIGNMENT 16
+#define GLTF_ARENA_HEADER_SIZE ((sizeof(GLTF_Arena) + GLTF_ARENA_ALIGNMENT - 1) & ~(unsigned long long)(GLTF_ARENA_ALIGNMENT - 1))
+
+GLTF_Arena* gltfarena_create(const GLTF_Allocator* allocator) {
+    GLTF_Arena* arena = (GLTF_Arena*)gltfmemory_allocate(allocator, GLTF_ARENA_HEADER_SIZE + GLTF_ARENA_CHUNK_SIZE, 0);
+    if (!arena) return NULL;
+
+    arena->next = NULL;
+    arena->used = 0;
+    arena->capacity = GLTF_ARENA_CHUNK_SIZE;
+    if (allocator) arena->allocator = *allocator;
+    else memset(&arena->allocator, 0, sizeof(GLTF_Allocator));
+    return arena;
+}
+
+void* gltfarena_allocate(GLTF_Arena** arena, unsigned long long size, int empty) {
+    size = (size + GLTF_ARENA_ALIGNMENT - 1) & ~(unsigned long long)(GLTF_ARENA_ALIGNMENT - 1);
+
+    GLTF_Arena* chunk = *arena;
+    if (!chunk || chunk->capacity - chunk->used < size) {
+        // chunks double in size so the count stays logarithmic, a bigger allocation gets a chunk on its own
+        unsigned long long capacity = chunk ? chunk->capacity * 2 : GLTF_ARENA_CHUNK_SIZE;
+        if (capacity > GLTF_ARENA_CHUNK_SIZE_MAX) capacity = GLTF_ARENA_CHUNK_SIZE_MAX;
+        if (capacity < size) capacity = size;
+
+        // new chunks come from the same allocator as the newest one
+        GLTF_Arena* grown = (GLTF_Arena*)gltfmemory_allocate(chunk ? &chunk->allocator : NULL, GLTF_ARENA_HEADER_SIZE + capacity, 0);
+        if (!grown) return NULL;
+
+        grown->used = 0;
+        grown->capacity = capacity;
+        if (chunk) grown->allocator = chunk->allocator;
+        else memset(&grown->allocator, 0, sizeof(GLTF_Allocator));
+
+        // an oversized allocation goes behind the newest chunk, which keeps the room it has left
+        if (chunk && capacity == size && chunk->capacity - chunk->used > 0) {
+            grown->used = size;
+            grown->next = chunk->next;
+            chunk->next = grown;
+            void* ptr = (unsigned char*)grown + GLTF_ARENA_HEADER_SIZE;
+            if (empty == 1) memset(ptr, 0, size);
+            return ptr;
+        }
+
+        grown->next = chunk;
+        *arena = chunk = grown;
+    }
+
+    void* ptr = (unsigned char*)chunk + GLTF_ARENA_HEADER_SIZE + chunk->used;
+    chunk->used += size;
+    if (empty == 1) memset(ptr, 0, size);
+    return ptr;
+}
+
+void gltfarena_merge(GLTF_Arena** arena, GLTF_Arena* other) {
+    if (!other) return;
+    if (!*arena) {
+        *arena = other;
+        return;
+    }
+
+    GLTF_Arena* last = other;
+    while (last->next) last = last->next;
+
+    last->next = (*arena)->next;
+    (*arena)->next = other;
+}
+
+void gltfarena_release(GLTF_Arena** arena) {
+    GLTF_Arena* chunk = *arena;
+    while (chunk) {
+        GLTF_Arena* next = chunk->next;
+        GLTF_Allocator allocator = chunk->allocator;
+        gltfmemory_deallocate(&allocator, chunk);
+        chunk = next;
+    }
+    *arena = NULL;
+}
+
+int platform_fileread(const char* path, unsigned long long* size, void** data, const GLTF_Allocator* allocator) {
     if (!path || !size || !data) {
         return 0;
     }
@@ -75,7 +181,8 @@ int platform_fileread(const char* path, unsigned long long* size, void** data) {
         return 0;
     }
 
-    char* fileData = (char*)gltfmemory_allocate(fileSize, 1);
+    // no need to zero the memory, fread overwrites every byte of it
+    char* fileData = (char*)gltfmemory_allocate(allocator, fileSize, 0);
     if (!fileData) {
         fclose(file);
         return 0;
@@ -85,7 +192,7 @@ int platform_fileread(const char* path, unsigned long long* size, void** data) {
     fclose(file);
 
     if (readSize != fileSize) {
-        gltfmemory_deallocate(fileData);
+        gltfmemory_deallocate(allocator, fileData);
         return 0;
     }
 
@@ -94,6 +201,321 @@ int platform_fileread(const char* path, unsigned long long* size, void** data) {
     return 1;
 }
 
+int platform_filereadrange(const char* path, unsigned long long offset, unsigned long long size, void* dst) {
+    if (!path || !dst) {
+        return 0;
+    }
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return 0;
+    }
+
+    LARGE_INTEGER position;
+    position.QuadPart = (LONGLONG)offset;
+    if (!SetFilePointerEx(file, position, NULL, FILE_BEGIN)) {
+        CloseHandle(file);
+        return 0;
+    }
+
+    // ReadFile is limited to 32 bits sizes
+    unsigned char* out = (unsigned char*)dst;
+    while (size > 0) {
+        DWORD chunk = size > 0x40000000ull ? 0x40000000u : (DWORD)size;
+        DWORD readSize = 0;
+        if (!ReadFile(file, out, chunk, &readSize, NULL) || readSize == 0) {
+            CloseHandle(file);
+            return 0;
+        }
+        out += readSize;
+        size -= readSize;
+    }
+
+    CloseHandle(file);
+    return 1;
+#else
+    int file = open(path, O_RDONLY);
+    if (file < 0) {
+        return 0;
+    }
+
+    if (lseek(file, (off_t)offset, SEEK_SET) == (off_t)-1) {
+        close(file);
+        return 0;
+    }
+
+    // read may return less than asked, keep going until the range is complete
+    unsigned char* out = (unsigned char*)dst;
+    while (size > 0) {
+        size_t chunk = size > 0x40000000ull ? 0x40000000u : (size_t)size;
+        ssize_t readSize = read(file, out, chunk);
+        if (readSize <= 0) {
+            close(file);
+            return 0;
+        }
+        out += readSize;
+        size -= (unsigned long long)readSize;
+    }
+
+    close(file);
+    return 1;
+#endif
+}
+
+int platform_filemap(const char* path, int sequential, unsigned long long* size, void** data) {
+    if (!path || !size || !data) {
+        return 0;
+    }
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, sequential ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return 0;
+    }
+
+    LARGE_INTEGER length;
+    if (!GetFileSizeEx(file, &length) || length.QuadPart <= 0) {
+        CloseHandle(file);
+        return 0;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mapping) {
+        return 0;
+    }
+
+    // the view keeps the mapping alive, so the handle can be closed right away
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!view) {
+        return 0;
+    }
+
+    *size = (unsigned long long)length.QuadPart;
+    *data = view;
+    return 1;
+#else
+    int file = open(path, O_RDONLY);
+    if (file < 0) {
+        return 0;
+    }
+
+    struct stat info;
+    if (fstat(file, &info) != 0 || info.st_size <= 0 || (unsigned long long)info.st_size > SIZE_MAX) {
+        close(file);
+        return 0;
+    }
+
+    // the mapping keeps a reference to the file, so the descriptor can be closed right away
+    void* view = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    if (view == MAP_FAILED) {
+        return 0;
+    }
+
+    // files accessed in any order, like lazy buffers, keep the default read ahead of the pages around each fault
+#if defined(MADV_SEQUENTIAL)
+    if (sequential) madvise(view, (size_t)info.st_size, MADV_SEQUENTIAL);
+#endif
+
+    *size = (unsigned long long)info.st_size;
+    *data = view;
+    return 1;
+#endif
+}
+
+void platform_fileunmap(void* data, unsigned long long size) {
+    if (!data) return;
+
+#if defined(_WIN32)
+    (void)size;
+    UnmapViewOfFile(data);
+#else
+    munmap(data, (size_t)size);
+#endif
+}
+
+#if defined(GLTF_SIMD_X86)
+/// @brief executes the cpuid instruction
+static void internal_cpuid(unsigned int leaf, unsigned int subleaf, unsigned int regs[4]) {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuidex(info, (int)leaf, (int)subleaf);
+    regs[0] = (unsigned int)info[0]; regs[1] = (unsigned int)info[1]; regs[2] = (unsigned int)info[2]; regs[3] = (unsigned int)info[3];
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+/// @brief reads the extended control register, tells which register states the operating system saves
+static unsigned long long internal_xgetbv() {
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    unsigned int eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((unsigned long long)edx << 32) | eax;
+#endif
+}
+#endif
+
+unsigned int platform_cpu_features() {
+    static int s_detected = 0;
+    static unsigned int s_features = 0;
+    if (s_detected) return s_features;
+
+    unsigned int features = 0;
+
+#if defined(GLTF_SIMD_X86)
+    unsigned int regs[4];
+    internal_cpuid(0, 0, regs);
+    unsigned int maxLeaf = regs[0];
+
+    if (maxLeaf >= 1) {
+        internal_cpuid(1, 0, regs);
+        if (regs[3] & (1u << 26)) features |= CPU_FEATURE_SSE2;
+        if (regs[2] & (1u << 9)) features |= CPU_FEATURE_SSSE3;
+        if (regs[2] & (1u << 19)) features |= CPU_FEATURE_SSE41;
+        if (regs[2] & (1u << 20)) features |= CPU_FEATURE_SSE42;
+
+        // avx2 also requires the operating system to save the ymm registers
+        int osxsave = (regs[2] & (1u << 27)) != 0;
+        int avx = (regs[2] & (1u << 28)) != 0;
+        if (maxLeaf >= 7 && osxsave && avx && (internal_xgetbv() & 0x6) == 0x6) {
+            internal_cpuid(7, 0, regs);
+            if (regs[1] & (1u << 5)) features |= CPU_FEATURE_AVX2;
+        }
+    }
+#endif
+
+    s_features = features;
+    s_detected = 1;
+    return features;
+}
+
+unsigned int platform_cpu_count() {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (unsigned int)info.dwNumberOfProcessors : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (unsigned int)count : 1;
+#endif
+}
+
+double platform_time() {
+#if defined(_WIN32)
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+#else
+    // strict iso builds hides clock_gettime, the wall clock is the fallback
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    return (double)now.tv_sec + (double)now.tv_usec * 1e-6;
+#endif
+}
+
+long long platform_atomic_add(volatile long long* value, long long amount) {
+#if defined(_WIN32)
+    return InterlockedExchangeAdd64((volatile LONG64*)value, amount);
+#else
+    return __sync_fetch_and_add(value, amount);
+#endif
+}
+
+long long platform_atomic_min(volatile long long* value, long long candidate) {
+    long long current = platform_atomic_add(value, 0);
+    while (candidate < current) {
+#if defined(_WIN32)
+        long long previous = InterlockedCompareExchange64((volatile LONG64*)value, candidate, current);
+#else
+        long long previous = __sync_val_compare_and_swap(value, current, candidate);
+#endif
+        if (previous == current) break;
+        current = previous;
+    }
+    return current;
+}
+
+/// @brief the state shared by every thread of a parallel for
+typedef struct {
+    platform_task task;
+    void* taskData;
+    unsigned long long count;
+    volatile long long next;
+} internal_parallel_work;
+
+/// @brief keeps taking indices until none are left
+static void internal_parallel_run(internal_parallel_work* work) {
+    for (;;) {
+        unsigned long long index = (unsigned long long)platform_atomic_add(&work->next, 1);
+        if (index >= work->count) return;
+        work->task(work->taskData, index);
+    }
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI internal_parallel_thread(LPVOID param) {
+    internal_parallel_run((internal_parallel_work*)param);
+    return 0;
+}
+#else
+static void* internal_parallel_thread(void* param) {
+    internal_parallel_run((internal_parallel_work*)param);
+    return NULL;
+}
+#endif
+
+void platform_parallel_for(unsigned int threadCount, unsigned long long count, platform_task task, void* taskData, const GLTF_Allocator* allocator) {
+    if (count == 0) return;
+
+    if (threadCount == 0) threadCount = platform_cpu_count();
+    if (threadCount > count) threadCount = (unsigned int)count;
+
+    internal_parallel_work work;
+    work.task = task;
+    work.taskData = taskData;
+    work.count = count;
+    work.next = 0;
+
+    // the calling thread is one of the workers
+    unsigned int workers = 0;
+#if defined(_WIN32)
+    HANDLE* threads = threadCount > 1 ? (HANDLE*)gltfmemory_allocate(allocator, sizeof(HANDLE) * (threadCount - 1), 0) : NULL;
+    for (unsigned int i = 0; threads && i < threadCount - 1; ++i) {
+        threads[workers] = CreateThread(NULL, 0, internal_parallel_thread, &work, 0, NULL);
+        if (threads[workers]) workers++;
+    }
+#else
+    pthread_t* threads = threadCount > 1 ? (pthread_t*)gltfmemory_allocate(allocator, sizeof(pthread_t) * (threadCount - 1), 0) : NULL;
+    for (unsigned int i = 0; threads && i < threadCount - 1; ++i) {
+        if (pthread_create(&threads[workers], NULL, internal_parallel_thread, &work) == 0) workers++;
+    }
+#endif
+
+    // when threads can't be created the calling thread simply does all the work
+    internal_parallel_run(&work);
+
+    for (unsigned int i = 0; i < workers; ++i) {
+#if defined(_WIN32)
+        WaitForSingleObject(threads[i], INFINITE);
+        CloseHandle(threads[i]);
+#else
+        pthread_join(threads[i], NULL);
+#endif
+    }
+    gltfmemory_deallocate(allocator, threads);
+}
+
 void* strncpy_impl(void* dest, const char* src, unsigned long long size) {
     char* d = (char*)dest;
     unsigned long long i;
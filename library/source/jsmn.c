@@ -1,5 +1,11 @@
 #include "jsmn.h"
 
+#include "gltfparser_util.h"
+
+#if defined(GLTF_SIMD_X86)
+#include <immintrin.h>
+#endif
+
 /// it is weird that C does not declare NULL as anything
 #ifndef NULL
     #ifdef __cplusplus
@@ -13,6 +19,147 @@
 /// INTERNAL
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#if defined(GLTF_SIMD_X86)
+
+/// @brief index of the lowest set bit, mask must not be 0
+static unsigned int jsmn_ctz(unsigned int mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (unsigned int)index;
+#else
+    return (unsigned int)__builtin_ctz(mask);
+#endif
+}
+
+/// @brief sse2 variant of jsmn_scan_string
+GLTF_TARGET("sse2") static unsigned long long jsmn_scan_string_sse2(const char* js, unsigned long long pos, const unsigned long long len) {
+    const __m128i quote = _mm_set1_epi8('\"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; pos + 16 <= len; pos += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(js + pos));
+        __m128i hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)), _mm_cmpeq_epi8(chunk, zero));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(hit);
+        if (mask) return pos + jsmn_ctz(mask);
+    }
+    return pos;
+}
+
+/// @brief avx2 variant of jsmn_scan_string
+GLTF_TARGET("avx2") static unsigned long long jsmn_scan_string_avx2(const char* js, unsigned long long pos, const unsigned long long len) {
+    const __m256i quote = _mm256_set1_epi8('\"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i zero = _mm256_setzero_si256();
+
+    for (; pos + 32 <= len; pos += 32) {
+        __m256i chunk = _mm256_loadu_si256((const __m256i*)(js + pos));
+        __m256i hit = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote), _mm256_cmpeq_epi8(chunk, backslash)), _mm256_cmpeq_epi8(chunk, zero));
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(hit);
+        if (mask) return pos + jsmn_ctz(mask);
+    }
+    return pos;
+}
+
+/// @brief sse2 variant of jsmn_scan_whitespace
+GLTF_TARGET("sse2") static unsigned long long jsmn_scan_whitespace_sse2(const char* js, unsigned long long pos, const unsigned long long len) {
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i lf = _mm_set1_epi8('\n');
+
+    for (; pos + 16 <= len; pos += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(js + pos));
+        __m128i ws = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, tab)), _mm_or_si128(_mm_cmpeq_epi8(chunk, cr), _mm_cmpeq_epi8(chunk, lf)));
+        unsigned int mask = ~(unsigned int)_mm_movemask_epi8(ws) & 0xFFFFu;
+        if (mask) return pos + jsmn_ctz(mask);
+    }
+    return pos;
+}
+
+/// @brief avx2 variant of jsmn_scan_whitespace
+GLTF_TARGET("avx2") static unsigned long long jsmn_scan_whitespace_avx2(const char* js, unsigned long long pos, const unsigned long long len) {
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i cr = _mm256_set1_epi8('\r');
+    const __m256i lf = _mm256_set1_epi8('\n');
+
+    for (; pos + 32 <= len; pos += 32) {
+        __m256i chunk = _mm256_loadu_si256((const __m256i*)(js + pos));
+        __m256i ws = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, space), _mm256_cmpeq_epi8(chunk, tab)), _mm256_or_si256(_mm256_cmpeq_epi8(chunk, cr), _mm256_cmpeq_epi8(chunk, lf)));
+        unsigned int mask = ~(unsigned int)_mm256_movemask_epi8(ws);
+        if (mask) return pos + jsmn_ctz(mask);
+    }
+    return pos;
+}
+
+/// @brief sse2 variant of jsmn_scan_primitive
+GLTF_TARGET("sse2") static unsigned long long jsmn_scan_primitive_sse2(const char* js, unsigned long long pos, const unsigned long long len) {
+    const __m128i comma = _mm_set1_epi8(',');
+    const __m128i bracket = _mm_set1_epi8(']');
+    const __m128i brace = _mm_set1_epi8('}');
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i del = _mm_set1_epi8(127);
+    const __m128i printable = _mm_set1_epi8(32);
+#ifndef JSMN_STRICT
+    const __m128i colon = _mm_set1_epi8(':');
+#endif
+
+    for (; pos + 16 <= len; pos += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(js + pos));
+
+        // tabs, line breaks, null and any non ascii character are all below 32 as signed bytes
+        __m128i hit = _mm_or_si128(_mm_cmplt_epi8(chunk, printable), _mm_cmpeq_epi8(chunk, del));
+        hit = _mm_or_si128(hit, _mm_or_si128(_mm_cmpeq_epi8(chunk, comma), _mm_cmpeq_epi8(chunk, space)));
+        hit = _mm_or_si128(hit, _mm_or_si128(_mm_cmpeq_epi8(chunk, bracket), _mm_cmpeq_epi8(chunk, brace)));
+#ifndef JSMN_STRICT
+        hit = _mm_or_si128(hit, _mm_cmpeq_epi8(chunk, colon));
+#endif
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(hit);
+        if (mask) return pos + jsmn_ctz(mask);
+    }
+    return pos;
+}
+
+#endif
+
+/// @brief skips the characters of a string that need no attention, many bytes at a time when the cpu allows it
+/// @return the first quote, backslash or null character, or where the vectorized scan has stopped
+static unsigned long long jsmn_scan_string(const char* js, unsigned long long pos, const unsigned long long len, const unsigned int features) {
+#if defined(GLTF_SIMD_X86)
+    if (features & CPU_FEATURE_AVX2) pos = jsmn_scan_string_avx2(js, pos, len);
+    else if (features & CPU_FEATURE_SSE2) pos = jsmn_scan_string_sse2(js, pos, len);
+#else
+    (void)js; (void)len; (void)features;
+#endif
+    return pos;
+}
+
+/// @brief skips a run of whitespaces, many bytes at a time when the cpu allows it
+/// @return the first non whitespace character, or where the vectorized scan has stopped
+static unsigned long long jsmn_scan_whitespace(const char* js, unsigned long long pos, const unsigned long long len, const unsigned int features) {
+#if defined(GLTF_SIMD_X86)
+    if (features & CPU_FEATURE_AVX2) pos = jsmn_scan_whitespace_avx2(js, pos, len);
+    else if (features & CPU_FEATURE_SSE2) pos = jsmn_scan_whitespace_sse2(js, pos, len);
+#else
+    (void)js; (void)len; (void)features;
+#endif
+    return pos;
+}
+
+/// @brief skips the characters of a primitive, many bytes at a time when the cpu allows it
+/// @return the first delimiter or invalid character, or where the vectorized scan has stopped
+static unsigned long long jsmn_scan_primitive(const char* js, unsigned long long pos, const unsigned long long len, const unsigned int features) {
+#if defined(GLTF_SIMD_X86)
+    // primitives are short, the 16 bytes variant fits them better
+    if (features & CPU_FEATURE_SSE2) pos = jsmn_scan_primitive_sse2(js, pos, len);
+#else
+    (void)js; (void)len; (void)features;
+#endif
+    return pos;
+}
+
 /// @brief Allocates a fresh unused token from the token pool
 static jsmntok_t* jsmn_alloc_token(jsmn_parser* parser, jsmntok_t* tokens, const unsigned long long num_tokens) {
 	jsmntok_t* tok;
@@ -22,6 +169,7 @@ static jsmntok_t* jsmn_alloc_token(jsmn_parser* parser, jsmntok_t* tokens, const
 	tok = &tokens[parser->toknext++];
 	tok->start = tok->end = -1;
 	tok->size = 0;
+	tok->next = parser->toknext;
 #ifdef JSMN_PARENT_LINKS
 	tok->parent = -1;
 #endif
@@ -38,12 +186,16 @@ static void jsmn_fill_token(jsmntok_t* token, const jsmntype_t type,
 }
 
 /// @brief fills next available token with JSON primitive.
-static int jsmn_parse_primitive(jsmn_parser* parser, const char* js, const unsigned long long len, jsmntok_t* tokens, const unsigned long long num_tokens) {
+static int jsmn_parse_primitive(jsmn_parser* parser, const char* js, const unsigned long long len, jsmntok_t* tokens, const unsigned long long num_tokens, const unsigned int features) {
     jsmntok_t* token;
     int start;
     start = parser->pos;
 
     for (; parser->pos < len && js[parser->pos] != '\0'; parser->pos++) {
+        parser->pos = (unsigned int)jsmn_scan_primitive(js, parser->pos, len, features);
+        if (parser->pos >= len || js[parser->pos] == '\0') {
+            break;
+        }
         switch (js[parser->pos]) {
 #ifndef JSMN_STRICT
             /* in strict mode primitive must be followed by "," or "}" or "]" */
@@ -91,7 +243,7 @@ found:
 }
 
 /// @brief fills next token with JSON string
-static int jsmn_parse_string(jsmn_parser* parser, const char* js, const unsigned long long len, jsmntok_t* tokens, const unsigned long long num_tokens) {
+static int jsmn_parse_string(jsmn_parser* parser, const char* js, const unsigned long long len, jsmntok_t* tokens, const unsigned long long num_tokens, const unsigned int features) {
     jsmntok_t* token;
     int start = parser->pos;
 
@@ -99,6 +251,10 @@ static int jsmn_parse_string(jsmn_parser* parser, const char* js, const unsigned
     parser->pos++;
 
     for (; parser->pos < len && js[parser->pos] != '\0'; parser->pos++) {
+        parser->pos = (unsigned int)jsmn_scan_string(js, parser->pos, len, features);
+        if (parser->pos >= len || js[parser->pos] == '\0') {
+            break;
+        }
         char c = js[parser->pos];
 
         /* quote: end of string */
@@ -169,13 +325,14 @@ void jsmn_init(jsmn_parser* parser) {
 	parser->pos = 0;
 	parser->toknext = 0;
 	parser->toksuper = -1;
+	parser->tokopen = -1;
 }
 
 int jsmn_parse(jsmn_parser* parser, const char* js, const unsigned long long len, jsmntok_t* tokens, const unsigned int num_tokens) {
     int r;
-    int i;
     jsmntok_t* token;
     int count = parser->toknext;
+    const unsigned int features = platform_cpu_features();
 
     for (; parser->pos < len && js[parser->pos] != '\0'; parser->pos++) {
         char c;
@@ -201,6 +358,9 @@ int jsmn_parse(jsmn_parser* parser, const char* js, const unsigned long long len
                     return JSMN_ERROR_INVAL;
                 }
 #endif
+                if (t->size == JSMN_SIZE_MAX) {
+                    return JSMN_ERROR_SIZE;
+                }
                 t->size++;
 #ifdef JSMN_PARENT_LINKS
                 token->parent = parser->toksuper;
@@ -209,6 +369,10 @@ int jsmn_parse(jsmn_parser* parser, const char* js, const unsigned long long len
             token->type = (c == '{' ? JSMN_OBJECT : JSMN_ARRAY);
             token->start = parser->pos;
             parser->toksuper = parser->toknext - 1;
+
+            /* until it's closed, the next of an object or array links to the one it's inside of */
+            token->next = parser->tokopen;
+            parser->tokopen = parser->toknext - 1;
             break;
         case '}':
         case ']':
@@ -216,60 +380,32 @@ int jsmn_parse(jsmn_parser* parser, const char* js, const unsigned long long len
                 break;
             }
             type = (c == '}' ? JSMN_OBJECT : JSMN_ARRAY);
-#ifdef JSMN_PARENT_LINKS
-            if (parser->toknext < 1) {
+
+            /* the innermost open object or array is the one being closed, error if unmatched closing bracket */
+            if (parser->tokopen == -1) {
                 return JSMN_ERROR_INVAL;
             }
-            token = &tokens[parser->toknext - 1];
-            for (;;) {
-                if (token->start != -1 && token->end == -1) {
-                    if (token->type != type) {
-                        return JSMN_ERROR_INVAL;
-                    }
-                    token->end = parser->pos + 1;
-                    parser->toksuper = token->parent;
-                    break;
-                }
-                if (token->parent == -1) {
-                    if (token->type != type || parser->toksuper == -1) {
-                        return JSMN_ERROR_INVAL;
-                    }
-                    break;
-                }
-                token = &tokens[token->parent];
-            }
-#else
-            for (i = parser->toknext - 1; i >= 0; i--) {
-                token = &tokens[i];
-                if (token->start != -1 && token->end == -1) {
-                    if (token->type != type) {
-                        return JSMN_ERROR_INVAL;
-                    }
-                    parser->toksuper = -1;
-                    token->end = parser->pos + 1;
-                    break;
-                }
-            }
-            /* error if unmatched closing bracket */
-            if (i == -1) {
+            token = &tokens[parser->tokopen];
+            if (token->type != type) {
                 return JSMN_ERROR_INVAL;
             }
-            for (; i >= 0; i--) {
-                token = &tokens[i];
-                if (token->start != -1 && token->end == -1) {
-                    parser->toksuper = i;
-                    break;
-                }
-            }
-#endif
+            token->end = parser->pos + 1;
+
+            /* the one it was inside of becomes the innermost open one, and the next becomes the token after the subtree */
+            parser->tokopen = token->next;
+            parser->toksuper = token->next;
+            token->next = parser->toknext;
             break;
         case '\"':
-            r = jsmn_parse_string(parser, js, len, tokens, num_tokens);
+            r = jsmn_parse_string(parser, js, len, tokens, num_tokens, features);
             if (r < 0) {
                 return r;
             }
             count++;
             if (parser->toksuper != -1 && tokens != NULL) {
+                if (tokens[parser->toksuper].size == JSMN_SIZE_MAX) {
+                    return JSMN_ERROR_SIZE;
+                }
                 tokens[parser->toksuper].size++;
             }
             break;
@@ -277,6 +413,8 @@ int jsmn_parse(jsmn_parser* parser, const char* js, const unsigned long long len
         case '\r':
         case '\n':
         case ' ':
+            /* indentation comes in runs, the loop increment lands on the first character after it */
+            parser->pos = (unsigned int)jsmn_scan_whitespace(js, parser->pos + 1, len, features) - 1;
             break;
         case ':':
             parser->toksuper = parser->toknext - 1;
@@ -284,19 +422,9 @@ int jsmn_parse(jsmn_parser* parser, const char* js, const unsigned long long len
         case ',':
             if (tokens != NULL && parser->toksuper != -1 &&
                 tokens[parser->toksuper].type != JSMN_ARRAY &&
-                tokens[parser->toksuper].type != JSMN_OBJECT) {
-#ifdef JSMN_PARENT_LINKS
-                parser->toksuper = tokens[parser->toksuper].parent;
-#else
-                for (i = parser->toknext - 1; i >= 0; i--) {
-                    if (tokens[i].type == JSMN_ARRAY || tokens[i].type == JSMN_OBJECT) {
-                        if (tokens[i].start != -1 && tokens[i].end == -1) {
-                            parser->toksuper = i;
-                            break;
-                        }
-                    }
-                }
-#endif
+                tokens[parser->toksuper].type != JSMN_OBJECT &&
+                parser->tokopen != -1) {
+                parser->toksuper = parser->tokopen;
             }
             break;
 #ifdef JSMN_STRICT
@@ -327,12 +455,15 @@ int jsmn_parse(jsmn_parser* parser, const char* js, const unsigned long long len
             /* in non-strict mode every unquoted value is a primitive */
         default:
 #endif
-            r = jsmn_parse_primitive(parser, js, len, tokens, num_tokens);
+            r = jsmn_parse_primitive(parser, js, len, tokens, num_tokens, features);
             if (r < 0) {
                 return r;
             }
             count++;
             if (parser->toksuper != -1 && tokens != NULL) {
+                if (tokens[parser->toksuper].size == JSMN_SIZE_MAX) {
+                    return JSMN_ERROR_SIZE;
+                }
                 tokens[parser->toksuper].size++;
             }
             break;
@@ -345,14 +476,46 @@ int jsmn_parse(jsmn_parser* parser, const char* js, const unsigned long long len
         }
     }
 
-    if (tokens != NULL) {
-        for (i = parser->toknext - 1; i >= 0; i--) {
-            /* unmatched opened object or array */
-            if (tokens[i].start != -1 && tokens[i].end == -1) {
-                return JSMN_ERROR_PART;
-            }
-        }
+    /* unmatched opened object or array */
+    if (tokens != NULL && parser->tokopen != -1) {
+        return JSMN_ERROR_PART;
     }
 
     return count;
 }
+
+int jsmn_parse_alloc(jsmn_parser* parser, const char* js, const unsigned long long len, jsmntok_t** tokens, unsigned int* num_tokens, const GLTF_Allocator* allocator) {
+    /* gltf json averages a token every 8 to 16 bytes, starting a bit above that avoids most of the growths */
+    if (*tokens == NULL || *num_tokens == 0) {
+        unsigned long long estimate = len / 8 + 64;
+        if (estimate > 0x7FFFFFFF) estimate = 0x7FFFFFFF;
+
+        jsmntok_t* grown = (jsmntok_t*)gltfmemory_reallocate(allocator, *tokens, sizeof(jsmntok_t) * estimate);
+        if (grown == NULL) {
+            return JSMN_ERROR_NOMEM;
+        }
+        *tokens = grown;
+        *num_tokens = (unsigned int)estimate;
+    }
+
+    for (;;) {
+        int r = jsmn_parse(parser, js, len, *tokens, *num_tokens);
+        if (r != JSMN_ERROR_NOMEM) {
+            return r;
+        }
+
+        /* the parser stopped right before the token it could not allocate, it resumes from there */
+        unsigned long long capacity = (unsigned long long)*num_tokens * 2;
+        if (capacity > 0x7FFFFFFF) capacity = 0x7FFFFFFF;
+        if (capacity <= *num_tokens) {
+            return JSMN_ERROR_NOMEM;
+        }
+
+        jsmntok_t* grown = (jsmntok_t*)gltfmemory_reallocate(allocator, *tokens, sizeof(jsmntok_t) * capacity);
+        if (grown == NULL) {
+            return JSMN_ERROR_NOMEM;
+        }
+        *tokens = grown;
+        *num_tokens = (unsigned int)capacity;
+    }
+}
@@ -0,0 +1,493 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gltfparser.h"
+
+/// @brief a document parsed from memory and whether it must be accepted
+typedef struct {
+	const char* name;
+	const char* json;
+	int valid;
+	unsigned int sections;  // the sections option, 0 builds all of them
+} TestCase;
+
+static const TestCase s_gCases[] = {
+	{ "minimal document", "{\"asset\":{\"version\":\"2.0\"}}", 1, 0 },
+	{ "legacy document", "{\"asset\":{\"version\":\"1.0\"}}", 0, 0 },
+	{ "document of a later minor version", "{\"asset\":{\"version\":\"2.1\"}}", 1, 0 },
+	{ "buffer view into a missing buffer", "{\"asset\":{\"version\":\"2.0\"},\"bufferViews\":[{\"buffer\":7,\"byteLength\":4}]}", 0, 0 },
+	{ "buffer with an http uri", "{\"asset\":{\"version\":\"2.0\"},\"buffers\":[{\"uri\":\"http://example.com/a.bin\",\"byteLength\":4}]}", 0, 0 },
+	{ "buffer with a file uri", "{\"asset\":{\"version\":\"2.0\"},\"buffers\":[{\"uri\":\"file:///a.bin\",\"byteLength\":4}]}", 0, 0 },
+	{ "buffer with a base64 data uri", "{\"asset\":{\"version\":\"2.0\"},\"buffers\":[{\"uri\":\"data:application/octet-stream;base64,AAAAAA==\",\"byteLength\":4}]}", 1, 0 },
+	{ "buffer with a data uri that is not base64", "{\"asset\":{\"version\":\"2.0\"},\"buffers\":[{\"uri\":\"data:application/octet-stream,%00%00%00%00\",\"byteLength\":4}]}", 0, 0 },
+	{ "accessor with a fractional buffer view index", "{\"asset\":{\"version\":\"2.0\"},\"bufferViews\":[{\"buffer\":0,\"byteLength\":4}],\"buffers\":[{\"byteLength\":4}],\"accessors\":[{\"bufferView\":1.5,\"componentType\":5126,\"count\":1,\"type\":\"SCALAR\"}]}", 0, 0 },
+	{ "accessor with a negative buffer view index", "{\"asset\":{\"version\":\"2.0\"},\"accessors\":[{\"bufferView\":-1,\"componentType\":5126,\"count\":1,\"type\":\"SCALAR\"}]}", 0, 0 },
+	{ "node with a mesh index out of the int range", "{\"asset\":{\"version\":\"2.0\"},\"nodes\":[{\"mesh\":4294967296}]}", 0, 0 },
+	{ "primitive with a fractional mode", "{\"asset\":{\"version\":\"2.0\"},\"meshes\":[{\"primitives\":[{\"attributes\":{},\"mode\":4.5}]}]}", 0, 0 },
+	{ "node with a translation out of the float range", "{\"asset\":{\"version\":\"2.0\"},\"nodes\":[{\"translation\":[1e39,0,0]}]}", 0, 0 },
+	{ "node with a short translation", "{\"asset\":{\"version\":\"2.0\"},\"nodes\":[{\"translation\":[1,0]}]}", 0, 0 },
+	{ "accessor with more than 16 min and max values", "{\"asset\":{\"version\":\"2.0\"},\"accessors\":[{\"componentType\":5126,\"count\":1,\"type\":\"MAT4\",\"min\":[0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0],\"max\":[1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1]}]}", 1, 0 },
+	{ "accessor with an invalid max value", "{\"asset\":{\"version\":\"2.0\"},\"accessors\":[{\"componentType\":5126,\"count\":1,\"type\":\"SCALAR\",\"max\":[true]}]}", 0, 0 },
+	{ "buffer view into a skipped buffers section", "{\"asset\":{\"version\":\"2.0\"},\"bufferViews\":[{\"buffer\":7,\"byteLength\":4}]}", 1, Section_BufferViews },
+	{ "buffer view into a built buffers section", "{\"asset\":{\"version\":\"2.0\"},\"bufferViews\":[{\"buffer\":7,\"byteLength\":4}]}", 0, Section_BufferViews | Section_Buffers },
+	{ "accessor of a missing buffer view", "{\"asset\":{\"version\":\"2.0\"},\"accessors\":[{\"bufferView\":3,\"componentType\":5126,\"count\":1,\"type\":\"SCALAR\"}]}", 0, 0 },
+};
+
+/// @brief parses a document from memory and checks it's accepted or rejected with an error
+/// @param test the document
+/// @return 1 when the outcome is the expected one
+static int test_run(const TestCase* test) {
+	GLTF_ParseOptions options = { 0 };
+	options.sections = test->sections;
+
+	GLTF2 data = GLTF_ParseFromMemory(test->json, strlen(test->json), &options);
+	const GLTF_Context* context = GLTF_GetContext();
+	const int valid = context->errorsCount == 0;
+	GLTF_Free(&data);
+
+	if (valid != test->valid) {
+		printf("FAILED %s: expected it to be %s\n%s", test->name, test->valid ? "accepted" : "rejected", GLTF_GetErrors());
+		return 0;
+	}
+	return 1;
+}
+
+/// @brief reads indices from accessors that can't be read and checks nothing is reported as written
+/// @return 1 when every read failed
+static int test_indices_failures(void) {
+	unsigned short out[4] = { 0 };
+	GLTF_IndexInfo info;
+
+	// an accessor without any index
+	GLTF_Accessor empty = { 0 };
+	empty.componentType = ComponentType_R16_UNSIGNED;
+	empty.type = Type_Scalar;
+	empty.stride = 2;
+	if (GLTF_AccessorReadIndices(&empty, IndexFormat_Auto, 0, out, sizeof(out), &info) != 0) {
+		printf("FAILED indices of an empty accessor were read\n");
+		return 0;
+	}
+
+	// a sparse accessor whose sparse buffer views are not loaded
+	GLTF_BufferView unloaded = { 0 };
+	unloaded.size = 64;
+	GLTF_Accessor sparse = empty;
+	sparse.count = 4;
+	sparse.isSparse = 1;
+	sparse.sparse.count = 1;
+	sparse.sparse.indicesComponentType = ComponentType_R8_UNSIGNED;
+	sparse.sparse.indicesBufferView = &unloaded;
+	sparse.sparse.valuesBufferView = &unloaded;
+	if (GLTF_AccessorReadIndices(&sparse, IndexFormat_Auto, 1, out, sizeof(out), &info) != 0) {
+		printf("FAILED indices of a sparse accessor without data were read\n");
+		return 0;
+	}
+	return 1;
+}
+
+/// @brief parses a document whose only buffer is a base64 data uri of the given bytes
+/// @param bytes the buffer bytes
+/// @param size how many bytes there are
+/// @param sections the json of the rest of the document sections, after the buffers
+/// @param options the parse options, NULL means the default ones
+/// @return the parsed data, it must be released with GLTF_Free
+static GLTF2 test_parse_buffer(const void* bytes, unsigned long long size, const char* sections, const GLTF_ParseOptions* options) {
+	static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	char json[4096];
+	int length = sprintf(json, "{\"asset\":{\"version\":\"2.0\"},\"buffers\":[{\"byteLength\":%llu,\"uri\":\"data:application/octet-stream;base64,", size);
+
+	const unsigned char* b = (const unsigned char*)bytes;
+	for (unsigned long long i = 0; i < size; i += 3) {
+		const unsigned int group = (unsigned int)b[i] << 16 | (i + 1 < size ? (unsigned int)b[i + 1] << 8 : 0) | (i + 2 < size ? b[i + 2] : 0);
+		json[length++] = alphabet[group >> 18 & 63];
+		json[length++] = alphabet[group >> 12 & 63];
+		json[length++] = i + 1 < size ? alphabet[group >> 6 & 63] : '=';
+		json[length++] = i + 2 < size ? alphabet[group & 63] : '=';
+	}
+	length += sprintf(json + length, "\"}],%s}", sections);
+
+	GLTF_ParseOptions defaultOptions = { 0 };
+	return GLTF_ParseFromMemory(json, (unsigned long long)length, options ? options : &defaultOptions);
+}
+
+/// @brief checks floats read back against the expected ones
+/// @param name what was read
+/// @param read how many elements the read returned
+/// @param expectedCount how many elements it should have returned
+/// @param values the floats read
+/// @param expected the expected floats
+/// @param count how many floats to compare
+/// @return 1 when they match
+static int test_floats(const char* name, unsigned long long read, unsigned long long expectedCount, const float* values, const float* expected, unsigned long long count) {
+	int passed = read == expectedCount;
+	for (unsigned long long i = 0; i < count && passed; ++i) {
+		const float difference = values[i] - expected[i];
+		passed = difference < 1e-6f && difference > -1e-6f;
+	}
+	if (!passed) printf("FAILED %s read back wrong values\n", name);
+	return passed;
+}
+
+/// @brief reads normalized, integer and float accessors as floats, u32 and u16
+/// @return 1 when normalized values are mapped into [0, 1] or [-1, 1] and integers are widened or clamped
+static int test_readers(void) {
+	struct {
+		unsigned char normalizedU8[4];
+		short normalizedI16[4];
+		unsigned char u8[4];
+		float f32[2];
+	} buffer = { { 0, 255, 51 }, { -32768, 32767, 0 }, { 7, 200 }, { -1.0f, 70000.5f } };
+	const char* sections = "\"bufferViews\":[{\"buffer\":0,\"byteLength\":3},{\"buffer\":0,\"byteOffset\":4,\"byteLength\":6},{\"buffer\":0,\"byteOffset\":12,\"byteLength\":2},{\"buffer\":0,\"byteOffset\":16,\"byteLength\":8}],"
+		"\"accessors\":[{\"bufferView\":0,\"componentType\":5121,\"normalized\":true,\"count\":3,\"type\":\"SCALAR\"},{\"bufferView\":1,\"componentType\":5122,\"normalized\":true,\"count\":3,\"type\":\"SCALAR\"},"
+		"{\"bufferView\":2,\"componentType\":5121,\"count\":2,\"type\":\"SCALAR\"},{\"bufferView\":3,\"componentType\":5126,\"count\":2,\"type\":\"SCALAR\"}]";
+
+	GLTF2 data = test_parse_buffer(&buffer, sizeof(buffer), sections, NULL);
+	if (data.accessorsCount != 4) {
+		printf("FAILED readers document was not parsed\n");
+		GLTF_Free(&data);
+		return 0;
+	}
+
+	static const float normalizedU8[3] = { 0.0f, 1.0f, 0.2f };
+	static const float normalizedI16[3] = { -1.0f, 1.0f, 0.0f };
+	float floats[3] = { 0 };
+	int passed = test_floats("normalized u8 accessor", GLTF_AccessorReadFloat(&data.accessors[0], 0, 3, floats, 0), 3, floats, normalizedU8, 3);
+	passed &= test_floats("normalized i16 accessor", GLTF_AccessorReadFloat(&data.accessors[1], 0, 3, floats, 0), 3, floats, normalizedI16, 3);
+
+	// the u8 elements are widened into every other u32, the ones between them are left untouched
+	unsigned int u32[4] = { 1, 1, 1, 1 };
+	unsigned short u16[2] = { 0 };
+	if (GLTF_AccessorReadU32(&data.accessors[2], 0, 2, u32, sizeof(unsigned int) * 2) != 2 || u32[0] != 7 || u32[1] != 1 || u32[2] != 200 || u32[3] != 1
+		|| GLTF_AccessorReadU16(&data.accessors[2], 0, 2, u16, 0) != 2 || u16[0] != 7 || u16[1] != 200) {
+		printf("FAILED u8 accessor was not widened\n");
+		passed = 0;
+	}
+
+	// floats are truncated and clamped into the integer range
+	if (GLTF_AccessorReadU16(&data.accessors[3], 0, 2, u16, 0) != 2 || u16[0] != 0 || u16[1] != 65535
+		|| GLTF_AccessorReadU32(&data.accessors[3], 0, 2, u32, 0) != 2 || u32[0] != 0 || u32[1] != 70000) {
+		printf("FAILED float accessor was not clamped into integers\n");
+		passed = 0;
+	}
+
+	GLTF_Free(&data);
+	return passed;
+}
+
+/// @brief reads a sparse accessor with the readers, materialized and resolved, then with indices that aren't strictly increasing or are out of bounds
+/// @return 1 when the sparse values override the base ones and the invalid indices are rejected
+static int test_sparse(void) {
+	// 4 base floats, 2 u16 sparse indices and their 2 float values
+	struct { float base[4]; unsigned short indices[2]; float values[2]; } buffer = { { 1, 2, 3, 4 }, { 1, 3 }, { 20, 40 } };
+	const char* sections = "\"bufferViews\":[{\"buffer\":0,\"byteLength\":16},{\"buffer\":0,\"byteOffset\":16,\"byteLength\":4},{\"buffer\":0,\"byteOffset\":20,\"byteLength\":8}],"
+		"\"accessors\":[{\"bufferView\":0,\"componentType\":5126,\"count\":4,\"type\":\"SCALAR\","
+		"\"sparse\":{\"count\":2,\"indices\":{\"bufferView\":1,\"componentType\":5123},\"values\":{\"bufferView\":2}}}]";
+
+	GLTF2 data = test_parse_buffer(&buffer, sizeof(buffer), sections, NULL);
+	if (data.accessorsCount != 1) {
+		printf("FAILED sparse document was not parsed\n");
+		GLTF_Free(&data);
+		return 0;
+	}
+
+	static const float expected[4] = { 1, 20, 3, 40 };
+	float values[4] = { 0 };
+	int passed = test_floats("sparse accessor", GLTF_AccessorReadFloat(&data.accessors[0], 0, 4, values, 0), 4, values, expected, 4);
+	passed &= test_floats("sparse accessor tail", GLTF_AccessorReadFloat(&data.accessors[0], 2, 8, values, 0), 2, values, expected + 2, 2);
+
+	memset(values, 0, sizeof(values));
+	passed &= test_floats("materialized sparse accessor", GLTF_AccessorMaterialize(&data.accessors[0], values, sizeof(values)), sizeof(values), values, expected, 4);
+
+	memset(values, 0, sizeof(values));
+	passed &= GLTF_AccessorResolveSparse(&data, &data.accessors[0]) && data.accessors[0].sparse.resolved;
+	passed &= test_floats("resolved sparse accessor", GLTF_AccessorReadFloat(&data.accessors[0], 0, 4, values, 0), 4, values, expected, 4);
+	GLTF_Free(&data);
+
+	// decreasing, repeated and out of bounds indices
+	static const unsigned short invalid[][2] = { { 3, 1 }, { 1, 1 }, { 1, 4 } };
+	for (unsigned long long i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+		memcpy(buffer.indices, invalid[i], sizeof(buffer.indices));
+		data = test_parse_buffer(&buffer, sizeof(buffer), sections, NULL);
+		if (data.accessorsCount != 1 || GLTF_AccessorReadFloat(&data.accessors[0], 0, 4, values, 0) != 0 || GLTF_AccessorMaterialize(&data.accessors[0], values, sizeof(values)) != 0
+			|| GLTF_GetContext()->errors[0].code != ErrorCode_InvalidDocument) {
+			printf("FAILED sparse indices %u, %u were read\n", invalid[i][0], invalid[i][1]);
+			passed = 0;
+		}
+		GLTF_Free(&data);
+	}
+	return passed;
+}
+
+/// @brief reads u32 indices whose rebased range is right below, at and above the 16 bits limit, and u8 indices widened into 16 bits
+/// @return 1 when the width, range and values are the expected ones and narrowing what doesn't fit fails
+static int test_indices(void) {
+	struct {
+		unsigned int below[3];
+		unsigned int at[40];
+		unsigned int above[2];
+		unsigned char u8[4];
+	} buffer = { { 1005, 1000, 1000 + 65534 }, { 0 }, { 1000, 1000 + 65536 }, { 2, 0, 1 } };
+
+	// long enough for the vectorized scan and conversion, with the highest index in the tail
+	for (unsigned int i = 0; i < 40; ++i) {
+		buffer.at[i] = 1000 + i;
+	}
+	buffer.at[37] = 1000 + 65535;
+	const char* sections = "\"bufferViews\":[{\"buffer\":0,\"byteLength\":12},{\"buffer\":0,\"byteOffset\":12,\"byteLength\":160},{\"buffer\":0,\"byteOffset\":172,\"byteLength\":8},{\"buffer\":0,\"byteOffset\":180,\"byteLength\":3}],"
+		"\"accessors\":[{\"bufferView\":0,\"componentType\":5125,\"count\":3,\"type\":\"SCALAR\"},{\"bufferView\":1,\"componentType\":5125,\"count\":40,\"type\":\"SCALAR\"},"
+		"{\"bufferView\":2,\"componentType\":5125,\"count\":2,\"type\":\"SCALAR\"},{\"bufferView\":3,\"componentType\":5121,\"count\":3,\"type\":\"SCALAR\"}]";
+
+	GLTF2 data = test_parse_buffer(&buffer, sizeof(buffer), sections, NULL);
+	if (data.accessorsCount != 4) {
+		printf("FAILED indices document was not parsed\n");
+		GLTF_Free(&data);
+		return 0;
+	}
+
+	int passed = 1;
+	unsigned short u16[40] = { 0 };
+	unsigned int u32[40] = { 0 };
+	GLTF_IndexInfo info;
+
+	// max - base == 65534 fits in 16 bits without the primitive restart value
+	if (GLTF_AccessorReadIndices(&data.accessors[0], IndexFormat_Auto, 1, u16, sizeof(u16), &info) != 6 || info.componentType != ComponentType_R16_UNSIGNED
+		|| info.count != 3 || info.min != 1000 || info.max != 1000 + 65534 || info.base != 1000 || u16[0] != 5 || u16[1] != 0 || u16[2] != 65534) {
+		printf("FAILED indices below the 16 bits limit\n");
+		passed = 0;
+	}
+
+	// max - base == 65535 is picked as 32 bits, but still fits when 16 bits are asked for
+	if (GLTF_AccessorReadIndices(&data.accessors[1], IndexFormat_Auto, 1, u32, sizeof(u32), &info) != sizeof(u32) || info.componentType != ComponentType_R32_UNSIGNED
+		|| info.base != 1000 || u32[0] != 0 || u32[37] != 65535 || u32[39] != 39
+		|| GLTF_AccessorReadIndices(&data.accessors[1], IndexFormat_U16, 1, u16, sizeof(u16), &info) != sizeof(u16) || info.componentType != ComponentType_R16_UNSIGNED
+		|| u16[1] != 1 || u16[37] != 65535 || u16[39] != 39) {
+		printf("FAILED indices at the 16 bits limit\n");
+		passed = 0;
+	}
+
+	// max - base == 65536 doesn't fit in 16 bits
+	if (GLTF_AccessorReadIndices(&data.accessors[2], IndexFormat_U16, 1, u16, sizeof(u16), &info) != 0
+		|| GLTF_AccessorReadIndices(&data.accessors[2], IndexFormat_U32, 0, u32, sizeof(u32), &info) != 8 || info.base != 0 || u32[0] != 1000 || u32[1] != 1000 + 65536) {
+		printf("FAILED indices above the 16 bits limit\n");
+		passed = 0;
+	}
+
+	// the size alone, then u8 indices widened into 16 bits
+	if (GLTF_AccessorReadIndices(&data.accessors[3], IndexFormat_Auto, 0, NULL, 0, &info) != 6
+		|| GLTF_AccessorReadIndices(&data.accessors[3], IndexFormat_Auto, 0, u16, sizeof(u16), &info) != 6 || info.componentType != ComponentType_R16_UNSIGNED
+		|| info.min != 0 || info.max != 2 || u16[0] != 2 || u16[1] != 0 || u16[2] != 1) {
+		printf("FAILED u8 indices were not widened\n");
+		passed = 0;
+	}
+
+	GLTF_Free(&data);
+	return passed;
+}
+
+/// @brief parses a big nodes array with two invalid nodes on one and on several threads, the reported errors must be the same
+/// @return 1 when they are
+static int test_parallel_errors(void) {
+	const unsigned int nodesCount = GLTF_PARALLEL_ELEMENTS_MIN * 4;
+	char* json = (char*)malloc(nodesCount * 32 + 64);
+	if (!json) return 0;
+
+	unsigned long long length = (unsigned long long)sprintf(json, "{\"asset\":{\"version\":\"2.0\"},\"nodes\":[");
+	for (unsigned int i = 0; i < nodesCount; ++i) {
+		const int invalid = i == nodesCount / 3 || i == nodesCount - 1;
+		length += (unsigned long long)sprintf(json + length, "%s{\"translation\":[%s]}", i ? "," : "", invalid ? "1,0" : "1,0,0");
+	}
+	length += (unsigned long long)sprintf(json + length, "]}");
+
+	GLTF_ParseOptions options = { 0 };
+	GLTF_Context sequential;
+	GLTF_Context parallel;
+	options.context = &sequential;
+	GLTF2 data = GLTF_ParseFromMemory(json, length, &options);
+	GLTF_Free(&data);
+
+	options.context = &parallel;
+	options.parseThreads = 8;
+	data = GLTF_ParseFromMemory(json, length, &options);
+	GLTF_Free(&data);
+	free(json);
+
+	if (sequential.errorsCount == 0 || sequential.errorsCount != parallel.errorsCount || strcmp(sequential.log, parallel.log) != 0) {
+		printf("FAILED parallel errors differ from sequential ones:\n%s\nvs\n%s\n", sequential.log, parallel.log);
+		return 0;
+	}
+	return 1;
+}
+
+/// @brief writes bytes to a file of the working directory
+/// @param path the file path
+/// @param data the bytes
+/// @param size how many bytes there are
+/// @return 1 on success
+static int test_write_bytes(const char* path, const void* data, unsigned long long size) {
+	FILE* file = fopen(path, "wb");
+	if (!file) {
+		printf("FAILED to write %s\n", path);
+		return 0;
+	}
+	const int written = fwrite(data, 1, (size_t)size, file) == size;
+	return fclose(file) == 0 && written;
+}
+
+/// @brief writes a document to a file of the working directory
+/// @param path the file path
+/// @param json the document
+/// @return 1 on success
+static int test_write_file(const char* path, const char* json) {
+	return test_write_bytes(path, json, strlen(json));
+}
+
+/// @brief probes a valid file and two that fails, the counts and sizes of the first must match it's json
+/// @return 1 when they do and only the valid file is flagged as such
+static int test_probe(void) {
+	const char* path = "tests_probe.gltf";
+	int passed = test_write_file(path, "{\"asset\":{\"version\":\"2.0\",\"generator\":\"tests\"},\"nodes\":[{},{},{}],\"meshes\":[{\"primitives\":[]}],"
+		"\"buffers\":[{\"byteLength\":4},{\"uri\":\"a.bin\",\"byteLength\":12}],\"extensionsUsed\":[\"KHR_materials_unlit\"]}");
+
+	GLTF_ProbeInfo info = GLTF_Probe(path);
+	if (!info.valid || info.isGlb || info.nodesCount != 3 || info.meshesCount != 1 || info.accessorsCount != 0 || info.buffersCount != 2
+		|| info.bufferSizes[0] != 4 || info.bufferSizes[1] != 12 || info.extensionsUsedCount != 1 || strcmp(info.extensionsUsed[0], "KHR_materials_unlit") != 0
+		|| !info.asset.generator || strcmp(info.asset.generator, "tests") != 0) {
+		printf("FAILED probe of a valid file\n");
+		passed = 0;
+	}
+	GLTF_FreeProbe(&info);
+
+	static const char* const invalid[] = {
+		"{\"asset\":{\"version\":\"2.0\"},\"nodes\":[{},{}],\"buffers\":[{\"byteLength\":true}]}",
+		"{\"asset\":{\"version\":\"2.0\"},\"nodes\":[",
+	};
+	for (unsigned long long i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+		passed &= test_write_file(path, invalid[i]);
+		info = GLTF_Probe(path);
+		if (info.valid || GLTF_GetContext()->errorsCount == 0) {
+			printf("FAILED probe of invalid file %llu\n", i);
+			passed = 0;
+		}
+		GLTF_FreeProbe(&info);
+	}
+
+	remove(path);
+	info = GLTF_Probe(path);
+	if (info.valid) {
+		printf("FAILED probe of a missing file\n");
+		passed = 0;
+	}
+	GLTF_FreeProbe(&info);
+	return passed;
+}
+
+/// @brief parses a batch of files, one of them invalid and one missing, on several threads
+/// @return 1 when every result matches it's own file and only the valid files are parsed
+static int test_batch(void) {
+	static const char* const paths[] = { "tests_batch0.gltf", "tests_batch1.gltf", "tests_batch2.gltf", "tests_batch_missing.gltf" };
+	int passed = test_write_file(paths[0], "{\"asset\":{\"version\":\"2.0\"},\"nodes\":[{}]}")
+		& test_write_file(paths[1], "{\"asset\":{\"version\":\"2.0\"},\"nodes\":[{\"translation\":[1,0]}]}")
+		& test_write_file(paths[2], "{\"asset\":{\"version\":\"2.0\"},\"nodes\":[{},{},{}]}");
+
+	GLTF_ParseOptions options = { 0 };
+	options.loadThreads = 3;
+	GLTF_BatchResult results[4];
+	GLTF_BatchStats stats;
+	const unsigned long long parsed = GLTF_ParseBatch(paths, 4, &options, results, &stats);
+
+	if (parsed != 2 || stats.filesCount != 4 || stats.parsedCount != 2
+		|| !results[0].parsed || results[0].errorsCount != 0 || results[0].data.nodesCount != 1
+		|| results[1].parsed || results[1].errorsCount == 0 || results[1].error.code != ErrorCode_InvalidDocument
+		|| !results[2].parsed || results[2].data.nodesCount != 3
+		|| results[3].parsed || results[3].error.code != ErrorCode_File) {
+		printf("FAILED batch results don't match their files\n");
+		passed = 0;
+	}
+
+	for (unsigned long long i = 0; i < 4; ++i) {
+		GLTF_Free(&results[i].data);
+		remove(paths[i]);
+	}
+	return passed;
+}
+
+/// @brief parses a document with an external buffer lazily, then requires an accessor and a buffer view
+/// @return 1 when nothing is loaded until it's required and the required data matches the file
+static int test_lazy(void) {
+	struct { float floats[4]; unsigned short shorts[2]; } buffer = { { 1, 2, 3, 4 }, { 9, 8 } };
+	int passed = test_write_bytes("tests_lazy.bin", &buffer, sizeof(buffer))
+		& test_write_file("tests_lazy.gltf", "{\"asset\":{\"version\":\"2.0\"},\"buffers\":[{\"uri\":\"tests_lazy.bin\",\"byteLength\":20}],"
+			"\"bufferViews\":[{\"buffer\":0,\"byteLength\":16},{\"buffer\":0,\"byteOffset\":16,\"byteLength\":4}],"
+			"\"accessors\":[{\"bufferView\":0,\"byteOffset\":4,\"componentType\":5126,\"count\":3,\"type\":\"SCALAR\"}]}");
+
+	GLTF_ParseOptions options = { 0 };
+	options.bufferMode = BufferMode_Lazy;
+	GLTF2 data = GLTF_ParseFromFileWithOptions("tests_lazy.gltf", &options);
+	if (data.accessorsCount != 1 || data.bufferViewsCount != 2 || data.buffers[0].data || data.bufferViews[0].data || data.bufferViews[1].data) {
+		printf("FAILED lazy document was not parsed without loading it's buffers\n");
+		GLTF_Free(&data);
+		remove("tests_lazy.gltf");
+		remove("tests_lazy.bin");
+		return 0;
+	}
+
+	static const float expected[3] = { 2, 3, 4 };
+	float values[3] = { 0 };
+	if (GLTF_AccessorReadFloat(&data.accessors[0], 0, 3, values, 0) != 0) {
+		printf("FAILED lazy accessor was read before being required\n");
+		passed = 0;
+	}
+
+	passed &= GLTF_RequireAccessor(&data, &data.accessors[0]);
+	passed &= test_floats("required accessor", GLTF_AccessorReadFloat(&data.accessors[0], 0, 3, values, 0), 3, values, expected, 3);
+	if (data.bufferViews[1].data) {
+		printf("FAILED requiring an accessor has loaded an unrelated buffer view\n");
+		passed = 0;
+	}
+
+	unsigned short shorts[2] = { 0 };
+	if (!GLTF_RequireBufferView(&data, &data.bufferViews[1]) || !data.bufferViews[1].data) {
+		printf("FAILED buffer view was not required\n");
+		passed = 0;
+	}
+	else {
+		memcpy(shorts, data.bufferViews[1].data, sizeof(shorts));
+		if (shorts[0] != 9 || shorts[1] != 8) {
+			printf("FAILED required buffer view has the wrong bytes\n");
+			passed = 0;
+		}
+	}
+
+	GLTF_Free(&data);
+	remove("tests_lazy.gltf");
+	remove("tests_lazy.bin");
+	return passed;
+}
+
+/// @brief every test that isn't a document of s_gCases
+static int (*const s_gTests[])(void) = {
+	test_indices_failures,
+	test_readers,
+	test_sparse,
+	test_indices,
+	test_parallel_errors,
+	test_batch,
+	test_lazy,
+	test_probe,
+};
+
+int main(void) {
+	const int casesCount = (int)(sizeof(s_gCases) / sizeof(s_gCases[0]));
+	const int testsCount = (int)(sizeof(s_gTests) / sizeof(s_gTests[0]));
+
+	int failed = 0;
+	for (int i = 0; i < casesCount; ++i) {
+		failed += !test_run(&s_gCases[i]);
+	}
+	for (int i = 0; i < testsCount; ++i) {
+		failed += !s_gTests[i]();
+	}
+
+	printf("%d of %d tests failed\n", failed, casesCount + testsCount);
+	return failed ? 1 : 0;
+}